@@ -0,0 +1,70 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <string>
+
+#include <cpp_utils/Formatter.hpp>
+
+#include <ddspipe_core/configuration/IConfiguration.hpp>
+
+#include <ddsrouter_core/library/library_dll.h>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Configuration of the binary log, that records the log entries without formatting them.
+ */
+struct BinaryLogConfiguration : public ddspipe::core::IConfiguration
+{
+
+    /////////////////////////
+    // CONSTRUCTORS
+    /////////////////////////
+
+    DDSROUTER_CORE_DllAPI BinaryLogConfiguration() = default;
+
+    /////////////////////////
+    // METHODS
+    /////////////////////////
+
+    DDSROUTER_CORE_DllAPI virtual bool is_valid(
+            utils::Formatter& error_msg) const noexcept override;
+
+    /////////////////////////
+    // VARIABLES
+    /////////////////////////
+
+    //! Whether the log entries are written in a binary log instead of formatted. Only read at start up.
+    bool enabled = false;
+
+    //! Bytes of the buffer of each thread. Entries that do not fit are dropped.
+    unsigned int buffer_size = 1048576;
+
+    //! Period in milliseconds to write the buffered entries in the file.
+    unsigned int period = 100;
+
+    //! Directory where the binary log is written.
+    std::string output_directory = ".";
+
+    //! Smallest buffer that fits the largest entry.
+    static constexpr unsigned int MIN_BUFFER_SIZE = 4096;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
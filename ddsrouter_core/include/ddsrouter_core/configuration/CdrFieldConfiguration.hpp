@@ -0,0 +1,44 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <string>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Field of the type of a topic, as serialized in CDR.
+ *
+ * Members of nested structures are declared as fields of their own, in the order they are serialized.
+ */
+struct CdrFieldConfiguration
+{
+    //! Name of the field, as referenced in the expressions (e.g. robot_id or pose.x).
+    std::string name{};
+
+    /**
+     * @brief Type of the field.
+     *
+     * A primitive (boolean, char, int8, uint8, int16, uint16, int32, uint32, int64, uint64, float32, float64),
+     * a string, an array of them (e.g. float64[16]) or a sequence of them (e.g. sequence<uint8>).
+     */
+    std::string type{};
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,80 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include <cpp_utils/Formatter.hpp>
+
+#include <ddspipe_core/configuration/IConfiguration.hpp>
+#include <ddspipe_core/types/participant/ParticipantId.hpp>
+#include <ddspipe_core/types/topic/filter/WildcardDdsFilterTopic.hpp>
+
+#include <ddsrouter_core/configuration/CdrFieldConfiguration.hpp>
+#include <ddsrouter_core/library/library_dll.h>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Configuration of a single content filter rule.
+ *
+ * The samples of the topics matching \c topic received by \c participant_id (or by any participant if empty) are
+ * only forwarded if they match \c expression .
+ * As the router does not know the types of the topics, the rule declares the \c fields of the type, in the order
+ * they are serialized, up to the last field referenced by the expression.
+ */
+struct ContentFilterConfiguration : public ddspipe::core::IConfiguration
+{
+
+    /////////////////////////
+    // CONSTRUCTORS
+    /////////////////////////
+
+    DDSROUTER_CORE_DllAPI ContentFilterConfiguration() = default;
+
+    /////////////////////////
+    // METHODS
+    /////////////////////////
+
+    //! Check the fields and compile the expression, so a wrong rule is reported when loading the configuration.
+    DDSROUTER_CORE_DllAPI virtual bool is_valid(
+            utils::Formatter& error_msg) const noexcept override;
+
+    /////////////////////////
+    // VARIABLES
+    /////////////////////////
+
+    //! Topics filtered by this rule. By default, every topic.
+    ddspipe::core::types::WildcardDdsFilterTopic topic{};
+
+    //! Participant whose received samples are filtered. Empty means every participant.
+    ddspipe::core::types::ParticipantId participant_id{};
+
+    //! Filter expression, in the SQL subset of the content filtered topics of DDS.
+    std::string expression{};
+
+    //! Values of the parameters %0, %1... of the expression.
+    std::vector<std::string> parameters{};
+
+    //! Layout of the type of the topics filtered.
+    std::vector<CdrFieldConfiguration> fields{};
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
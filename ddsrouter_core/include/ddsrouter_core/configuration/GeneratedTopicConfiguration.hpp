@@ -0,0 +1,87 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include <cpp_utils/Formatter.hpp>
+
+#include <ddspipe_core/configuration/IConfiguration.hpp>
+
+#include <ddsrouter_core/library/library_dll.h>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Configuration of a topic of a Generator Participant.
+ *
+ * Messages are generated in bursts of \c burst messages, so that \c rate messages are generated per second.
+ * Each message has a random size between \c size and \c max_size , and keyed topics go through their \c keys
+ * instances round-robin.
+ */
+struct GeneratedTopicConfiguration : public ddspipe::core::IConfiguration
+{
+
+    /////////////////////////
+    // CONSTRUCTORS
+    /////////////////////////
+
+    DDSROUTER_CORE_DllAPI GeneratedTopicConfiguration() = default;
+
+    /////////////////////////
+    // METHODS
+    /////////////////////////
+
+    DDSROUTER_CORE_DllAPI virtual bool is_valid(
+            utils::Formatter& error_msg) const noexcept override;
+
+    //! Name of the type, or the default generated type if empty.
+    DDSROUTER_CORE_DllAPI std::string effective_type_name() const noexcept;
+
+    /////////////////////////
+    // VARIABLES
+    /////////////////////////
+
+    //! Name of the topic.
+    std::string topic_name{};
+
+    //! Name of the type. By default, the generated type, keyed or not depending on \c keys .
+    std::string type_name{};
+
+    //! Messages per second. 0 means as fast as possible.
+    double rate = 0;
+
+    //! Size in bytes of the messages.
+    uint32_t size = 64;
+
+    //! Maximum size in bytes of the messages. 0 means every message has \c size bytes.
+    uint32_t max_size = 0;
+
+    //! Number of instances of the topic. 0 means the topic is not keyed.
+    uint32_t keys = 0;
+
+    //! Messages generated at once.
+    uint32_t burst = 1;
+
+    //! Total messages to generate. 0 means unlimited.
+    uint64_t samples = 0;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
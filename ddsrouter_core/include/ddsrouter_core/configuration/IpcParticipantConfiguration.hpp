@@ -0,0 +1,67 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include <cpp_utils/Formatter.hpp>
+
+#include <ddspipe_participants/configuration/ParticipantConfiguration.hpp>
+
+#include <ddsrouter_core/library/library_dll.h>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Configuration of an IPC Participant.
+ *
+ * Two IPC Participants of different DDS Routers in the same host communicate if they share the same \c channel .
+ */
+struct IpcParticipantConfiguration : public ddspipe::participants::ParticipantConfiguration
+{
+
+    /////////////////////////
+    // CONSTRUCTORS
+    /////////////////////////
+
+    DDSROUTER_CORE_DllAPI IpcParticipantConfiguration() = default;
+
+    /////////////////////////
+    // METHODS
+    /////////////////////////
+
+    DDSROUTER_CORE_DllAPI virtual bool is_valid(
+            utils::Formatter& error_msg) const noexcept override;
+
+    /////////////////////////
+    // VARIABLES
+    /////////////////////////
+
+    //! Name of the shared memory channel. It must be the same in both DDS Routers.
+    std::string channel{};
+
+    //! Size in bytes of the ring of each direction. It must be a power of two, and the same in both DDS Routers.
+    uint64_t ring_size = 8 * 1024 * 1024;
+
+    //! Maximum time in milliseconds that a message waits for space in a full ring before being dropped.
+    unsigned int max_blocking_time = 100;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,70 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <string>
+
+#include <cpp_utils/Formatter.hpp>
+
+#include <ddspipe_core/configuration/IConfiguration.hpp>
+
+#include <ddsrouter_core/library/library_dll.h>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Configuration of the sampling profiler, that records the stacks of the DDS Router on demand.
+ */
+struct ProfilerConfiguration : public ddspipe::core::IConfiguration
+{
+
+    /////////////////////////
+    // CONSTRUCTORS
+    /////////////////////////
+
+    DDSROUTER_CORE_DllAPI ProfilerConfiguration() = default;
+
+    /////////////////////////
+    // METHODS
+    /////////////////////////
+
+    DDSROUTER_CORE_DllAPI virtual bool is_valid(
+            utils::Formatter& error_msg) const noexcept override;
+
+    /////////////////////////
+    // VARIABLES
+    /////////////////////////
+
+    //! Whether profiling sessions can be started.
+    bool enabled = false;
+
+    //! Milliseconds that each profiling session lasts.
+    unsigned int duration = 10000;
+
+    //! Samples per second of CPU time.
+    unsigned int frequency = 99;
+
+    //! Directory where the folded stacks of each session are written.
+    std::string output_directory = ".";
+
+    //! Maximum samples per second of CPU time.
+    static constexpr unsigned int MAX_FREQUENCY = 1000;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
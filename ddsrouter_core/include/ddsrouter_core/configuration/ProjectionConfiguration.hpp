@@ -0,0 +1,87 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include <cpp_utils/Formatter.hpp>
+
+#include <ddspipe_core/configuration/IConfiguration.hpp>
+#include <ddspipe_core/types/participant/ParticipantId.hpp>
+#include <ddspipe_core/types/topic/filter/WildcardDdsFilterTopic.hpp>
+
+#include <ddsrouter_core/configuration/CdrFieldConfiguration.hpp>
+#include <ddsrouter_core/library/library_dll.h>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Configuration of a single projection rule.
+ *
+ * The samples of the topics matching \c topic sent by \c participant_id (or by any participant if empty) are
+ * stripped of the fields in \c strip , and published under the derived type \c type_name .
+ * As the router does not know the types of the topics, the rule declares every field of the type, in the order
+ * they are serialized.
+ */
+struct ProjectionConfiguration : public ddspipe::core::IConfiguration
+{
+
+    /////////////////////////
+    // CONSTRUCTORS
+    /////////////////////////
+
+    DDSROUTER_CORE_DllAPI ProjectionConfiguration() = default;
+
+    /////////////////////////
+    // METHODS
+    /////////////////////////
+
+    //! Check the fields stripped are in the layout, so a wrong rule is reported when loading the configuration.
+    DDSROUTER_CORE_DllAPI virtual bool is_valid(
+            utils::Formatter& error_msg) const noexcept override;
+
+    //! Name of the type derived from \c type_name by this rule.
+    DDSROUTER_CORE_DllAPI std::string derived_type_name(
+            const std::string& type_name) const;
+
+    /////////////////////////
+    // VARIABLES
+    /////////////////////////
+
+    //! Topics projected by this rule. By default, every topic.
+    ddspipe::core::types::WildcardDdsFilterTopic topic{};
+
+    //! Participant whose sent samples are projected. Empty means every participant.
+    ddspipe::core::types::ParticipantId participant_id{};
+
+    //! Names of the fields removed from the samples.
+    std::vector<std::string> strip{};
+
+    //! Layout of the type of the topics projected.
+    std::vector<CdrFieldConfiguration> fields{};
+
+    //! Name of the derived type the samples are published with. Empty means the original name plus a suffix.
+    std::string type_name{};
+
+    //! Suffix of the derived types without a configured name.
+    static constexpr const char* DERIVED_TYPE_SUFFIX = "_projected";
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,96 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cpp_utils/Formatter.hpp>
+
+#include <ddspipe_core/configuration/IConfiguration.hpp>
+#include <ddspipe_core/types/participant/ParticipantId.hpp>
+#include <ddspipe_core/types/topic/filter/WildcardDdsFilterTopic.hpp>
+
+#include <ddsrouter_core/library/library_dll.h>
+#include <ddsrouter_core/types/RateLimitScope.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Configuration of a single rate limit rule.
+ *
+ * A rule shapes the traffic of its \c scope (topic, participant or route) both in messages per second and in bytes
+ * per second, allowing bursts of \c burst_msgs messages and \c burst_bytes bytes.
+ * Only the topics matching \c topic are affected by the rule.
+ * Topic rules can be applied \c per_instance in keyed topics, so every instance gets its share of the rate.
+ */
+struct RateLimitConfiguration : public ddspipe::core::IConfiguration
+{
+
+    /////////////////////////
+    // CONSTRUCTORS
+    /////////////////////////
+
+    DDSROUTER_CORE_DllAPI RateLimitConfiguration() = default;
+
+    /////////////////////////
+    // METHODS
+    /////////////////////////
+
+    DDSROUTER_CORE_DllAPI virtual bool is_valid(
+            utils::Formatter& error_msg) const noexcept override;
+
+    /////////////////////////
+    // VARIABLES
+    /////////////////////////
+
+    //! Entity whose traffic is shaped.
+    types::RateLimitScope scope = types::RateLimitScope::topic;
+
+    //! Topics affected by this rule. By default, every topic.
+    ddspipe::core::types::WildcardDdsFilterTopic topic{};
+
+    //! Participant shaped by this rule (only for participant scope).
+    ddspipe::core::types::ParticipantId participant_id{};
+
+    //! Source participant of the route shaped by this rule (only for route scope).
+    ddspipe::core::types::ParticipantId source_participant_id{};
+
+    //! Destination participant of the route shaped by this rule (only for route scope).
+    ddspipe::core::types::ParticipantId destination_participant_id{};
+
+    //! Maximum messages per second. 0 means unlimited.
+    double max_msgs_per_second = 0;
+
+    //! Maximum bytes per second. 0 means unlimited.
+    double max_bytes_per_second = 0;
+
+    //! Maximum number of messages in a burst. 0 means one second worth of messages.
+    unsigned int burst_msgs = 0;
+
+    //! Maximum number of bytes in a burst. 0 means one second worth of bytes.
+    unsigned int burst_bytes = 0;
+
+    /**
+     * @brief Whether the limit is shared fairly between the instances of keyed topics (only for topic scope).
+     *
+     * Instead of dropping the messages exceeding the rate, the latest sample of each instance is kept and the
+     * pending instances are sent round-robin as the rate allows.
+     */
+    bool per_instance = false;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,70 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include <cpp_utils/Formatter.hpp>
+
+#include <ddspipe_participants/configuration/ParticipantConfiguration.hpp>
+
+#include <ddsrouter_core/library/library_dll.h>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Configuration of a Recorder Participant.
+ *
+ * The Recorder Participant stores every message it receives in segment files inside \c output_directory .
+ */
+struct RecorderParticipantConfiguration : public ddspipe::participants::ParticipantConfiguration
+{
+
+    /////////////////////////
+    // CONSTRUCTORS
+    /////////////////////////
+
+    DDSROUTER_CORE_DllAPI RecorderParticipantConfiguration() = default;
+
+    /////////////////////////
+    // METHODS
+    /////////////////////////
+
+    DDSROUTER_CORE_DllAPI virtual bool is_valid(
+            utils::Formatter& error_msg) const noexcept override;
+
+    /////////////////////////
+    // VARIABLES
+    /////////////////////////
+
+    //! Directory where the segment files are created. It is created if it does not exist.
+    std::string output_directory = ".";
+
+    //! Maximum size in bytes of a segment file. A new segment is started when the current one is full.
+    uint64_t segment_size = 64 * 1024 * 1024;
+
+    //! Period in milliseconds in which the written data is flushed to disk.
+    unsigned int fsync_period = 1000;
+
+    //! Maximum size in bytes of the messages waiting to be written. Messages that do not fit are not recorded.
+    uint64_t max_pending_size = 64 * 1024 * 1024;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,55 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cpp_utils/Formatter.hpp>
+
+#include <ddspipe_participants/configuration/ParticipantConfiguration.hpp>
+
+#include <ddsrouter_core/library/library_dll.h>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Configuration of a Sink Participant.
+ *
+ * The Sink Participant measures the messages forwarded to it, and reports them every \c report_period .
+ * With \c check_sequence , it also counts the generated messages lost or received out of order in each topic.
+ */
+struct SinkParticipantConfiguration : public ddspipe::participants::ParticipantConfiguration
+{
+
+    /////////////////////////
+    // CONSTRUCTORS
+    /////////////////////////
+
+    DDSROUTER_CORE_DllAPI SinkParticipantConfiguration() = default;
+
+    /////////////////////////
+    // VARIABLES
+    /////////////////////////
+
+    //! Period in milliseconds of the reports logged. 0 means no report is logged.
+    unsigned int report_period = 1000;
+
+    //! Whether to check the continuity of the sequence of the generated messages in each topic.
+    bool check_sequence = false;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
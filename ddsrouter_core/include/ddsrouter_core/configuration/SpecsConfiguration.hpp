@@ -16,6 +16,8 @@
 
 #include <memory>
 #include <set>
+#include <string>
+#include <vector>
 
 #include <cpp_utils/Formatter.hpp>
 
@@ -25,6 +27,15 @@
 #include <ddspipe_core/configuration/MonitorConfiguration.hpp>
 #include <ddspipe_core/types/dds/TopicQoS.hpp>
 
+#include <ddsrouter_core/configuration/BinaryLogConfiguration.hpp>
+#include <ddsrouter_core/configuration/ContentFilterConfiguration.hpp>
+#include <ddsrouter_core/configuration/LogThrottleConfiguration.hpp>
+#include <ddsrouter_core/configuration/MetricsExporterConfiguration.hpp>
+#include <ddsrouter_core/configuration/ProfilerConfiguration.hpp>
+#include <ddsrouter_core/configuration/ProjectionConfiguration.hpp>
+#include <ddsrouter_core/configuration/RateLimitConfiguration.hpp>
+#include <ddsrouter_core/configuration/ThreadConfiguration.hpp>
+#include <ddsrouter_core/configuration/TracingConfiguration.hpp>
 #include <ddsrouter_core/library/library_dll.h>
 
 namespace eprosima {
@@ -34,7 +45,23 @@ namespace core {
 /**
  * This data struct contains the values for advance configuration of the DDS Router such as:
  * - Number of threads to Thread Pool
+ * - Name, CPU affinity and scheduling policy of the threads
+ * - Adaptive number of forwarding threads
+ * - Binary log
+ * - Log throttle
+ * - Monitor of the thread pool
+ * - Metrics exporter
+ * - Sampling profiler
+ * - Tracing of the samples
  * - Default maximum history depth
+ * - Content filters
+ * - Projections
+ * - Rate limits
+ * - Lazy creation of writers
+ * - Batching of discovery events
+ * - Discovery cache
+ * - Warm up of the builtin topics
+ * - Preallocated histories
  */
 struct SpecsConfiguration : public ddspipe::core::IConfiguration
 {
@@ -58,6 +85,28 @@ struct SpecsConfiguration : public ddspipe::core::IConfiguration
 
     unsigned int number_of_threads = 12;
 
+    //! Threads of the thread pool, which forward the data.
+    ThreadConfiguration forwarding_threads{};
+
+    //! Threads created along with the participants (e.g. the reception and event threads of Fast DDS).
+    ThreadConfiguration participant_threads{};
+
+    //! Threads of the internal tasks of the DDS Router (e.g. discovery batching, idle writers or the monitor).
+    ThreadConfiguration housekeeping_threads{};
+
+    /**
+     * @brief Minimum threads forwarding data at once when adapting them to the load.
+     *
+     * @note 0 (default) means the number of threads does not adapt, and \c number_of_threads are used.
+     */
+    unsigned int min_threads = 0;
+
+    //! Maximum threads forwarding data at once when adapting them to the load. Replaces \c number_of_threads .
+    unsigned int max_threads = 0;
+
+    //! Microseconds that data should wait for a thread. Longer waits add threads, and shorter ones remove them.
+    unsigned int target_queue_latency = 1000;
+
     /**
      * @brief Whether readers that aren't connected to any writers should be deleted.
      *
@@ -76,8 +125,71 @@ struct SpecsConfiguration : public ddspipe::core::IConfiguration
     //! Configuration of the DDS Pipe's Log consumers.
     ddspipe::core::DdsPipeLogConfiguration log_configuration;
 
+    //! Binary log, that records the log entries of the hot paths without formatting them.
+    BinaryLogConfiguration binary_log{};
+
+    //! Limits of the entries logged by each call site of the hot paths. Empty means no limit.
+    std::vector<LogThrottleConfiguration> log_throttles{};
+
     //! Configuration of the DDS Pipe's Monitor.
     ddspipe::core::MonitorConfiguration monitor_configuration{};
+
+    //! Whether to measure the slots of the thread pool and log them periodically.
+    bool thread_pool_monitor = false;
+
+    //! Milliseconds between the logs of the thread pool monitor.
+    unsigned int thread_pool_monitor_period = 1000;
+
+    //! HTTP endpoint that serves the metrics of the DDS Router in OpenMetrics format.
+    MetricsExporterConfiguration metrics_exporter{};
+
+    //! Sampling profiler, that records the stacks of the DDS Router on demand.
+    ProfilerConfiguration profiler{};
+
+    //! Tracing of the stages of the samples of some topics, dumped on demand.
+    TracingConfiguration tracing{};
+
+    //! Content filters applied to the samples received. Empty means every sample is forwarded.
+    std::vector<ContentFilterConfiguration> content_filters{};
+
+    //! Fields stripped from the samples sent to some participants. Empty means samples are sent whole.
+    std::vector<ProjectionConfiguration> projections{};
+
+    //! Rate limits applied in the data path. Empty means no limit.
+    std::vector<RateLimitConfiguration> rate_limits{};
+
+    /**
+     * @brief Whether writers are created with the first message to send, instead of with their topic bridge.
+     *
+     * @note Setting it to true reduces the resources of routers with many topics and little traffic in most of them.
+     * @warning Setting it to true is incompatible with transient-local durability.
+     */
+    bool lazy_writers = false;
+
+    //! Milliseconds without sending that make a lazy writer be destroyed. 0 means never. Requires \c lazy_writers .
+    unsigned int writers_idle_ttl = 0;
+
+    /**
+     * @brief Milliseconds that discovery events are gathered to be processed in a single batch.
+     *
+     * Events of the same endpoint within a batch are coalesced. 0 means every event is processed right away.
+     */
+    unsigned int discovery_batch_period = 0;
+
+    //! File where the endpoints discovered are saved to be loaded in the next execution. Empty means no cache.
+    std::string discovery_cache;
+
+    //! Milliseconds for the endpoints of the discovery cache to be discovered again before they are removed.
+    unsigned int discovery_cache_ttl = 30000;
+
+    //! Whether to create every endpoint of the builtin topics before the router starts, and measure their readiness.
+    bool warm_up = false;
+
+    //! Whether to reserve the payloads of the histories of reliable and transient local topics when they are created.
+    bool preallocate_histories = false;
+
+    //! Maximum size in bytes of the payloads preallocated. Bigger payloads are allocated when they arrive.
+    uint32_t max_sample_size = 0;
 };
 
 } /* namespace core */
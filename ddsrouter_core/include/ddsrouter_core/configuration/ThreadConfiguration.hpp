@@ -0,0 +1,75 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <set>
+#include <string>
+
+#include <cpp_utils/Formatter.hpp>
+
+#include <ddspipe_core/configuration/IConfiguration.hpp>
+
+#include <ddsrouter_core/library/library_dll.h>
+#include <ddsrouter_core/types/ThreadPolicy.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Configuration of a class of threads of the DDS Router: their name, the CPUs where they run and their scheduling.
+ *
+ * Every setting left unset keeps the value of the thread that creates them.
+ */
+struct ThreadConfiguration : public ddspipe::core::IConfiguration
+{
+
+    /////////////////////////
+    // CONSTRUCTORS
+    /////////////////////////
+
+    DDSROUTER_CORE_DllAPI ThreadConfiguration() = default;
+
+    /////////////////////////
+    // METHODS
+    /////////////////////////
+
+    DDSROUTER_CORE_DllAPI virtual bool is_valid(
+            utils::Formatter& error_msg) const noexcept override;
+
+    //! Whether any setting is set.
+    DDSROUTER_CORE_DllAPI bool is_set() const noexcept;
+
+    /////////////////////////
+    // VARIABLES
+    /////////////////////////
+
+    //! Name of the threads, as shown by \c top . At most 15 characters. Empty to keep the name.
+    std::string name{};
+
+    //! CPUs where the threads may run. Empty to keep the affinity.
+    std::set<uint32_t> affinity{};
+
+    //! Scheduling policy of the threads.
+    types::ThreadPolicy policy = types::ThreadPolicy::inherited;
+
+    //! Priority of the threads, from 1 to 99. Only for the fifo and round_robin policies.
+    int priority = 0;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
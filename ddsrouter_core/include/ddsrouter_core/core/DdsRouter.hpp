@@ -14,6 +14,12 @@
 
 #pragma once
 
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
 #include <cpp_utils/ReturnCode.hpp>
 #include <cpp_utils/thread_pool/pool/SlotThreadPool.hpp>
 
@@ -26,7 +32,21 @@
 
 #include <ddsrouter_core/core/ParticipantFactory.hpp>
 #include <ddsrouter_core/configuration/DdsRouterConfiguration.hpp>
+#include <ddsrouter_core/efficiency/concurrency/ConcurrencyGate.hpp>
+#include <ddsrouter_core/efficiency/discovery/DiscoveryCache.hpp>
+#include <ddsrouter_core/efficiency/discovery/DiscoveryCoalescer.hpp>
+#include <ddsrouter_core/efficiency/filter/ContentFilterEngine.hpp>
+#include <ddsrouter_core/efficiency/instrumentation/ThreadPoolInstrumentation.hpp>
+#include <ddsrouter_core/efficiency/lazy/LazyWriterEngine.hpp>
+#include <ddsrouter_core/efficiency/payload/PreallocatedPayloadPool.hpp>
+#include <ddsrouter_core/efficiency/projection/ProjectionEngine.hpp>
+#include <ddsrouter_core/efficiency/rate_limit/RateLimitEngine.hpp>
+#include <ddsrouter_core/efficiency/warmup/TopicReadinessTracker.hpp>
 #include <ddsrouter_core/library/library_dll.h>
+#include <ddsrouter_core/monitoring/PipelineTracer.hpp>
+#include <ddsrouter_core/monitoring/RouterMetrics.hpp>
+#include <ddsrouter_core/monitoring/producers/ThreadPoolMonitorProducer.hpp>
+#include <ddsrouter_core/participants/sink/SinkParticipant.hpp>
 
 namespace eprosima {
 namespace ddsrouter {
@@ -66,7 +86,7 @@ public:
 
     // EVENTS
     /**
-     * @brief Reload the allowed topic configuration
+     * @brief Reload the allowed topic configuration, and the topics traced
      *
      * @param [in] configuration : new configuration
      *
@@ -83,6 +103,7 @@ public:
      * @brief Start communication in DDS Router
      *
      * Enable every topic Bridge.
+     * If warm up is configured, the endpoints of the builtin topics that do not exist yet are created before.
      *
      * @note this method returns a ReturnCode for future possible errors
      *
@@ -101,6 +122,104 @@ public:
      */
     DDSROUTER_CORE_DllAPI utils::ReturnCode stop() noexcept;
 
+    /**
+     * @brief Counters of every rate limiter active in the DDS Router
+     *
+     * There is a limiter for each rate limit rule and each entity (topic, participant or route) it applies to.
+     * Limiters are created along with the readers and writers they shape.
+     *
+     * @return accepted and dropped messages and bytes of each limiter
+     */
+    DDSROUTER_CORE_DllAPI std::vector<RateLimitStatistics> rate_limit_statistics() const;
+
+    /**
+     * @brief Counters of every content filter active in the DDS Router
+     *
+     * There is a filter for each content filter rule and each topic it applies to.
+     *
+     * @return samples forwarded, dropped and not evaluated of each filter
+     */
+    DDSROUTER_CORE_DllAPI std::vector<ContentFilterStatistics> content_filter_statistics() const;
+
+    /**
+     * @brief Counters of every projection active in the DDS Router
+     *
+     * There is a projection for each projection rule and each topic it applies to.
+     *
+     * @return samples projected and dropped, and bytes before and after projecting them, of each projection
+     */
+    DDSROUTER_CORE_DllAPI std::vector<ProjectionStatistics> projection_statistics() const;
+
+    /**
+     * @brief Counters of the lazy writers of the DDS Router
+     *
+     * @return writers of the topic bridges, and how many of them have been created and destroyed.
+     * All 0 if lazy writers are not configured.
+     */
+    DDSROUTER_CORE_DllAPI LazyWriterStatistics lazy_writer_statistics() const;
+
+    /**
+     * @brief Counters of the preallocated payload pool
+     *
+     * @return payload slots reserved and payloads served from them or from the heap.
+     * All 0 if preallocated histories are not configured.
+     */
+    DDSROUTER_CORE_DllAPI PayloadPoolStatistics payload_pool_statistics() const;
+
+    /**
+     * @brief Counters of the adaptive forwarding threads
+     *
+     * @return threads allowed to forward data, data waiting for them, and times the limit has changed.
+     * All 0 if adaptive threads are not configured.
+     */
+    DDSROUTER_CORE_DllAPI ConcurrencyStatistics concurrency_statistics() const;
+
+    /**
+     * @brief Counters of each slot of the thread pool
+     *
+     * There is a slot for each reader, executed by a single thread at a time.
+     *
+     * @return transmissions queued and executed, and their queue latency and time, since each slot was created.
+     * Empty if neither the thread pool monitor nor the metrics exporter are configured.
+     */
+    DDSROUTER_CORE_DllAPI std::vector<SlotStatistics> thread_pool_statistics() const;
+
+    /**
+     * @brief Every measure of the DDS Router, as served by the metrics exporter
+     *
+     * @return snapshot of the counters of the thread pool, rate limits, sinks, payload pool and forwarding threads.
+     */
+    DDSROUTER_CORE_DllAPI RouterMetrics metrics() const;
+
+    /**
+     * @brief Readiness of the endpoints of each builtin topic
+     *
+     * @return readiness of every builtin topic. Empty if warm up is not configured.
+     */
+    DDSROUTER_CORE_DllAPI std::vector<TopicReadiness> topic_readiness() const;
+
+    /**
+     * @brief Counters of the discovery events batched
+     *
+     * @return events received, coalesced and forwarded to the DDS Pipe, and endpoints of the discovery cache
+     * preloaded and expired. All 0 if neither discovery batching nor cache are configured.
+     */
+    DDSROUTER_CORE_DllAPI DiscoveryCoalescerStatistics discovery_statistics() const;
+
+    /**
+     * @brief Measures of every Sink Participant in the DDS Router
+     *
+     * @return report of each sink, by participant id
+     */
+    DDSROUTER_CORE_DllAPI std::map<ddspipe::core::types::ParticipantId, SinkReport> sink_reports() const;
+
+    /**
+     * @brief Write the events traced of the samples as Chrome trace events
+     *
+     * @return path of the file written, or empty if tracing is not configured or the file could not be written.
+     */
+    DDSROUTER_CORE_DllAPI std::string dump_trace() const;
+
 protected:
 
     /**
@@ -111,21 +230,77 @@ protected:
      */
     void init_participants_();
 
+    //! Add the endpoints of the discovery cache of the configured participants to the DDS Pipe.
+    void preload_discovery_cache_();
+
+    //! Create the endpoints of the builtin topics that do not exist yet, and log their readiness.
+    void warm_up_();
+
+    //! Names of the builtin topics.
+    std::set<std::string> builtin_topic_names_() const;
+
 
     DdsRouterConfiguration configuration_;
 
+    //! Database where participants report their discoveries.
     std::shared_ptr<ddspipe::core::DiscoveryDatabase> discovery_database_;
 
+    //! Database of the DDS Pipe. Same as \c discovery_database_ unless discovery events are batched.
+    std::shared_ptr<ddspipe::core::DiscoveryDatabase> pipe_discovery_database_;
+
+    //! Forwards the discovery events in batches. nullptr if neither discovery batching nor cache are configured.
+    std::shared_ptr<DiscoveryCoalescer> discovery_coalescer_;
+
+    //! Measures the creation of the endpoints. nullptr if warm up is not configured.
+    std::shared_ptr<TopicReadinessTracker> readiness_tracker_;
+
+    //! Snapshot of the endpoints discovered. nullptr if the discovery cache is not configured.
+    std::unique_ptr<DiscoveryCache> discovery_cache_;
+
     std::shared_ptr<ddspipe::core::PayloadPool> payload_pool_;
 
+    //! Same as \c payload_pool_ if preallocated histories are configured, nullptr otherwise.
+    std::shared_ptr<PreallocatedPayloadPool> preallocated_payload_pool_;
+
     std::shared_ptr<ddspipe::core::ParticipantsDatabase> participants_database_;
 
     std::shared_ptr<utils::SlotThreadPool> thread_pool_;
 
+    //! Limits the threads of \c thread_pool_ forwarding data at once. nullptr if adaptive threads are not configured.
+    std::shared_ptr<ConcurrencyGate> concurrency_gate_;
+
+    //! Counters of the slots of \c thread_pool_ . nullptr if neither the thread pool monitor nor the metrics exporter
+    //! are configured.
+    std::shared_ptr<ThreadPoolInstrumentation> thread_pool_instrumentation_;
+
+    //! Logs the counters of \c thread_pool_instrumentation_ periodically.
+    std::unique_ptr<ThreadPoolMonitorProducer> thread_pool_monitor_;
+
+    //! Traces the stages of the samples of some topics. nullptr if tracing is not configured.
+    std::shared_ptr<PipelineTracer> pipeline_tracer_;
+
+    //! Time between adjustments of the threads forwarding data at once.
+    static constexpr utils::Duration_ms CONCURRENCY_ADJUSTMENT_PERIOD = 100;
+
     std::shared_ptr<ddspipe::core::AllowedTopicList> allowed_topics_;
 
+    //! Content filters shared by every participant. nullptr if no content filter is configured.
+    std::shared_ptr<ContentFilterEngine> content_filter_engine_;
+
+    //! Projections shared by every participant. nullptr if no projection is configured.
+    std::shared_ptr<ProjectionEngine> projection_engine_;
+
+    //! Rate limits shared by every participant. nullptr if no rate limit is configured.
+    std::shared_ptr<RateLimitEngine> rate_limit_engine_;
+
+    //! Creates the writers lazily. nullptr if lazy writers are not configured.
+    std::shared_ptr<LazyWriterEngine> lazy_writer_engine_;
+
     std::unique_ptr<ddspipe::core::DdsPipe> ddspipe_;
 
+    //! Sink participants, kept apart so their measures are reachable even when decorated.
+    std::map<ddspipe::core::types::ParticipantId, std::shared_ptr<SinkParticipant>> sink_participants_;
+
     ParticipantFactory participant_factory_;
 };
 
@@ -0,0 +1,61 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <memory>
+
+#include <ddsrouter_core/configuration/ThreadConfiguration.hpp>
+#include <ddsrouter_core/library/library_dll.h>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Applies a \c ThreadConfiguration to the calling thread while it exists, and restores the previous one afterwards.
+ *
+ * Threads inherit the name, CPU affinity and scheduling policy of the thread that creates them, so every thread
+ * created inside the scope of this object is configured, including those created by the DDS Pipe or Fast DDS.
+ * Settings that can not be applied (e.g. a real time policy without privileges) are warned and skipped.
+ *
+ * @note Only supported in Linux. Elsewhere it warns once the configuration is set and does nothing.
+ */
+class ScopedThreadConfiguration
+{
+public:
+
+    DDSROUTER_CORE_DllAPI ScopedThreadConfiguration(
+            const ThreadConfiguration& configuration);
+
+    DDSROUTER_CORE_DllAPI ~ScopedThreadConfiguration();
+
+    ScopedThreadConfiguration(
+            const ScopedThreadConfiguration&) = delete;
+
+    ScopedThreadConfiguration& operator =(
+            const ScopedThreadConfiguration&) = delete;
+
+protected:
+
+    //! Settings of the calling thread before applying the configuration.
+    struct PreviousSettings;
+
+    //! nullptr if nothing has been applied.
+    std::unique_ptr<PreviousSettings> previous_;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,287 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <ddsrouter_core/configuration/CdrFieldConfiguration.hpp>
+#include <ddsrouter_core/library/library_dll.h>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+//! Kinds of the elements of a field.
+enum class CdrElementKind : uint8_t
+{
+    boolean,
+    character,
+    int8,
+    uint8,
+    int16,
+    uint16,
+    int32,
+    uint32,
+    int64,
+    uint64,
+    float32,
+    float64,
+    string,
+};
+
+//! How many elements a field holds.
+enum class CdrContainerKind : uint8_t
+{
+    //! A single element.
+    single,
+    //! \c length elements.
+    array,
+    //! A length followed by that many elements.
+    sequence,
+};
+
+//! Type of a field.
+struct CdrFieldType
+{
+    CdrElementKind element = CdrElementKind::uint8;
+
+    CdrContainerKind container = CdrContainerKind::single;
+
+    //! Elements of an array.
+    uint32_t length = 1;
+
+    //! Bytes of each element. 0 for strings.
+    DDSROUTER_CORE_DllAPI uint32_t element_size() const noexcept;
+
+    //! Whether every sample serializes the field in the same bytes.
+    DDSROUTER_CORE_DllAPI bool fixed_size() const noexcept;
+};
+
+//! Field of a \c CdrLayout .
+struct CdrField
+{
+    std::string name;
+
+    CdrFieldType type;
+};
+
+//! Bytes of a field in a sample, from its first element to the end of its last one.
+struct CdrSpan
+{
+    uint32_t begin = 0;
+
+    uint32_t end = 0;
+};
+
+//! Encoding of a sample, given by its encapsulation.
+struct CdrEncoding
+{
+    //! Index of the encoding in the offsets cached by \c CdrLayout .
+    enum Variant : uint8_t
+    {
+        //! CDR of XCDR1.
+        xcdr1 = 0,
+        //! Final types in XCDR2.
+        plain_xcdr2 = 1,
+        //! Appendable types in XCDR2, that start with a DHEADER.
+        delimited_xcdr2 = 2,
+    };
+
+    static constexpr std::size_t VARIANTS = 3;
+
+    Variant variant = xcdr1;
+
+    bool little_endian = true;
+
+    //! Offset of the first field.
+    uint32_t first = 4;
+
+    //! Largest alignment of a primitive: 8 in XCDR1 and 4 in XCDR2.
+    uint32_t max_alignment = 8;
+
+    //! Whether sequences and arrays of strings start with a DHEADER, as in XCDR2.
+    bool delimited_collections = false;
+};
+
+/**
+ * Layout of the fields of a type serialized in CDR, to find them in the samples without deserializing them.
+ *
+ * Fields are declared in the order they are serialized, so the offset of a field depends on the fields before it.
+ * Offsets of the fields preceded only by fields of a fixed size are computed once for each encoding.
+ * The rest are found walking the fields before them in each sample.
+ *
+ * Only the encapsulations of types without optional members are supported: CDR, PLAIN_CDR2 and DELIMITED_CDR2, in
+ * both endiannesses. Nested appendable structures in DELIMITED_CDR2 must declare their DHEADER as a uint32 field.
+ */
+class CdrLayout
+{
+public:
+
+    /**
+     * @brief Layout of \c fields , in this order.
+     *
+     * @throw \c InitializationException if there are no fields, a name is repeated or a type is not supported.
+     */
+    DDSROUTER_CORE_DllAPI CdrLayout(
+            const std::vector<CdrFieldConfiguration>& fields);
+
+    /**
+     * @brief Type of a field, as written in \c CdrFieldConfiguration::type .
+     *
+     * @throw \c InitializationException if the type is not supported.
+     */
+    DDSROUTER_CORE_DllAPI static CdrFieldType parse_type(
+            const std::string& type);
+
+    //! Encoding of a sample. false if its encapsulation is not supported.
+    DDSROUTER_CORE_DllAPI static bool encoding(
+            const uint8_t* data,
+            uint32_t size,
+            CdrEncoding& encoding) noexcept;
+
+    //! Encoding of the samples of \c variant , in little endian.
+    DDSROUTER_CORE_DllAPI static CdrEncoding encoding(
+            CdrEncoding::Variant variant) noexcept;
+
+    //! Number of fields.
+    DDSROUTER_CORE_DllAPI std::size_t size() const noexcept;
+
+    DDSROUTER_CORE_DllAPI const CdrField& field(
+            std::size_t index) const;
+
+    //! Spans of the leading fields of a fixed size in \c variant , which are the same in every sample.
+    DDSROUTER_CORE_DllAPI const std::vector<CdrSpan>& fixed_spans(
+            CdrEncoding::Variant variant) const noexcept;
+
+    //! Index of the field named \c name , or \c NOT_FOUND .
+    DDSROUTER_CORE_DllAPI std::size_t find(
+            const std::string& name) const noexcept;
+
+    /**
+     * @brief Find the first \c count fields in a sample, calling \c visitor(index, span) for each one in order.
+     *
+     * @return false if the sample is too short for them.
+     */
+    template <typename Visitor>
+    bool locate(
+            const uint8_t* data,
+            uint32_t size,
+            const CdrEncoding& encoding,
+            std::size_t count,
+            Visitor&& visitor) const noexcept;
+
+    //! Read a primitive of the encoding of a sample.
+    template <typename T>
+    static T read(
+            const uint8_t* data,
+            bool little_endian) noexcept;
+
+    //! Alignment of an element of \c size bytes at \c offset , relative to the end of the encapsulation.
+    DDSROUTER_CORE_DllAPI static uint32_t align(
+            uint32_t offset,
+            uint32_t size,
+            const CdrEncoding& encoding) noexcept;
+
+    static constexpr std::size_t NOT_FOUND = static_cast<std::size_t>(-1);
+
+protected:
+
+    //! Find the field of \c type at \c offset , and move \c offset past it. false if the sample is too short.
+    DDSROUTER_CORE_DllAPI static bool advance_(
+            const uint8_t* data,
+            uint32_t size,
+            const CdrEncoding& encoding,
+            const CdrFieldType& type,
+            uint32_t& offset,
+            CdrSpan& span) noexcept;
+
+    std::vector<CdrField> fields_;
+
+    //! Spans of the fields preceded only by fields of a fixed size, by encoding.
+    std::array<std::vector<CdrSpan>, CdrEncoding::VARIANTS> fixed_spans_;
+
+    //! Offset after the last field in \c fixed_spans_ , by encoding.
+    std::array<uint32_t, CdrEncoding::VARIANTS> fixed_end_;
+};
+
+template <typename Visitor>
+bool CdrLayout::locate(
+        const uint8_t* data,
+        uint32_t size,
+        const CdrEncoding& encoding,
+        std::size_t count,
+        Visitor&& visitor) const noexcept
+{
+    const std::vector<CdrSpan>& fixed = fixed_spans_[encoding.variant];
+    const std::size_t fixed_count = count < fixed.size() ? count : fixed.size();
+
+    // The fixed fields are in the sample if the last of them is
+    if (fixed_count > 0 && fixed[fixed_count - 1].end > size)
+    {
+        return false;
+    }
+
+    for (std::size_t index = 0; index < fixed_count; ++index)
+    {
+        visitor(index, fixed[index]);
+    }
+
+    uint32_t offset = fixed_end_[encoding.variant];
+    for (std::size_t index = fixed_count; index < count; ++index)
+    {
+        CdrSpan span;
+        if (!advance_(data, size, encoding, fields_[index].type, offset, span))
+        {
+            return false;
+        }
+        visitor(index, span);
+    }
+
+    return true;
+}
+
+template <typename T>
+T CdrLayout::read(
+        const uint8_t* data,
+        bool little_endian) noexcept
+{
+    uint8_t bytes[sizeof(T)];
+    std::memcpy(bytes, data, sizeof(T));
+
+    const uint16_t probe = 1;
+    const bool host_little_endian = *reinterpret_cast<const uint8_t*>(&probe) == 1;
+    if (little_endian != host_little_endian)
+    {
+        for (std::size_t i = 0; i < sizeof(T) / 2; ++i)
+        {
+            const uint8_t byte = bytes[i];
+            bytes[i] = bytes[sizeof(T) - 1 - i];
+            bytes[sizeof(T) - 1 - i] = byte;
+        }
+    }
+
+    T value;
+    std::memcpy(&value, bytes, sizeof(T));
+    return value;
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
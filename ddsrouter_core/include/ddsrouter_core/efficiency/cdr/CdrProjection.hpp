@@ -0,0 +1,118 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <ddsrouter_core/configuration/CdrFieldConfiguration.hpp>
+#include <ddsrouter_core/efficiency/cdr/CdrLayout.hpp>
+#include <ddsrouter_core/library/library_dll.h>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Rewriter of the samples of a type serialized in CDR, that removes some of its fields.
+ *
+ * The result is the serialization of the type without the fields removed, in the same encapsulation as the
+ * original sample. Fields are copied as they are serialized, realigned only when their offset changes.
+ *
+ * The copies of the leading fields of a fixed size are planned once for each encoding, merging the fields kept
+ * that are contiguous into a single copy. The rest are found walking the fields before them in each sample.
+ *
+ * Every field of the type must be declared, as the fields after the last declared one could not be realigned.
+ * Members of nested appendable structures cannot be removed, as their DHEADER would not be updated.
+ */
+class CdrProjection
+{
+public:
+
+    /**
+     * @brief Rewriter of the samples of \c fields that removes \c stripped .
+     *
+     * @throw \c InitializationException if the layout is not valid, a field stripped is not in the layout, or no
+     * field or every field is stripped.
+     */
+    DDSROUTER_CORE_DllAPI CdrProjection(
+            const std::vector<CdrFieldConfiguration>& fields,
+            const std::vector<std::string>& stripped);
+
+    /**
+     * @brief Write the projection of a sample serialized in CDR.
+     *
+     * The projection is never larger than the sample plus its final padding.
+     *
+     * @param [in] data : sample serialized.
+     * @param [in] size : size of the sample.
+     * @param [out] output : buffer of at least \c size + \c MAX_PADDING bytes.
+     *
+     * @return size of the projection, or 0 if the sample does not follow the layout or its encapsulation is not
+     * supported.
+     */
+    DDSROUTER_CORE_DllAPI uint32_t project(
+            const uint8_t* data,
+            uint32_t size,
+            uint8_t* output) const noexcept;
+
+    //! Bytes added at most to the end of a projection, so its size is a multiple of 4.
+    static constexpr uint32_t MAX_PADDING = 3;
+
+protected:
+
+    //! Copy of contiguous fields, with the padding written before them.
+    struct Copy
+    {
+        uint32_t source;
+
+        uint32_t target;
+
+        uint32_t length;
+
+        //! Bytes of padding before \c target .
+        uint32_t padding;
+    };
+
+    //! Copy a field found at \c span to \c offset , realigning its elements if needed. Returns the offset after it.
+    uint32_t copy_(
+            const uint8_t* data,
+            const CdrEncoding& encoding,
+            const CdrFieldType& type,
+            const CdrSpan& span,
+            uint8_t* output,
+            uint32_t offset) const noexcept;
+
+    //! Alignment of the beginning of a field.
+    static uint32_t alignment_(
+            const CdrFieldType& type) noexcept;
+
+    const CdrLayout layout_;
+
+    //! Whether each field of the layout is kept.
+    std::vector<bool> kept_;
+
+    //! Copies of the leading fields of a fixed size, by encoding.
+    std::array<std::vector<Copy>, CdrEncoding::VARIANTS> plans_;
+
+    //! Offset in the projection after the copies of \c plans_ , by encoding.
+    std::array<uint32_t, CdrEncoding::VARIANTS> plan_end_;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
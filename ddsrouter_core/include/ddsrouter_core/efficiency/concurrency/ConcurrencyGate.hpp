@@ -0,0 +1,152 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+
+#include <cpp_utils/event/PeriodicEventHandler.hpp>
+#include <cpp_utils/time/time_utils.hpp>
+
+#include <ddsrouter_core/library/library_dll.h>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Snapshot of the counters of a \c ConcurrencyGate .
+ */
+struct ConcurrencyStatistics
+{
+    //! Threads allowed to forward data at once.
+    uint64_t limit = 0;
+
+    //! Threads forwarding data.
+    uint64_t active = 0;
+
+    //! Readers with data waiting for a thread.
+    uint64_t pending = 0;
+
+    //! Mean time in microseconds that data waited for a thread in the last period.
+    uint64_t mean_wait_us = 0;
+
+    //! Times the limit has grown so far.
+    uint64_t grown = 0;
+
+    //! Times the limit has shrunk so far.
+    uint64_t shrunk = 0;
+};
+
+/**
+ * Limits how many threads of the thread pool forward data at once, adapting the limit to the load.
+ *
+ * The thread pool keeps its maximum number of threads, but only \c limit of them pass the gate; the rest sleep in
+ * it until a thread leaves, so idle cores are not used.
+ * Every period the limit is adjusted from the time that data waited to be taken and the readers waiting:
+ * - It grows by half when data waits longer than the target or more readers wait than threads may run.
+ * - It shrinks by one when data waits less than half the target for several consecutive periods.
+ * Growing fast and shrinking slowly keeps the limit from oscillating around the target.
+ */
+class ConcurrencyGate
+{
+public:
+
+    /**
+     * @brief Construct a new ConcurrencyGate, starting with \c min_threads threads.
+     *
+     * @param [in] min_threads : minimum threads allowed to forward data at once.
+     * @param [in] max_threads : maximum threads allowed to forward data at once, i.e. threads of the pool.
+     * @param [in] target_wait_us : target time in microseconds for data to wait for a thread.
+     * @param [in] period : time in milliseconds between adjustments. 0 to only adjust when calling \c adjust .
+     */
+    DDSROUTER_CORE_DllAPI ConcurrencyGate(
+            uint32_t min_threads,
+            uint32_t max_threads,
+            uint64_t target_wait_us,
+            utils::Duration_ms period);
+
+    DDSROUTER_CORE_DllAPI ~ConcurrencyGate();
+
+    //! Wait until the calling thread is allowed to forward data.
+    DDSROUTER_CORE_DllAPI void enter() noexcept;
+
+    //! Let another thread forward data.
+    DDSROUTER_CORE_DllAPI void exit() noexcept;
+
+    //! Notify that a reader has data waiting for a thread.
+    DDSROUTER_CORE_DllAPI void data_pending() noexcept;
+
+    //! Notify that a thread has started taking the data of a reader, after waiting \c wait_us microseconds.
+    DDSROUTER_CORE_DllAPI void data_taken(
+            uint64_t wait_us) noexcept;
+
+    /**
+     * @brief Adjust the limit from the waits notified since the previous adjustment.
+     *
+     * @return new limit minus the previous one.
+     */
+    DDSROUTER_CORE_DllAPI int64_t adjust() noexcept;
+
+    DDSROUTER_CORE_DllAPI ConcurrencyStatistics statistics() const noexcept;
+
+    //! Periods in a row with short waits before shrinking the limit.
+    static constexpr uint32_t SHRINK_PERIODS = 3;
+
+protected:
+
+    const uint32_t min_threads_;
+
+    const uint32_t max_threads_;
+
+    const uint64_t target_wait_us_;
+
+    //! Guards the limit and the threads in the gate. The notifications of data only update atomic counters.
+    mutable std::mutex mutex_;
+
+    //! Notified when a thread leaves or the limit grows.
+    std::condition_variable condition_;
+
+    uint32_t limit_;
+
+    uint32_t active_;
+
+    //! Readers with data waiting. Signed, as the data may be taken before its notification is counted.
+    std::atomic<int64_t> pending_;
+
+    //! Waits notified since the previous adjustment.
+    std::atomic<uint64_t> wait_sum_us_;
+    std::atomic<uint64_t> wait_count_;
+
+    //! Mean wait of the previous period.
+    uint64_t mean_wait_us_;
+
+    //! Periods in a row with short waits.
+    uint32_t calm_periods_;
+
+    uint64_t grown_;
+
+    uint64_t shrunk_;
+
+    //! Adjusts the limit periodically. nullptr if the period is 0.
+    std::unique_ptr<utils::event::PeriodicEventHandler> controller_;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,71 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include <ddsrouter_core/library/library_dll.h>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Counter incremented from many threads at once without contention.
+ *
+ * Each thread adds in its own slot, in a cache line of its own, so threads counting at once do not invalidate each
+ * other's caches as they would with a single atomic. Slots are only summed when the value is read, which is
+ * expected to happen much less often than counting (e.g. when the measures are reported).
+ */
+class PerThreadCounter
+{
+public:
+
+    //! Slots of each counter. Up to this many threads count without sharing a slot.
+    static constexpr std::size_t SLOTS = 64;
+
+    DDSROUTER_CORE_DllAPI PerThreadCounter();
+
+    //! Add \c amount in the slot of the calling thread.
+    DDSROUTER_CORE_DllAPI void add(
+            uint64_t amount = 1) noexcept;
+
+    //! Sum of every slot.
+    DDSROUTER_CORE_DllAPI uint64_t value() const noexcept;
+
+protected:
+
+    struct alignas(64) Slot
+    {
+        std::atomic<uint64_t> value{0};
+    };
+
+    /**
+     * @brief Slot of the calling thread.
+     *
+     * Threads get consecutive slots the first time they count in any counter, so they use the same slot in every
+     * counter. Slots are shared again only when there are more than \c SLOTS threads.
+     */
+    static std::size_t slot_index_() noexcept;
+
+    std::unique_ptr<Slot[]> slots_;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,85 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <ddspipe_core/types/dds/Endpoint.hpp>
+
+#include <ddsrouter_core/library/library_dll.h>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Snapshot on disk of the remote endpoints discovered by the DDS Router.
+ *
+ * It is saved when the router stops and loaded when it starts again, so the bridges of the known topics are created
+ * right away instead of waiting for the live discovery.
+ *
+ * The file stores, for each endpoint, its guid, kind, topic, type, QoS and the participant that discovered it.
+ * It is written in host byte order, so it is only meant to be read by the same host.
+ */
+class DiscoveryCache
+{
+public:
+
+    /**
+     * @brief Construct a new DiscoveryCache.
+     *
+     * @param [in] file : path of the snapshot file.
+     */
+    DDSROUTER_CORE_DllAPI DiscoveryCache(
+            const std::string& file);
+
+    /**
+     * @brief Read the endpoints of the snapshot.
+     *
+     * @return the endpoints saved. Empty if the file does not exist or is not a valid snapshot.
+     */
+    DDSROUTER_CORE_DllAPI std::vector<ddspipe::core::types::Endpoint> load() const noexcept;
+
+    /**
+     * @brief Replace the snapshot with \c endpoints .
+     *
+     * The snapshot is written in a temporary file and then renamed, so a crash while saving never corrupts it.
+     *
+     * @return whether the snapshot has been saved.
+     */
+    DDSROUTER_CORE_DllAPI bool save(
+            const std::vector<ddspipe::core::types::Endpoint>& endpoints) const noexcept;
+
+protected:
+
+    //! Encode an endpoint in \c buffer , that is resized to fit it.
+    static void encode_(
+            const ddspipe::core::types::Endpoint& endpoint,
+            std::vector<uint8_t>& buffer);
+
+    //! Decode an endpoint written by \c encode_ . Returns false if the record is corrupted.
+    static bool decode_(
+            const uint8_t* record,
+            uint64_t size,
+            ddspipe::core::types::Endpoint& endpoint);
+
+    const std::string file_;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,212 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include <cpp_utils/time/time_utils.hpp>
+
+#include <ddspipe_core/dynamic/DiscoveryDatabase.hpp>
+#include <ddspipe_core/types/dds/Endpoint.hpp>
+#include <ddspipe_core/types/dds/Guid.hpp>
+
+#include <ddsrouter_core/library/library_dll.h>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Snapshot of the counters of a \c DiscoveryCoalescer .
+ */
+struct DiscoveryCoalescerStatistics
+{
+    //! Discovery events received from the participants.
+    uint64_t received = 0;
+
+    //! Endpoints added to the DDS Pipe.
+    uint64_t added = 0;
+
+    //! Endpoints updated in the DDS Pipe.
+    uint64_t updated = 0;
+
+    //! Endpoints erased from the DDS Pipe.
+    uint64_t erased = 0;
+
+    //! Events merged with a later event of the same endpoint, that did not reach the DDS Pipe.
+    uint64_t coalesced = 0;
+
+    //! Batches processed.
+    uint64_t batches = 0;
+
+    //! Endpoints added to the DDS Pipe from a discovery cache.
+    uint64_t preloaded = 0;
+
+    //! Preloaded endpoints erased from the DDS Pipe because they have not been discovered again.
+    uint64_t expired = 0;
+};
+
+/**
+ * Gathers the discovery events of the participants and forwards them to the DDS Pipe in batches.
+ *
+ * The participants report their discoveries to a \c source database, whose callbacks only queue the events here.
+ * A dedicated thread waits \c period since the first event of a batch, and then forwards the whole batch to the
+ * \c target database used by the DDS Pipe, so a discovery storm does not reach the DDS Pipe one endpoint at a time.
+ *
+ * Events of the same endpoint within a batch are coalesced into its latest state:
+ * - Repeated discoveries and updates become a single add or update.
+ * - An endpoint discovered and erased (i.e. flapping) within the batch is never seen by the DDS Pipe.
+ *
+ * Endpoints known from a previous execution can be preloaded in the \c target database before they are discovered.
+ * Those that are not discovered again within a time to live are erased from it.
+ *
+ * The coalescer must be owned by a \c std::shared_ptr , so the callbacks registered in \c source , that can not be
+ * unregistered, do nothing once it is destroyed.
+ */
+class DiscoveryCoalescer : public std::enable_shared_from_this<DiscoveryCoalescer>
+{
+public:
+
+    /**
+     * @brief Construct a new DiscoveryCoalescer.
+     *
+     * @param [in] source : database where the participants report their discoveries.
+     * @param [in] target : database of the DDS Pipe.
+     * @param [in] period : milliseconds to gather the events of a batch.
+     */
+    DDSROUTER_CORE_DllAPI DiscoveryCoalescer(
+            const std::shared_ptr<ddspipe::core::DiscoveryDatabase>& source,
+            const std::shared_ptr<ddspipe::core::DiscoveryDatabase>& target,
+            utils::Duration_ms period);
+
+    //! Stop the thread. Pending events are discarded.
+    DDSROUTER_CORE_DllAPI ~DiscoveryCoalescer();
+
+    //! Register in the source database and start the thread.
+    DDSROUTER_CORE_DllAPI void init();
+
+    //! Forward the pending events right away.
+    DDSROUTER_CORE_DllAPI void flush() noexcept;
+
+    //! Whether every event received has been forwarded.
+    DDSROUTER_CORE_DllAPI bool idle() const noexcept;
+
+    /**
+     * @brief Add endpoints to the target database before they are discovered.
+     *
+     * Events received afterwards for these endpoints are forwarded as updates.
+     *
+     * @param [in] endpoints : endpoints known from a previous execution.
+     * @param [in] ttl : milliseconds for the endpoints to be discovered again before they are erased.
+     */
+    DDSROUTER_CORE_DllAPI void preload(
+            const std::vector<ddspipe::core::types::Endpoint>& endpoints,
+            utils::Duration_ms ttl) noexcept;
+
+    //! Endpoints currently in the target database.
+    DDSROUTER_CORE_DllAPI std::vector<ddspipe::core::types::Endpoint> endpoints() const noexcept;
+
+    DDSROUTER_CORE_DllAPI DiscoveryCoalescerStatistics statistics() const noexcept;
+
+protected:
+
+    //! Latest state of an endpoint with pending events.
+    struct PendingEndpoint
+    {
+        ddspipe::core::types::Endpoint endpoint;
+
+        //! Whether the endpoint exists after its latest event.
+        bool alive;
+
+        //! Number of events received for the endpoint in this batch.
+        uint64_t events;
+    };
+
+    //! Queue the event of an endpoint, merging it with the previous events of the same endpoint.
+    void on_event_(
+            const ddspipe::core::types::Endpoint& endpoint,
+            bool alive) noexcept;
+
+    //! Routine of the thread that forwards the batches.
+    void routine_() noexcept;
+
+    //! Forward a batch to the target database. Only called with \c forward_mutex_ locked.
+    void forward_nts_(
+            std::vector<PendingEndpoint>&& batch) noexcept;
+
+    //! Erase the preloaded endpoints that have not been discovered again.
+    void expire_preloaded_() noexcept;
+
+    std::shared_ptr<ddspipe::core::DiscoveryDatabase> source_;
+
+    std::shared_ptr<ddspipe::core::DiscoveryDatabase> target_;
+
+    const utils::Duration_ms period_;
+
+    //! Guards the pending events and \c running_ .
+    mutable std::mutex mutex_;
+
+    std::condition_variable cv_;
+
+    bool running_;
+
+    //! Whether there are preloaded endpoints waiting to be discovered again. Guarded by \c mutex_ .
+    bool expiring_;
+
+    //! Time when the preloaded endpoints not discovered again expire. Guarded by \c mutex_ .
+    std::chrono::steady_clock::time_point expiration_;
+
+    //! Endpoints with pending events, by arrival order of their first event in the batch.
+    std::vector<PendingEndpoint> pending_;
+
+    //! Position in \c pending_ of each endpoint.
+    std::map<ddspipe::core::types::Guid, std::size_t> pending_index_;
+
+    //! Serializes the batches forwarded by the thread and by \c flush .
+    mutable std::mutex forward_mutex_;
+
+    //! Endpoints that exist in the target database. Guarded by \c forward_mutex_ .
+    std::map<ddspipe::core::types::Guid, ddspipe::core::types::Endpoint> forwarded_;
+
+    //! Preloaded endpoints not discovered again yet. Guarded by \c forward_mutex_ .
+    std::set<ddspipe::core::types::Guid> preloaded_;
+
+    //! Events taken from \c pending_ and not forwarded yet.
+    std::atomic<uint64_t> in_flight_;
+
+    std::atomic<uint64_t> received_;
+    std::atomic<uint64_t> added_;
+    std::atomic<uint64_t> updated_;
+    std::atomic<uint64_t> erased_;
+    std::atomic<uint64_t> coalesced_;
+    std::atomic<uint64_t> batches_;
+    std::atomic<uint64_t> preloaded_count_;
+    std::atomic<uint64_t> expired_;
+
+    std::thread thread_;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
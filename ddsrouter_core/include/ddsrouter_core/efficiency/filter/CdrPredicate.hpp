@@ -0,0 +1,217 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <ddsrouter_core/configuration/CdrFieldConfiguration.hpp>
+#include <ddsrouter_core/efficiency/cdr/CdrLayout.hpp>
+#include <ddsrouter_core/library/library_dll.h>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+//! Result of evaluating a \c CdrPredicate on a sample.
+enum class CdrPredicateResult : uint8_t
+{
+    match,
+    no_match,
+    //! The encapsulation of the sample is not supported, or the sample is too short for the fields.
+    malformed,
+};
+
+/**
+ * Filter expression compiled against the layout of a type, and evaluated on the samples serialized in CDR.
+ *
+ * The expression follows the SQL subset of the content filtered topics of DDS:
+ *
+ * \code
+ * robot_id IN (1, 2, 3) AND (battery < 0.2 OR state = 'FAULT') AND NOT pose.x BETWEEN %0 AND %1
+ * \endcode
+ *
+ * - Conditions are joined with AND, OR and NOT, and grouped with parentheses.
+ * - Comparisons are =, <>, <, <=, > and >= between fields and values, and LIKE between strings, where \c %
+ *   matches any text and \c _ any character.
+ * - BETWEEN and IN (an extension of the subset) check ranges and lists of values.
+ * - Values are numbers, TRUE, FALSE, strings quoted with ' and parameters %0 to %99.
+ *
+ * The expression is parsed and its types checked once. Evaluating it only reads the fields it references, so the
+ * fields after the last of them are never walked.
+ */
+class CdrPredicate
+{
+public:
+
+    /**
+     * @brief Compile \c expression for the type of \c fields .
+     *
+     * @param [in] expression : filter expression.
+     * @param [in] parameters : values of the parameters %0, %1... of the expression.
+     * @param [in] fields : layout of the type of the samples.
+     *
+     * @throw \c InitializationException if the expression is not well formed, references unknown fields or
+     * parameters, or compares values of different types.
+     */
+    DDSROUTER_CORE_DllAPI CdrPredicate(
+            const std::string& expression,
+            const std::vector<std::string>& parameters,
+            const std::vector<CdrFieldConfiguration>& fields);
+
+    //! Whether a sample serialized in CDR matches the expression.
+    DDSROUTER_CORE_DllAPI CdrPredicateResult evaluate(
+            const uint8_t* data,
+            uint32_t size) const noexcept;
+
+    //! Constants point to the text of the expression they own, so predicates are not copied.
+    CdrPredicate(
+            const CdrPredicate&) = delete;
+
+    CdrPredicate& operator =(
+            const CdrPredicate&) = delete;
+
+    DDSROUTER_CORE_DllAPI const std::string& expression() const noexcept;
+
+    //! Most fields an expression can reference.
+    static constexpr std::size_t MAX_FIELDS = 32;
+
+protected:
+
+    //! Kind of the values compared.
+    enum class ValueKind : uint8_t
+    {
+        boolean,
+        signed_integer,
+        unsigned_integer,
+        floating,
+        string,
+    };
+
+    /**
+     * @brief Value of a field in a sample, or of a constant of the expression.
+     *
+     * Trivial, so the values of the fields are not initialized in each sample before being decoded.
+     */
+    struct Value
+    {
+        ValueKind kind;
+
+        int64_t signed_integer;
+
+        uint64_t unsigned_integer;
+
+        double floating;
+
+        //! Text of strings, not terminated.
+        const char* string;
+
+        uint32_t length;
+    };
+
+    //! Comparison operators.
+    enum class Operator : uint8_t
+    {
+        equal,
+        not_equal,
+        less,
+        less_equal,
+        greater,
+        greater_equal,
+        like,
+    };
+
+    //! Field of the sample or constant.
+    struct Operand
+    {
+        bool field = false;
+
+        //! Slot of the value of the field in a sample.
+        std::size_t slot = 0;
+
+        ValueKind kind = ValueKind::boolean;
+
+        //! Value of a constant. Its string points to \c text once the expression is compiled.
+        Value constant{};
+
+        std::string text{};
+    };
+
+    enum class NodeKind : uint8_t
+    {
+        conjunction,
+        disjunction,
+        negation,
+        comparison,
+        between,
+        membership,
+    };
+
+    //! Node of the expression tree, whose children are indexes in \c nodes_ .
+    struct Node
+    {
+        NodeKind kind = NodeKind::comparison;
+
+        Operator op = Operator::equal;
+
+        std::size_t left = 0;
+
+        std::size_t right = 0;
+
+        //! Operands of comparisons (2), ranges (3) and lists (1 + values).
+        std::vector<Operand> operands{};
+    };
+
+    //! Value of \c operand , taking the fields from \c values .
+    static const Value& value_(
+            const Operand& operand,
+            const Value* values) noexcept;
+
+    //! Three way comparison of two values of kinds that can be compared.
+    static int compare_(
+            const Value& a,
+            const Value& b) noexcept;
+
+    bool evaluate_(
+            std::size_t node,
+            const Value* values) const noexcept;
+
+    const std::string expression_;
+
+    const CdrLayout layout_;
+
+    std::vector<Node> nodes_;
+
+    std::size_t root_ = 0;
+
+    //! Slot of each field of the layout, or \c NO_SLOT if the expression does not reference it.
+    std::vector<std::size_t> slots_;
+
+    //! Element of each field of the layout, kept apart for the data path.
+    std::vector<CdrElementKind> elements_;
+
+    //! Fields walked in each sample, up to the last one referenced.
+    std::size_t fields_walked_ = 0;
+
+    static constexpr std::size_t NO_SLOT = static_cast<std::size_t>(-1);
+
+    friend class CdrPredicateParser;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,85 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include <ddsrouter_core/efficiency/filter/CdrPredicate.hpp>
+#include <ddsrouter_core/library/library_dll.h>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Counters of a content filter in a topic.
+ */
+struct ContentFilterStatistics
+{
+    //! Topic filtered.
+    std::string topic;
+
+    //! Expression of the rule that created the filter.
+    std::string expression;
+
+    uint64_t forwarded;
+    uint64_t dropped;
+
+    //! Samples forwarded without evaluating the expression, as they could not be decoded.
+    uint64_t malformed;
+};
+
+/**
+ * Applies a compiled \c CdrPredicate to the samples of a topic, and counts what it forwards and drops.
+ *
+ * Samples that cannot be evaluated (unsupported encapsulation, or shorter than the declared fields) are forwarded,
+ * so a wrong layout never silences a topic.
+ *
+ * Every method is lock-free, so it can be called from any thread in the data path.
+ */
+class ContentFilter
+{
+public:
+
+    DDSROUTER_CORE_DllAPI ContentFilter(
+            const std::shared_ptr<const CdrPredicate>& predicate,
+            const std::string& topic);
+
+    //! Whether the sample serialized in \c data must be forwarded.
+    DDSROUTER_CORE_DllAPI bool accept(
+            const uint8_t* data,
+            uint32_t size) noexcept;
+
+    //! Snapshot of the counters.
+    DDSROUTER_CORE_DllAPI ContentFilterStatistics statistics() const;
+
+protected:
+
+    //! Compiled expression, shared by every topic of the rule.
+    const std::shared_ptr<const CdrPredicate> predicate_;
+
+    const std::string topic_;
+
+    std::atomic<uint64_t> forwarded_{0};
+    std::atomic<uint64_t> dropped_{0};
+    std::atomic<uint64_t> malformed_{0};
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,83 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <ddspipe_core/types/participant/ParticipantId.hpp>
+#include <ddspipe_core/types/topic/dds/DdsTopic.hpp>
+
+#include <ddsrouter_core/configuration/ContentFilterConfiguration.hpp>
+#include <ddsrouter_core/efficiency/filter/CdrPredicate.hpp>
+#include <ddsrouter_core/efficiency/filter/ContentFilter.hpp>
+#include <ddsrouter_core/library/library_dll.h>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Content filtering engine of the DDS Router.
+ *
+ * It compiles the expression of every configured rule once, and hands a \c ContentFilter to the readers of the
+ * topics and participants each rule applies to, when these are created.
+ * Readers check their filters right after taking a sample, so a sample dropped is released before any writer
+ * copies or references its payload.
+ */
+class ContentFilterEngine
+{
+public:
+
+    /**
+     * @brief Compile the expressions of \c configurations .
+     *
+     * @throw \c InitializationException if any expression is not valid.
+     */
+    DDSROUTER_CORE_DllAPI ContentFilterEngine(
+            const std::vector<ContentFilterConfiguration>& configurations);
+
+    //! Whether there is no rule configured.
+    DDSROUTER_CORE_DllAPI bool empty() const noexcept;
+
+    //! Get (creating them if needed) the filters a sample received by \c participant_id in \c topic must match.
+    DDSROUTER_CORE_DllAPI std::vector<std::shared_ptr<ContentFilter>> filters(
+            const ddspipe::core::types::DdsTopic& topic,
+            const ddspipe::core::types::ParticipantId& participant_id);
+
+    //! Snapshot of the counters of every filter created so far.
+    DDSROUTER_CORE_DllAPI std::vector<ContentFilterStatistics> statistics() const;
+
+protected:
+
+    const std::vector<ContentFilterConfiguration> configurations_;
+
+    //! Compiled expression of each rule.
+    std::vector<std::shared_ptr<const CdrPredicate>> predicates_;
+
+    //! Filters indexed by rule index and topic name.
+    std::map<std::pair<std::size_t, std::string>, std::shared_ptr<ContentFilter>> filters_;
+
+    //! Protects the filters. Only taken when creating readers, never in the data path.
+    mutable std::mutex mutex_;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,158 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <ddspipe_core/types/participant/ParticipantId.hpp>
+
+#include <ddsrouter_core/library/library_dll.h>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Snapshot of the counters of a slot of the thread pool, i.e. the transmissions of a reader.
+ *
+ * Counters and times accumulate since the slot was first registered, across the readers of its participant and topic.
+ */
+struct SlotStatistics
+{
+    //! Participant of the reader.
+    ddspipe::core::types::ParticipantId participant_id;
+
+    //! Topic of the reader.
+    std::string topic;
+
+    //! Times that the reader notified data, each one queueing its slot in the thread pool.
+    uint64_t enqueued = 0;
+
+    //! Transmissions that a thread has completed, taking every message of the reader.
+    uint64_t executed = 0;
+
+    //! Messages taken from the reader.
+    uint64_t messages = 0;
+
+    //! Bytes of payload of the messages taken from the reader.
+    uint64_t bytes = 0;
+
+    //! Maximum messages waiting in the reader when it notified data.
+    uint64_t max_queue_depth = 0;
+
+    //! Total time in microseconds from the data being notified to a thread taking it.
+    uint64_t queue_latency_us = 0;
+
+    //! Maximum time in microseconds from the data being notified to a thread taking it.
+    uint64_t max_queue_latency_us = 0;
+
+    //! Total time in microseconds that threads spent in transmissions.
+    uint64_t task_time_us = 0;
+
+    //! Maximum time in microseconds that a thread spent in a transmission.
+    uint64_t max_task_time_us = 0;
+};
+
+/**
+ * Counters of a slot of the thread pool.
+ *
+ * A slot is never executed by two threads at once, so the counters of its transmissions have a single writer and
+ * only need relaxed atomics. Each slot has its own cache line, so threads of different slots do not contend.
+ */
+struct alignas(64) SlotCounters
+{
+    //! Notify that the reader has data, with \c queue_depth messages waiting.
+    DDSROUTER_CORE_DllAPI void record_enqueue(
+            uint64_t queue_depth) noexcept;
+
+    //! Notify that a thread started a transmission \c latency_us microseconds after the data was notified.
+    DDSROUTER_CORE_DllAPI void record_start(
+            uint64_t latency_us) noexcept;
+
+    //! Notify that a thread took a message of \c size bytes.
+    DDSROUTER_CORE_DllAPI void record_message(
+            uint64_t size) noexcept;
+
+    //! Notify that a thread completed a transmission that took \c time_us microseconds.
+    DDSROUTER_CORE_DllAPI void record_end(
+            uint64_t time_us) noexcept;
+
+    std::atomic<uint64_t> enqueued{0};
+    std::atomic<uint64_t> executed{0};
+    std::atomic<uint64_t> messages{0};
+    std::atomic<uint64_t> bytes{0};
+    std::atomic<uint64_t> max_queue_depth{0};
+    std::atomic<uint64_t> queue_latency_us{0};
+    std::atomic<uint64_t> max_queue_latency_us{0};
+    std::atomic<uint64_t> task_time_us{0};
+    std::atomic<uint64_t> max_task_time_us{0};
+
+    //! Tag of the samples of the thread running the slot, for the sampling profiler.
+    std::string profiler_tag;
+};
+
+/**
+ * Registry of the counters of every slot of the thread pool.
+ *
+ * Counters are only read when their statistics are requested, so measuring costs a few relaxed atomic operations
+ * per transmission.
+ */
+class ThreadPoolInstrumentation
+{
+public:
+
+    /**
+     * @brief Get the counters of the slot of a reader, creating them the first time its participant and topic register.
+     *
+     * A reader that is created again for the same participant and topic keeps counting in the same slot.
+     *
+     * @param [in] participant_id : participant of the reader.
+     * @param [in] topic : name of the topic of the reader.
+     */
+    DDSROUTER_CORE_DllAPI std::shared_ptr<SlotCounters> register_slot(
+            const ddspipe::core::types::ParticipantId& participant_id,
+            const std::string& topic);
+
+    //! Counters of every slot registered.
+    DDSROUTER_CORE_DllAPI std::vector<SlotStatistics> statistics() const;
+
+protected:
+
+    struct Slot
+    {
+        ddspipe::core::types::ParticipantId participant_id;
+        std::string topic;
+        std::shared_ptr<SlotCounters> counters;
+    };
+
+    mutable std::mutex mutex_;
+
+    //! Slots in the order they were registered, so every statistics snapshot extends the previous one.
+    std::vector<Slot> slots_;
+
+    //! Index in \c slots_ of the slot of each participant and topic.
+    std::map<std::pair<ddspipe::core::types::ParticipantId, std::string>, std::size_t> slot_indexes_;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
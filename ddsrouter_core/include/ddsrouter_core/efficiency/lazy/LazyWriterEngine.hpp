@@ -0,0 +1,172 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <cpp_utils/event/PeriodicEventHandler.hpp>
+#include <cpp_utils/time/time_utils.hpp>
+
+#include <ddspipe_core/dynamic/DiscoveryDatabase.hpp>
+#include <ddspipe_core/interface/IParticipant.hpp>
+#include <ddspipe_core/interface/IWriter.hpp>
+#include <ddspipe_core/types/dds/Endpoint.hpp>
+#include <ddspipe_core/types/dds/Guid.hpp>
+#include <ddspipe_core/types/participant/ParticipantId.hpp>
+#include <ddspipe_core/types/topic/dds/DdsTopic.hpp>
+
+#include <ddsrouter_core/library/library_dll.h>
+#include <ddsrouter_core/participants/lazy/LazyWriter.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Snapshot of the counters of the lazy writers of a DDS Router.
+ */
+struct LazyWriterStatistics
+{
+    //! Lazy writers, i.e. writers of the topic bridges.
+    uint64_t writers = 0;
+
+    //! Lazy writers whose inner writer exists.
+    uint64_t active = 0;
+
+    //! Inner writers created so far.
+    uint64_t created = 0;
+
+    //! Inner writers destroyed for being idle so far.
+    uint64_t reaped = 0;
+};
+
+/**
+ * Creates the lazy writers of a DDS Router, and periodically destroys the ones idle for longer than a TTL.
+ *
+ * The reaper only runs if the TTL is not 0, checking every writer each half TTL, so a writer is destroyed after
+ * being idle between 1 and 1.5 times the TTL.
+ *
+ * Writers whose participant has discovered readers in their topic are never destroyed, as a writer created again
+ * loses the messages sent before the readers match it. Thus only writers without subscribers release their
+ * resources, and topics publishing less often than the TTL do not lose their messages.
+ */
+class LazyWriterEngine
+{
+public:
+
+    /**
+     * @brief Construct a new LazyWriterEngine.
+     *
+     * @param [in] idle_ttl : milliseconds without writing that make a writer be destroyed. 0 means never.
+     */
+    DDSROUTER_CORE_DllAPI LazyWriterEngine(
+            utils::Duration_ms idle_ttl);
+
+    //! Stop the reaper.
+    DDSROUTER_CORE_DllAPI ~LazyWriterEngine();
+
+    //! Create a lazy writer of \c participant in \c topic .
+    DDSROUTER_CORE_DllAPI std::shared_ptr<ddspipe::core::IWriter> create_writer(
+            const std::shared_ptr<ddspipe::core::IParticipant>& participant,
+            const ddspipe::core::types::DdsTopic& topic);
+
+    /**
+     * @brief Destroy the inner writer of every writer idle for longer than the TTL.
+     *
+     * Called periodically by the reaper.
+     *
+     * @return number of writers destroyed.
+     */
+    DDSROUTER_CORE_DllAPI uint64_t reap_idle_writers() noexcept;
+
+    /**
+     * @brief Create right away the inner writers of the lazy writers in \c topics .
+     *
+     * The writers are created in parallel, and this method returns once all of them have been created.
+     *
+     * @param [in] topics : names of the topics whose writers are created.
+     *
+     * @return number of writers that could not be created.
+     */
+    DDSROUTER_CORE_DllAPI uint64_t warm_up(
+            const std::set<std::string>& topics);
+
+    /**
+     * @brief Keep track of the readers discovered in \c discovery_database , so writers with readers are not reaped.
+     *
+     * Must be called before the participants discover any endpoint.
+     */
+    DDSROUTER_CORE_DllAPI void track_readers(
+            const std::shared_ptr<ddspipe::core::DiscoveryDatabase>& discovery_database);
+
+    //! Whether \c participant_id has discovered any reader in \c topic_name .
+    DDSROUTER_CORE_DllAPI bool has_readers(
+            const ddspipe::core::types::ParticipantId& participant_id,
+            const std::string& topic_name) const;
+
+    //! Snapshot of the counters of every lazy writer created so far.
+    DDSROUTER_CORE_DllAPI LazyWriterStatistics statistics() const;
+
+protected:
+
+    //! Lazy writers alive, removing the expired ones. Must be called with \c mutex_ locked.
+    std::vector<std::shared_ptr<LazyWriter>> alive_writers_nts_();
+
+    //! Milliseconds without writing that make a writer be destroyed. 0 means never.
+    const utils::Duration_ms idle_ttl_;
+
+    //! Counters shared with the writers, so they can outlive this engine.
+    std::shared_ptr<LazyWriterCounters> counters_;
+
+    //! Guards \c writers_ .
+    mutable std::mutex mutex_;
+
+    //! Writers created, released when the DDS Pipe destroys them.
+    std::vector<std::weak_ptr<LazyWriter>> writers_;
+
+    //! Readers discovered, by participant and topic.
+    struct DiscoveredReaders
+    {
+        //! Add, update or remove a reader as notified by the discovery database.
+        void update(
+                const ddspipe::core::types::Endpoint& endpoint,
+                bool erased);
+
+        //! Participant and topic of each reader alive.
+        std::map<ddspipe::core::types::Guid, std::pair<ddspipe::core::types::ParticipantId, std::string>> readers;
+
+        //! Readers alive of each participant and topic.
+        std::map<std::pair<ddspipe::core::types::ParticipantId, std::string>, uint64_t> counts;
+
+        mutable std::mutex mutex;
+    };
+
+    //! Shared with the callbacks of the discovery database, which may outlive this engine.
+    std::shared_ptr<DiscoveredReaders> discovered_readers_;
+
+    //! Periodic reaper. nullptr if writers are never destroyed.
+    std::unique_ptr<utils::event::PeriodicEventHandler> reaper_;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,55 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include <ddspipe_core/types/data/RtpsPayloadData.hpp>
+
+#include <ddsrouter_core/library/library_dll.h>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Data of a message whose memory is recycled instead of returned to the heap.
+ *
+ * The DDS Pipe destroys the data taken from the readers through a pointer to \c IRoutingData , whose virtual
+ * destructor calls the deallocation function of the class created.
+ * The memory released is kept in a free list and reused by the next data created, so once the DDS Router reaches
+ * its steady state, routing a message does not allocate its data.
+ *
+ * Create it with \c std::make_unique as any other data.
+ */
+struct PooledRtpsPayloadData : public ddspipe::core::types::RtpsPayloadData
+{
+    //! Take the memory from the free list, or allocate it if the list is empty.
+    DDSROUTER_CORE_DllAPI static void* operator new(
+            std::size_t size);
+
+    //! Keep the memory in the free list, or free it if the list is full.
+    DDSROUTER_CORE_DllAPI static void operator delete(
+            void* memory,
+            std::size_t size) noexcept;
+
+    //! Number of objects in the free list.
+    DDSROUTER_CORE_DllAPI static uint64_t cached() noexcept;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,179 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <ddspipe_core/efficiency/payload/PayloadPool.hpp>
+
+#include <ddsrouter_core/library/library_dll.h>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Snapshot of the counters of a \c PreallocatedPayloadPool .
+ */
+struct PayloadPoolStatistics
+{
+    //! Slots reserved.
+    uint64_t slots = 0;
+
+    //! Slots not in use.
+    uint64_t free_slots = 0;
+
+    //! Payloads served from a slot.
+    uint64_t pooled = 0;
+
+    //! Payloads allocated in the heap, because they did not fit in a slot or there was no slot free.
+    uint64_t heap = 0;
+};
+
+/**
+ * Payload pool that serves the payloads from slots of a fixed size reserved up front.
+ *
+ * Slots are reserved with \c reserve when the topic bridges are created, so once every bridge exists the payloads
+ * are taken from and returned to a free list without any heap allocation.
+ * Payloads bigger than a slot, or requested when every slot is in use, are allocated in the heap as usual.
+ *
+ * The free list is a lock-free stack of slot indexes, tagged to avoid the ABA problem, so taking and returning a slot
+ * never locks. Only \c reserve and \c statistics lock.
+ *
+ * As in the default pool of the DDS Pipe, a payload is shared between the readers and writers of a bridge by
+ * counting its references, so it is only copied when it comes from a different pool.
+ */
+class PreallocatedPayloadPool : public ddspipe::core::PayloadPool
+{
+public:
+
+    /**
+     * @brief Construct a new PreallocatedPayloadPool without slots.
+     *
+     * @param [in] slot_size : maximum size in bytes of the payloads served from a slot.
+     */
+    DDSROUTER_CORE_DllAPI PreallocatedPayloadPool(
+            uint32_t slot_size);
+
+    /**
+     * @brief Reserve \c slots more slots.
+     *
+     * Allocates the memory of the slots at once, so it must not be called in the data path.
+     */
+    DDSROUTER_CORE_DllAPI void reserve(
+            uint64_t slots);
+
+    DDSROUTER_CORE_DllAPI bool get_payload(
+            uint32_t size,
+            ddspipe::core::types::Payload& payload) override;
+
+    DDSROUTER_CORE_DllAPI bool get_payload(
+            const ddspipe::core::types::Payload& src_payload,
+            fastrtps::rtps::IPayloadPool*& data_owner,
+            ddspipe::core::types::Payload& target_payload) override;
+
+    DDSROUTER_CORE_DllAPI bool release_payload(
+            ddspipe::core::types::Payload& payload) override;
+
+    DDSROUTER_CORE_DllAPI uint32_t slot_size() const noexcept;
+
+    DDSROUTER_CORE_DllAPI PayloadPoolStatistics statistics() const noexcept;
+
+protected:
+
+    //! Index of no slot, that ends the free list.
+    static constexpr uint32_t NO_SLOT = UINT32_MAX;
+
+    //! Slots of the first segment of the slot table. Every segment doubles the slots of the previous one.
+    static constexpr uint32_t FIRST_SEGMENT_SLOTS = 64;
+
+    //! Segments of the slot table, enough to index every slot below \c NO_SLOT .
+    static constexpr std::size_t SEGMENTS = 27;
+
+    //! Header in front of the data of every payload of this pool.
+    struct alignas(8) PayloadHeader
+    {
+        //! Readers and writers holding the payload.
+        std::atomic<uint32_t> references;
+
+        //! Next slot in the free list, while the slot is free.
+        std::atomic<uint32_t> next;
+
+        //! Index of the slot in the slot table.
+        uint32_t index;
+
+        //! Whether the payload is a slot or has been allocated in the heap.
+        bool pooled;
+    };
+
+    //! Header of a payload of this pool.
+    static PayloadHeader* header_(
+            uint8_t* data) noexcept;
+
+    //! Segment of the slot table that holds \c index , and its first index.
+    static std::size_t segment_(
+            uint32_t index,
+            uint32_t& first_index) noexcept;
+
+    //! Slot with \c index . It must have been reserved.
+    PayloadHeader* slot_(
+            uint32_t index) const noexcept;
+
+    //! Take a free slot. nullptr if there is none.
+    PayloadHeader* take_slot_() noexcept;
+
+    //! Return a slot to the free list.
+    void return_slot_(
+            PayloadHeader* header) noexcept;
+
+    const uint32_t slot_size_;
+
+    //! Bytes between two consecutive slots, header included.
+    const std::size_t slot_stride_;
+
+    //! Guards \c chunks_ , \c segments_ and \c slots_ , so only \c reserve and \c statistics lock.
+    mutable std::mutex mutex_;
+
+    //! Memory of the slots, one chunk per \c reserve .
+    std::vector<std::unique_ptr<uint8_t[]>> chunks_;
+
+    //! Memory of the segments of the slot table.
+    std::vector<std::unique_ptr<PayloadHeader*[]>> segments_;
+
+    //! Slot of every index, in segments that are never moved so they can be read without locking.
+    std::array<std::atomic<PayloadHeader**>, SEGMENTS> slot_table_;
+
+    //! Top of the free list: the tag in the upper half and the index of the slot in the lower half.
+    std::atomic<uint64_t> free_list_;
+
+    //! Slots in the free list.
+    std::atomic<uint64_t> free_slots_;
+
+    //! Slots reserved.
+    uint64_t slots_;
+
+    std::atomic<uint64_t> pooled_;
+
+    std::atomic<uint64_t> heap_;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,82 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <ddspipe_core/types/participant/ParticipantId.hpp>
+#include <ddspipe_core/types/topic/dds/DdsTopic.hpp>
+
+#include <ddsrouter_core/configuration/ProjectionConfiguration.hpp>
+#include <ddsrouter_core/efficiency/cdr/CdrProjection.hpp>
+#include <ddsrouter_core/efficiency/projection/TopicProjection.hpp>
+#include <ddsrouter_core/library/library_dll.h>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Projection engine of the DDS Router.
+ *
+ * It builds the rewriter of every configured rule once, and hands a \c TopicProjection to the writers of the
+ * topics and participants each rule applies to, when these are created.
+ * If several rules apply to the same writer, the first one is used.
+ */
+class ProjectionEngine
+{
+public:
+
+    /**
+     * @brief Build the rewriters of \c configurations .
+     *
+     * @throw \c InitializationException if any rule is not valid.
+     */
+    DDSROUTER_CORE_DllAPI ProjectionEngine(
+            const std::vector<ProjectionConfiguration>& configurations);
+
+    //! Whether there is no rule configured.
+    DDSROUTER_CORE_DllAPI bool empty() const noexcept;
+
+    //! Get (creating it if needed) the projection of the samples sent by \c participant_id in \c topic , if any.
+    DDSROUTER_CORE_DllAPI std::shared_ptr<TopicProjection> projection(
+            const ddspipe::core::types::DdsTopic& topic,
+            const ddspipe::core::types::ParticipantId& participant_id);
+
+    //! Snapshot of the counters of every projection created so far.
+    DDSROUTER_CORE_DllAPI std::vector<ProjectionStatistics> statistics() const;
+
+protected:
+
+    const std::vector<ProjectionConfiguration> configurations_;
+
+    //! Rewriter of each rule.
+    std::vector<std::shared_ptr<const CdrProjection>> rewriters_;
+
+    //! Projections indexed by rule index and topic name.
+    std::map<std::pair<std::size_t, std::string>, std::shared_ptr<TopicProjection>> projections_;
+
+    //! Protects the projections. Only taken when creating writers, never in the data path.
+    mutable std::mutex mutex_;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
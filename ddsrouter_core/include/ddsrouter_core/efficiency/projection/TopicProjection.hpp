@@ -0,0 +1,101 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include <ddspipe_core/efficiency/payload/PayloadPool.hpp>
+
+#include <ddsrouter_core/efficiency/cdr/CdrProjection.hpp>
+#include <ddsrouter_core/library/library_dll.h>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Counters of a projection in a topic.
+ */
+struct ProjectionStatistics
+{
+    //! Topic projected.
+    std::string topic;
+
+    //! Derived type the samples are published with.
+    std::string type_name;
+
+    //! Samples sent projected.
+    uint64_t projected;
+
+    //! Samples not sent, as they do not follow the layout of the projection.
+    uint64_t dropped;
+
+    //! Bytes of the samples projected, before and after being projected.
+    uint64_t original_bytes;
+    uint64_t projected_bytes;
+};
+
+/**
+ * Applies a \c CdrProjection to the samples of a topic, and counts what it projects and drops.
+ *
+ * Every method but \c statistics is lock-free, so it can be called from any thread in the data path.
+ */
+class TopicProjection
+{
+public:
+
+    DDSROUTER_CORE_DllAPI TopicProjection(
+            const std::shared_ptr<const CdrProjection>& projection,
+            const std::string& topic,
+            const std::string& type_name);
+
+    //! Derived type the samples are published with.
+    DDSROUTER_CORE_DllAPI const std::string& type_name() const noexcept;
+
+    /**
+     * @brief Project a sample into a payload of \c pool .
+     *
+     * @return false if the sample does not follow the layout, or there is no payload available. \c target is
+     * empty then.
+     */
+    DDSROUTER_CORE_DllAPI bool project(
+            const ddspipe::core::types::Payload& source,
+            ddspipe::core::PayloadPool& pool,
+            ddspipe::core::types::Payload& target) noexcept;
+
+    //! Snapshot of the counters.
+    DDSROUTER_CORE_DllAPI ProjectionStatistics statistics() const;
+
+protected:
+
+    //! Rewriter of the type, shared by every topic of the rule.
+    const std::shared_ptr<const CdrProjection> projection_;
+
+    const std::string topic_;
+
+    const std::string type_name_;
+
+    std::atomic<uint64_t> projected_{0};
+    std::atomic<uint64_t> dropped_{0};
+    std::atomic<uint64_t> original_bytes_{0};
+    std::atomic<uint64_t> projected_bytes_{0};
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,121 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <vector>
+
+#include <fastdds/rtps/common/InstanceHandle.h>
+
+#include <ddspipe_core/interface/IRoutingData.hpp>
+
+#include <ddsrouter_core/library/library_dll.h>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Table that keeps the latest pending sample of each instance of a topic.
+ *
+ * It is an open addressing hash table (linear probing and backward shift deletion) indexed by instance handle,
+ * so each instance costs a single slot and a lookup touches contiguous memory.
+ * Instances with a pending sample are visited in round-robin order: an instance enters the queue when it gets a
+ * pending sample, and keeps its position if the sample is replaced by a newer one.
+ *
+ * @warning This class is not thread safe.
+ */
+class InstanceSampleTable
+{
+public:
+
+    using Key = fastrtps::rtps::InstanceHandle_t;
+
+    DDSROUTER_CORE_DllAPI InstanceSampleTable(
+            std::size_t initial_capacity = 16);
+
+    /**
+     * @brief Set \c sample as the pending sample of instance \c key .
+     *
+     * @return the pending sample replaced, or nullptr if the instance had none.
+     */
+    DDSROUTER_CORE_DllAPI std::unique_ptr<ddspipe::core::IRoutingData> store(
+            const Key& key,
+            std::unique_ptr<ddspipe::core::IRoutingData>&& sample);
+
+    /**
+     * @brief Forget instance \c key .
+     *
+     * @return the pending sample of the instance, or nullptr if it had none.
+     */
+    DDSROUTER_CORE_DllAPI std::unique_ptr<ddspipe::core::IRoutingData> erase(
+            const Key& key);
+
+    //! Next pending sample in round-robin order, or nullptr if there is none. The sample is kept in the table.
+    DDSROUTER_CORE_DllAPI ddspipe::core::IRoutingData* front();
+
+    //! Remove and return the sample given by \c front .
+    DDSROUTER_CORE_DllAPI std::unique_ptr<ddspipe::core::IRoutingData> pop();
+
+    //! Number of instances with a pending sample.
+    DDSROUTER_CORE_DllAPI std::size_t pending() const noexcept;
+
+    //! Number of instances known.
+    DDSROUTER_CORE_DllAPI std::size_t instances() const noexcept;
+
+protected:
+
+    struct Slot
+    {
+        Key key{};
+        std::unique_ptr<ddspipe::core::IRoutingData> sample{};
+        bool used = false;
+    };
+
+    static std::size_t hash_(
+            const Key& key) noexcept;
+
+    //! Index of the slot of \c key , or \c capacity if not present.
+    std::size_t find_(
+            const Key& key) const noexcept;
+
+    //! Index of the slot of \c key , creating it if not present.
+    std::size_t find_or_insert_(
+            const Key& key);
+
+    //! Double the capacity, rehashing every slot.
+    void grow_();
+
+    //! Skip the queue entries whose instance has no pending sample anymore.
+    void discard_stale_front_();
+
+    std::vector<Slot> slots_;
+
+    std::size_t mask_;
+
+    std::size_t used_;
+
+    std::size_t pending_;
+
+    //! Instances with a pending sample in round-robin order. May contain entries of erased instances.
+    std::deque<Key> queue_;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
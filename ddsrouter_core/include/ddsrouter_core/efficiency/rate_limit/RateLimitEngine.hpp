@@ -0,0 +1,166 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <cpp_utils/event/PeriodicEventHandler.hpp>
+#include <cpp_utils/time/time_utils.hpp>
+
+#include <ddspipe_core/types/participant/ParticipantId.hpp>
+#include <ddspipe_core/types/topic/dds/DdsTopic.hpp>
+
+#include <ddsrouter_core/configuration/RateLimitConfiguration.hpp>
+#include <ddsrouter_core/efficiency/rate_limit/RateLimiter.hpp>
+#include <ddsrouter_core/library/library_dll.h>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Limiters that a writer must check before sending a message.
+ */
+struct TransmissionLimiters
+{
+    //! Limiters of the destination participant, checked for every message.
+    std::vector<std::shared_ptr<RateLimiter>> participant;
+
+    //! Limiters of the routes ending in the destination participant, indexed by source participant index.
+    std::vector<std::pair<uint32_t, std::shared_ptr<RateLimiter>>> route;
+
+    bool empty() const noexcept
+    {
+        return participant.empty() && route.empty();
+    }
+
+};
+
+/**
+ * Unified rate limiting engine of the DDS Router.
+ *
+ * It owns every \c RateLimiter created from the configured rules, and hands them to the readers and writers
+ * when these are created, so the data path only checks the atomics of the limiters it already holds.
+ *
+ * - Topic limiters are checked by the readers, right after a message is taken and before any writer gets it.
+ * - Participant limiters are checked by the writers of the participant.
+ * - Route limiters are checked by the writers of the destination participant, only for messages received by
+ *   the source participant.
+ *
+ * In order for a writer to know which participant received the message it is writing, readers publish their
+ * participant index in a thread local variable when they take a message.
+ * This relies on the message being taken and written by the same thread, which is the DDS Pipe behaviour.
+ *
+ * Topic rules applied per instance in keyed topics are not checked by plain readers: they keep the samples over
+ * the rate instead of dropping them, so the engine runs a pacer that periodically lets them retry.
+ */
+class RateLimitEngine
+{
+public:
+
+    DDSROUTER_CORE_DllAPI RateLimitEngine(
+            const std::vector<RateLimitConfiguration>& configurations);
+
+    //! Whether there is no rule configured.
+    DDSROUTER_CORE_DllAPI bool empty() const noexcept;
+
+    //! Get the index that identifies a participant in the data path.
+    DDSROUTER_CORE_DllAPI uint32_t participant_index(
+            const ddspipe::core::types::ParticipantId& participant_id);
+
+    //! Whether any rule limits a route.
+    DDSROUTER_CORE_DllAPI bool has_route_rules() const noexcept;
+
+    //! Get (creating them if needed) the limiters to check when receiving data in \c topic .
+    DDSROUTER_CORE_DllAPI std::vector<std::shared_ptr<RateLimiter>> reception_limiters(
+            const ddspipe::core::types::DdsTopic& topic);
+
+    //! Get (creating them if needed) the limiters to share between the instances of \c topic .
+    DDSROUTER_CORE_DllAPI std::vector<std::shared_ptr<RateLimiter>> instance_limiters(
+            const ddspipe::core::types::DdsTopic& topic);
+
+    /**
+     * @brief Register a callback to be called periodically by the pacer.
+     *
+     * The pacer starts with the first callback registered.
+     * A callback returning false is unregistered.
+     */
+    DDSROUTER_CORE_DllAPI void register_pacing_callback(
+            std::function<bool()> callback);
+
+    //! Get (creating them if needed) the limiters to check when \c destination sends data in \c topic .
+    DDSROUTER_CORE_DllAPI TransmissionLimiters transmission_limiters(
+            const ddspipe::core::types::DdsTopic& topic,
+            const ddspipe::core::types::ParticipantId& destination);
+
+    //! Snapshot of the counters of every limiter created so far.
+    DDSROUTER_CORE_DllAPI std::vector<RateLimitStatistics> statistics() const;
+
+    //! Set the index of the participant that received the message being processed by this thread.
+    DDSROUTER_CORE_DllAPI static void set_current_source(
+            uint32_t participant_index) noexcept;
+
+    //! Index of the participant that received the message being processed by this thread.
+    DDSROUTER_CORE_DllAPI static uint32_t current_source() noexcept;
+
+    //! Value of \c current_source when the thread is not processing any message.
+    static constexpr uint32_t NO_SOURCE = static_cast<uint32_t>(-1);
+
+protected:
+
+    //! Get or create the limiter for rule \c rule_index and entity \c key .
+    std::shared_ptr<RateLimiter> get_limiter_nts_(
+            std::size_t rule_index,
+            const std::string& key);
+
+    //! Call every pacing callback, unregistering the ones that are not needed anymore.
+    void pace_() noexcept;
+
+    //! Whether a rule applies to \c topic per instance.
+    static bool is_per_instance_(
+            const RateLimitConfiguration& rule,
+            const ddspipe::core::types::DdsTopic& topic) noexcept;
+
+    const std::vector<RateLimitConfiguration> configurations_;
+
+    //! Limiters indexed by rule index and shaped entity.
+    std::map<std::pair<std::size_t, std::string>, std::shared_ptr<RateLimiter>> limiters_;
+
+    std::map<ddspipe::core::types::ParticipantId, uint32_t> participant_indexes_;
+
+    //! Protects the limiters and indexes. Only taken when creating entities, never in the data path.
+    mutable std::mutex mutex_;
+
+    std::vector<std::function<bool()>> pacing_callbacks_;
+
+    //! Period of the pacer, short enough to follow the fastest per instance rule.
+    utils::Duration_ms pacing_period_;
+
+    //! Protects the pacing callbacks.
+    std::mutex pacing_mutex_;
+
+    //! Declared last, so it is stopped before anything it uses is destroyed.
+    std::unique_ptr<utils::event::PeriodicEventHandler> pacer_;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,110 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+#include <ddsrouter_core/configuration/RateLimitConfiguration.hpp>
+#include <ddsrouter_core/efficiency/rate_limit/TokenBucket.hpp>
+#include <ddsrouter_core/library/library_dll.h>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Snapshot of the counters of a \c RateLimiter .
+ */
+struct RateLimitStatistics
+{
+    //! Scope of the rule that created the limiter.
+    types::RateLimitScope scope;
+
+    //! Entity shaped by the limiter (topic name, participant id or "src->dst" route).
+    std::string key;
+
+    uint64_t accepted_msgs;
+    uint64_t accepted_bytes;
+    uint64_t dropped_msgs;
+    uint64_t dropped_bytes;
+};
+
+/**
+ * Shapes traffic both in messages and bytes per second, and counts what it accepts and drops.
+ *
+ * Every method is lock-free, so it can be called from any thread in the data path.
+ */
+class RateLimiter
+{
+public:
+
+    DDSROUTER_CORE_DllAPI RateLimiter(
+            const RateLimitConfiguration& configuration,
+            const std::string& key);
+
+    /**
+     * @brief Check whether a message of \c size bytes fits in the rate and consume its tokens if so.
+     *
+     * @param [in] size : size of the message in bytes.
+     * @param [in] now : current time as given by \c TokenBucket::now() .
+     *
+     * @return true if the message must be forwarded.
+     */
+    DDSROUTER_CORE_DllAPI bool accept(
+            uint64_t size,
+            int64_t now) noexcept;
+
+    /**
+     * @brief Same as \c accept , but a rejected message is not counted as dropped.
+     *
+     * Used when a rejected message is kept to be sent later.
+     */
+    DDSROUTER_CORE_DllAPI bool try_accept(
+            uint64_t size,
+            int64_t now) noexcept;
+
+    //! Count a message of \c size bytes as dropped.
+    DDSROUTER_CORE_DllAPI void drop(
+            uint64_t size) noexcept;
+
+    /**
+     * @brief Undo an \c accept , because the message has been dropped afterwards by another limiter.
+     */
+    DDSROUTER_CORE_DllAPI void refund(
+            uint64_t size) noexcept;
+
+    DDSROUTER_CORE_DllAPI RateLimitStatistics statistics() const noexcept;
+
+protected:
+
+    const types::RateLimitScope scope_;
+
+    const std::string key_;
+
+    TokenBucket msgs_bucket_;
+
+    TokenBucket bytes_bucket_;
+
+    std::atomic<uint64_t> accepted_msgs_{0};
+    std::atomic<uint64_t> accepted_bytes_{0};
+    std::atomic<uint64_t> dropped_msgs_{0};
+    std::atomic<uint64_t> dropped_bytes_{0};
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,91 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+#include <ddsrouter_core/library/library_dll.h>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Lock-free token bucket.
+ *
+ * The bucket is implemented as a Generic Cell Rate Algorithm (GCRA): instead of storing the number of tokens
+ * available and refilling it periodically, it stores the \c theoretical \c arrival \c time (TAT) of the next token.
+ * This way the whole state of the bucket is a single atomic integer, and consuming tokens is a CAS loop over it.
+ *
+ * A bucket with \c rate 0 is unlimited and accepts every request.
+ */
+class TokenBucket
+{
+public:
+
+    /**
+     * @brief Construct a new TokenBucket.
+     *
+     * @param [in] rate : number of tokens refilled per second. 0 means unlimited.
+     * @param [in] burst : maximum number of tokens that can be consumed at once.
+     *                     If 0, the burst is set to one second worth of tokens.
+     */
+    DDSROUTER_CORE_DllAPI TokenBucket(
+            double rate,
+            double burst = 0);
+
+    /**
+     * @brief Try to consume \c tokens from the bucket.
+     *
+     * @param [in] tokens : number of tokens to consume.
+     * @param [in] now : current time in nanoseconds, as given by \c now() .
+     *
+     * @return true if there were enough tokens and they have been consumed.
+     * @return false otherwise. In this case no token is consumed.
+     */
+    DDSROUTER_CORE_DllAPI bool try_consume(
+            uint64_t tokens,
+            int64_t now) noexcept;
+
+    /**
+     * @brief Return \c tokens previously consumed to the bucket.
+     *
+     * Used to undo a \c try_consume when the request has been rejected by a different bucket.
+     */
+    DDSROUTER_CORE_DllAPI void refund(
+            uint64_t tokens) noexcept;
+
+    //! Whether the bucket limits anything at all.
+    DDSROUTER_CORE_DllAPI bool unlimited() const noexcept;
+
+    //! Current time in nanoseconds in a monotonic clock.
+    DDSROUTER_CORE_DllAPI static int64_t now() noexcept;
+
+protected:
+
+    //! Nanoseconds that a single token takes to be refilled.
+    double nanoseconds_per_token_;
+
+    //! Nanoseconds ahead of current time that the TAT is allowed to be (i.e. the burst).
+    int64_t tolerance_;
+
+    //! Theoretical arrival time of the next token in nanoseconds.
+    std::atomic<int64_t> theoretical_arrival_time_;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,99 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <ddsrouter_core/library/library_dll.h>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Readiness of the endpoints of a topic.
+ */
+struct TopicReadiness
+{
+    std::string topic;
+
+    //! Readers created in the topic.
+    uint64_t readers = 0;
+
+    //! Writers created in the topic.
+    uint64_t writers = 0;
+
+    //! Readers and writers that could not be created.
+    uint64_t failed = 0;
+
+    //! Milliseconds spent creating the readers and writers of the topic.
+    double creation_ms = 0;
+
+    //! Milliseconds since the router was created until the last endpoint of the topic was created.
+    double ready_ms = 0;
+
+    //! Whether every endpoint of the topic has been created.
+    bool ready = false;
+};
+
+/**
+ * Measures the creation of the readers and writers of each topic.
+ *
+ * The endpoints are reported by a \c ReadinessParticipant wrapping each participant of the router.
+ */
+class TopicReadinessTracker
+{
+public:
+
+    //! Construct a new TopicReadinessTracker, whose creation is the origin of \c TopicReadiness::ready_ms .
+    DDSROUTER_CORE_DllAPI TopicReadinessTracker();
+
+    /**
+     * @brief Account an endpoint created, or that failed to be created.
+     *
+     * @param [in] topic : name of the topic of the endpoint.
+     * @param [in] is_writer : whether the endpoint is a writer or a reader.
+     * @param [in] duration : time that the creation took.
+     * @param [in] success : whether the endpoint has been created.
+     */
+    DDSROUTER_CORE_DllAPI void endpoint_created(
+            const std::string& topic,
+            bool is_writer,
+            std::chrono::steady_clock::duration duration,
+            bool success) noexcept;
+
+    //! Readiness of each topic in \c topics , in the same order. Topics without endpoints are not ready.
+    DDSROUTER_CORE_DllAPI std::vector<TopicReadiness> readiness(
+            const std::set<std::string>& topics) const;
+
+protected:
+
+    const std::chrono::steady_clock::time_point origin_;
+
+    //! Guards \c topics_ .
+    mutable std::mutex mutex_;
+
+    std::map<std::string, TopicReadiness> topics_;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,419 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <istream>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include <ddsrouter_core/configuration/BinaryLogConfiguration.hpp>
+#include <ddsrouter_core/library/library_dll.h>
+#include <ddsrouter_core/logging/BinaryLogFormat.hpp>
+#include <ddsrouter_core/logging/LogSite.hpp>
+#include <ddsrouter_core/logging/LogThrottle.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Raw arguments of an entry, encoded as in \c BinaryLogFormat.hpp .
+ *
+ * Numbers, booleans and strings are copied as they are. Any other argument is streamed into a string.
+ */
+class BinaryLogArguments
+{
+public:
+
+    template <typename T>
+    void add(
+            const T& value) noexcept;
+
+    const uint8_t* data() const noexcept
+    {
+        return data_;
+    }
+
+    uint32_t size() const noexcept
+    {
+        return size_;
+    }
+
+protected:
+
+    void add_value_(
+            uint8_t type,
+            const void* value,
+            uint32_t size) noexcept
+    {
+        if (BINARY_LOG_MAX_ARGUMENTS_SIZE - size_ < 1 + size)
+        {
+            // Mark the arguments as full, so no later argument takes the place of this one
+            size_ = BINARY_LOG_MAX_ARGUMENTS_SIZE;
+            return;
+        }
+
+        data_[size_] = type;
+        std::memcpy(data_ + size_ + 1, value, size);
+        size_ += 1 + size;
+    }
+
+    //! Copy a string, truncated to the space left.
+    void add_string_(
+            const char* value,
+            std::size_t size) noexcept
+    {
+        if (BINARY_LOG_MAX_ARGUMENTS_SIZE - size_ < 1 + sizeof(uint16_t))
+        {
+            size_ = BINARY_LOG_MAX_ARGUMENTS_SIZE;
+            return;
+        }
+
+        const uint16_t length = static_cast<uint16_t>(
+            std::min<std::size_t>(size, BINARY_LOG_MAX_ARGUMENTS_SIZE - size_ - 1 - sizeof(uint16_t)));
+
+        data_[size_] = BINARY_LOG_STRING;
+        std::memcpy(data_ + size_ + 1, &length, sizeof(length));
+        std::memcpy(data_ + size_ + 1 + sizeof(length), value, length);
+        size_ += 1 + sizeof(length) + length;
+    }
+
+    uint8_t data_[BINARY_LOG_MAX_ARGUMENTS_SIZE];
+
+    uint32_t size_ = 0;
+};
+
+//! Counters of a \c BinaryLog .
+struct BinaryLogStatistics
+{
+    //! Threads that have logged entries.
+    uint64_t threads = 0;
+
+    //! Entries written in the file.
+    uint64_t written = 0;
+
+    //! Entries dropped because the buffer of their thread was full.
+    uint64_t dropped = 0;
+
+    //! Bytes written in the file.
+    uint64_t bytes = 0;
+};
+
+/**
+ * Log that records the entries of the binary log macros without formatting them.
+ *
+ * Each thread copies the id of the call site and the raw arguments of its entries in a buffer of its own, without
+ * locks, and the entries that do not fit are dropped. A thread of the log writes the buffers in a file periodically,
+ * and \c decode turns the file back into text offline.
+ *
+ * There is at most one binary log in the process, that must outlive every thread that logs in it. When there is
+ * none, the macros format their entries and queue them in \c utils::Log , as the regular log macros.
+ */
+class BinaryLog
+{
+public:
+
+    /**
+     * @brief Create the file of the log in the output directory and start writing the entries of every thread.
+     *
+     * @throw \c InitializationException if there is already a binary log or the file cannot be created.
+     */
+    DDSROUTER_CORE_DllAPI BinaryLog(
+            const BinaryLogConfiguration& configuration);
+
+    //! Write the entries left and close the file.
+    DDSROUTER_CORE_DllAPI ~BinaryLog();
+
+    /**
+     * @brief Log an entry of \c site , unless the verbosity of \c utils::Log filters it out or the log throttle
+     * suppresses it.
+     *
+     * Use the \c logBinary macros instead.
+     */
+    template <typename ... Args>
+    static void log(
+            LogSite& site,
+            const Args& ... args) noexcept;
+
+    //! Write the entries buffered by every thread in the file now.
+    DDSROUTER_CORE_DllAPI void flush();
+
+    //! Path of the file of the log.
+    DDSROUTER_CORE_DllAPI const std::string& path() const noexcept;
+
+    DDSROUTER_CORE_DllAPI BinaryLogStatistics statistics() const;
+
+    /**
+     * @brief Write the entries of a binary log as text, one per line.
+     *
+     * @return entries written.
+     *
+     * @throw \c InitializationException if \c input is not a binary log of a supported version.
+     */
+    DDSROUTER_CORE_DllAPI static uint64_t decode(
+            std::istream& input,
+            std::ostream& output);
+
+    //! Replace each \c {} in \c format by the next argument. Placeholders without argument are kept.
+    DDSROUTER_CORE_DllAPI static std::string format_message(
+            const char* format,
+            const std::vector<std::string>& arguments);
+
+protected:
+
+    //! Buffer of the entries of a thread. Only that thread writes in it, and only the log thread reads it.
+    struct ThreadBuffer
+    {
+        std::thread::id thread;
+
+        //! Index of the thread in the entries.
+        uint32_t index = 0;
+
+        std::unique_ptr<uint8_t[]> data;
+
+        //! Bytes written by the thread.
+        alignas(64) std::atomic<uint64_t> head{0};
+
+        //! Bytes written in the file.
+        alignas(64) std::atomic<uint64_t> tail{0};
+    };
+
+    //! Whether the verbosity of \c utils::Log lets entries of \c kind through.
+    DDSROUTER_CORE_DllAPI static bool accepts_(
+            BinaryLogKind kind) noexcept;
+
+    //! Binary log of the process. nullptr if there is none.
+    DDSROUTER_CORE_DllAPI static BinaryLog* active_() noexcept;
+
+    //! Copy an entry in the buffer of the calling thread.
+    DDSROUTER_CORE_DllAPI void push_(
+            LogSite& site,
+            const BinaryLogArguments& arguments) noexcept;
+
+    //! Format an entry and queue it in \c utils::Log .
+    DDSROUTER_CORE_DllAPI static void queue_(
+            const LogSite& site,
+            const std::vector<std::string>& arguments) noexcept;
+
+    //! Argument streamed into a string.
+    template <typename T>
+    static std::string to_string_(
+            const T& value);
+
+    //! Give \c site an id if it has none yet.
+    static uint32_t register_site_(
+            LogSite& site) noexcept;
+
+    //! Buffer of the calling thread, created with its first entry.
+    ThreadBuffer* thread_buffer_() noexcept;
+
+    //! Write the entries buffered by every thread in the file. Guarded by \c file_mutex_ .
+    void write_nts_();
+
+    //! Write the \c BINARY_LOG_SITE record of \c site_id if it is not in the file yet. Guarded by \c file_mutex_ .
+    void declare_site_nts_(
+            uint32_t site_id);
+
+    //! Routine of the log thread.
+    void routine_();
+
+    const BinaryLogConfiguration configuration_;
+
+    //! Bytes of each buffer, multiple of \c BINARY_LOG_ALIGNMENT .
+    const uint64_t capacity_;
+
+    //! Distinguishes the logs in the buffers cached by each thread.
+    const uint64_t id_;
+
+    std::string path_;
+
+    //! Guards the buffers. Never taken to log entries, except the first one of each thread.
+    mutable std::mutex mutex_;
+
+    std::vector<std::unique_ptr<ThreadBuffer>> buffers_;
+
+    //! Guards the file and the sites declared in it.
+    mutable std::mutex file_mutex_;
+
+    std::ofstream file_;
+
+    //! Whether each site, by id, has been declared in the file.
+    std::vector<bool> declared_sites_;
+
+    uint64_t written_ = 0;
+
+    uint64_t bytes_ = 0;
+
+    std::atomic<uint64_t> dropped_{0};
+
+    //! Wakes up the log thread to stop.
+    std::mutex stop_mutex_;
+    std::condition_variable stop_cv_;
+    bool stop_ = false;
+
+    std::thread thread_;
+};
+
+template <typename T>
+void BinaryLogArguments::add(
+        const T& value) noexcept
+{
+    using Type = typename std::decay<T>::type;
+
+    if constexpr (std::is_same<Type, bool>::value)
+    {
+        const uint8_t boolean = value ? 1 : 0;
+        add_value_(BINARY_LOG_BOOLEAN, &boolean, sizeof(boolean));
+    }
+    else if constexpr (std::is_same<Type, char>::value)
+    {
+        add_string_(&value, 1);
+    }
+    else if constexpr (std::is_integral<Type>::value && std::is_signed<Type>::value)
+    {
+        const int64_t number = value;
+        add_value_(BINARY_LOG_SIGNED, &number, sizeof(number));
+    }
+    else if constexpr (std::is_integral<Type>::value)
+    {
+        const uint64_t number = value;
+        add_value_(BINARY_LOG_UNSIGNED, &number, sizeof(number));
+    }
+    else if constexpr (std::is_floating_point<Type>::value)
+    {
+        const double number = value;
+        add_value_(BINARY_LOG_FLOATING, &number, sizeof(number));
+    }
+    else if constexpr (std::is_convertible<const T&, const char*>::value)
+    {
+        const char* string = value;
+        add_string_(string ? string : "(null)", string ? std::strlen(string) : 6);
+    }
+    else if constexpr (std::is_same<Type, std::string>::value)
+    {
+        add_string_(value.data(), value.size());
+    }
+    else
+    {
+        // Slow path for the types without a raw encoding, as the regular log macros
+        try
+        {
+            std::ostringstream stream;
+            stream << value;
+            const std::string string = stream.str();
+            add_string_(string.data(), string.size());
+        }
+        catch (...)
+        {
+            add_string_("?", 1);
+        }
+    }
+}
+
+template <typename ... Args>
+void BinaryLog::log(
+        LogSite& site,
+        const Args& ... args) noexcept
+{
+    if (!accepts_(site.kind) || !LogThrottle::accepts(site))
+    {
+        return;
+    }
+
+    BinaryLog* binary_log = active_();
+    if (binary_log)
+    {
+        BinaryLogArguments arguments;
+        (arguments.add(args), ...);
+        binary_log->push_(site, arguments);
+        return;
+    }
+
+    try
+    {
+        queue_(site, {to_string_(args)...});
+    }
+    catch (...)
+    {
+        // Logging must never fail on the hot path
+    }
+}
+
+template <typename T>
+std::string BinaryLog::to_string_(
+        const T& value)
+{
+    using Type = typename std::decay<T>::type;
+
+    if constexpr (std::is_same<Type, bool>::value)
+    {
+        // Same as the binary log decoded
+        return value ? "true" : "false";
+    }
+    else
+    {
+        std::ostringstream stream;
+        stream << value;
+        return stream.str();
+    }
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
+
+/**
+ * Macros to log on the hot paths. The message is a format where each \c {} is replaced by an argument:
+ *
+ * \code
+ * logBinaryWarning(DDSROUTER_IPC, "Message of {} bytes dropped in topic {}.", size, topic_name);
+ * \endcode
+ *
+ * As the regular log macros, debug entries are only logged in debug builds.
+ */
+#define DDSROUTER_BINARY_LOG_(category, kind, format, ...)                                          \
+    do                                                                                              \
+    {                                                                                               \
+        static eprosima::ddsrouter::core::LogSite ddsrouter_binary_log_site_{                       \
+            #category, kind, format, __FILE__, __LINE__};                                           \
+        eprosima::ddsrouter::core::BinaryLog::log(ddsrouter_binary_log_site_, ## __VA_ARGS__);      \
+    } while (0)
+
+#define logBinaryError(category, format, ...) \
+    DDSROUTER_BINARY_LOG_(category, eprosima::ddsrouter::core::BinaryLogKind::error, format, ## __VA_ARGS__)
+
+#define logBinaryWarning(category, format, ...) \
+    DDSROUTER_BINARY_LOG_(category, eprosima::ddsrouter::core::BinaryLogKind::warning, format, ## __VA_ARGS__)
+
+#define logBinaryInfo(category, format, ...) \
+    DDSROUTER_BINARY_LOG_(category, eprosima::ddsrouter::core::BinaryLogKind::info, format, ## __VA_ARGS__)
+
+#if !defined(NDEBUG)
+#define logBinaryDebug(category, format, ...) logBinaryInfo(category, format, ## __VA_ARGS__)
+#else
+#define logBinaryDebug(category, format, ...)
+#endif // !defined(NDEBUG)
@@ -0,0 +1,132 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * On disk format of the binary log.
+ *
+ * A binary log is a \c BinaryLogFileHeader followed by records, each one a \c BinaryLogRecordHeader followed by its
+ * body and padded to \c BINARY_LOG_ALIGNMENT . A header of type \c BINARY_LOG_END (all zeros) or the end of the file
+ * mark the end of the log, so a log that has not been closed properly can still be decoded.
+ *
+ * Every entry references the call site that logged it. The call site, with the format of the message, is declared
+ * once with a \c BINARY_LOG_SITE record before the first entry that references it. An entry only carries the raw
+ * arguments of the message, each one a \c BinaryLogArgumentType byte followed by its value:
+ *  - Integers and floating point numbers as 8 bytes.
+ *  - Booleans as 1 byte.
+ *  - Strings, and any other argument once streamed, as a 2 bytes size followed by the characters.
+ *
+ * All integers are stored in the byte order of the host that logs.
+ */
+
+//! Magic number at the beginning of every binary log.
+constexpr char BINARY_LOG_MAGIC[8] = {'D', 'D', 'S', 'R', 'L', 'O', 'G', '1'};
+
+//! Version of the format.
+constexpr uint32_t BINARY_LOG_FORMAT_VERSION = 1;
+
+//! Extension of the binary logs.
+constexpr const char* BINARY_LOG_EXTENSION = ".ddslog";
+
+//! Alignment of every record inside a binary log.
+constexpr uint64_t BINARY_LOG_ALIGNMENT = 8;
+
+//! Maximum size of the arguments of an entry. The arguments that do not fit are discarded.
+constexpr uint64_t BINARY_LOG_MAX_ARGUMENTS_SIZE = 1024;
+
+//! Kinds of record in a binary log.
+enum BinaryLogRecordType : uint16_t
+{
+    BINARY_LOG_END = 0,
+    BINARY_LOG_SITE = 1,
+    BINARY_LOG_ENTRY = 2,
+    //! Space skipped at the end of the buffer of a thread. Never written in a binary log.
+    BINARY_LOG_PADDING = 3,
+};
+
+//! Kinds of argument of an entry.
+enum BinaryLogArgumentType : uint8_t
+{
+    BINARY_LOG_SIGNED = 'i',
+    BINARY_LOG_UNSIGNED = 'u',
+    BINARY_LOG_FLOATING = 'f',
+    BINARY_LOG_BOOLEAN = 'b',
+    BINARY_LOG_STRING = 's',
+};
+
+//! Header of the binary log.
+struct BinaryLogFileHeader
+{
+    char magic[8];
+    uint32_t version;
+    uint32_t reserved;
+    //! Creation time of the file in nanoseconds since epoch.
+    int64_t creation_time;
+};
+
+//! Header of every record in a binary log.
+struct BinaryLogRecordHeader
+{
+    //! Size of the body, without this header nor the padding.
+    uint32_t size;
+    uint16_t type;
+    uint16_t reserved;
+};
+
+//! Body of a \c BINARY_LOG_SITE record. It is followed by the category, the format and the file.
+struct BinaryLogSite
+{
+    uint32_t site_id;
+    //! \c BinaryLogKind of the entries of the site.
+    uint8_t kind;
+    uint8_t reserved[3];
+    uint32_t line;
+    uint16_t category_size;
+    uint16_t format_size;
+    uint16_t file_size;
+    uint16_t reserved_2;
+};
+
+//! Body of a \c BINARY_LOG_ENTRY record. It is followed by the arguments.
+struct BinaryLogEntry
+{
+    //! Time of the entry in nanoseconds since epoch.
+    int64_t timestamp;
+    uint32_t site_id;
+    //! Index of the thread that logged the entry, from 1.
+    uint32_t thread;
+};
+
+static_assert(sizeof(BinaryLogFileHeader) == 24, "Unexpected padding in BinaryLogFileHeader");
+static_assert(sizeof(BinaryLogRecordHeader) == 8, "Unexpected padding in BinaryLogRecordHeader");
+static_assert(sizeof(BinaryLogSite) == 20, "Unexpected padding in BinaryLogSite");
+static_assert(sizeof(BinaryLogEntry) == 16, "Unexpected padding in BinaryLogEntry");
+
+//! Space that a record with a body of \c body_size bytes takes in a binary log.
+constexpr uint64_t binary_log_aligned_size(
+        uint64_t body_size) noexcept
+{
+    return (sizeof(BinaryLogRecordHeader) + body_size + BINARY_LOG_ALIGNMENT - 1) & ~(BINARY_LOG_ALIGNMENT - 1);
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,71 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+//! Kinds of log entry, with the same values as \c utils::Log::Kind .
+enum class BinaryLogKind : uint8_t
+{
+    error = 0,
+    warning = 1,
+    info = 2,
+};
+
+/**
+ * Call site of a binary log macro.
+ *
+ * Each macro keeps a static site, registered with the first entry it logs.
+ */
+struct LogSite
+{
+    const char* category;
+
+    BinaryLogKind kind;
+
+    //! Message of the entries, where each \c {} is replaced by an argument.
+    const char* format;
+
+    const char* file;
+
+    uint32_t line;
+
+    //! Id of the site in the process. 0 until it is registered.
+    std::atomic<uint32_t> id{0};
+
+    //! Log throttle whose limit is cached in \c limit . 0 until a throttle limits the site.
+    std::atomic<uint64_t> throttle{0};
+
+    //! Entries let through in each window of the log throttle.
+    std::atomic<uint32_t> limit{0};
+
+    //! Start of the current window of the log throttle, in nanoseconds.
+    std::atomic<int64_t> window_start{0};
+
+    //! Entries logged in the current window of the log throttle, suppressed included.
+    std::atomic<uint32_t> window_entries{0};
+
+    //! Entries suppressed by the log throttle and not reported yet.
+    std::atomic<uint64_t> suppressed{0};
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,126 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <ddsrouter_core/configuration/LogThrottleConfiguration.hpp>
+#include <ddsrouter_core/library/library_dll.h>
+#include <ddsrouter_core/logging/LogSite.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+//! Counters of the log throttle.
+struct LogThrottleStatistics
+{
+    //! Entries suppressed for exceeding the limit of their site.
+    uint64_t suppressed = 0;
+
+    //! Reports of the suppressed entries logged, one per site and window with entries suppressed.
+    uint64_t reports = 0;
+};
+
+/**
+ * Limits the entries logged by each call site of the \c logBinary macros, so an error storm does not flood the log.
+ *
+ * Each site lets through up to the limit of the first rule matching its category in each window, and suppresses
+ * the rest. The entries suppressed are reported once per window and site, as repeated N times, with the category,
+ * kind, file and line of the site. Sites whose category matches no rule are not limited.
+ *
+ * There is at most one log throttle in the process, active while it exists.
+ */
+class LogThrottle
+{
+public:
+
+    /**
+     * @brief Start limiting the entries of the sites matching \c rules .
+     *
+     * @param [in] rules : limits of the sites, by category. The first matching one applies.
+     * @param [in] window : milliseconds of each window, where the limits are per second.
+     *
+     * @throw \c InitializationException if there is already a log throttle in the process.
+     */
+    DDSROUTER_CORE_DllAPI LogThrottle(
+            const std::vector<LogThrottleConfiguration>& rules,
+            unsigned int window = 1000);
+
+    //! Stop limiting, wait for the threads checking an entry with it, and report the entries suppressed left.
+    DDSROUTER_CORE_DllAPI ~LogThrottle();
+
+    /**
+     * @brief Whether an entry of \c site must be logged.
+     *
+     * Lock free, except for the first entry suppressed of a site in each window.
+     *
+     * @return true if there is no log throttle active or \c site is within its limit.
+     */
+    DDSROUTER_CORE_DllAPI static bool accepts(
+            LogSite& site) noexcept;
+
+    //! Log the reports of the entries suppressed now, instead of at the end of the window.
+    DDSROUTER_CORE_DllAPI void report() noexcept;
+
+    DDSROUTER_CORE_DllAPI LogThrottleStatistics statistics() const noexcept;
+
+protected:
+
+    //! Whether an entry of \c site is within its limit, counting it as suppressed otherwise.
+    bool accepts_(
+            LogSite& site) noexcept;
+
+    //! Entries per window of \c site , cached in the site. 0 means unlimited.
+    uint32_t limit_(
+            LogSite& site) noexcept;
+
+    //! Routine of the report thread.
+    void routine_();
+
+    const std::vector<LogThrottleConfiguration> rules_;
+
+    //! Nanoseconds of each window.
+    const int64_t window_;
+
+    //! Distinguishes the throttles in the limits cached by each site.
+    const uint64_t id_;
+
+    //! Guards \c pending_ . Only taken with the first entry suppressed of a site in each window.
+    std::mutex pending_mutex_;
+
+    //! Sites with entries suppressed since their last report.
+    std::vector<LogSite*> pending_;
+
+    std::atomic<uint64_t> suppressed_{0};
+
+    std::atomic<uint64_t> reports_{0};
+
+    //! Wakes up the report thread to stop.
+    std::mutex stop_mutex_;
+    std::condition_variable stop_cv_;
+    bool stop_ = false;
+
+    std::thread thread_;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,89 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include <cpp_utils/event/PeriodicEventHandler.hpp>
+
+#include <ddsrouter_core/configuration/MetricsExporterConfiguration.hpp>
+#include <ddsrouter_core/library/library_dll.h>
+#include <ddsrouter_core/monitoring/MetricsHttpServer.hpp>
+#include <ddsrouter_core/monitoring/RouterMetrics.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Serves the metrics of the DDS Router over HTTP in OpenMetrics format, to be scraped by Prometheus.
+ *
+ * The metrics are gathered and serialized once every period, and every scrape sends the last snapshot as is, so the
+ * cost of a scrape does not depend on the number of topics, and scraping never touches the data path.
+ */
+class MetricsExporter
+{
+public:
+
+    //! Gathers the metrics of the DDS Router.
+    using MetricsProvider = std::function<RouterMetrics()>;
+
+    /**
+     * @brief Start serving the metrics gathered by \c metrics .
+     *
+     * @param [in] configuration : address, port and period of the exporter.
+     * @param [in] metrics : gatherer of the metrics, called once every period.
+     *
+     * @throw \c InitializationException if the exporter can not listen in the address and port configured, or out of
+     * Linux.
+     */
+    DDSROUTER_CORE_DllAPI MetricsExporter(
+            const MetricsExporterConfiguration& configuration,
+            MetricsProvider metrics);
+
+    DDSROUTER_CORE_DllAPI ~MetricsExporter();
+
+    //! Gather and serialize the metrics, replacing the snapshot served.
+    DDSROUTER_CORE_DllAPI void refresh();
+
+    //! Last snapshot of the metrics, in OpenMetrics format.
+    DDSROUTER_CORE_DllAPI std::shared_ptr<const std::string> snapshot() const;
+
+    //! Port where the metrics are served.
+    DDSROUTER_CORE_DllAPI uint16_t port() const noexcept;
+
+    //! Serialize \c metrics in OpenMetrics text format, adding up the slots and rate limits with the same labels.
+    DDSROUTER_CORE_DllAPI static std::string serialize(
+            const RouterMetrics& metrics);
+
+protected:
+
+    const MetricsProvider metrics_;
+
+    mutable std::mutex mutex_;
+
+    std::shared_ptr<const std::string> snapshot_;
+
+    std::unique_ptr<MetricsHttpServer> server_;
+
+    std::unique_ptr<utils::event::PeriodicEventHandler> refresher_;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
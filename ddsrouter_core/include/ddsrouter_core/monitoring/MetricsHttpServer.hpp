@@ -0,0 +1,88 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include <ddsrouter_core/library/library_dll.h>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Minimal HTTP/1.1 server that answers \c GET \c /metrics with a body produced elsewhere.
+ *
+ * Requests are served one at a time from a single thread, and every connection is closed after its response, which
+ * is all a metrics scraper needs. Any other path is answered with 404, and any other method with 405.
+ */
+class MetricsHttpServer
+{
+public:
+
+    //! Produces the body of each response. Called from the thread of the server.
+    using BodyProvider = std::function<std::shared_ptr<const std::string>()>;
+
+    /**
+     * @brief Listen in \c address and \c port , and start serving.
+     *
+     * @param [in] address : IPv4 address to listen in.
+     * @param [in] port : TCP port to listen in. 0 to let the system choose one.
+     * @param [in] body : producer of the body of the responses.
+     *
+     * @throw \c InitializationException if the server can not listen in \c address and \c port , or out of Linux.
+     */
+    DDSROUTER_CORE_DllAPI MetricsHttpServer(
+            const std::string& address,
+            uint16_t port,
+            BodyProvider body);
+
+    //! Stop serving and close the socket.
+    DDSROUTER_CORE_DllAPI ~MetricsHttpServer();
+
+    //! Port where the server listens.
+    DDSROUTER_CORE_DllAPI uint16_t port() const noexcept;
+
+    //! Content type of the responses to \c /metrics .
+    static constexpr const char* CONTENT_TYPE = "application/openmetrics-text; version=1.0.0; charset=utf-8";
+
+protected:
+
+    //! Accept connections until the server is destroyed.
+    void serve_() noexcept;
+
+    //! Read the request of a connection and answer it.
+    void handle_(
+            int connection) noexcept;
+
+    const BodyProvider body_;
+
+    int fd_;
+
+    uint16_t port_;
+
+    std::atomic<bool> stop_;
+
+    std::thread thread_;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
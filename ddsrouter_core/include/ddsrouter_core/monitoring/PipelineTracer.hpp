@@ -0,0 +1,231 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <ddspipe_core/types/participant/ParticipantId.hpp>
+#include <ddspipe_core/types/topic/dds/DdsTopic.hpp>
+#include <ddspipe_core/types/topic/filter/WildcardDdsFilterTopic.hpp>
+
+#include <ddsrouter_core/configuration/TracingConfiguration.hpp>
+#include <ddsrouter_core/library/library_dll.h>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+//! Stages of a sample through the DDS Router.
+enum class TraceStage : uint8_t
+{
+    //! The reader notified that it has data.
+    notification,
+
+    //! The slot of the reader was queued in the thread pool.
+    enqueue,
+
+    //! A thread of the pool started taking the data of the reader.
+    dequeue,
+
+    //! The sample was taken from the reader, copying its payload.
+    payload_copy,
+
+    //! A writer wrote the sample.
+    write,
+};
+
+//! Name of a stage in the traces.
+DDSROUTER_CORE_DllAPI const char* to_string(
+        TraceStage stage) noexcept;
+
+/**
+ * Reader or writer traced by a \c PipelineTracer .
+ */
+struct TracedEndpoint
+{
+    //! Whether the topic of the endpoint is traced. Changes when the topics traced are reloaded.
+    std::atomic<bool> enabled{false};
+
+    //! Participant of the endpoint.
+    ddspipe::core::types::ParticipantId participant_id;
+
+    //! Topic of the endpoint.
+    ddspipe::core::types::DdsTopic topic;
+
+    //! Index of the endpoint in its tracer.
+    uint32_t index = 0;
+
+    //! Samples taken by the endpoint, if it is a reader. Only the thread of its slot takes them.
+    std::atomic<uint32_t> samples{0};
+};
+
+//! Counters of the events of a \c PipelineTracer .
+struct TraceStatistics
+{
+    //! Threads that have recorded events.
+    uint64_t threads = 0;
+
+    //! Events recorded.
+    uint64_t recorded = 0;
+
+    //! Events overwritten by newer events of their thread.
+    uint64_t overwritten = 0;
+};
+
+/**
+ * Tracer of the stages of the samples of some topics through the DDS Router, dumped as Chrome trace events.
+ *
+ * Each thread records its events in a ring buffer of its own, without locks, and the oldest events are overwritten
+ * once it is full. Dumping copies every buffer while the threads keep recording, discarding the events overwritten
+ * meanwhile.
+ *
+ * The endpoints of the topics not traced only check a flag, so the topics traced can be changed at any time.
+ */
+class PipelineTracer
+{
+public:
+
+    DDSROUTER_CORE_DllAPI PipelineTracer(
+            const TracingConfiguration& configuration);
+
+    /**
+     * @brief Register a reader or writer of \c topic in \c participant_id .
+     *
+     * @return endpoint to record its events, enabled if its topic is traced.
+     */
+    DDSROUTER_CORE_DllAPI std::shared_ptr<TracedEndpoint> register_endpoint(
+            const ddspipe::core::types::ParticipantId& participant_id,
+            const ddspipe::core::types::DdsTopic& topic);
+
+    //! Trace the endpoints of the topics matching \c topics , and no other.
+    DDSROUTER_CORE_DllAPI void reload(
+            const std::vector<ddspipe::core::types::WildcardDdsFilterTopic>& topics);
+
+    /**
+     * @brief Record a stage of \c endpoint in the buffer of the calling thread.
+     *
+     * @param [in] begin : time when the stage began, as returned by \c now .
+     * @param [in] end : time when the stage ended. Same as \c begin for stages that are instants.
+     * @param [in] source : reader of the sample. nullptr if there is none.
+     * @param [in] sample : number of the sample in \c source .
+     */
+    DDSROUTER_CORE_DllAPI void record(
+            const TracedEndpoint& endpoint,
+            TraceStage stage,
+            int64_t begin,
+            int64_t end,
+            const TracedEndpoint* source = nullptr,
+            uint32_t sample = 0) noexcept;
+
+    //! Write every event kept as a Chrome trace (JSON object format).
+    DDSROUTER_CORE_DllAPI void dump(
+            std::ostream& output) const;
+
+    /**
+     * @brief Write every event kept in a new file in the output directory.
+     *
+     * @return path of the file written, or empty if it could not be written.
+     */
+    DDSROUTER_CORE_DllAPI std::string dump() const;
+
+    DDSROUTER_CORE_DllAPI TraceStatistics statistics() const;
+
+    //! Current time in nanoseconds.
+    DDSROUTER_CORE_DllAPI static int64_t now() noexcept;
+
+    /**
+     * @brief Set the sample that the calling thread is forwarding, for the writers to record it.
+     *
+     * @param [in] source : reader of the sample. nullptr if the thread is not forwarding a sample.
+     * @param [in] sample : number of the sample in \c source .
+     */
+    DDSROUTER_CORE_DllAPI static void set_current_sample(
+            const TracedEndpoint* source,
+            uint32_t sample) noexcept;
+
+    //! Reader of the sample that the calling thread is forwarding. nullptr if none.
+    DDSROUTER_CORE_DllAPI static const TracedEndpoint* current_source() noexcept;
+
+    //! Number of the sample that the calling thread is forwarding.
+    DDSROUTER_CORE_DllAPI static uint32_t current_sample() noexcept;
+
+protected:
+
+    /**
+     * Event in a ring buffer.
+     *
+     * Fields are atomic so they can be read while they are overwritten, in which case the event is discarded.
+     */
+    struct Event
+    {
+        std::atomic<int64_t> begin{0};
+        std::atomic<int64_t> end{0};
+
+        //! Stage in the highest 32 bits, index of the endpoint in the lowest.
+        std::atomic<uint64_t> stage_endpoint{0};
+
+        //! Index of the source plus 1 in the highest 32 bits (0 if none), sample in the lowest.
+        std::atomic<uint64_t> source_sample{0};
+    };
+
+    //! Ring buffer of the events of a thread. Only that thread writes in it.
+    struct ThreadBuffer
+    {
+        std::thread::id thread;
+
+        //! Index of the thread in the traces.
+        uint32_t index = 0;
+
+        std::unique_ptr<Event[]> events;
+
+        //! Events whose writing has started.
+        alignas(64) std::atomic<uint64_t> reserved{0};
+
+        //! Events written.
+        std::atomic<uint64_t> written{0};
+    };
+
+    //! Buffer of the calling thread, created with its first event.
+    ThreadBuffer* thread_buffer_() noexcept;
+
+    //! Whether \c topic is traced. Guarded by \c mutex_ .
+    bool traced_nts_(
+            const ddspipe::core::types::DdsTopic& topic) const noexcept;
+
+    const TracingConfiguration configuration_;
+
+    //! Distinguishes the tracers in the buffers cached by each thread.
+    const uint64_t id_;
+
+    //! Guards the endpoints, buffers and topics traced. Never taken to record events.
+    mutable std::mutex mutex_;
+
+    std::vector<std::shared_ptr<TracedEndpoint>> endpoints_;
+
+    std::vector<std::unique_ptr<ThreadBuffer>> buffers_;
+
+    std::vector<ddspipe::core::types::WildcardDdsFilterTopic> topics_;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
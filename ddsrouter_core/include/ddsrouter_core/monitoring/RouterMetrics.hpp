@@ -0,0 +1,57 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <map>
+#include <vector>
+
+#include <ddspipe_core/types/participant/ParticipantId.hpp>
+
+#include <ddsrouter_core/efficiency/concurrency/ConcurrencyGate.hpp>
+#include <ddsrouter_core/efficiency/instrumentation/ThreadPoolInstrumentation.hpp>
+#include <ddsrouter_core/efficiency/payload/PreallocatedPayloadPool.hpp>
+#include <ddsrouter_core/efficiency/rate_limit/RateLimiter.hpp>
+#include <ddsrouter_core/participants/sink/SinkStatistics.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Snapshot of every measure of the DDS Router.
+ *
+ * Measures of the features not configured are left empty or 0.
+ */
+struct RouterMetrics
+{
+    //! Messages, bytes, queue latency and task time of each reader.
+    std::vector<SlotStatistics> slots;
+
+    //! Messages and bytes accepted and dropped by each rate limiter.
+    std::vector<RateLimitStatistics> rate_limits;
+
+    //! Messages, bytes and latencies received by each Sink Participant.
+    std::map<ddspipe::core::types::ParticipantId, SinkReport> sinks;
+
+    //! Usage of the preallocated payload pool.
+    PayloadPoolStatistics payload_pool;
+
+    //! Threads forwarding data at once.
+    ConcurrencyStatistics concurrency;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
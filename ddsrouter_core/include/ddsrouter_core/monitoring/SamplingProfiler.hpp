@@ -0,0 +1,152 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include <ddspipe_core/types/participant/ParticipantId.hpp>
+
+#include <ddsrouter_core/configuration/ProfilerConfiguration.hpp>
+#include <ddsrouter_core/library/library_dll.h>
+#include <ddsrouter_core/monitoring/SignalTrigger.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+//! Counters of the sessions of the sampling profiler.
+struct ProfilerStatistics
+{
+    //! File of the last profile written. Empty if none.
+    std::string last_profile;
+
+
+    //! Profiling sessions completed.
+    uint64_t sessions = 0;
+
+    //! Stacks sampled in every session.
+    uint64_t samples = 0;
+
+    //! Stacks not sampled because the memory of their session was full.
+    uint64_t dropped = 0;
+};
+
+/**
+ * Sampling profiler of the CPU time of the DDS Router, to profile a router in production without attaching an
+ * external profiler.
+ *
+ * A profiling session samples the stack of the thread running every time the process consumes 1 / \c frequency
+ * seconds of CPU time, for the \c duration configured. Sampling only copies the return addresses of the stack to
+ * memory reserved for the session, and the symbols are resolved once the session is over, so the overhead while
+ * profiling is that of the signals alone.
+ *
+ * Each session writes a file with the folded stacks, one line per different stack and its number of samples, ready
+ * to render a flame graph. Threads forwarding the data of a reader tag their samples with its participant and topic
+ * (see \c tag_thread ), which are the root frames of their stacks.
+ *
+ * Only one profiler may exist at a time, as the profiling timer and signal belong to the process.
+ * Profiling is only supported in Linux.
+ */
+class SamplingProfiler
+{
+public:
+
+    /**
+     * @brief Create a profiler, ready to start sessions with \c profile or \c trigger .
+     *
+     * @throw \c InitializationException if another profiler exists.
+     */
+    DDSROUTER_CORE_DllAPI SamplingProfiler(
+            const ProfilerConfiguration& configuration);
+
+    //! Stop the session running, if any, and the signal handlers.
+    DDSROUTER_CORE_DllAPI ~SamplingProfiler();
+
+    /**
+     * @brief Profile the process for the duration configured, and write its folded stacks.
+     *
+     * Blocks until the session is over. Sessions requested at once run one after the other.
+     *
+     * @return path of the file written, or empty if the session could not run.
+     */
+    DDSROUTER_CORE_DllAPI std::string profile();
+
+    /**
+     * @brief Start a profiling session in the background.
+     *
+     * Requests while a session is running in the background are ignored.
+     * Safe to call from a signal handler.
+     */
+    DDSROUTER_CORE_DllAPI void trigger() noexcept;
+
+    /**
+     * @brief Start a profiling session in the background whenever the process receives \c signal (e.g. SIGUSR2).
+     *
+     * @throw \c InitializationException if the signal can not be handled.
+     */
+    DDSROUTER_CORE_DllAPI void trigger_on_signal(
+            int signal);
+
+    DDSROUTER_CORE_DllAPI ProfilerStatistics statistics() const noexcept;
+
+    /**
+     * @brief Tag the samples of the calling thread with \c tag , until it is tagged again or untagged.
+     *
+     * \c tag must remain valid while the thread is tagged with it. It is copied in every sample, and truncated to
+     * \c MAX_TAG_SIZE characters.
+     */
+    DDSROUTER_CORE_DllAPI static void tag_thread(
+            const char* tag) noexcept;
+
+    //! Stop tagging the samples of the calling thread.
+    DDSROUTER_CORE_DllAPI static void untag_thread() noexcept;
+
+    //! Tag of the data of \c topic in \c participant_id , made of the root frames of the folded stacks.
+    DDSROUTER_CORE_DllAPI static std::string tag(
+            const ddspipe::core::types::ParticipantId& participant_id,
+            const std::string& topic);
+
+    //! Maximum characters of a tag.
+    static constexpr std::size_t MAX_TAG_SIZE = 127;
+
+protected:
+
+    const ProfilerConfiguration configuration_;
+
+    //! Guards \c stop_ and \c statistics_ .
+    mutable std::mutex mutex_;
+
+    //! Notifies the session running to stop.
+    std::condition_variable cv_;
+
+    //! Whether the profiler is being destroyed. Guarded by \c mutex_ .
+    bool stop_;
+
+    ProfilerStatistics statistics_;
+
+    //! Serializes the sessions.
+    std::mutex session_mutex_;
+
+    //! Runs the sessions requested with \c trigger in the background.
+    std::unique_ptr<SignalTrigger> trigger_;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,93 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <thread>
+
+#if defined(__linux__)
+#include <semaphore.h>
+#include <signal.h>
+#endif // defined(__linux__)
+
+#include <ddsrouter_core/library/library_dll.h>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Runs a callback in a thread of its own whenever it is triggered, e.g. by a signal sent to the process.
+ *
+ * Triggers while the callback is pending or running are ignored.
+ * Triggering is only supported in Linux.
+ */
+class SignalTrigger
+{
+public:
+
+    //! Create a trigger of \c callback , and the thread that runs it.
+    DDSROUTER_CORE_DllAPI SignalTrigger(
+            std::function<void()> callback);
+
+    //! Stop handling the signal, if any, restoring its previous handler, and wait for the callback if it is running.
+    DDSROUTER_CORE_DllAPI ~SignalTrigger();
+
+    /**
+     * @brief Run the callback in the background.
+     *
+     * Safe to call from a signal handler.
+     */
+    DDSROUTER_CORE_DllAPI void trigger() noexcept;
+
+    /**
+     * @brief Run the callback whenever the process receives \c signal (e.g. SIGUSR1).
+     *
+     * @throw \c InitializationException if the signal can not be handled, or another trigger already handles it.
+     */
+    DDSROUTER_CORE_DllAPI void trigger_on_signal(
+            int signal);
+
+protected:
+
+    //! Routine of the thread that runs the callback.
+    void routine_() noexcept;
+
+    std::function<void()> callback_;
+
+    //! Whether the trigger is being destroyed.
+    std::atomic<bool> stop_;
+
+    //! Whether the callback has been triggered and is not over yet.
+    std::atomic<bool> triggered_;
+
+    //! Signal that triggers the callback. 0 if none.
+    int signal_;
+
+#if defined(__linux__)
+    //! Handling of \c signal_ before this trigger, restored when it is destroyed.
+    struct sigaction previous_;
+
+    //! Posted by \c trigger , as it may be called from a signal handler.
+    sem_t semaphore_;
+#endif // defined(__linux__)
+
+    std::thread thread_;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
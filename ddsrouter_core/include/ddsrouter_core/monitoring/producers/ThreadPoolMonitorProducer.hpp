@@ -0,0 +1,82 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <cpp_utils/event/PeriodicEventHandler.hpp>
+#include <cpp_utils/time/time_utils.hpp>
+
+#include <ddsrouter_core/efficiency/instrumentation/ThreadPoolInstrumentation.hpp>
+#include <ddsrouter_core/library/library_dll.h>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Monitor producer of the slots of the thread pool, next to the topics producer of the DDS Pipe monitor.
+ *
+ * Every period it produces the counters of each slot relative to the previous period, and consumes them by logging
+ * them under the \c MONITOR_DATA log filter. Maximum values are kept since the slot was registered.
+ */
+class ThreadPoolMonitorProducer
+{
+public:
+
+    /**
+     * @brief Construct a new ThreadPoolMonitorProducer .
+     *
+     * @param [in] instrumentation : counters of the slots of the thread pool.
+     * @param [in] period : time in milliseconds between productions. 0 to only produce when calling \c produce .
+     */
+    DDSROUTER_CORE_DllAPI ThreadPoolMonitorProducer(
+            const std::shared_ptr<ThreadPoolInstrumentation>& instrumentation,
+            utils::Duration_ms period);
+
+    DDSROUTER_CORE_DllAPI ~ThreadPoolMonitorProducer();
+
+    DDSROUTER_CORE_DllAPI void produce_and_consume();
+
+    //! Gather the counters of each slot since the previous production.
+    DDSROUTER_CORE_DllAPI void produce();
+
+    //! Log the counters gathered in the last production.
+    DDSROUTER_CORE_DllAPI void consume();
+
+    //! Counters gathered in the last production.
+    DDSROUTER_CORE_DllAPI std::vector<SlotStatistics> data() const;
+
+protected:
+
+    std::shared_ptr<ThreadPoolInstrumentation> instrumentation_;
+
+    mutable std::mutex mutex_;
+
+    //! Counters since the slots were registered, in the previous production.
+    std::vector<SlotStatistics> previous_;
+
+    //! Counters of the last period.
+    std::vector<SlotStatistics> data_;
+
+    //! Produces and consumes periodically. nullptr if the period is 0.
+    std::unique_ptr<utils::event::PeriodicEventHandler> event_handler_;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,161 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <ddspipe_core/dynamic/DiscoveryDatabase.hpp>
+#include <ddspipe_core/efficiency/payload/PayloadPool.hpp>
+#include <ddspipe_core/interface/IParticipant.hpp>
+#include <ddspipe_core/types/dds/Endpoint.hpp>
+#include <ddspipe_core/types/topic/dds/DdsTopic.hpp>
+
+#include <ddsrouter_core/library/library_dll.h>
+#include <ddsrouter_core/participants/auxiliar/InjectorReader.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Base of the participants that inject in the DDS Router messages that do not come from the network.
+ *
+ * The topics are announced in the discovery database as if a writer of this participant had been discovered, and the
+ * messages are injected in the \c InjectorReader that the DDS Router creates for each of them.
+ * The subclasses inject from a thread of their own, that waits until the DDS Router forwards each topic.
+ * Nothing is written in this participant.
+ */
+class InjectorParticipant : public ddspipe::core::IParticipant
+{
+public:
+
+    /**
+     * @brief Construct a new InjectorParticipant.
+     *
+     * @param [in] guid_tag : byte of the guid prefix that tells apart the endpoints of each kind of injector.
+     */
+    DDSROUTER_CORE_DllAPI InjectorParticipant(
+            const ddspipe::core::types::ParticipantId& id,
+            const std::shared_ptr<ddspipe::core::PayloadPool>& payload_pool,
+            const std::shared_ptr<ddspipe::core::DiscoveryDatabase>& discovery_database,
+            uint8_t guid_tag);
+
+    //! Erase the announced endpoints from the discovery database.
+    DDSROUTER_CORE_DllAPI virtual ~InjectorParticipant();
+
+    DDSROUTER_CORE_DllAPI ddspipe::core::types::ParticipantId id() const noexcept override;
+
+    DDSROUTER_CORE_DllAPI bool is_repeater() const noexcept override;
+
+    DDSROUTER_CORE_DllAPI bool is_rtps_kind() const noexcept override;
+
+    DDSROUTER_CORE_DllAPI ddspipe::core::types::TopicQoS topic_qos() const noexcept override;
+
+    DDSROUTER_CORE_DllAPI std::shared_ptr<ddspipe::core::IWriter> create_writer(
+            const ddspipe::core::ITopic& topic) override;
+
+    DDSROUTER_CORE_DllAPI std::shared_ptr<ddspipe::core::IReader> create_reader(
+            const ddspipe::core::ITopic& topic) override;
+
+protected:
+
+    using TopicKey = std::pair<std::string, std::string>;
+
+    //! State of an injected topic. Only accessed by the injecting thread.
+    struct InjectedTopic
+    {
+        ddspipe::core::types::DdsTopic topic;
+
+        //! Endpoint announced in the discovery database.
+        ddspipe::core::types::Endpoint endpoint;
+
+        //! Reader of the topic, once created.
+        std::shared_ptr<InjectorReader> reader;
+
+        //! Whether the DDS Router does not forward the topic.
+        bool skipped = false;
+    };
+
+    //! Announce \c topic as discovered by this participant.
+    void announce_(
+            InjectedTopic& topic);
+
+    /**
+     * @brief Wait until the DDS Router forwards the data of \c topic .
+     *
+     * The topic is announced again periodically while the DDS Router has not created its reader, as it may not be
+     * listening to discovery yet. If it is never created, the topic is marked as skipped.
+     *
+     * @param [out] waited : time spent waiting.
+     *
+     * @return false if the topic is not forwarded or the participant is stopping.
+     */
+    bool wait_forwarding_(
+            InjectedTopic& topic,
+            std::chrono::steady_clock::duration& waited) noexcept;
+
+    /**
+     * @brief Wait until \c time or until the participant stops.
+     *
+     * @return false if the participant is stopping.
+     */
+    bool wait_until_(
+            const std::chrono::steady_clock::time_point& time) noexcept;
+
+    //! Wake up the injecting thread so it stops.
+    void stop_() noexcept;
+
+    //! New guid for an endpoint of this participant.
+    ddspipe::core::types::Guid new_guid_(
+            ddspipe::core::types::EndpointKind kind) noexcept;
+
+    const ddspipe::core::types::ParticipantId id_;
+
+    std::shared_ptr<ddspipe::core::PayloadPool> payload_pool_;
+
+    std::shared_ptr<ddspipe::core::DiscoveryDatabase> discovery_database_;
+
+    const uint8_t guid_tag_;
+
+    //! Readers created by the DDS Router, by topic name and type name.
+    std::map<TopicKey, std::shared_ptr<InjectorReader>> readers_;
+
+    //! Endpoints announced, to erase them on destruction.
+    std::vector<ddspipe::core::types::Endpoint> announced_;
+
+    //! Protects \c readers_ and \c announced_ .
+    std::mutex mutex_;
+
+    //! Notifies readers created, enabled or disabled, and stopping.
+    std::condition_variable cv_;
+
+    //! Whether the injecting thread must keep running. Changed with \c mutex_ taken.
+    std::atomic<bool> running_;
+
+    std::atomic<uint32_t> entity_counter_;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
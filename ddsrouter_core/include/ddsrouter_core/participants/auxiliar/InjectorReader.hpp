@@ -0,0 +1,75 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <functional>
+
+#include <ddspipe_core/types/dds/Guid.hpp>
+#include <ddspipe_core/types/topic/dds/DdsTopic.hpp>
+#include <ddspipe_participants/reader/auxiliar/InternalReader.hpp>
+
+#include <ddsrouter_core/library/library_dll.h>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Reader of an \c InjectorParticipant .
+ *
+ * The messages of its topic are injected in it by its participant. It lets the participant know when it is enabled,
+ * so the participant waits for the DDS Router to forward data instead of injecting messages that would not be sent.
+ */
+class InjectorReader : public ddspipe::participants::InternalReader
+{
+public:
+
+    /**
+     * @brief Construct a new InjectorReader.
+     *
+     * @param [in] on_enabled_change : called every time the reader is enabled or disabled.
+     */
+    DDSROUTER_CORE_DllAPI InjectorReader(
+            const ddspipe::core::types::ParticipantId& participant_id,
+            const ddspipe::core::types::DdsTopic& topic,
+            const ddspipe::core::types::Guid& guid,
+            std::function<void()> on_enabled_change);
+
+    DDSROUTER_CORE_DllAPI ddspipe::core::types::Guid guid() const override;
+
+    DDSROUTER_CORE_DllAPI ddspipe::core::types::DdsTopic topic() const override;
+
+    //! Whether the DDS Router is forwarding the data of this reader.
+    DDSROUTER_CORE_DllAPI bool forwarding() const noexcept;
+
+protected:
+
+    void enable_nts_() noexcept override;
+
+    void disable_nts_() noexcept override;
+
+    const ddspipe::core::types::DdsTopic topic_;
+
+    const ddspipe::core::types::Guid guid_;
+
+    std::function<void()> on_enabled_change_;
+
+    std::atomic<bool> forwarding_;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
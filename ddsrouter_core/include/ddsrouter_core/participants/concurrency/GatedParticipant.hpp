@@ -0,0 +1,50 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <memory>
+
+#include <ddsrouter_core/efficiency/concurrency/ConcurrencyGate.hpp>
+#include <ddsrouter_core/library/library_dll.h>
+#include <ddsrouter_core/participants/decorator/ParticipantDecorator.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Participant decorator that limits how many threads forward the data of its readers at once.
+ *
+ * Every reader is wrapped in a \c GatedReader sharing the same \c ConcurrencyGate . Writers are not wrapped.
+ */
+class GatedParticipant : public ParticipantDecorator
+{
+public:
+
+    DDSROUTER_CORE_DllAPI GatedParticipant(
+            const std::shared_ptr<ddspipe::core::IParticipant>& participant,
+            const std::shared_ptr<ConcurrencyGate>& gate);
+
+    DDSROUTER_CORE_DllAPI std::shared_ptr<ddspipe::core::IReader> create_reader(
+            const ddspipe::core::ITopic& topic) override;
+
+protected:
+
+    std::shared_ptr<ConcurrencyGate> gate_;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,75 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+
+#include <ddsrouter_core/efficiency/concurrency/ConcurrencyGate.hpp>
+#include <ddsrouter_core/library/library_dll.h>
+#include <ddsrouter_core/participants/decorator/ReaderDecorator.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Reader decorator that makes the threads pass a \c ConcurrencyGate before taking its data.
+ *
+ * A thread enters the gate with the first message it takes, and the reader holds it until it has no more data, it is
+ * disabled or it is destroyed, so the gate limits how many transmissions run at once.
+ * The time from the data being notified to being taken is reported to the gate, so it can adapt its limit.
+ */
+class GatedReader : public ReaderDecorator
+{
+public:
+
+    DDSROUTER_CORE_DllAPI GatedReader(
+            const std::shared_ptr<ddspipe::core::IReader>& reader,
+            const std::shared_ptr<ConcurrencyGate>& gate);
+
+    DDSROUTER_CORE_DllAPI ~GatedReader();
+
+    //! Disable the reader, leaving the gate if a transmission was interrupted.
+    DDSROUTER_CORE_DllAPI void disable() noexcept override;
+
+    DDSROUTER_CORE_DllAPI void set_on_data_available_callback(
+            std::function<void()> on_data_available_lambda) noexcept override;
+
+    DDSROUTER_CORE_DllAPI utils::ReturnCode take(
+            std::unique_ptr<ddspipe::core::IRoutingData>& data) noexcept override;
+
+protected:
+
+    //! Current time in microseconds.
+    static int64_t now_us_() noexcept;
+
+    //! Leave the gate, if the reader holds it.
+    void release_gate_() noexcept;
+
+    std::shared_ptr<ConcurrencyGate> gate_;
+
+    //! Whether a transmission of this reader is in the gate.
+    std::atomic<bool> holding_gate_;
+
+    //! Time in microseconds when data was notified and not taken yet. 0 if there is none.
+    std::atomic<int64_t> pending_since_;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
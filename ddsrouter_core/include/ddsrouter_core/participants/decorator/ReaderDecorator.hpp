@@ -0,0 +1,70 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <functional>
+#include <memory>
+
+#include <ddspipe_core/interface/IReader.hpp>
+#include <ddspipe_core/interface/IRoutingData.hpp>
+
+#include <ddsrouter_core/library/library_dll.h>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Reader that wraps another reader and forwards every call to it.
+ *
+ * Subclasses override \c take to act over the data before the DDS Pipe hands it to the writers.
+ */
+class ReaderDecorator : public ddspipe::core::IReader
+{
+public:
+
+    DDSROUTER_CORE_DllAPI ReaderDecorator(
+            const std::shared_ptr<ddspipe::core::IReader>& reader);
+
+    DDSROUTER_CORE_DllAPI void enable() noexcept override;
+
+    DDSROUTER_CORE_DllAPI void disable() noexcept override;
+
+    DDSROUTER_CORE_DllAPI void set_on_data_available_callback(
+            std::function<void()> on_data_available_lambda) noexcept override;
+
+    DDSROUTER_CORE_DllAPI void unset_on_data_available_callback() noexcept override;
+
+    DDSROUTER_CORE_DllAPI utils::ReturnCode take(
+            std::unique_ptr<ddspipe::core::IRoutingData>& data) noexcept override;
+
+    DDSROUTER_CORE_DllAPI ddspipe::core::types::Guid guid() const override;
+
+    DDSROUTER_CORE_DllAPI fastrtps::RecursiveTimedMutex& get_rtps_mutex() const override;
+
+    DDSROUTER_CORE_DllAPI uint64_t get_unread_count() const override;
+
+    DDSROUTER_CORE_DllAPI ddspipe::core::types::DdsTopic topic() const override;
+
+    DDSROUTER_CORE_DllAPI ddspipe::core::types::ParticipantId participant_id() const override;
+
+protected:
+
+    std::shared_ptr<ddspipe::core::IReader> reader_;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,54 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <memory>
+
+#include <ddspipe_core/interface/IRoutingData.hpp>
+#include <ddspipe_core/interface/IWriter.hpp>
+
+#include <ddsrouter_core/library/library_dll.h>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Writer that wraps another writer and forwards every call to it.
+ *
+ * Subclasses override \c write to act over the data before it is sent by the inner writer.
+ */
+class WriterDecorator : public ddspipe::core::IWriter
+{
+public:
+
+    DDSROUTER_CORE_DllAPI WriterDecorator(
+            const std::shared_ptr<ddspipe::core::IWriter>& writer);
+
+    DDSROUTER_CORE_DllAPI void enable() noexcept override;
+
+    DDSROUTER_CORE_DllAPI void disable() noexcept override;
+
+    DDSROUTER_CORE_DllAPI utils::ReturnCode write(
+            ddspipe::core::IRoutingData& data) noexcept override;
+
+protected:
+
+    std::shared_ptr<ddspipe::core::IWriter> writer_;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
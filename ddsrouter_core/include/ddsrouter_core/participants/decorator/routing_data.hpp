@@ -0,0 +1,58 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <fastdds/rtps/common/ChangeKind_t.hpp>
+
+#include <ddspipe_core/interface/IRoutingData.hpp>
+#include <ddspipe_core/types/data/RtpsPayloadData.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * @brief Get the RTPS data inside a routing data, if it is RTPS data.
+ *
+ * @return pointer to the RTPS data, or nullptr if the data is of any other kind.
+ */
+inline ddspipe::core::types::RtpsPayloadData* as_rtps_data(
+        ddspipe::core::IRoutingData& data) noexcept
+{
+    return dynamic_cast<ddspipe::core::types::RtpsPayloadData*>(&data);
+}
+
+//! Const version of \c as_rtps_data .
+inline const ddspipe::core::types::RtpsPayloadData* as_rtps_data(
+        const ddspipe::core::IRoutingData& data) noexcept
+{
+    return dynamic_cast<const ddspipe::core::types::RtpsPayloadData*>(&data);
+}
+
+/**
+ * @brief Whether a routing data carries a user sample.
+ *
+ * Instance state changes (dispose, unregister) do not carry user data, and must never be dropped or modified by
+ * the router features that act over the samples.
+ */
+inline bool carries_user_data(
+        const ddspipe::core::types::RtpsPayloadData& data) noexcept
+{
+    return data.kind == fastrtps::rtps::ALIVE;
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,52 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <memory>
+
+#include <ddsrouter_core/efficiency/filter/ContentFilterEngine.hpp>
+#include <ddsrouter_core/library/library_dll.h>
+#include <ddsrouter_core/participants/decorator/ParticipantDecorator.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Participant decorator that filters the samples received by the wrapped participant with the rules of a
+ * \c ContentFilterEngine .
+ *
+ * Readers are only wrapped if there is any rule that applies to them, so topics without filters do not pay any
+ * overhead. Writers are never wrapped.
+ */
+class ContentFilteredParticipant : public ParticipantDecorator
+{
+public:
+
+    DDSROUTER_CORE_DllAPI ContentFilteredParticipant(
+            const std::shared_ptr<ddspipe::core::IParticipant>& participant,
+            const std::shared_ptr<ContentFilterEngine>& engine);
+
+    DDSROUTER_CORE_DllAPI std::shared_ptr<ddspipe::core::IReader> create_reader(
+            const ddspipe::core::ITopic& topic) override;
+
+protected:
+
+    std::shared_ptr<ContentFilterEngine> engine_;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,58 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include <ddsrouter_core/efficiency/filter/ContentFilter.hpp>
+#include <ddsrouter_core/library/library_dll.h>
+#include <ddsrouter_core/participants/decorator/ReaderDecorator.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Reader decorator that drops the samples not matching the content filters of its topic.
+ *
+ * Samples are checked right after being taken from the inner reader, on the serialized payload.
+ * A dropped sample is released before any writer references its payload, so it never reaches the writers'
+ * histories.
+ * Messages that do not carry user data (dispose, unregister) are never dropped.
+ */
+class ContentFilteredReader : public ReaderDecorator
+{
+public:
+
+    DDSROUTER_CORE_DllAPI ContentFilteredReader(
+            const std::shared_ptr<ddspipe::core::IReader>& reader,
+            const std::vector<std::shared_ptr<ContentFilter>>& filters);
+
+    DDSROUTER_CORE_DllAPI utils::ReturnCode take(
+            std::unique_ptr<ddspipe::core::IRoutingData>& data) noexcept override;
+
+protected:
+
+    //! Whether the message matches every filter.
+    bool accept_(
+            const ddspipe::core::IRoutingData& data) noexcept;
+
+    const std::vector<std::shared_ptr<ContentFilter>> filters_;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,125 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Format of the messages created by the Generator Participant.
+ *
+ * Every message is the CDR little endian serialization of one of these types, so it can be received by any DDS
+ * application that registers them:
+ *
+ * \code
+ * struct GeneratedPayload { unsigned long key; sequence<octet> data; };
+ * struct GeneratedKeyedPayload { @key unsigned long key; sequence<octet> data; };
+ * \endcode
+ *
+ * The first octets of \c data hold the rest of the \c GeneratedPayloadHeader , that the Sink Participant uses to
+ * measure the latency and the losses of the generated messages.
+ */
+
+//! Name of the type of the generated messages in unkeyed topics.
+constexpr const char* GENERATED_PAYLOAD_TYPE_NAME = "GeneratedPayload";
+
+//! Name of the type of the generated messages in keyed topics.
+constexpr const char* GENERATED_KEYED_PAYLOAD_TYPE_NAME = "GeneratedKeyedPayload";
+
+//! Magic number that tells generated messages apart from any other.
+constexpr uint32_t GENERATED_PAYLOAD_MAGIC = 0x4e454744;  // "DGEN"
+
+//! Header at the beginning of every generated message.
+struct GeneratedPayloadHeader
+{
+    //! CDR little endian encapsulation.
+    uint8_t encapsulation[4];
+    //! Instance of the message, from 1. 0 in unkeyed topics.
+    uint32_t key;
+    //! Number of octets in \c data , that starts with the rest of this header.
+    uint32_t data_size;
+    uint32_t magic;
+    //! Number of the message in its topic, from 1.
+    uint64_t sequence;
+    //! Time the message was generated, in nanoseconds of a monotonic clock.
+    int64_t timestamp;
+};
+
+static_assert(sizeof(GeneratedPayloadHeader) == 32, "Unexpected padding in GeneratedPayloadHeader");
+
+//! Minimum size of a generated message.
+constexpr uint32_t GENERATED_PAYLOAD_MIN_SIZE = sizeof(GeneratedPayloadHeader);
+
+//! Current time in the clock of \c GeneratedPayloadHeader::timestamp .
+inline int64_t generated_payload_now() noexcept
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/**
+ * @brief Write the header of a generated message of \c size bytes in \c buffer .
+ *
+ * \c size must be at least \c GENERATED_PAYLOAD_MIN_SIZE .
+ */
+inline void write_generated_payload_header(
+        uint8_t* buffer,
+        uint32_t size,
+        uint32_t key,
+        uint64_t sequence,
+        int64_t timestamp) noexcept
+{
+    GeneratedPayloadHeader header;
+    header.encapsulation[0] = 0x00;
+    header.encapsulation[1] = 0x01;
+    header.encapsulation[2] = 0x00;
+    header.encapsulation[3] = 0x00;
+    header.key = key;
+    header.data_size = size - static_cast<uint32_t>(offsetof(GeneratedPayloadHeader, magic));
+    header.magic = GENERATED_PAYLOAD_MAGIC;
+    header.sequence = sequence;
+    header.timestamp = timestamp;
+
+    std::memcpy(buffer, &header, sizeof(header));
+}
+
+/**
+ * @brief Read the header of a message, if it was generated by a Generator Participant.
+ *
+ * @return false if the message is not a generated message.
+ */
+inline bool read_generated_payload_header(
+        const uint8_t* buffer,
+        uint32_t size,
+        GeneratedPayloadHeader& header) noexcept
+{
+    if (size < GENERATED_PAYLOAD_MIN_SIZE)
+    {
+        return false;
+    }
+
+    std::memcpy(&header, buffer, sizeof(header));
+    return header.magic == GENERATED_PAYLOAD_MAGIC;
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,110 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include <ddspipe_core/dynamic/DiscoveryDatabase.hpp>
+#include <ddspipe_core/efficiency/payload/PayloadPool.hpp>
+
+#include <ddsrouter_core/configuration/GeneratorParticipantConfiguration.hpp>
+#include <ddsrouter_core/library/library_dll.h>
+#include <ddsrouter_core/participants/auxiliar/InjectorParticipant.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Participant that publishes synthetic messages in the DDS Router.
+ *
+ * Every configured topic is announced as discovered by this participant, and a thread of its own generates the
+ * messages of all of them with the configured rates, sizes, keys and bursts once the DDS Router forwards them.
+ * Messages follow the \c GeneratedPayloadHeader format, so a Sink Participant can measure their latency and losses.
+ */
+class GeneratorParticipant : public InjectorParticipant
+{
+public:
+
+    DDSROUTER_CORE_DllAPI GeneratorParticipant(
+            const std::shared_ptr<GeneratorParticipantConfiguration>& participant_configuration,
+            const std::shared_ptr<ddspipe::core::PayloadPool>& payload_pool,
+            const std::shared_ptr<ddspipe::core::DiscoveryDatabase>& discovery_database);
+
+    DDSROUTER_CORE_DllAPI ~GeneratorParticipant();
+
+    //! Announce the topics and start generating messages.
+    DDSROUTER_CORE_DllAPI void init();
+
+    //! Number of messages generated.
+    DDSROUTER_CORE_DllAPI uint64_t generated() const noexcept;
+
+    //! Whether every topic has generated all its samples.
+    DDSROUTER_CORE_DllAPI bool finished() const noexcept;
+
+protected:
+
+    //! State of a generated topic. Only accessed by the generating thread.
+    struct GeneratedTopic : public InjectedTopic
+    {
+        GeneratedTopicConfiguration configuration;
+
+        //! Time of the next burst.
+        std::chrono::steady_clock::time_point next_burst;
+
+        //! Time between bursts.
+        std::chrono::nanoseconds burst_period{0};
+
+        //! Messages generated.
+        uint64_t sequence = 0;
+
+        //! Whether no more messages are generated in this topic.
+        bool done = false;
+    };
+
+    //! Routine of the generating thread.
+    void generate_routine_() noexcept;
+
+    //! Generate the next burst of \c topic .
+    void generate_burst_(
+            GeneratedTopic& topic) noexcept;
+
+    //! Generate a message of \c topic .
+    bool generate_message_(
+            GeneratedTopic& topic) noexcept;
+
+    std::shared_ptr<GeneratorParticipantConfiguration> configuration_;
+
+    std::vector<GeneratedTopic> topics_;
+
+    //! Random sizes of the messages.
+    std::minstd_rand random_;
+
+    std::atomic<uint64_t> generated_;
+
+    std::atomic<bool> finished_;
+
+    std::thread generate_thread_;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,262 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <utility>
+
+#include <cpp_utils/ReturnCode.hpp>
+
+#include <ddspipe_core/dynamic/DiscoveryDatabase.hpp>
+#include <ddspipe_core/efficiency/payload/PayloadPool.hpp>
+#include <ddspipe_core/types/data/RtpsPayloadData.hpp>
+#include <ddspipe_core/types/dds/Endpoint.hpp>
+#include <ddspipe_core/types/dds/Guid.hpp>
+#include <ddspipe_core/types/participant/ParticipantId.hpp>
+#include <ddspipe_core/types/topic/dds/DdsTopic.hpp>
+
+#include <ddsrouter_core/library/library_dll.h>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+class InProcessReader;
+
+/**
+ * Entry point for an application that embeds the DDS Router to publish and receive data without a DDS participant.
+ *
+ * Each channel is identified by a name, and it is shared between the application and the In Process Participant
+ * configured with the same channel name.
+ * Either side may get the channel first: publications and subscriptions made before the participant exists are
+ * announced to the DDS Router once the participant is created.
+ *
+ * Data is exchanged as serialized payloads owned by the payload pool of the DDS Router, so it is never copied:
+ * - To publish, \c loan a payload, serialize the sample in it, and \c publish it. The DDS Router takes it directly.
+ * - To receive, \c subscribe a callback to a topic. The callback receives the data as routed by the DDS Router,
+ *   which is only valid during the callback.
+ *
+ * Every method is thread safe.
+ */
+class InProcessChannel
+{
+public:
+
+    //! Callback that receives the data routed to a subscribed topic.
+    using DataCallback = std::function<void (
+                const ddspipe::core::types::DdsTopic& topic,
+                const ddspipe::core::types::RtpsPayloadData& data)>;
+
+    /**
+     * @brief Get the channel with a given name, creating it if it does not exist.
+     *
+     * The channel exists as long as the application or the participant keeps a reference to it.
+     */
+    DDSROUTER_CORE_DllAPI static std::shared_ptr<InProcessChannel> get(
+            const std::string& name);
+
+    //! Use \c get to create channels.
+    InProcessChannel(
+            const std::string& name);
+
+    DDSROUTER_CORE_DllAPI ~InProcessChannel();
+
+    //! Name of the channel.
+    DDSROUTER_CORE_DllAPI const std::string& name() const noexcept;
+
+    //! Whether an In Process Participant is attached to the channel.
+    DDSROUTER_CORE_DllAPI bool attached() const noexcept;
+
+    /////////////////////////
+    // APPLICATION SIDE
+    /////////////////////////
+
+    /**
+     * @brief Announce that the application publishes in a topic, so the DDS Router routes it.
+     *
+     * The topic is announced as a writer discovered by the In Process Participant.
+     */
+    DDSROUTER_CORE_DllAPI void announce_publication(
+            const ddspipe::core::types::DdsTopic& topic);
+
+    //! Announce that the application no longer publishes in a topic.
+    DDSROUTER_CORE_DllAPI void withdraw_publication(
+            const ddspipe::core::types::DdsTopic& topic);
+
+    /**
+     * @brief Receive the data routed to a topic.
+     *
+     * The topic is announced as a reader discovered by the In Process Participant.
+     * A new subscription to the same topic replaces the previous callback.
+     */
+    DDSROUTER_CORE_DllAPI void subscribe(
+            const ddspipe::core::types::DdsTopic& topic,
+            DataCallback callback);
+
+    //! Stop receiving the data routed to a topic.
+    DDSROUTER_CORE_DllAPI void unsubscribe(
+            const ddspipe::core::types::DdsTopic& topic);
+
+    /**
+     * @brief Get a payload of \c size bytes from the DDS Router payload pool.
+     *
+     * The sample must be serialized in \c payload.data and its size set in \c payload.length .
+     * The source timestamp is set to the current time, and the instance handle must be set for keyed topics.
+     *
+     * @return data to fill and \c publish , or nullptr if no participant is attached or the pool is exhausted.
+     */
+    DDSROUTER_CORE_DllAPI std::unique_ptr<ddspipe::core::types::RtpsPayloadData> loan(
+            uint32_t size);
+
+    /**
+     * @brief Publish data obtained with \c loan in a topic previously announced.
+     *
+     * @return \c RETCODE_OK if the DDS Router has taken the data.
+     * @return \c RETCODE_NOT_ENABLED if no participant is attached or the DDS Router has not created the reader of
+     * the topic yet (e.g. right after announcing it).
+     * @return \c RETCODE_BAD_PARAMETER if the data is null.
+     */
+    DDSROUTER_CORE_DllAPI utils::ReturnCode publish(
+            const ddspipe::core::types::DdsTopic& topic,
+            std::unique_ptr<ddspipe::core::types::RtpsPayloadData>&& data);
+
+    /**
+     * @brief Publish a sample already serialized in an application buffer.
+     *
+     * Convenience method that copies the buffer into a loaned payload.
+     */
+    DDSROUTER_CORE_DllAPI utils::ReturnCode publish(
+            const ddspipe::core::types::DdsTopic& topic,
+            const void* serialized_data,
+            uint32_t size);
+
+    /////////////////////////
+    // PARTICIPANT SIDE
+    /////////////////////////
+
+    /**
+     * @brief Attach an In Process Participant and announce the application endpoints to its DDS Router.
+     *
+     * @throw \c InitializationException if another participant is already attached.
+     */
+    DDSROUTER_CORE_DllAPI void attach(
+            const ddspipe::core::types::ParticipantId& participant_id,
+            const std::shared_ptr<ddspipe::core::PayloadPool>& payload_pool,
+            const std::shared_ptr<ddspipe::core::DiscoveryDatabase>& discovery_database);
+
+    //! Detach the participant, removing the application endpoints from its DDS Router.
+    DDSROUTER_CORE_DllAPI void detach();
+
+    //! Register the reader of a topic, where the data published by the application is injected.
+    DDSROUTER_CORE_DllAPI void register_reader(
+            const ddspipe::core::types::DdsTopic& topic,
+            const std::shared_ptr<InProcessReader>& reader);
+
+    //! Hand the data routed to a topic to the subscription callback, if any.
+    DDSROUTER_CORE_DllAPI void deliver(
+            const ddspipe::core::types::DdsTopic& topic,
+            const ddspipe::core::types::RtpsPayloadData& data);
+
+    //! Create a guid for an endpoint of this channel.
+    DDSROUTER_CORE_DllAPI ddspipe::core::types::Guid new_guid(
+            ddspipe::core::types::EndpointKind kind) noexcept;
+
+protected:
+
+    //! Topics are told apart by name and type.
+    using TopicKey = std::pair<std::string, std::string>;
+
+    //! Orders the topic keys, and compares them with topics so data is routed without building a key.
+    struct TopicKeyLess
+    {
+        using is_transparent = void;
+
+        bool operator ()(
+                const TopicKey& lhs,
+                const TopicKey& rhs) const noexcept
+        {
+            return lhs < rhs;
+        }
+
+        bool operator ()(
+                const TopicKey& lhs,
+                const ddspipe::core::types::DdsTopic& rhs) const noexcept
+        {
+            return std::tie(lhs.first, lhs.second) < std::tie(rhs.m_topic_name, rhs.type_name);
+        }
+
+        bool operator ()(
+                const ddspipe::core::types::DdsTopic& lhs,
+                const TopicKey& rhs) const noexcept
+        {
+            return std::tie(lhs.m_topic_name, lhs.type_name) < std::tie(rhs.first, rhs.second);
+        }
+    };
+
+    template <typename T>
+    using TopicMap = std::map<TopicKey, T, TopicKeyLess>;
+
+    static TopicKey key_(
+            const ddspipe::core::types::DdsTopic& topic);
+
+    //! Add or update an application endpoint, and add it to the discovery database if attached.
+    void announce_(
+            TopicMap<ddspipe::core::types::Endpoint>& endpoints,
+            const ddspipe::core::types::DdsTopic& topic,
+            ddspipe::core::types::EndpointKind kind);
+
+    //! Remove an application endpoint, and remove it from the discovery database if attached.
+    void withdraw_(
+            TopicMap<ddspipe::core::types::Endpoint>& endpoints,
+            const ddspipe::core::types::DdsTopic& topic);
+
+    const std::string name_;
+
+    //! Index of this channel among the channels of the process, used in the guids.
+    const uint32_t index_;
+
+    uint32_t entity_counter_;
+
+    //! Attached participant. Empty id if there is none.
+    ddspipe::core::types::ParticipantId participant_id_;
+
+    std::shared_ptr<ddspipe::core::PayloadPool> payload_pool_;
+
+    std::shared_ptr<ddspipe::core::DiscoveryDatabase> discovery_database_;
+
+    //! Endpoints of the application publications.
+    TopicMap<ddspipe::core::types::Endpoint> publications_;
+
+    //! Endpoints of the application subscriptions.
+    TopicMap<ddspipe::core::types::Endpoint> subscriptions_;
+
+    //! Callbacks of the application subscriptions.
+    TopicMap<std::shared_ptr<DataCallback>> callbacks_;
+
+    //! Readers of the attached participant.
+    TopicMap<std::weak_ptr<InProcessReader>> readers_;
+
+    mutable std::mutex mutex_;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,83 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <memory>
+
+#include <ddspipe_core/dynamic/DiscoveryDatabase.hpp>
+#include <ddspipe_core/efficiency/payload/PayloadPool.hpp>
+#include <ddspipe_core/interface/IParticipant.hpp>
+
+#include <ddsrouter_core/configuration/InProcessParticipantConfiguration.hpp>
+#include <ddsrouter_core/library/library_dll.h>
+#include <ddsrouter_core/participants/inprocess/InProcessChannel.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Participant that connects the DDS Router with the application that embeds it, through an \c InProcessChannel .
+ *
+ * The topics published and subscribed by the application are seen by the DDS Router as endpoints discovered by this
+ * participant, and the data is exchanged as payloads of the DDS Router payload pool, without serialization nor
+ * copies.
+ */
+class InProcessParticipant : public ddspipe::core::IParticipant
+{
+public:
+
+    DDSROUTER_CORE_DllAPI InProcessParticipant(
+            const std::shared_ptr<InProcessParticipantConfiguration>& participant_configuration,
+            const std::shared_ptr<ddspipe::core::PayloadPool>& payload_pool,
+            const std::shared_ptr<ddspipe::core::DiscoveryDatabase>& discovery_database);
+
+    DDSROUTER_CORE_DllAPI ~InProcessParticipant();
+
+    /**
+     * @brief Attach to the channel of the configuration.
+     *
+     * @throw \c InitializationException if another participant is attached to the same channel.
+     */
+    DDSROUTER_CORE_DllAPI void init();
+
+    DDSROUTER_CORE_DllAPI ddspipe::core::types::ParticipantId id() const noexcept override;
+
+    DDSROUTER_CORE_DllAPI bool is_repeater() const noexcept override;
+
+    DDSROUTER_CORE_DllAPI bool is_rtps_kind() const noexcept override;
+
+    DDSROUTER_CORE_DllAPI ddspipe::core::types::TopicQoS topic_qos() const noexcept override;
+
+    DDSROUTER_CORE_DllAPI std::shared_ptr<ddspipe::core::IWriter> create_writer(
+            const ddspipe::core::ITopic& topic) override;
+
+    DDSROUTER_CORE_DllAPI std::shared_ptr<ddspipe::core::IReader> create_reader(
+            const ddspipe::core::ITopic& topic) override;
+
+protected:
+
+    std::shared_ptr<InProcessParticipantConfiguration> configuration_;
+
+    std::shared_ptr<ddspipe::core::PayloadPool> payload_pool_;
+
+    std::shared_ptr<ddspipe::core::DiscoveryDatabase> discovery_database_;
+
+    std::shared_ptr<InProcessChannel> channel_;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
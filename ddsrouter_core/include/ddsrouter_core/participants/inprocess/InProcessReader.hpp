@@ -0,0 +1,54 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <ddspipe_core/types/dds/Guid.hpp>
+#include <ddspipe_core/types/topic/dds/DdsTopic.hpp>
+#include <ddspipe_participants/reader/auxiliar/InternalReader.hpp>
+
+#include <ddsrouter_core/library/library_dll.h>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Reader of an In Process Participant.
+ *
+ * The data published by the application through the \c InProcessChannel is injected directly in it.
+ */
+class InProcessReader : public ddspipe::participants::InternalReader
+{
+public:
+
+    DDSROUTER_CORE_DllAPI InProcessReader(
+            const ddspipe::core::types::ParticipantId& participant_id,
+            const ddspipe::core::types::DdsTopic& topic,
+            const ddspipe::core::types::Guid& guid);
+
+    DDSROUTER_CORE_DllAPI ddspipe::core::types::Guid guid() const override;
+
+    DDSROUTER_CORE_DllAPI ddspipe::core::types::DdsTopic topic() const override;
+
+protected:
+
+    const ddspipe::core::types::DdsTopic topic_;
+
+    const ddspipe::core::types::Guid guid_;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,66 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+
+#include <ddsrouter_core/efficiency/instrumentation/ThreadPoolInstrumentation.hpp>
+#include <ddsrouter_core/library/library_dll.h>
+#include <ddsrouter_core/participants/decorator/ReaderDecorator.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Reader decorator that measures the transmissions of its slot of the thread pool.
+ *
+ * Notifying data queues the slot, the first message taken starts a transmission, and the reader having no more data
+ * ends it.
+ */
+class InstrumentedReader : public ReaderDecorator
+{
+public:
+
+    DDSROUTER_CORE_DllAPI InstrumentedReader(
+            const std::shared_ptr<ddspipe::core::IReader>& reader,
+            const std::shared_ptr<SlotCounters>& counters);
+
+    DDSROUTER_CORE_DllAPI void set_on_data_available_callback(
+            std::function<void()> on_data_available_lambda) noexcept override;
+
+    DDSROUTER_CORE_DllAPI utils::ReturnCode take(
+            std::unique_ptr<ddspipe::core::IRoutingData>& data) noexcept override;
+
+protected:
+
+    //! Current time in microseconds.
+    static int64_t now_us_() noexcept;
+
+    std::shared_ptr<SlotCounters> counters_;
+
+    //! Time in microseconds when data was notified and not taken yet. 0 if there is none.
+    std::atomic<int64_t> enqueued_since_;
+
+    //! Time in microseconds when the current transmission started. 0 if there is none.
+    std::atomic<int64_t> started_at_;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,193 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include <ddsrouter_core/library/library_dll.h>
+#include <ddsrouter_core/participants/ipc/SpscRing.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+struct IpcChannelHeader;
+
+/**
+ * Bidirectional channel between two processes of the same host over a POSIX shared memory segment.
+ *
+ * The segment holds a header and two \c SpscRing , one per direction.
+ * The first process that opens the channel creates and initializes the segment, and each process claims one of
+ * the two sides of the channel, writing in the ring of its side and reading from the other one.
+ *
+ * A side is claimed by storing the pid of its owner, so a side left by a process that has died is claimed again.
+ * Each claim increments the epoch of the side, so the peer can notice that the other side has been restarted.
+ *
+ * Each ring only has one consumer (the receiving thread of the owner of the other side), but there may be several
+ * producer threads in the owner process, so the producer side of the ring is serialized with a mutex.
+ */
+class IpcChannel
+{
+public:
+
+    /**
+     * @brief Open the channel and claim a free side.
+     *
+     * @param [in] name : name of the channel.
+     * @param [in] ring_size : size of each ring. It must be a power of two.
+     * @param [in] max_blocking_time : maximum time to wait for space in a full ring.
+     *
+     * @throw \c InitializationException if the segment cannot be opened, its size does not match, or both sides
+     * are already claimed by live processes.
+     */
+    DDSROUTER_CORE_DllAPI IpcChannel(
+            const std::string& name,
+            uint64_t ring_size,
+            std::chrono::milliseconds max_blocking_time);
+
+    //! Release the side, and remove the segment if the peer is not attached.
+    DDSROUTER_CORE_DllAPI ~IpcChannel();
+
+    //! Side of the channel claimed by this process (0 or 1).
+    DDSROUTER_CORE_DllAPI uint32_t side() const noexcept;
+
+    //! Epoch of the side claimed by this process.
+    DDSROUTER_CORE_DllAPI uint32_t epoch() const noexcept;
+
+    //! Whether the other side is claimed by a process.
+    DDSROUTER_CORE_DllAPI bool peer_attached() const noexcept;
+
+    //! Epoch of the other side. It changes every time the other side is claimed again.
+    DDSROUTER_CORE_DllAPI uint32_t peer_epoch() const noexcept;
+
+    //! Maximum size of a single record.
+    DDSROUTER_CORE_DllAPI uint64_t max_record_size() const noexcept;
+
+    /**
+     * @brief Send a record to the peer.
+     *
+     * The record content is written in place in the ring by \c fill , that receives a pointer to \c size bytes.
+     * If the ring is full, it waits for the peer to consume records up to the maximum blocking time.
+     *
+     * @return true if the record has been sent.
+     * @return false if the record is too big, the peer is not attached, or the ring has remained full.
+     */
+    template <typename FillFunction>
+    bool send(
+            uint32_t type,
+            uint64_t size,
+            FillFunction&& fill);
+
+    /**
+     * @brief Access the oldest record received from the peer.
+     *
+     * Must be called always from the same thread.
+     *
+     * @return pointer to the record content, or nullptr if there is no record.
+     */
+    DDSROUTER_CORE_DllAPI const uint8_t* try_receive(
+            uint32_t& type,
+            uint64_t& size) noexcept;
+
+    //! Free the record returned by the last \c try_receive .
+    DDSROUTER_CORE_DllAPI void release_received() noexcept;
+
+protected:
+
+    //! Claim a free side, or a side whose owner has died.
+    bool claim_side_() noexcept;
+
+    //! Size of the shared memory segment.
+    uint64_t segment_size_() const noexcept;
+
+    //! Name of the shared memory segment.
+    const std::string segment_name_;
+
+    const uint64_t ring_size_;
+
+    const std::chrono::milliseconds max_blocking_time_;
+
+    int fd_;
+
+    void* segment_;
+
+    IpcChannelHeader* header_;
+
+    uint32_t side_;
+
+    uint32_t epoch_;
+
+    //! Ring written by this process.
+    std::unique_ptr<SpscRing> outbound_;
+
+    //! Ring written by the peer.
+    std::unique_ptr<SpscRing> inbound_;
+
+    //! Serializes the writers of this process, as the ring only supports one producer.
+    std::mutex outbound_mutex_;
+};
+
+template <typename FillFunction>
+bool IpcChannel::send(
+        uint32_t type,
+        uint64_t size,
+        FillFunction&& fill)
+{
+    if (size > max_record_size())
+    {
+        return false;
+    }
+
+    const auto deadline = std::chrono::steady_clock::now() + max_blocking_time_;
+    unsigned int attempt = 0;
+
+    std::lock_guard<std::mutex> lock(outbound_mutex_);
+
+    while (true)
+    {
+        uint8_t* buffer = outbound_->try_reserve(size);
+        if (buffer)
+        {
+            fill(buffer);
+            outbound_->commit(type);
+            return true;
+        }
+
+        // Nobody will ever make room in the ring
+        if (!peer_attached() || std::chrono::steady_clock::now() >= deadline)
+        {
+            return false;
+        }
+
+        // Spin briefly first, as the peer is usually draining the ring at the same time
+        if (++attempt < 64)
+        {
+            std::this_thread::yield();
+        }
+        else
+        {
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+    }
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,164 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+//! Types of the records exchanged through an IPC channel.
+enum IpcRecordType : uint32_t
+{
+    //! A sample or an instance state change of a topic.
+    IPC_DATA_RECORD = 1,
+
+    //! Creation, update or removal of an endpoint.
+    IPC_ENDPOINT_RECORD = 2,
+};
+
+/**
+ * Writes plain values in a buffer with enough space, in host byte order.
+ *
+ * Both sides of an IPC channel run in the same host, so no endianness conversion is needed.
+ */
+class IpcEncoder
+{
+public:
+
+    explicit IpcEncoder(
+            uint8_t* buffer) noexcept
+        : cursor_(buffer)
+    {
+    }
+
+    template <typename T>
+    void write(
+            const T& value) noexcept
+    {
+        std::memcpy(cursor_, &value, sizeof(T));
+        cursor_ += sizeof(T);
+    }
+
+    void write_bytes(
+            const void* data,
+            uint32_t size) noexcept
+    {
+        write(size);
+        if (size > 0)
+        {
+            std::memcpy(cursor_, data, size);
+            cursor_ += size;
+        }
+    }
+
+    void write_string(
+            const std::string& value) noexcept
+    {
+        write_bytes(value.data(), static_cast<uint32_t>(value.size()));
+    }
+
+    //! Bytes needed to encode a string or a byte array of \c size bytes.
+    static uint64_t bytes_size(
+            uint64_t size) noexcept
+    {
+        return sizeof(uint32_t) + size;
+    }
+
+protected:
+
+    uint8_t* cursor_;
+};
+
+/**
+ * Reads the values written by an \c IpcEncoder , checking that they are inside the record.
+ *
+ * Each read returns false if the record is too short, so a corrupted record is discarded instead of read out of
+ * bounds.
+ */
+class IpcDecoder
+{
+public:
+
+    IpcDecoder(
+            const uint8_t* buffer,
+            uint64_t size) noexcept
+        : cursor_(buffer)
+        , end_(buffer + size)
+    {
+    }
+
+    template <typename T>
+    bool read(
+            T& value) noexcept
+    {
+        if (static_cast<uint64_t>(end_ - cursor_) < sizeof(T))
+        {
+            return false;
+        }
+
+        std::memcpy(&value, cursor_, sizeof(T));
+        cursor_ += sizeof(T);
+        return true;
+    }
+
+    /**
+     * @brief Read a byte array without copying it.
+     *
+     * @param [out] data : pointer to the array inside the record.
+     * @param [out] size : size of the array.
+     */
+    bool read_bytes(
+            const uint8_t*& data,
+            uint32_t& size) noexcept
+    {
+        if (!read(size) || static_cast<uint64_t>(end_ - cursor_) < size)
+        {
+            return false;
+        }
+
+        data = cursor_;
+        cursor_ += size;
+        return true;
+    }
+
+    bool read_string(
+            std::string& value)
+    {
+        const uint8_t* data;
+        uint32_t size;
+
+        if (!read_bytes(data, size))
+        {
+            return false;
+        }
+
+        value.assign(reinterpret_cast<const char*>(data), size);
+        return true;
+    }
+
+protected:
+
+    const uint8_t* cursor_;
+
+    const uint8_t* end_;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
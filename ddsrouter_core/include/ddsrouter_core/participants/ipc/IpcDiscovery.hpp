@@ -0,0 +1,97 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+
+#include <ddspipe_core/types/dds/Endpoint.hpp>
+#include <ddspipe_core/types/dds/Guid.hpp>
+
+#include <ddsrouter_core/library/library_dll.h>
+#include <ddsrouter_core/participants/ipc/IpcChannel.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Announces the endpoints of an IPC Participant to the other side of its channel.
+ *
+ * It keeps every local endpoint alive, so they can be announced again when the peer is restarted.
+ *
+ * The guids of the local endpoints carry the side and the epoch of the channel in their prefix, so the endpoints
+ * announced by a previous owner of the other side are told apart from the ones of the current owner.
+ */
+class IpcDiscovery
+{
+public:
+
+    DDSROUTER_CORE_DllAPI IpcDiscovery(
+            const std::shared_ptr<IpcChannel>& channel);
+
+    //! Create the guid of a new local endpoint.
+    DDSROUTER_CORE_DllAPI ddspipe::core::types::Guid new_guid(
+            ddspipe::core::types::EndpointKind kind) noexcept;
+
+    //! Announce a new local endpoint, or a change in an existing one.
+    DDSROUTER_CORE_DllAPI void announce(
+            const ddspipe::core::types::Endpoint& endpoint);
+
+    //! Announce that a local endpoint has been destroyed.
+    DDSROUTER_CORE_DllAPI void withdraw(
+            const ddspipe::core::types::Endpoint& endpoint);
+
+    //! Announce every local endpoint again.
+    DDSROUTER_CORE_DllAPI void reannounce();
+
+    /**
+     * @brief Decode an endpoint record sent by the peer.
+     *
+     * @return false if the record is malformed.
+     */
+    DDSROUTER_CORE_DllAPI static bool decode(
+            const uint8_t* record,
+            uint64_t size,
+            ddspipe::core::types::Endpoint& endpoint);
+
+    //! Epoch of the channel side that created an endpoint guid.
+    DDSROUTER_CORE_DllAPI static uint32_t epoch_of(
+            const ddspipe::core::types::Guid& guid) noexcept;
+
+protected:
+
+    //! Send an endpoint record.
+    void send_nts_(
+            const ddspipe::core::types::Endpoint& endpoint);
+
+    std::shared_ptr<IpcChannel> channel_;
+
+    //! Entity ids of the local endpoints.
+    std::atomic<uint32_t> entity_counter_;
+
+    //! Alive local endpoints.
+    std::map<ddspipe::core::types::Guid, ddspipe::core::types::Endpoint> endpoints_;
+
+    //! Protects the local endpoints and keeps the announcements in order.
+    std::mutex mutex_;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,135 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+
+#include <ddspipe_core/dynamic/DiscoveryDatabase.hpp>
+#include <ddspipe_core/efficiency/payload/PayloadPool.hpp>
+#include <ddspipe_core/interface/IParticipant.hpp>
+#include <ddspipe_core/types/dds/Endpoint.hpp>
+
+#include <ddsrouter_core/configuration/IpcParticipantConfiguration.hpp>
+#include <ddsrouter_core/library/library_dll.h>
+#include <ddsrouter_core/participants/ipc/IpcChannel.hpp>
+#include <ddsrouter_core/participants/ipc/IpcDiscovery.hpp>
+#include <ddsrouter_core/participants/ipc/IpcReader.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Participant that connects two DDS Routers running in the same host through a shared memory channel.
+ *
+ * Samples and endpoint discovery travel through the lock-free rings of an \c IpcChannel , so they do not go through
+ * the network stack nor through the RTPS protocol.
+ * Every endpoint created in this participant is announced to the other side, where it is added to the discovery
+ * database of that DDS Router as if it had been discovered by its IPC Participant.
+ *
+ * A thread per participant consumes the inbound ring and injects the samples in the reader of their topic.
+ */
+class IpcParticipant : public ddspipe::core::IParticipant
+{
+public:
+
+    DDSROUTER_CORE_DllAPI IpcParticipant(
+            const std::shared_ptr<IpcParticipantConfiguration>& participant_configuration,
+            const std::shared_ptr<ddspipe::core::PayloadPool>& payload_pool,
+            const std::shared_ptr<ddspipe::core::DiscoveryDatabase>& discovery_database);
+
+    DDSROUTER_CORE_DllAPI ~IpcParticipant();
+
+    /**
+     * @brief Open the channel and start receiving from it.
+     *
+     * @throw \c InitializationException if the channel cannot be opened.
+     */
+    DDSROUTER_CORE_DllAPI void init();
+
+    DDSROUTER_CORE_DllAPI ddspipe::core::types::ParticipantId id() const noexcept override;
+
+    DDSROUTER_CORE_DllAPI bool is_repeater() const noexcept override;
+
+    DDSROUTER_CORE_DllAPI bool is_rtps_kind() const noexcept override;
+
+    DDSROUTER_CORE_DllAPI ddspipe::core::types::TopicQoS topic_qos() const noexcept override;
+
+    DDSROUTER_CORE_DllAPI std::shared_ptr<ddspipe::core::IWriter> create_writer(
+            const ddspipe::core::ITopic& topic) override;
+
+    DDSROUTER_CORE_DllAPI std::shared_ptr<ddspipe::core::IReader> create_reader(
+            const ddspipe::core::ITopic& topic) override;
+
+protected:
+
+    //! Routine of the receiving thread.
+    void receive_routine_() noexcept;
+
+    //! Inject a data record in the reader of its topic.
+    void receive_data_(
+            const uint8_t* record,
+            uint64_t size) noexcept;
+
+    //! Add, update or remove an endpoint of the peer in the discovery database.
+    void receive_endpoint_(
+            const uint8_t* record,
+            uint64_t size) noexcept;
+
+    //! React to the peer attaching, restarting or leaving.
+    void check_peer_() noexcept;
+
+    //! Remove from the discovery database every endpoint of the peer.
+    void erase_remote_endpoints_() noexcept;
+
+    std::shared_ptr<IpcParticipantConfiguration> configuration_;
+
+    std::shared_ptr<ddspipe::core::PayloadPool> payload_pool_;
+
+    std::shared_ptr<ddspipe::core::DiscoveryDatabase> discovery_database_;
+
+    std::shared_ptr<IpcChannel> channel_;
+
+    std::shared_ptr<IpcDiscovery> discovery_;
+
+    //! Readers by topic name and type name.
+    std::map<std::pair<std::string, std::string>, std::weak_ptr<IpcReader>> readers_;
+
+    //! Protects the readers map.
+    std::mutex readers_mutex_;
+
+    //! Endpoints of the peer added to the discovery database. Only accessed by the receiving thread.
+    std::map<ddspipe::core::types::Guid, ddspipe::core::types::Endpoint> remote_endpoints_;
+
+    //! Topic of the last data record received. Only accessed by the receiving thread.
+    std::pair<std::string, std::string> received_topic_key_;
+
+    //! Epoch of the peer whose endpoints are in the database. Only accessed by the receiving thread.
+    uint32_t known_peer_epoch_;
+
+    std::atomic<bool> running_;
+
+    std::thread receive_thread_;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
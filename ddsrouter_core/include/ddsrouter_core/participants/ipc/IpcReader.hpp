@@ -0,0 +1,63 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <memory>
+
+#include <ddspipe_core/types/dds/Endpoint.hpp>
+#include <ddspipe_core/types/topic/dds/DdsTopic.hpp>
+#include <ddspipe_participants/reader/auxiliar/InternalReader.hpp>
+
+#include <ddsrouter_core/library/library_dll.h>
+#include <ddsrouter_core/participants/ipc/IpcDiscovery.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Reader of an IPC Participant.
+ *
+ * The receiving thread of the participant injects in it the messages of its topic that arrive through the channel.
+ */
+class IpcReader : public ddspipe::participants::InternalReader
+{
+public:
+
+    /**
+     * @brief Construct a new IpcReader and announce it to the peer.
+     */
+    DDSROUTER_CORE_DllAPI IpcReader(
+            const ddspipe::core::types::ParticipantId& participant_id,
+            const ddspipe::core::types::DdsTopic& topic,
+            const std::shared_ptr<IpcDiscovery>& discovery);
+
+    //! Announce to the peer that the reader no longer exists.
+    DDSROUTER_CORE_DllAPI ~IpcReader();
+
+    DDSROUTER_CORE_DllAPI ddspipe::core::types::Guid guid() const override;
+
+    DDSROUTER_CORE_DllAPI ddspipe::core::types::DdsTopic topic() const override;
+
+protected:
+
+    std::shared_ptr<IpcDiscovery> discovery_;
+
+    ddspipe::core::types::Endpoint endpoint_;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,69 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <memory>
+
+#include <ddspipe_core/types/dds/Endpoint.hpp>
+#include <ddspipe_core/types/topic/dds/DdsTopic.hpp>
+#include <ddspipe_participants/writer/auxiliar/BaseWriter.hpp>
+
+#include <ddsrouter_core/library/library_dll.h>
+#include <ddsrouter_core/participants/ipc/IpcChannel.hpp>
+#include <ddsrouter_core/participants/ipc/IpcDiscovery.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Writer of an IPC Participant.
+ *
+ * It copies every message directly into the outbound ring of the channel, from where the reader of the same
+ * topic in the other DDS Router takes it.
+ */
+class IpcWriter : public ddspipe::participants::BaseWriter
+{
+public:
+
+    /**
+     * @brief Construct a new IpcWriter and announce it to the peer.
+     */
+    DDSROUTER_CORE_DllAPI IpcWriter(
+            const ddspipe::core::types::ParticipantId& participant_id,
+            const ddspipe::core::types::DdsTopic& topic,
+            const std::shared_ptr<IpcChannel>& channel,
+            const std::shared_ptr<IpcDiscovery>& discovery);
+
+    //! Announce to the peer that the writer no longer exists.
+    DDSROUTER_CORE_DllAPI ~IpcWriter();
+
+protected:
+
+    utils::ReturnCode write_nts_(
+            ddspipe::core::IRoutingData& data) noexcept override;
+
+    const ddspipe::core::types::DdsTopic topic_;
+
+    std::shared_ptr<IpcChannel> channel_;
+
+    std::shared_ptr<IpcDiscovery> discovery_;
+
+    ddspipe::core::types::Endpoint endpoint_;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
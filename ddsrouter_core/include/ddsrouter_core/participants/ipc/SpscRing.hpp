@@ -0,0 +1,141 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+#include <ddsrouter_core/library/library_dll.h>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Shared state of a \c SpscRing .
+ *
+ * It lives in shared memory, so it only contains lock-free atomics.
+ * Each index is in its own cache line so producer and consumer do not invalidate each other's line.
+ */
+struct SpscRingControl
+{
+    //! Bytes written by the producer since the ring was created.
+    alignas(64) std::atomic<uint64_t> head;
+
+    //! Bytes released by the consumer since the ring was created.
+    alignas(64) std::atomic<uint64_t> tail;
+};
+
+/**
+ * Single producer single consumer ring of variable size records.
+ *
+ * The ring does not own any memory: it is a view over a \c SpscRingControl and a data area whose size is a power
+ * of two, both usually mapped in shared memory by two different processes.
+ *
+ * Each record is an 8 bytes header (length and type) followed by its content, aligned to 8 bytes.
+ * Records are never split: when a record does not fit before the end of the data area, a padding record fills
+ * the remaining space and the record is written at the beginning.
+ *
+ * The producer reserves space with \c try_reserve , writes the content in place and publishes it with \c commit .
+ * The consumer reads the oldest record in place with \c try_peek and frees it with \c release .
+ */
+class SpscRing
+{
+public:
+
+    //! Type of the records that only fill the space until the end of the data area.
+    static constexpr uint32_t PADDING_RECORD = 0;
+
+    //! Size of the header of each record.
+    static constexpr uint64_t RECORD_HEADER_SIZE = 8;
+
+    DDSROUTER_CORE_DllAPI SpscRing(
+            SpscRingControl* control,
+            uint8_t* data,
+            uint64_t capacity) noexcept;
+
+    //! Maximum content size of a single record.
+    DDSROUTER_CORE_DllAPI uint64_t max_record_size() const noexcept;
+
+    /////////////////////////
+    // PRODUCER
+    /////////////////////////
+
+    /**
+     * @brief Reserve space for a record of \c size bytes.
+     *
+     * @return pointer where the content must be written, or nullptr if there is not enough free space.
+     */
+    DDSROUTER_CORE_DllAPI uint8_t* try_reserve(
+            uint64_t size) noexcept;
+
+    //! Publish the record reserved by the last \c try_reserve .
+    DDSROUTER_CORE_DllAPI void commit(
+            uint32_t type) noexcept;
+
+    /////////////////////////
+    // CONSUMER
+    /////////////////////////
+
+    /**
+     * @brief Access the oldest record without removing it.
+     *
+     * @param [out] type : type of the record.
+     * @param [out] size : size of the record content.
+     *
+     * @return pointer to the record content, or nullptr if the ring is empty.
+     */
+    DDSROUTER_CORE_DllAPI const uint8_t* try_peek(
+            uint32_t& type,
+            uint64_t& size) noexcept;
+
+    //! Free the record returned by the last \c try_peek .
+    DDSROUTER_CORE_DllAPI void release() noexcept;
+
+    //! Discard every record in the ring, e.g. the ones left by a previous producer.
+    DDSROUTER_CORE_DllAPI void reset_consumer() noexcept;
+
+protected:
+
+    //! Header of each record.
+    struct RecordHeader
+    {
+        uint32_t size;
+        uint32_t type;
+    };
+
+    //! Size of a record in the data area, header and alignment included.
+    static uint64_t record_footprint_(
+            uint64_t size) noexcept;
+
+    SpscRingControl* control_;
+
+    uint8_t* data_;
+
+    const uint64_t capacity_;
+
+    //! Position of the record being reserved by the producer.
+    uint64_t reserved_position_;
+
+    //! Size of the record being reserved by the producer.
+    uint64_t reserved_size_;
+
+    //! Footprint of the record being read by the consumer.
+    uint64_t peeked_footprint_;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
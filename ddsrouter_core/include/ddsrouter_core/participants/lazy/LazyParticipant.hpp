@@ -0,0 +1,51 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <memory>
+
+#include <ddsrouter_core/efficiency/lazy/LazyWriterEngine.hpp>
+#include <ddsrouter_core/library/library_dll.h>
+#include <ddsrouter_core/participants/decorator/ParticipantDecorator.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Participant decorator whose writers are created by a \c LazyWriterEngine .
+ *
+ * The writers of the wrapped participant are only created once they have a message to send, and destroyed again
+ * when idle. Readers are not affected, as they must exist to receive the messages in the first place.
+ */
+class LazyParticipant : public ParticipantDecorator
+{
+public:
+
+    DDSROUTER_CORE_DllAPI LazyParticipant(
+            const std::shared_ptr<ddspipe::core::IParticipant>& participant,
+            const std::shared_ptr<LazyWriterEngine>& engine);
+
+    DDSROUTER_CORE_DllAPI std::shared_ptr<ddspipe::core::IWriter> create_writer(
+            const ddspipe::core::ITopic& topic) override;
+
+protected:
+
+    std::shared_ptr<LazyWriterEngine> engine_;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
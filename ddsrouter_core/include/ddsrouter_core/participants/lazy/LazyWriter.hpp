@@ -0,0 +1,143 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <shared_mutex>
+
+#include <ddspipe_core/interface/IParticipant.hpp>
+#include <ddspipe_core/interface/IRoutingData.hpp>
+#include <ddspipe_core/interface/IWriter.hpp>
+#include <ddspipe_core/types/participant/ParticipantId.hpp>
+#include <ddspipe_core/types/topic/dds/DdsTopic.hpp>
+
+#include <ddsrouter_core/library/library_dll.h>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+//! Counters shared by every lazy writer of a DDS Router.
+struct LazyWriterCounters
+{
+    //! Inner writers created.
+    std::atomic<uint64_t> created{0};
+
+    //! Inner writers destroyed for being idle.
+    std::atomic<uint64_t> reaped{0};
+
+    //! Inner writers alive.
+    std::atomic<uint64_t> active{0};
+};
+
+/**
+ * Writer that creates the writer of its participant only when it has the first message to send.
+ *
+ * The DDS Pipe creates a writer for every topic bridge, even if no message is ever sent in the topic.
+ * A lazy writer delays the creation of the actual writer, with its history and endpoints, until a message arrives,
+ * and destroys it again once it has been idle for long enough (see \c reap_if_idle ), so routers that discover
+ * many more topics than the ones carrying traffic only hold resources for the latter.
+ *
+ * Messages are written holding a shared lock, so concurrent writes do not block each other, while the creation
+ * and destruction of the inner writer hold it exclusively.
+ */
+class LazyWriter : public ddspipe::core::IWriter
+{
+public:
+
+    DDSROUTER_CORE_DllAPI LazyWriter(
+            const std::shared_ptr<ddspipe::core::IParticipant>& participant,
+            const ddspipe::core::types::DdsTopic& topic,
+            const std::shared_ptr<LazyWriterCounters>& counters);
+
+    DDSROUTER_CORE_DllAPI ~LazyWriter();
+
+    DDSROUTER_CORE_DllAPI void enable() noexcept override;
+
+    DDSROUTER_CORE_DllAPI void disable() noexcept override;
+
+    /**
+     * @brief Write \c data with the inner writer, creating it if it does not exist.
+     *
+     * @return \c RETCODE_ERROR if the inner writer could not be created, or the result of the inner write otherwise.
+     */
+    DDSROUTER_CORE_DllAPI utils::ReturnCode write(
+            ddspipe::core::IRoutingData& data) noexcept override;
+
+    /**
+     * @brief Destroy the inner writer if it has not written anything in the last \c idle_ttl nanoseconds.
+     *
+     * A writer that is writing at the moment is never idle.
+     *
+     * @param [in] now : current time in nanoseconds of a monotonic clock.
+     * @param [in] idle_ttl : nanoseconds without writing that make the writer idle.
+     *
+     * @return true if the inner writer has been destroyed.
+     */
+    DDSROUTER_CORE_DllAPI bool reap_if_idle(
+            int64_t now,
+            int64_t idle_ttl) noexcept;
+
+    /**
+     * @brief Create the inner writer before the first message arrives.
+     *
+     * The writer counts as just used, so it is not reaped before the idle TTL.
+     *
+     * @return whether the inner writer exists.
+     */
+    DDSROUTER_CORE_DllAPI bool warm_up() noexcept;
+
+    //! Whether the inner writer exists.
+    DDSROUTER_CORE_DllAPI bool created() const noexcept;
+
+    //! Topic of the writer.
+    DDSROUTER_CORE_DllAPI const ddspipe::core::types::DdsTopic& topic() const noexcept;
+
+    //! Id of the participant of the writer.
+    DDSROUTER_CORE_DllAPI ddspipe::core::types::ParticipantId participant_id() const noexcept;
+
+    //! Current time in nanoseconds in the clock of \c reap_if_idle .
+    DDSROUTER_CORE_DllAPI static int64_t now() noexcept;
+
+protected:
+
+    //! Create the inner writer. Must be called with \c mutex_ locked exclusively.
+    bool create_nts_() noexcept;
+
+    //! Participant that creates the inner writer.
+    std::shared_ptr<ddspipe::core::IParticipant> participant_;
+
+    const ddspipe::core::types::DdsTopic topic_;
+
+    std::shared_ptr<LazyWriterCounters> counters_;
+
+    //! Guards \c writer_ and \c enabled_ .
+    mutable std::shared_timed_mutex mutex_;
+
+    //! Inner writer. nullptr until the first message, and after being reaped.
+    std::shared_ptr<ddspipe::core::IWriter> writer_;
+
+    //! Whether the DDS Pipe has enabled this writer, so the inner writer is enabled when created.
+    bool enabled_;
+
+    //! Time of the last message written, in nanoseconds.
+    std::atomic<int64_t> last_write_;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
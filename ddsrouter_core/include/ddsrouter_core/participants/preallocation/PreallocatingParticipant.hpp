@@ -0,0 +1,77 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+
+#include <ddsrouter_core/efficiency/payload/PreallocatedPayloadPool.hpp>
+#include <ddsrouter_core/library/library_dll.h>
+#include <ddsrouter_core/participants/decorator/ParticipantDecorator.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Participant decorator that reserves the payload slots of the histories of its readers and writers.
+ *
+ * When a reader or writer of a reliable or transient local topic is created, as many slots as the history depth of
+ * the topic are reserved in a \c PreallocatedPayloadPool , so the samples kept in its history never need a heap
+ * allocation. Best effort volatile topics keep no samples, and topics with unlimited histories can not be bounded,
+ * so they reserve nothing.
+ *
+ * The slots are reserved once per topic for the writers and once per topic for the readers of this participant, so
+ * endpoints created again for the same topic (e.g. when the unused entities are removed and discovered again) do not
+ * grow the pool. Slots are never returned to the pool, as other payloads may be using them.
+ */
+class PreallocatingParticipant : public ParticipantDecorator
+{
+public:
+
+    DDSROUTER_CORE_DllAPI PreallocatingParticipant(
+            const std::shared_ptr<ddspipe::core::IParticipant>& participant,
+            const std::shared_ptr<PreallocatedPayloadPool>& payload_pool);
+
+    DDSROUTER_CORE_DllAPI std::shared_ptr<ddspipe::core::IWriter> create_writer(
+            const ddspipe::core::ITopic& topic) override;
+
+    DDSROUTER_CORE_DllAPI std::shared_ptr<ddspipe::core::IReader> create_reader(
+            const ddspipe::core::ITopic& topic) override;
+
+protected:
+
+    //! Reserve the slots of a history in \c topic , if it needs them and \c reserved_topics has not reserved them yet.
+    void reserve_history_(
+            const ddspipe::core::ITopic& topic,
+            std::set<std::string>& reserved_topics);
+
+    std::shared_ptr<PreallocatedPayloadPool> payload_pool_;
+
+    //! Guards \c writer_topics_ and \c reader_topics_ .
+    std::mutex mutex_;
+
+    //! Topics whose writer history has been reserved.
+    std::set<std::string> writer_topics_;
+
+    //! Topics whose reader history has been reserved.
+    std::set<std::string> reader_topics_;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,58 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <memory>
+
+#include <ddspipe_core/efficiency/payload/PayloadPool.hpp>
+
+#include <ddsrouter_core/efficiency/projection/ProjectionEngine.hpp>
+#include <ddsrouter_core/library/library_dll.h>
+#include <ddsrouter_core/participants/decorator/ParticipantDecorator.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Participant decorator that projects the samples sent by the wrapped participant with the rules of a
+ * \c ProjectionEngine .
+ *
+ * Writers of the topics projected are created with the derived type of their rule, and wrapped so they send the
+ * samples projected. The rest of the writers, and every reader, are not wrapped.
+ */
+class ProjectedParticipant : public ParticipantDecorator
+{
+public:
+
+    DDSROUTER_CORE_DllAPI ProjectedParticipant(
+            const std::shared_ptr<ddspipe::core::IParticipant>& participant,
+            const std::shared_ptr<ProjectionEngine>& engine,
+            const std::shared_ptr<ddspipe::core::PayloadPool>& payload_pool);
+
+    DDSROUTER_CORE_DllAPI std::shared_ptr<ddspipe::core::IWriter> create_writer(
+            const ddspipe::core::ITopic& topic) override;
+
+protected:
+
+    std::shared_ptr<ProjectionEngine> engine_;
+
+    //! Pool the payloads projected are taken from.
+    std::shared_ptr<ddspipe::core::PayloadPool> payload_pool_;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
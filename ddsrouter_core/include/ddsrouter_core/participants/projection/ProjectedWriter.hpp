@@ -0,0 +1,59 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <memory>
+
+#include <ddspipe_core/efficiency/payload/PayloadPool.hpp>
+
+#include <ddsrouter_core/efficiency/projection/TopicProjection.hpp>
+#include <ddsrouter_core/library/library_dll.h>
+#include <ddsrouter_core/participants/decorator/WriterDecorator.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Writer decorator that sends the samples projected.
+ *
+ * The payload of the data is replaced by its projection while the inner writer sends it, and restored afterwards,
+ * so the rest of the writers of the topic get the original sample.
+ * This relies on the writers of a topic being called one after the other, which is the DDS Pipe behaviour.
+ * Samples that cannot be projected are dropped, as they cannot be sent with the derived type.
+ * Messages that do not carry user data (dispose, unregister) are sent as they are.
+ */
+class ProjectedWriter : public WriterDecorator
+{
+public:
+
+    DDSROUTER_CORE_DllAPI ProjectedWriter(
+            const std::shared_ptr<ddspipe::core::IWriter>& writer,
+            const std::shared_ptr<TopicProjection>& projection,
+            const std::shared_ptr<ddspipe::core::PayloadPool>& payload_pool);
+
+    DDSROUTER_CORE_DllAPI utils::ReturnCode write(
+            ddspipe::core::IRoutingData& data) noexcept override;
+
+protected:
+
+    const std::shared_ptr<TopicProjection> projection_;
+
+    const std::shared_ptr<ddspipe::core::PayloadPool> payload_pool_;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,96 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <ddsrouter_core/efficiency/rate_limit/InstanceSampleTable.hpp>
+#include <ddsrouter_core/efficiency/rate_limit/RateLimiter.hpp>
+#include <ddsrouter_core/library/library_dll.h>
+#include <ddsrouter_core/participants/decorator/ReaderDecorator.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Reader decorator that shares the topic rate limits fairly between the instances of a keyed topic.
+ *
+ * Every sample received is moved from the inner reader to an \c InstanceSampleTable , where it replaces the
+ * previous pending sample of its instance (which is counted as dropped).
+ * \c take returns the pending samples in round-robin order across instances, as long as the limiters accept them.
+ * When the limiters reject a sample, it is kept until \c wake is called again by the engine pacer.
+ *
+ * Messages that do not carry user data (dispose, unregister) bypass the limiters and are returned first, and
+ * they discard the pending sample of their instance so an old sample can not revive it.
+ */
+class InstanceRateLimitedReader : public ReaderDecorator
+{
+public:
+
+    DDSROUTER_CORE_DllAPI InstanceRateLimitedReader(
+            const std::shared_ptr<ddspipe::core::IReader>& reader,
+            const std::vector<std::shared_ptr<RateLimiter>>& limiters);
+
+    DDSROUTER_CORE_DllAPI void set_on_data_available_callback(
+            std::function<void()> on_data_available_lambda) noexcept override;
+
+    DDSROUTER_CORE_DllAPI void unset_on_data_available_callback() noexcept override;
+
+    DDSROUTER_CORE_DllAPI utils::ReturnCode take(
+            std::unique_ptr<ddspipe::core::IRoutingData>& data) noexcept override;
+
+    DDSROUTER_CORE_DllAPI uint64_t get_unread_count() const override;
+
+    //! Notify the DDS Pipe if there are pending samples, so it takes them if the rate allows it.
+    DDSROUTER_CORE_DllAPI void wake() noexcept;
+
+protected:
+
+    //! Move every sample of the inner reader to the table or the bypass queue.
+    void drain_nts_() noexcept;
+
+    //! Check every limiter, undoing the consumed tokens if any of them rejects the message.
+    bool accept_nts_(
+            const ddspipe::core::IRoutingData& data) noexcept;
+
+    const std::vector<std::shared_ptr<RateLimiter>> limiters_;
+
+    //! Latest pending sample of each instance.
+    InstanceSampleTable table_;
+
+    //! Messages that skip the limiters.
+    std::deque<std::unique_ptr<ddspipe::core::IRoutingData>> bypass_;
+
+    //! Number of pending samples, readable without locking the table.
+    std::atomic<std::size_t> pending_;
+
+    //! Protects the table and the bypass queue.
+    mutable std::mutex mutex_;
+
+    std::function<void()> on_data_available_;
+
+    //! Protects the callback, so it is not unset while the pacer calls it.
+    std::mutex callback_mutex_;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,62 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include <ddsrouter_core/efficiency/rate_limit/RateLimiter.hpp>
+#include <ddsrouter_core/library/library_dll.h>
+#include <ddsrouter_core/participants/decorator/ReaderDecorator.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Reader decorator that drops the messages exceeding the topic rate limits.
+ *
+ * Messages are checked right after being taken from the inner reader.
+ * A dropped message is released before any writer references its payload, so it never reaches the writers'
+ * histories.
+ * Messages that do not carry user data (dispose, unregister) are never dropped.
+ */
+class RateLimitedReader : public ReaderDecorator
+{
+public:
+
+    DDSROUTER_CORE_DllAPI RateLimitedReader(
+            const std::shared_ptr<ddspipe::core::IReader>& reader,
+            const std::vector<std::shared_ptr<RateLimiter>>& limiters,
+            uint32_t participant_index);
+
+    DDSROUTER_CORE_DllAPI utils::ReturnCode take(
+            std::unique_ptr<ddspipe::core::IRoutingData>& data) noexcept override;
+
+protected:
+
+    //! Check every limiter, undoing the consumed tokens if any of them rejects the message.
+    bool accept_(
+            const ddspipe::core::IRoutingData& data) noexcept;
+
+    const std::vector<std::shared_ptr<RateLimiter>> limiters_;
+
+    //! Index of the participant of this reader, published to the writers through the engine.
+    const uint32_t participant_index_;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
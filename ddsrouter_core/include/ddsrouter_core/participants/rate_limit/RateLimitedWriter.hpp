@@ -0,0 +1,54 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <memory>
+
+#include <ddsrouter_core/efficiency/rate_limit/RateLimitEngine.hpp>
+#include <ddsrouter_core/library/library_dll.h>
+#include <ddsrouter_core/participants/decorator/WriterDecorator.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Writer decorator that drops the messages exceeding the participant and route rate limits.
+ *
+ * Dropped messages are not an error: \c write returns \c RETCODE_OK and the drop is counted by the limiter.
+ */
+class RateLimitedWriter : public WriterDecorator
+{
+public:
+
+    DDSROUTER_CORE_DllAPI RateLimitedWriter(
+            const std::shared_ptr<ddspipe::core::IWriter>& writer,
+            const TransmissionLimiters& limiters);
+
+    DDSROUTER_CORE_DllAPI utils::ReturnCode write(
+            ddspipe::core::IRoutingData& data) noexcept override;
+
+protected:
+
+    //! Check every limiter that applies, undoing the consumed tokens if any of them rejects the message.
+    bool accept_(
+            uint64_t size) noexcept;
+
+    const TransmissionLimiters limiters_;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,139 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * On disk format of the records written by the Recorder Participant.
+ *
+ * A recording is a sequence of segments. Every segment is a pair of files with the same name:
+ *  - The segment file ( \c RECORD_SEGMENT_EXTENSION ) is a \c RecordFileHeader followed by records, each one a
+ *    \c RecordHeader followed by its body and padded to \c RECORD_ALIGNMENT . A header of type \c RECORD_END (all
+ *    zeros) marks the end of the segment, also when the segment has not been closed properly.
+ *  - The index file ( \c RECORD_INDEX_EXTENSION ) is a \c RecordFileHeader followed by a \c RecordIndexEntry per
+ *    data record of the segment, in the order they were written, so that it is sorted by reception time.
+ *
+ * Every segment declares the topics it uses with a \c RECORD_TOPIC record before their first data record, so
+ * segments can be read independently. Topic ids are the same in all the segments of a recording.
+ *
+ * All integers are stored in the byte order of the host that records.
+ */
+
+//! Magic number at the beginning of every segment file.
+constexpr char RECORD_SEGMENT_MAGIC[8] = {'D', 'D', 'S', 'R', 'S', 'E', 'G', '1'};
+
+//! Magic number at the beginning of every index file.
+constexpr char RECORD_INDEX_MAGIC[8] = {'D', 'D', 'S', 'R', 'I', 'D', 'X', '1'};
+
+//! Version of the format.
+constexpr uint32_t RECORD_FORMAT_VERSION = 1;
+
+//! Extension of the segment files.
+constexpr const char* RECORD_SEGMENT_EXTENSION = ".ddsrec";
+
+//! Extension of the index files.
+constexpr const char* RECORD_INDEX_EXTENSION = ".ddsidx";
+
+//! Alignment of every record inside a segment.
+constexpr uint64_t RECORD_ALIGNMENT = 8;
+
+//! Kinds of record in a segment.
+enum RecordType : uint16_t
+{
+    RECORD_END = 0,
+    RECORD_TOPIC = 1,
+    RECORD_DATA = 2,
+};
+
+//! Header of the segment and index files.
+struct RecordFileHeader
+{
+    char magic[8];
+    uint32_t version;
+    uint32_t reserved;
+    //! Creation time of the file in nanoseconds since epoch.
+    int64_t creation_time;
+};
+
+//! Header of every record in a segment.
+struct RecordHeader
+{
+    //! Size of the body, without this header nor the padding.
+    uint32_t size;
+    uint16_t type;
+    uint16_t reserved;
+};
+
+//! Body of a \c RECORD_TOPIC record. It is followed by the topic name and the type name.
+struct RecordTopic
+{
+    uint32_t topic_id;
+    uint8_t keyed;
+    uint8_t reliable;
+    uint8_t transient_local;
+    uint8_t reserved;
+    uint32_t name_size;
+    uint32_t type_size;
+};
+
+//! Body of a \c RECORD_DATA record. It is followed by the payload.
+struct RecordData
+{
+    uint32_t topic_id;
+    //! \c ChangeKind_t of the sample.
+    uint8_t kind;
+    uint8_t reserved[3];
+    //! Source timestamp in nanoseconds since epoch.
+    int64_t source_timestamp;
+    //! Time the router received the message in nanoseconds since epoch.
+    int64_t reception_timestamp;
+    uint8_t instance_handle[16];
+    uint32_t payload_size;
+    uint32_t reserved_2;
+};
+
+//! Entry of the index file.
+struct RecordIndexEntry
+{
+    //! Reception timestamp of the record in nanoseconds since epoch.
+    int64_t timestamp;
+    uint32_t topic_id;
+    //! Size of the body of the record.
+    uint32_t size;
+    //! Offset of the record header in the segment file.
+    uint64_t offset;
+};
+
+static_assert(sizeof(RecordFileHeader) == 24, "Unexpected padding in RecordFileHeader");
+static_assert(sizeof(RecordHeader) == 8, "Unexpected padding in RecordHeader");
+static_assert(sizeof(RecordTopic) == 16, "Unexpected padding in RecordTopic");
+static_assert(sizeof(RecordData) == 48, "Unexpected padding in RecordData");
+static_assert(sizeof(RecordIndexEntry) == 24, "Unexpected padding in RecordIndexEntry");
+
+//! Space that a record with a body of \c body_size bytes takes in a segment.
+constexpr uint64_t record_aligned_size(
+        uint64_t body_size) noexcept
+{
+    return (sizeof(RecordHeader) + body_size + RECORD_ALIGNMENT - 1) & ~(RECORD_ALIGNMENT - 1);
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
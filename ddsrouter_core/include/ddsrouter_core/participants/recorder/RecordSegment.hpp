@@ -0,0 +1,138 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <ddsrouter_core/library/library_dll.h>
+#include <ddsrouter_core/participants/recorder/RecordFormat.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Segment file of a recording, open for appending.
+ *
+ * The segment file is preallocated with its whole capacity and mapped in memory, so appending a record is a copy
+ * to memory that never waits for the disk. The written data reaches the disk when it is synchronized, what is
+ * expected to happen periodically from a different thread than the one appending.
+ *
+ * Appending ( \c reserve , \c commit , \c add_index ) must be done by a single thread, that may run concurrently
+ * with \c sync .
+ */
+class RecordSegment
+{
+public:
+
+    /**
+     * @brief Create the segment and index files \c path + extension.
+     *
+     * @param [in] path : path of the files without extension.
+     * @param [in] capacity : size in bytes of the segment file.
+     *
+     * @throw \c InitializationException if the files cannot be created or mapped.
+     */
+    DDSROUTER_CORE_DllAPI RecordSegment(
+            const std::string& path,
+            uint64_t capacity);
+
+    //! Close the segment if not closed yet.
+    DDSROUTER_CORE_DllAPI ~RecordSegment();
+
+    /**
+     * @brief Reserve space for a record with a body of \c size bytes.
+     *
+     * The record is not visible until \c commit is called.
+     *
+     * @param [out] offset : offset of the record in the segment file.
+     *
+     * @return Pointer where the body must be written, or nullptr if the record does not fit in the segment.
+     */
+    DDSROUTER_CORE_DllAPI uint8_t* reserve(
+            uint32_t size,
+            uint64_t& offset) noexcept;
+
+    //! Make visible the record reserved last.
+    DDSROUTER_CORE_DllAPI void commit(
+            RecordType type,
+            uint32_t size) noexcept;
+
+    //! Add an entry to the index of the segment.
+    DDSROUTER_CORE_DllAPI void add_index(
+            const RecordIndexEntry& entry);
+
+    /**
+     * @brief Write to disk every record committed and every index entry added so far.
+     *
+     * @return false if the data could not be written.
+     */
+    DDSROUTER_CORE_DllAPI bool sync() noexcept;
+
+    /**
+     * @brief Synchronize the segment, shrink the segment file to the data written and close both files.
+     *
+     * No record can be appended afterwards.
+     */
+    DDSROUTER_CORE_DllAPI void close() noexcept;
+
+    //! Path of the files without extension.
+    DDSROUTER_CORE_DllAPI const std::string& path() const noexcept;
+
+    //! Bytes of the segment file already used.
+    DDSROUTER_CORE_DllAPI uint64_t size() const noexcept;
+
+    //! Size of the largest record body that fits in an empty segment of \c capacity bytes.
+    DDSROUTER_CORE_DllAPI static uint64_t max_record_size(
+            uint64_t capacity) noexcept;
+
+protected:
+
+    const std::string path_;
+
+    const uint64_t capacity_;
+
+    int segment_fd_;
+
+    int index_fd_;
+
+    uint8_t* data_;
+
+    //! End of the committed records.
+    std::atomic<uint64_t> written_;
+
+    //! End of the records already synchronized. Only accessed with \c sync_mutex_ .
+    uint64_t synced_;
+
+    //! Offset of the record reserved last. Only accessed by the appending thread.
+    uint64_t reserved_;
+
+    //! Index entries not yet written to the index file.
+    std::vector<RecordIndexEntry> pending_index_;
+
+    //! Protects \c pending_index_ .
+    std::mutex index_mutex_;
+
+    //! Serializes \c sync and \c close .
+    std::mutex sync_mutex_;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,101 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <ddsrouter_core/library/library_dll.h>
+#include <ddsrouter_core/participants/recorder/RecordFormat.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Sequential reader of a segment file of a recording.
+ *
+ * The segment is mapped in memory and read in order. To read at disk bandwidth, the pages ahead of the current record
+ * are requested to the kernel in advance, in windows of \c prefetch_size bytes, and the pages already read are
+ * released, so reading segments of any size keeps a bounded amount of memory.
+ */
+class RecordSegmentReader
+{
+public:
+
+    /**
+     * @brief Open the segment file \c path + \c RECORD_SEGMENT_EXTENSION .
+     *
+     * @param [in] path : path of the segment without extension.
+     * @param [in] prefetch_size : bytes to read ahead of the current record.
+     *
+     * @throw \c InitializationException if the file cannot be mapped or it is not a segment.
+     */
+    DDSROUTER_CORE_DllAPI RecordSegmentReader(
+            const std::string& path,
+            uint64_t prefetch_size);
+
+    DDSROUTER_CORE_DllAPI ~RecordSegmentReader();
+
+    /**
+     * @brief Get the next record of the segment.
+     *
+     * The body remains valid until the reader is destroyed.
+     *
+     * @return false if there are no more records, or the rest of the segment is corrupt.
+     */
+    DDSROUTER_CORE_DllAPI bool next(
+            RecordType& type,
+            const uint8_t*& body,
+            uint32_t& size) noexcept;
+
+    //! Path of the segment without extension.
+    DDSROUTER_CORE_DllAPI const std::string& path() const noexcept;
+
+    /**
+     * @brief Paths without extension of the segments in \c directory , sorted by name.
+     *
+     * Segments of the same recording are sorted in the order they were written.
+     */
+    DDSROUTER_CORE_DllAPI static std::vector<std::string> list_segments(
+            const std::string& directory);
+
+protected:
+
+    //! Request the next window to the kernel and release the pages already read.
+    void prefetch_() noexcept;
+
+    const std::string path_;
+
+    const uint64_t prefetch_size_;
+
+    uint8_t* data_;
+
+    uint64_t size_;
+
+    //! Offset of the next record.
+    uint64_t offset_;
+
+    //! Offset up to which the pages have been requested.
+    uint64_t prefetched_;
+
+    //! Offset up to which the pages have been released.
+    uint64_t released_;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
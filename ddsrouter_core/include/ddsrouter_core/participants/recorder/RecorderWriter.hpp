@@ -0,0 +1,60 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+#include <ddspipe_core/types/topic/dds/DdsTopic.hpp>
+#include <ddspipe_participants/writer/auxiliar/BaseWriter.hpp>
+
+#include <ddsrouter_core/library/library_dll.h>
+#include <ddsrouter_core/participants/recorder/SegmentRecorder.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Writer of a Recorder Participant.
+ *
+ * It hands every message to the \c SegmentRecorder , that writes it to disk in its own threads.
+ */
+class RecorderWriter : public ddspipe::participants::BaseWriter
+{
+public:
+
+    //! Construct a new RecorderWriter and declare its topic in the recording.
+    DDSROUTER_CORE_DllAPI RecorderWriter(
+            const ddspipe::core::types::ParticipantId& participant_id,
+            const ddspipe::core::types::DdsTopic& topic,
+            const std::shared_ptr<SegmentRecorder>& recorder);
+
+protected:
+
+    utils::ReturnCode write_nts_(
+            ddspipe::core::IRoutingData& data) noexcept override;
+
+    const ddspipe::core::types::DdsTopic topic_;
+
+    std::shared_ptr<SegmentRecorder> recorder_;
+
+    //! Id of the topic in the recording.
+    const uint32_t topic_id_;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
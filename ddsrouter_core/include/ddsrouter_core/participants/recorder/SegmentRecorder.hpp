@@ -0,0 +1,220 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <ddspipe_core/efficiency/payload/PayloadPool.hpp>
+#include <ddspipe_core/types/data/RtpsPayloadData.hpp>
+#include <ddspipe_core/types/topic/dds/DdsTopic.hpp>
+
+#include <ddsrouter_core/configuration/RecorderParticipantConfiguration.hpp>
+#include <ddsrouter_core/library/library_dll.h>
+#include <ddsrouter_core/participants/recorder/RecordSegment.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Writes the messages of a Recorder Participant to segment files.
+ *
+ * Recording a message only takes a reference to its payload and queues it, so the threads forwarding data never
+ * wait for the disk. Two threads of its own do the I/O:
+ *  - The writing thread copies the queued messages to the current segment, and starts a new segment when it is full.
+ *  - The synchronization thread flushes the data written to disk every \c fsync_period , batching every message
+ *    written in the period in a single flush, and closes the full segments.
+ *
+ * If the disk is slower than the incoming data, the queue grows up to \c max_pending_size bytes and the messages
+ * that do not fit are dropped.
+ */
+class SegmentRecorder
+{
+public:
+
+    DDSROUTER_CORE_DllAPI SegmentRecorder(
+            const std::shared_ptr<RecorderParticipantConfiguration>& configuration,
+            const std::shared_ptr<ddspipe::core::PayloadPool>& payload_pool);
+
+    //! Write every message queued, close the current segment and stop the threads.
+    DDSROUTER_CORE_DllAPI ~SegmentRecorder();
+
+    /**
+     * @brief Create the output directory and the first segment, and start the threads.
+     *
+     * @throw \c InitializationException if the output directory or the segment cannot be created.
+     */
+    DDSROUTER_CORE_DllAPI void start();
+
+    /**
+     * @brief Assign an id to \c topic and queue its declaration.
+     *
+     * @return Id of the topic, to be used in \c record .
+     */
+    DDSROUTER_CORE_DllAPI uint32_t register_topic(
+            const ddspipe::core::types::DdsTopic& topic);
+
+    /**
+     * @brief Queue a message to be written.
+     *
+     * The payload is not copied, a reference to it is taken from the payload pool.
+     *
+     * @return false if the message has been dropped because the queue is full or it does not fit in a segment.
+     */
+    DDSROUTER_CORE_DllAPI bool record(
+            uint32_t topic_id,
+            const ddspipe::core::types::RtpsPayloadData& data) noexcept;
+
+    //! Block until every message queued so far has been written and flushed to disk.
+    DDSROUTER_CORE_DllAPI void flush();
+
+    //! Number of messages written.
+    DDSROUTER_CORE_DllAPI uint64_t recorded() const noexcept;
+
+    //! Number of messages dropped.
+    DDSROUTER_CORE_DllAPI uint64_t dropped() const noexcept;
+
+protected:
+
+    //! Topic as written in its declaration record.
+    struct RecordedTopic
+    {
+        uint32_t id;
+        std::string name;
+        std::string type;
+        bool keyed;
+        bool reliable;
+        bool transient_local;
+    };
+
+    //! Entry of the queue: either a topic declaration or a message.
+    struct PendingRecord
+    {
+        //! Set in topic declarations.
+        std::shared_ptr<const RecordedTopic> topic;
+
+        uint32_t topic_id;
+
+        int64_t reception_timestamp;
+
+        //! Reference to the message. Set in messages.
+        std::unique_ptr<ddspipe::core::types::RtpsPayloadData> data;
+    };
+
+    //! Routine of the writing thread.
+    void write_routine_() noexcept;
+
+    //! Routine of the synchronization thread.
+    void sync_routine_() noexcept;
+
+    //! Write a message in the current segment, starting a new one if it does not fit.
+    void write_data_(
+            const PendingRecord& record) noexcept;
+
+    //! Write the declaration of \c topic in the current segment.
+    bool write_topic_(
+            const RecordedTopic& topic) noexcept;
+
+    //! Hand the current segment to the synchronization thread to be closed, and open the next one.
+    bool rotate_() noexcept;
+
+    //! Create the next segment.
+    std::shared_ptr<RecordSegment> open_segment_();
+
+    std::shared_ptr<RecorderParticipantConfiguration> configuration_;
+
+    std::shared_ptr<ddspipe::core::PayloadPool> payload_pool_;
+
+    //! Prefix of the files of this recording, including the directory.
+    std::string recording_prefix_;
+
+    //! Number of segments created.
+    uint32_t segment_count_;
+
+    //! Next topic id to assign.
+    std::atomic<uint32_t> next_topic_id_;
+
+    //! Records waiting to be written.
+    std::deque<PendingRecord> queue_;
+
+    //! Bytes of payload in \c queue_ .
+    uint64_t pending_size_;
+
+    //! Number of records taken from the queue and written to a segment.
+    uint64_t written_count_;
+
+    //! Number of records queued.
+    uint64_t queued_count_;
+
+    //! Protects the queue and its counters.
+    std::mutex queue_mutex_;
+
+    //! Notifies records queued and records written.
+    std::condition_variable queue_cv_;
+
+    //! Topics declared. Only accessed by the writing thread.
+    std::map<uint32_t, std::shared_ptr<const RecordedTopic>> topics_;
+
+    //! Topics declared in the current segment. Only accessed by the writing thread.
+    std::vector<bool> declared_in_segment_;
+
+    //! Segment being written.
+    std::shared_ptr<RecordSegment> current_segment_;
+
+    //! Full segments waiting to be closed.
+    std::vector<std::shared_ptr<RecordSegment>> retired_segments_;
+
+    //! Number of synchronizations started.
+    uint64_t sync_started_;
+
+    //! Number of synchronizations finished.
+    uint64_t sync_finished_;
+
+    //! Whether a synchronization has been requested before its period.
+    bool sync_requested_;
+
+    //! Protects \c current_segment_ , \c retired_segments_ and the synchronization state.
+    std::mutex segments_mutex_;
+
+    //! Notifies the synchronization thread and the threads waiting for a synchronization.
+    std::condition_variable segments_cv_;
+
+    std::atomic<uint64_t> recorded_;
+
+    std::atomic<uint64_t> dropped_;
+
+    //! Whether the writing thread must keep running. Protected by \c queue_mutex_ .
+    bool writing_;
+
+    //! Whether the synchronization thread must keep running. Protected by \c segments_mutex_ .
+    bool syncing_;
+
+    std::thread write_thread_;
+
+    std::thread sync_thread_;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,111 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <ddspipe_core/dynamic/DiscoveryDatabase.hpp>
+#include <ddspipe_core/efficiency/payload/PayloadPool.hpp>
+
+#include <ddsrouter_core/configuration/ReplayerParticipantConfiguration.hpp>
+#include <ddsrouter_core/library/library_dll.h>
+#include <ddsrouter_core/participants/auxiliar/InjectorParticipant.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Participant that publishes in the DDS Router the messages recorded by a Recorder Participant.
+ *
+ * A thread of its own reads the segments of the input directory in order and injects every message in the reader of
+ * its topic, keeping the original time between messages divided by the configured speed.
+ * Every topic is announced as discovered by this participant the first time it appears in the recording, and the
+ * replay waits until the DDS Router is forwarding it, without counting the wait in the replay timing.
+ * Topics that the DDS Router does not forward are skipped.
+ */
+class ReplayerParticipant : public InjectorParticipant
+{
+public:
+
+    DDSROUTER_CORE_DllAPI ReplayerParticipant(
+            const std::shared_ptr<ReplayerParticipantConfiguration>& participant_configuration,
+            const std::shared_ptr<ddspipe::core::PayloadPool>& payload_pool,
+            const std::shared_ptr<ddspipe::core::DiscoveryDatabase>& discovery_database);
+
+    DDSROUTER_CORE_DllAPI ~ReplayerParticipant();
+
+    /**
+     * @brief Find the segments to replay and start replaying them.
+     *
+     * @throw \c InitializationException if the input directory cannot be read.
+     */
+    DDSROUTER_CORE_DllAPI void init();
+
+    //! Number of messages replayed.
+    DDSROUTER_CORE_DllAPI uint64_t replayed() const noexcept;
+
+    //! Whether every segment has been replayed.
+    DDSROUTER_CORE_DllAPI bool finished() const noexcept;
+
+protected:
+
+    //! Routine of the replaying thread.
+    void replay_routine_() noexcept;
+
+    //! Announce a topic the first time it is declared in the recording.
+    void replay_topic_(
+            const uint8_t* body,
+            uint32_t size) noexcept;
+
+    //! Wait for the time of the message and inject it in its reader.
+    void replay_data_(
+            const uint8_t* body,
+            uint32_t size) noexcept;
+
+    std::shared_ptr<ReplayerParticipantConfiguration> configuration_;
+
+    //! Segments to replay, in order.
+    std::vector<std::string> segments_;
+
+    //! Recorded topics by their id in the recording.
+    std::map<uint32_t, InjectedTopic> topics_;
+
+    //! Time when the first message of the recording is replayed.
+    std::chrono::steady_clock::time_point replay_start_;
+
+    //! Reception time of the first message of the recording, in nanoseconds since epoch.
+    int64_t recording_start_;
+
+    //! Whether the first message has been replayed.
+    bool started_;
+
+    std::atomic<uint64_t> replayed_;
+
+    std::atomic<bool> finished_;
+
+    std::thread replay_thread_;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
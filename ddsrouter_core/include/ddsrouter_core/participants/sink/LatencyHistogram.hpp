@@ -0,0 +1,94 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+#include <ddsrouter_core/efficiency/counters/PerThreadCounter.hpp>
+#include <ddsrouter_core/library/library_dll.h>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Lock-free histogram of latencies in nanoseconds.
+ *
+ * Values are counted in log-linear buckets: every power of two is split in \c SUB_BUCKETS buckets, so percentiles
+ * are known with a relative error below 1 / \c SUB_BUCKETS , whatever the magnitude of the latency, with a fixed
+ * amount of memory. Adding a value is a few relaxed atomic operations, so it can be done from every writer at once.
+ * The count and the sum, updated with every value, are kept per thread.
+ */
+class LatencyHistogram
+{
+public:
+
+    //! Buckets per power of two.
+    static constexpr uint32_t SUB_BUCKETS = 8;
+
+    DDSROUTER_CORE_DllAPI LatencyHistogram();
+
+    //! Count a latency. Negative latencies are counted as 0.
+    DDSROUTER_CORE_DllAPI void add(
+            int64_t nanoseconds) noexcept;
+
+    //! Number of latencies counted.
+    DDSROUTER_CORE_DllAPI uint64_t count() const noexcept;
+
+    DDSROUTER_CORE_DllAPI int64_t min() const noexcept;
+
+    DDSROUTER_CORE_DllAPI int64_t max() const noexcept;
+
+    DDSROUTER_CORE_DllAPI int64_t mean() const noexcept;
+
+    /**
+     * @brief Latency below which are the \c quantile of the latencies counted.
+     *
+     * @param [in] quantile : between 0 and 1, e.g. 0.99 for the 99th percentile.
+     *
+     * @return middle of the bucket of the percentile, or 0 if nothing has been counted.
+     */
+    DDSROUTER_CORE_DllAPI int64_t percentile(
+            double quantile) const noexcept;
+
+protected:
+
+    //! Powers of two covered, up to ~18 minutes.
+    static constexpr uint32_t MAX_EXPONENT = 40;
+
+    static constexpr uint32_t BUCKETS = (MAX_EXPONENT + 1) * SUB_BUCKETS;
+
+    static uint32_t bucket_(
+            uint64_t value) noexcept;
+
+    static uint64_t bucket_lower_bound_(
+            uint32_t bucket) noexcept;
+
+    std::array<std::atomic<uint64_t>, BUCKETS> buckets_;
+
+    PerThreadCounter count_;
+
+    PerThreadCounter sum_;
+
+    std::atomic<int64_t> min_;
+
+    std::atomic<int64_t> max_;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,120 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <ddspipe_core/dynamic/DiscoveryDatabase.hpp>
+#include <ddspipe_core/efficiency/payload/PayloadPool.hpp>
+#include <ddspipe_core/interface/IParticipant.hpp>
+#include <ddspipe_core/types/topic/dds/DdsTopic.hpp>
+
+#include <ddsrouter_core/configuration/SinkParticipantConfiguration.hpp>
+#include <ddsrouter_core/library/library_dll.h>
+#include <ddsrouter_core/participants/sink/SinkStatistics.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Participant that measures the messages forwarded to it and drops them.
+ *
+ * Each topic allowed in the DDS Router gets a \c SinkWriter that counts its messages and, for the ones created by a
+ * Generator Participant, their latency and the continuity of their sequence. The throughput and latency are logged
+ * periodically and can be queried, along with the counters of each topic, with \c report .
+ * The messages received and lost in each topic are notified to the topics monitor periodically too, from the counters
+ * of the topic, instead of by the writers with every message.
+ * This participant does not discover nor publish anything.
+ */
+class SinkParticipant : public ddspipe::core::IParticipant
+{
+public:
+
+    DDSROUTER_CORE_DllAPI SinkParticipant(
+            const std::shared_ptr<SinkParticipantConfiguration>& participant_configuration,
+            const std::shared_ptr<ddspipe::core::PayloadPool>& payload_pool,
+            const std::shared_ptr<ddspipe::core::DiscoveryDatabase>& discovery_database);
+
+    DDSROUTER_CORE_DllAPI ~SinkParticipant();
+
+    //! Start logging the periodic reports and notifying the topics monitor.
+    DDSROUTER_CORE_DllAPI void init();
+
+    DDSROUTER_CORE_DllAPI ddspipe::core::types::ParticipantId id() const noexcept override;
+
+    DDSROUTER_CORE_DllAPI bool is_repeater() const noexcept override;
+
+    DDSROUTER_CORE_DllAPI bool is_rtps_kind() const noexcept override;
+
+    DDSROUTER_CORE_DllAPI ddspipe::core::types::TopicQoS topic_qos() const noexcept override;
+
+    DDSROUTER_CORE_DllAPI std::shared_ptr<ddspipe::core::IWriter> create_writer(
+            const ddspipe::core::ITopic& topic) override;
+
+    DDSROUTER_CORE_DllAPI std::shared_ptr<ddspipe::core::IReader> create_reader(
+            const ddspipe::core::ITopic& topic) override;
+
+    //! Measures since the participant was created, in total and for each topic.
+    DDSROUTER_CORE_DllAPI SinkReport report() const noexcept;
+
+protected:
+
+    //! Topic notified to the topics monitor, with the counters already notified.
+    struct MonitoredTopic
+    {
+        ddspipe::core::types::DdsTopic topic;
+
+        std::shared_ptr<SinkTopicStatistics> statistics;
+
+        SinkTopicReport notified;
+    };
+
+    //! Routine of the thread that logs the reports and notifies the topics monitor.
+    void report_routine_() noexcept;
+
+    //! Notify the topics monitor of the messages received and lost since the last time.
+    void notify_monitor_() noexcept;
+
+    //! Period in milliseconds of the notifications to the topics monitor when reports are not logged.
+    static constexpr unsigned int MONITOR_PERIOD = 1000;
+
+    std::shared_ptr<SinkParticipantConfiguration> configuration_;
+
+    std::shared_ptr<SinkStatistics> statistics_;
+
+    //! Guards \c monitored_topics_ .
+    std::mutex monitored_topics_mutex_;
+
+    std::vector<MonitoredTopic> monitored_topics_;
+
+    std::mutex mutex_;
+
+    //! Notifies the reporting thread to stop.
+    std::condition_variable cv_;
+
+    //! Whether the reporting thread must keep running. Guarded by \c mutex_ .
+    bool running_;
+
+    std::thread report_thread_;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
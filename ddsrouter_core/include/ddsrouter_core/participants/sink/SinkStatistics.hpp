@@ -0,0 +1,166 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include <ddsrouter_core/efficiency/counters/PerThreadCounter.hpp>
+#include <ddsrouter_core/library/library_dll.h>
+#include <ddsrouter_core/participants/sink/LatencyHistogram.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+//! Snapshot of the measures of a topic in a Sink Participant.
+struct SinkTopicReport
+{
+    //! Messages received.
+    uint64_t messages = 0;
+
+    //! Bytes of payload received.
+    uint64_t bytes = 0;
+
+    //! Generated messages missing in the sequence of the topic when a later one arrived.
+    //! Only counted if the sequence is checked.
+    uint64_t lost = 0;
+
+    //! Generated messages received after a later one of the topic. Only counted if the sequence is checked.
+    uint64_t out_of_order = 0;
+};
+
+//! Snapshot of the measures of a Sink Participant.
+struct SinkReport
+{
+    //! Messages received.
+    uint64_t messages = 0;
+
+    //! Bytes of payload received.
+    uint64_t bytes = 0;
+
+    //! Messages received that were created by a Generator Participant, whose latency is measured.
+    uint64_t generated = 0;
+
+    //! Latencies of the generated messages, in nanoseconds.
+    int64_t latency_min = 0;
+    int64_t latency_mean = 0;
+    int64_t latency_p50 = 0;
+    int64_t latency_p99 = 0;
+    int64_t latency_max = 0;
+
+    //! Generated messages lost in every topic.
+    uint64_t lost = 0;
+
+    //! Generated messages received out of order in every topic.
+    uint64_t out_of_order = 0;
+
+    //! Measures of each topic, by topic name.
+    std::map<std::string, SinkTopicReport> topics;
+};
+
+/**
+ * Measures of the messages received in a topic of a Sink Participant.
+ *
+ * Updated with relaxed atomic operations only, as messages may arrive from different tracks at the same time.
+ */
+class SinkTopicStatistics
+{
+public:
+
+    DDSROUTER_CORE_DllAPI SinkTopicStatistics();
+
+    //! Count a message of \c size bytes.
+    DDSROUTER_CORE_DllAPI void add_message(
+            uint64_t size) noexcept;
+
+    /**
+     * @brief Check the continuity of the sequence of generated messages.
+     *
+     * A \c sequence further than the next expected counts the ones in between as lost,
+     * and a \c sequence older than the last one received counts as out of order.
+     *
+     * @return number of messages lost right before this one.
+     */
+    DDSROUTER_CORE_DllAPI uint64_t add_sequence(
+            uint64_t sequence) noexcept;
+
+    DDSROUTER_CORE_DllAPI SinkTopicReport report() const noexcept;
+
+protected:
+
+    std::atomic<uint64_t> messages_;
+
+    std::atomic<uint64_t> bytes_;
+
+    std::atomic<uint64_t> lost_;
+
+    std::atomic<uint64_t> out_of_order_;
+
+    //! Highest sequence received.
+    std::atomic<uint64_t> last_sequence_;
+};
+
+/**
+ * Measures of the messages received by the writers of a Sink Participant.
+ *
+ * Every writer counts in the same statistics, and also in the statistics of its topic. As writers of different
+ * topics count from different threads at once, these counters are kept per thread and only summed in \c report .
+ */
+class SinkStatistics
+{
+public:
+
+    DDSROUTER_CORE_DllAPI SinkStatistics();
+
+    //! Count a message of \c size bytes.
+    DDSROUTER_CORE_DllAPI void add_message(
+            uint64_t size) noexcept;
+
+    //! Count the latency of a generated message.
+    DDSROUTER_CORE_DllAPI void add_latency(
+            int64_t nanoseconds) noexcept;
+
+    /**
+     * @brief Statistics of the topic \c topic_name .
+     *
+     * They are created the first time a topic is requested, and shared by every writer of the topic afterwards.
+     */
+    DDSROUTER_CORE_DllAPI std::shared_ptr<SinkTopicStatistics> topic(
+            const std::string& topic_name);
+
+    DDSROUTER_CORE_DllAPI SinkReport report() const noexcept;
+
+protected:
+
+    PerThreadCounter messages_;
+
+    PerThreadCounter bytes_;
+
+    LatencyHistogram latency_;
+
+    //! Guards \c topics_ .
+    mutable std::mutex mutex_;
+
+    std::map<std::string, std::shared_ptr<SinkTopicStatistics>> topics_;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,64 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <memory>
+
+#include <ddspipe_core/types/topic/dds/DdsTopic.hpp>
+#include <ddspipe_participants/writer/auxiliar/BaseWriter.hpp>
+
+#include <ddsrouter_core/library/library_dll.h>
+#include <ddsrouter_core/participants/sink/SinkStatistics.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Writer of a Sink Participant.
+ *
+ * It counts every message it receives in the statistics of the participant and of its topic and, for messages
+ * created by a Generator Participant, their latency and optionally the continuity of their sequence.
+ * Nothing is serialized, sent nor logged. The participant notifies the received and lost messages to the topics
+ * monitor, so notifying does not block the threads forwarding the data.
+ */
+class SinkWriter : public ddspipe::participants::BaseWriter
+{
+public:
+
+    DDSROUTER_CORE_DllAPI SinkWriter(
+            const ddspipe::core::types::ParticipantId& participant_id,
+            const ddspipe::core::types::DdsTopic& topic,
+            const std::shared_ptr<SinkStatistics>& statistics,
+            bool check_sequence);
+
+protected:
+
+    utils::ReturnCode write_nts_(
+            ddspipe::core::IRoutingData& data) noexcept override;
+
+    const ddspipe::core::types::DdsTopic topic_;
+
+    std::shared_ptr<SinkStatistics> statistics_;
+
+    std::shared_ptr<SinkTopicStatistics> topic_statistics_;
+
+    //! Whether to check the sequence of the generated messages.
+    const bool check_sequence_;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
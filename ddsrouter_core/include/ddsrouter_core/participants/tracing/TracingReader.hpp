@@ -0,0 +1,62 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <memory>
+
+#include <ddsrouter_core/library/library_dll.h>
+#include <ddsrouter_core/monitoring/PipelineTracer.hpp>
+#include <ddsrouter_core/participants/decorator/ReaderDecorator.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Reader decorator that traces the notification, enqueue, dequeue and payload copy of its samples.
+ *
+ * Each sample taken becomes the current sample of the thread, so the writers that forward it record it as their
+ * source.
+ */
+class TracingReader : public ReaderDecorator
+{
+public:
+
+    DDSROUTER_CORE_DllAPI TracingReader(
+            const std::shared_ptr<ddspipe::core::IReader>& reader,
+            const std::shared_ptr<PipelineTracer>& tracer,
+            const std::shared_ptr<TracedEndpoint>& endpoint);
+
+    DDSROUTER_CORE_DllAPI void set_on_data_available_callback(
+            std::function<void()> on_data_available_lambda) noexcept override;
+
+    DDSROUTER_CORE_DllAPI utils::ReturnCode take(
+            std::unique_ptr<ddspipe::core::IRoutingData>& data) noexcept override;
+
+protected:
+
+    std::shared_ptr<PipelineTracer> tracer_;
+
+    std::shared_ptr<TracedEndpoint> endpoint_;
+
+    //! Whether a thread is taking the data of the reader. Only the thread of its slot takes.
+    std::atomic<bool> taking_;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,51 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <memory>
+
+#include <ddsrouter_core/library/library_dll.h>
+#include <ddsrouter_core/monitoring/PipelineTracer.hpp>
+#include <ddsrouter_core/participants/decorator/WriterDecorator.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Writer decorator that traces the writing of the samples, along with the reader they come from.
+ */
+class TracingWriter : public WriterDecorator
+{
+public:
+
+    DDSROUTER_CORE_DllAPI TracingWriter(
+            const std::shared_ptr<ddspipe::core::IWriter>& writer,
+            const std::shared_ptr<PipelineTracer>& tracer,
+            const std::shared_ptr<TracedEndpoint>& endpoint);
+
+    DDSROUTER_CORE_DllAPI utils::ReturnCode write(
+            ddspipe::core::IRoutingData& data) noexcept override;
+
+protected:
+
+    std::shared_ptr<PipelineTracer> tracer_;
+
+    std::shared_ptr<TracedEndpoint> endpoint_;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -28,7 +28,13 @@ ENUMERATION_BUILDER(
     initial_peers,
     discovery_server,
     echo,
-    xml
+    xml,
+    ipc,
+    inprocess,
+    recorder,
+    replayer,
+    generator,
+    sink
     );
 
 eProsima_ENUMERATION_BUILDER(
@@ -39,7 +45,13 @@ eProsima_ENUMERATION_BUILDER(
                     { ParticipantKind::initial_peers COMMA {"wan" COMMA "router" COMMA "initial-peers"} } COMMA
                     { ParticipantKind::discovery_server COMMA {"discovery-server" COMMA "ds" COMMA "local-ds" COMMA "local-discovery-server" COMMA "wan-ds" COMMA "wan-discovery-server"} } COMMA
                     { ParticipantKind::echo COMMA {"echo"} } COMMA
-                    { ParticipantKind::xml COMMA {"xml" COMMA "XML"} }
+                    { ParticipantKind::xml COMMA {"xml" COMMA "XML"} } COMMA
+                    { ParticipantKind::ipc COMMA {"ipc" COMMA "shm-ipc"} } COMMA
+                    { ParticipantKind::inprocess COMMA {"inprocess" COMMA "in-process"} } COMMA
+                    { ParticipantKind::recorder COMMA {"recorder" COMMA "record"} } COMMA
+                    { ParticipantKind::replayer COMMA {"replayer" COMMA "replay"} } COMMA
+                    { ParticipantKind::generator COMMA {"generator" COMMA "load-generator"} } COMMA
+                    { ParticipantKind::sink COMMA {"sink" COMMA "null"} }
                 }
     );
 
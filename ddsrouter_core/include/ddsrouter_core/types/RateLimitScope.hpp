@@ -0,0 +1,41 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cpp_utils/macros/custom_enumeration.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+namespace types {
+
+/**
+ * Entity whose traffic is shaped by a rate limit.
+ *
+ * - topic : every topic matching the filter has its own bucket, checked when the data is received.
+ * - participant : the participant has a single bucket for every topic it transmits.
+ * - route : the pair (source participant, destination participant) has a single bucket for every topic.
+ */
+ENUMERATION_BUILDER(
+    RateLimitScope,
+    topic,
+    participant,
+    route
+    );
+
+} /* namespace types */
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
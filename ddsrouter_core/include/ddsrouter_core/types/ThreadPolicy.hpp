@@ -0,0 +1,47 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cpp_utils/macros/custom_enumeration.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+namespace types {
+
+/**
+ * Scheduling policy of a class of threads.
+ *
+ * - inherited : keep the policy of the thread that creates them.
+ * - other : default time sharing policy.
+ * - fifo : real time, first in first out. Requires privileges.
+ * - round_robin : real time, round robin. Requires privileges.
+ * - batch : time sharing for CPU intensive threads, which are preempted less often.
+ * - idle : only run when the CPU has nothing else to do.
+ */
+ENUMERATION_BUILDER(
+    ThreadPolicy,
+    inherited,
+    other,
+    fifo,
+    round_robin,
+    batch,
+    idle
+    );
+
+} /* namespace types */
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -33,4 +33,5 @@ set(fastrtps_MINIMUM_VERSION "2.8")
 
 set(MODULE_DEPENDENCIES
     $<$<BOOL:${WIN32}>:iphlpapi$<SEMICOLON>Shlwapi>
+    $<$<BOOL:${UNIX}>:${CMAKE_DL_LIBS}>
     ${MODULE_FIND_PACKAGES})
@@ -0,0 +1,57 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file BinaryLogConfiguration.cpp
+ *
+ */
+
+#include <ddsrouter_core/configuration/BinaryLogConfiguration.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+bool BinaryLogConfiguration::is_valid(
+        utils::Formatter& error_msg) const noexcept
+{
+    if (!enabled)
+    {
+        return true;
+    }
+
+    if (buffer_size < MIN_BUFFER_SIZE)
+    {
+        error_msg << "The binary log buffer size must be at least " << MIN_BUFFER_SIZE << " bytes.";
+        return false;
+    }
+
+    if (period == 0)
+    {
+        error_msg << "The binary log period must be greater than 0.";
+        return false;
+    }
+
+    if (output_directory.empty())
+    {
+        error_msg << "The output directory of the binary log must not be empty.";
+        return false;
+    }
+
+    return true;
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,53 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ContentFilterConfiguration.cpp
+ *
+ */
+
+#include <exception>
+
+#include <ddsrouter_core/configuration/ContentFilterConfiguration.hpp>
+#include <ddsrouter_core/efficiency/filter/CdrPredicate.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+bool ContentFilterConfiguration::is_valid(
+        utils::Formatter& error_msg) const noexcept
+{
+    if (expression.empty())
+    {
+        error_msg << "Content filter requires an expression. ";
+        return false;
+    }
+
+    try
+    {
+        CdrPredicate predicate(expression, parameters, fields);
+    }
+    catch (const std::exception& e)
+    {
+        error_msg << "Content filter <" << expression << "> is not valid: " << e.what() << " ";
+        return false;
+    }
+
+    return true;
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -25,6 +25,12 @@
 #include <ddspipe_participants/configuration/SimpleParticipantConfiguration.hpp>
 
 #include <ddsrouter_core/configuration/DdsRouterConfiguration.hpp>
+#include <ddsrouter_core/configuration/GeneratorParticipantConfiguration.hpp>
+#include <ddsrouter_core/configuration/InProcessParticipantConfiguration.hpp>
+#include <ddsrouter_core/configuration/IpcParticipantConfiguration.hpp>
+#include <ddsrouter_core/configuration/RecorderParticipantConfiguration.hpp>
+#include <ddsrouter_core/configuration/ReplayerParticipantConfiguration.hpp>
+#include <ddsrouter_core/configuration/SinkParticipantConfiguration.hpp>
 #include <ddsrouter_core/types/ParticipantKind.hpp>
 
 namespace eprosima {
@@ -98,6 +104,51 @@ bool DdsRouterConfiguration::is_valid(
         return false;
     }
 
+    // Check that rate limits only reference existing participants
+    for (const auto& rate_limit : advanced_options.rate_limits)
+    {
+        std::set<ddspipe::core::types::ParticipantId> referenced;
+
+        if (rate_limit.scope == types::RateLimitScope::participant)
+        {
+            referenced.insert(rate_limit.participant_id);
+        }
+        else if (rate_limit.scope == types::RateLimitScope::route)
+        {
+            referenced.insert(rate_limit.source_participant_id);
+            referenced.insert(rate_limit.destination_participant_id);
+        }
+
+        for (const auto& participant_id : referenced)
+        {
+            if (ids.find(participant_id) == ids.end())
+            {
+                error_msg << "Rate limit references unknown participant " << participant_id << ". ";
+                return false;
+            }
+        }
+    }
+
+    // Check that content filters only reference existing participants
+    for (const auto& content_filter : advanced_options.content_filters)
+    {
+        if (!content_filter.participant_id.empty() && ids.find(content_filter.participant_id) == ids.end())
+        {
+            error_msg << "Content filter references unknown participant " << content_filter.participant_id << ". ";
+            return false;
+        }
+    }
+
+    // Check that projections only reference existing participants
+    for (const auto& projection : advanced_options.projections)
+    {
+        if (!projection.participant_id.empty() && ids.find(projection.participant_id) == ids.end())
+        {
+            error_msg << "Projection references unknown participant " << projection.participant_id << ". ";
+            return false;
+        }
+    }
+
     // Check that xml configuration files are accessible
     if (!xml_configuration.is_valid(error_msg))
     {
@@ -137,6 +188,30 @@ bool DdsRouterConfiguration::check_correct_configuration_object_(
             return check_correct_configuration_object_by_type_<ddspipe::participants::EchoParticipantConfiguration>(
                 configuration.second);
 
+        case types::ParticipantKind::ipc:
+            return check_correct_configuration_object_by_type_<IpcParticipantConfiguration>(
+                configuration.second);
+
+        case types::ParticipantKind::inprocess:
+            return check_correct_configuration_object_by_type_<InProcessParticipantConfiguration>(
+                configuration.second);
+
+        case types::ParticipantKind::recorder:
+            return check_correct_configuration_object_by_type_<RecorderParticipantConfiguration>(
+                configuration.second);
+
+        case types::ParticipantKind::replayer:
+            return check_correct_configuration_object_by_type_<ReplayerParticipantConfiguration>(
+                configuration.second);
+
+        case types::ParticipantKind::generator:
+            return check_correct_configuration_object_by_type_<GeneratorParticipantConfiguration>(
+                configuration.second);
+
+        case types::ParticipantKind::sink:
+            return check_correct_configuration_object_by_type_<SinkParticipantConfiguration>(
+                configuration.second);
+
         default:
             return check_correct_configuration_object_by_type_<ddspipe::participants::ParticipantConfiguration>(
                 configuration.second);
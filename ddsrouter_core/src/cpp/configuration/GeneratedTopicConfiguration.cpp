@@ -0,0 +1,76 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file GeneratedTopicConfiguration.cpp
+ *
+ */
+
+#include <ddsrouter_core/configuration/GeneratedTopicConfiguration.hpp>
+#include <ddsrouter_core/participants/generator/GeneratedPayload.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+bool GeneratedTopicConfiguration::is_valid(
+        utils::Formatter& error_msg) const noexcept
+{
+    if (topic_name.empty())
+    {
+        error_msg << "Generated topic name cannot be empty. ";
+        return false;
+    }
+
+    if (!(rate >= 0))
+    {
+        error_msg << "Rate of generated topic " << topic_name << " cannot be negative. ";
+        return false;
+    }
+
+    if (size < GENERATED_PAYLOAD_MIN_SIZE)
+    {
+        error_msg << "Size of generated topic " << topic_name << " must be at least " << GENERATED_PAYLOAD_MIN_SIZE
+                  << " bytes. ";
+        return false;
+    }
+
+    if (max_size != 0 && max_size < size)
+    {
+        error_msg << "Maximum size of generated topic " << topic_name << " cannot be smaller than its size. ";
+        return false;
+    }
+
+    if (burst == 0)
+    {
+        error_msg << "Burst of generated topic " << topic_name << " must be greater than 0. ";
+        return false;
+    }
+
+    return true;
+}
+
+std::string GeneratedTopicConfiguration::effective_type_name() const noexcept
+{
+    if (!type_name.empty())
+    {
+        return type_name;
+    }
+
+    return keys > 0 ? GENERATED_KEYED_PAYLOAD_TYPE_NAME : GENERATED_PAYLOAD_TYPE_NAME;
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,57 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file GeneratorParticipantConfiguration.cpp
+ *
+ */
+
+#include <set>
+#include <string>
+
+#include <ddsrouter_core/configuration/GeneratorParticipantConfiguration.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+bool GeneratorParticipantConfiguration::is_valid(
+        utils::Formatter& error_msg) const noexcept
+{
+    if (!ParticipantConfiguration::is_valid(error_msg))
+    {
+        return false;
+    }
+
+    std::set<std::string> topic_names;
+    for (const auto& topic : topics)
+    {
+        if (!topic.is_valid(error_msg))
+        {
+            return false;
+        }
+
+        if (!topic_names.insert(topic.topic_name).second)
+        {
+            error_msg << "Generated topic " << topic.topic_name << " is repeated. ";
+            return false;
+        }
+    }
+
+    return true;
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,65 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file IpcParticipantConfiguration.cpp
+ *
+ */
+
+#include <ddsrouter_core/configuration/IpcParticipantConfiguration.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+//! Minimum ring size, so the rings fit the usual samples.
+constexpr uint64_t MIN_IPC_RING_SIZE = 64 * 1024;
+
+bool IpcParticipantConfiguration::is_valid(
+        utils::Formatter& error_msg) const noexcept
+{
+    if (!ParticipantConfiguration::is_valid(error_msg))
+    {
+        return false;
+    }
+
+#if defined(__linux__)
+    if (channel.empty())
+    {
+        error_msg << "IPC channel name cannot be empty. ";
+        return false;
+    }
+
+    if (channel.find('/') != std::string::npos)
+    {
+        error_msg << "IPC channel name " << channel << " cannot contain '/'. ";
+        return false;
+    }
+
+    if (ring_size < MIN_IPC_RING_SIZE || (ring_size & (ring_size - 1)) != 0)
+    {
+        error_msg << "IPC ring size must be a power of two of at least " << MIN_IPC_RING_SIZE << " bytes. ";
+        return false;
+    }
+
+    return true;
+#else
+    error_msg << "IPC participants are only supported in Linux. ";
+    return false;
+#endif // defined(__linux__)
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,46 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file LogThrottleConfiguration.cpp
+ *
+ */
+
+#include <ddsrouter_core/configuration/LogThrottleConfiguration.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+bool LogThrottleConfiguration::is_valid(
+        utils::Formatter& error_msg) const noexcept
+{
+    if (category.empty())
+    {
+        error_msg << "The log throttle requires a category. ";
+        return false;
+    }
+
+    if (max_per_second == 0)
+    {
+        error_msg << "The entries per second of the log throttle of " << category << " must be greater than 0. ";
+        return false;
+    }
+
+    return true;
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,61 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file MetricsExporterConfiguration.cpp
+ *
+ */
+
+#if defined(__linux__)
+#include <arpa/inet.h>
+#endif // defined(__linux__)
+
+#include <ddsrouter_core/configuration/MetricsExporterConfiguration.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+bool MetricsExporterConfiguration::is_valid(
+        utils::Formatter& error_msg) const noexcept
+{
+    if (!enabled)
+    {
+        return true;
+    }
+
+#if defined(__linux__)
+    in_addr parsed_address{};
+    if (inet_pton(AF_INET, address.c_str(), &parsed_address) != 1)
+    {
+        error_msg << "Metrics exporter address " << address << " is not a valid IPv4 address.";
+        return false;
+    }
+
+    if (period == 0)
+    {
+        error_msg << "The period of the metrics exporter must be greater than 0.";
+        return false;
+    }
+
+    return true;
+#else
+    error_msg << "The metrics exporter is only supported in Linux.";
+    return false;
+#endif // defined(__linux__)
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
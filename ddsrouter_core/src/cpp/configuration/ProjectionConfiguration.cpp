@@ -0,0 +1,53 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ProjectionConfiguration.cpp
+ *
+ */
+
+#include <exception>
+
+#include <ddsrouter_core/configuration/ProjectionConfiguration.hpp>
+#include <ddsrouter_core/efficiency/cdr/CdrProjection.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+bool ProjectionConfiguration::is_valid(
+        utils::Formatter& error_msg) const noexcept
+{
+    try
+    {
+        CdrProjection projection(fields, strip);
+    }
+    catch (const std::exception& e)
+    {
+        error_msg << "Projection is not valid: " << e.what() << " ";
+        return false;
+    }
+
+    return true;
+}
+
+std::string ProjectionConfiguration::derived_type_name(
+        const std::string& type_name) const
+{
+    return this->type_name.empty() ? type_name + DERIVED_TYPE_SUFFIX : this->type_name;
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,75 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file RateLimitConfiguration.cpp
+ *
+ */
+
+#include <ddsrouter_core/configuration/RateLimitConfiguration.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+bool RateLimitConfiguration::is_valid(
+        utils::Formatter& error_msg) const noexcept
+{
+    if (max_msgs_per_second < 0 || max_bytes_per_second < 0)
+    {
+        error_msg << "Rate limits cannot be negative. ";
+        return false;
+    }
+
+    if (max_msgs_per_second == 0 && max_bytes_per_second == 0)
+    {
+        error_msg << "Rate limit must set a maximum number of messages or bytes per second. ";
+        return false;
+    }
+
+    if (per_instance && scope != types::RateLimitScope::topic)
+    {
+        error_msg << "Only topic rate limits can be applied per instance. ";
+        return false;
+    }
+
+    switch (scope)
+    {
+        case types::RateLimitScope::participant:
+            if (participant_id.empty())
+            {
+                error_msg << "Participant rate limit requires a participant. ";
+                return false;
+            }
+            break;
+
+        case types::RateLimitScope::route:
+            if (source_participant_id.empty() || destination_participant_id.empty())
+            {
+                error_msg << "Route rate limit requires a source and a destination participant. ";
+                return false;
+            }
+            break;
+
+        case types::RateLimitScope::topic:
+        default:
+            break;
+    }
+
+    return true;
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,71 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file RecorderParticipantConfiguration.cpp
+ *
+ */
+
+#include <ddsrouter_core/configuration/RecorderParticipantConfiguration.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+//! Minimum segment size, so a segment holds more than a handful of the usual samples.
+constexpr uint64_t MIN_RECORDER_SEGMENT_SIZE = 1024 * 1024;
+
+bool RecorderParticipantConfiguration::is_valid(
+        utils::Formatter& error_msg) const noexcept
+{
+    if (!ParticipantConfiguration::is_valid(error_msg))
+    {
+        return false;
+    }
+
+#if defined(__linux__)
+    if (output_directory.empty())
+    {
+        error_msg << "Recorder output directory cannot be empty. ";
+        return false;
+    }
+
+    if (segment_size < MIN_RECORDER_SEGMENT_SIZE)
+    {
+        error_msg << "Recorder segment size must be at least " << MIN_RECORDER_SEGMENT_SIZE << " bytes. ";
+        return false;
+    }
+
+    if (fsync_period == 0)
+    {
+        error_msg << "Recorder fsync period must be greater than 0. ";
+        return false;
+    }
+
+    if (max_pending_size == 0)
+    {
+        error_msg << "Recorder max pending size must be greater than 0. ";
+        return false;
+    }
+
+    return true;
+#else
+    error_msg << "Recorder participants are only supported in Linux. ";
+    return false;
+#endif // defined(__linux__)
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,62 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ReplayerParticipantConfiguration.cpp
+ *
+ */
+
+#include <ddsrouter_core/configuration/ReplayerParticipantConfiguration.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+bool ReplayerParticipantConfiguration::is_valid(
+        utils::Formatter& error_msg) const noexcept
+{
+    if (!ParticipantConfiguration::is_valid(error_msg))
+    {
+        return false;
+    }
+
+#if defined(__linux__)
+    if (input_directory.empty())
+    {
+        error_msg << "Replayer input directory cannot be empty. ";
+        return false;
+    }
+
+    if (!(speed >= 0))
+    {
+        error_msg << "Replayer speed cannot be negative. ";
+        return false;
+    }
+
+    if (prefetch_size == 0)
+    {
+        error_msg << "Replayer prefetch size must be greater than 0. ";
+        return false;
+    }
+
+    return true;
+#else
+    error_msg << "Replayer participants are only supported in Linux. ";
+    return false;
+#endif // defined(__linux__)
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -35,6 +35,110 @@ bool SpecsConfiguration::is_valid(
         return false;
     }
 
+    if (!forwarding_threads.is_valid(error_msg) ||
+            !participant_threads.is_valid(error_msg) ||
+            !housekeeping_threads.is_valid(error_msg))
+    {
+        return false;
+    }
+
+    if (min_threads > 0 || max_threads > 0)
+    {
+        if (min_threads < 1)
+        {
+            error_msg << "Minimum threads must be at least 1.";
+            return false;
+        }
+
+        if (max_threads < min_threads)
+        {
+            error_msg << "Maximum threads must be at least the minimum threads.";
+            return false;
+        }
+
+        if (target_queue_latency == 0)
+        {
+            error_msg << "Target queue latency must be greater than 0.";
+            return false;
+        }
+    }
+
+    if (thread_pool_monitor && thread_pool_monitor_period == 0)
+    {
+        error_msg << "The period of the thread pool monitor must be greater than 0.";
+        return false;
+    }
+
+    if (!binary_log.is_valid(error_msg))
+    {
+        return false;
+    }
+
+    for (const auto& log_throttle : log_throttles)
+    {
+        if (!log_throttle.is_valid(error_msg))
+        {
+            return false;
+        }
+    }
+
+    if (!metrics_exporter.is_valid(error_msg))
+    {
+        return false;
+    }
+
+    if (!profiler.is_valid(error_msg))
+    {
+        return false;
+    }
+
+    if (!tracing.is_valid(error_msg))
+    {
+        return false;
+    }
+
+    for (const auto& content_filter : content_filters)
+    {
+        if (!content_filter.is_valid(error_msg))
+        {
+            return false;
+        }
+    }
+
+    for (const auto& projection : projections)
+    {
+        if (!projection.is_valid(error_msg))
+        {
+            return false;
+        }
+    }
+
+    for (const auto& rate_limit : rate_limits)
+    {
+        if (!rate_limit.is_valid(error_msg))
+        {
+            return false;
+        }
+    }
+
+    if (writers_idle_ttl > 0 && !lazy_writers)
+    {
+        error_msg << "Idle writers can only be destroyed if they are lazy.";
+        return false;
+    }
+
+    if (!discovery_cache.empty() && discovery_cache_ttl == 0)
+    {
+        error_msg << "The endpoints of the discovery cache must have time to be discovered again.";
+        return false;
+    }
+
+    if (preallocate_histories && max_sample_size == 0)
+    {
+        error_msg << "The maximum sample size is required to preallocate the histories.";
+        return false;
+    }
+
     if (topic_qos.history_depth == 0U)
     {
         logWarning(DDSROUTER_SPECS, "Using non limited histories could lead to memory exhaustion in long executions.");
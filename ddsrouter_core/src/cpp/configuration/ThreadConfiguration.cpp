@@ -0,0 +1,72 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ThreadConfiguration.cpp
+ *
+ */
+
+#include <ddsrouter_core/configuration/ThreadConfiguration.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+//! Maximum length of a thread name, without the null terminator.
+constexpr std::size_t MAX_THREAD_NAME_LENGTH = 15;
+
+//! Maximum number of CPUs that an affinity may refer to.
+constexpr uint32_t MAX_THREAD_CPUS = 1024;
+
+bool ThreadConfiguration::is_valid(
+        utils::Formatter& error_msg) const noexcept
+{
+    if (name.size() > MAX_THREAD_NAME_LENGTH)
+    {
+        error_msg << "Thread name " << name << " is longer than " << MAX_THREAD_NAME_LENGTH << " characters.";
+        return false;
+    }
+
+    if (!affinity.empty() && *affinity.rbegin() >= MAX_THREAD_CPUS)
+    {
+        error_msg << "Thread affinity refers to CPU " << *affinity.rbegin() << ", but there are at most "
+                  << MAX_THREAD_CPUS << " CPUs.";
+        return false;
+    }
+
+    const bool real_time = policy == types::ThreadPolicy::fifo || policy == types::ThreadPolicy::round_robin;
+
+    if (real_time && (priority < 1 || priority > 99))
+    {
+        error_msg << "Thread priority must be between 1 and 99 in real time policies.";
+        return false;
+    }
+
+    if (!real_time && priority != 0)
+    {
+        error_msg << "Thread priority is only used in real time policies (fifo and round_robin).";
+        return false;
+    }
+
+    return true;
+}
+
+bool ThreadConfiguration::is_set() const noexcept
+{
+    return !name.empty() || !affinity.empty() || policy != types::ThreadPolicy::inherited;
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
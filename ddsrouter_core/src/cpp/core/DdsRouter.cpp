@@ -28,6 +28,16 @@
 
 #include <ddsrouter_core/configuration/DdsRouterConfiguration.hpp>
 #include <ddsrouter_core/core/DdsRouter.hpp>
+#include <ddsrouter_core/core/ScopedThreadConfiguration.hpp>
+#include <ddsrouter_core/participants/concurrency/GatedParticipant.hpp>
+#include <ddsrouter_core/participants/filter/ContentFilteredParticipant.hpp>
+#include <ddsrouter_core/participants/instrumentation/InstrumentedParticipant.hpp>
+#include <ddsrouter_core/participants/lazy/LazyParticipant.hpp>
+#include <ddsrouter_core/participants/preallocation/PreallocatingParticipant.hpp>
+#include <ddsrouter_core/participants/projection/ProjectedParticipant.hpp>
+#include <ddsrouter_core/participants/rate_limit/RateLimitedParticipant.hpp>
+#include <ddsrouter_core/participants/tracing/TracingParticipant.hpp>
+#include <ddsrouter_core/participants/warmup/ReadinessParticipant.hpp>
 
 namespace eprosima {
 namespace ddsrouter {
@@ -37,9 +47,14 @@ DdsRouter::DdsRouter(
         const DdsRouterConfiguration& configuration)
     : configuration_(configuration)
     , discovery_database_(new ddspipe::core::DiscoveryDatabase())
-    , payload_pool_(new ddspipe::core::FastPayloadPool())
+    , payload_pool_(configuration.advanced_options.preallocate_histories ?
+            std::shared_ptr<ddspipe::core::PayloadPool>(
+                new PreallocatedPayloadPool(configuration.advanced_options.max_sample_size)) :
+            std::shared_ptr<ddspipe::core::PayloadPool>(new ddspipe::core::FastPayloadPool()))
     , participants_database_(new ddspipe::core::ParticipantsDatabase())
-    , thread_pool_(std::make_shared<utils::SlotThreadPool>(configuration_.advanced_options.number_of_threads))
+    , thread_pool_(std::make_shared<utils::SlotThreadPool>(configuration_.advanced_options.max_threads > 0 ?
+            configuration_.advanced_options.max_threads :
+            configuration_.advanced_options.number_of_threads))
 {
     logDebug(DDSROUTER, "Creating DDS Router.");
 
@@ -52,20 +67,188 @@ DdsRouter::DdsRouter(
                       "Configuration for DDS Router is invalid: " << error_msg);
     }
 
+    preallocated_payload_pool_ = std::dynamic_pointer_cast<PreallocatedPayloadPool>(payload_pool_);
+
+    // Threads inherit the configuration of the thread that creates them, so each class is created in its own scope
+    {
+        ScopedThreadConfiguration housekeeping_threads(configuration_.advanced_options.housekeeping_threads);
+
+        // Compile the content filters only if required, so the data path is untouched otherwise
+        if (!configuration_.advanced_options.content_filters.empty())
+        {
+            content_filter_engine_ = std::make_shared<ContentFilterEngine>(
+                configuration_.advanced_options.content_filters);
+        }
+
+        // Compile the projections only if required, so the data path is untouched otherwise
+        if (!configuration_.advanced_options.projections.empty())
+        {
+            projection_engine_ = std::make_shared<ProjectionEngine>(configuration_.advanced_options.projections);
+        }
+
+        // Create the rate limit engine only if required, so the data path is untouched otherwise
+        if (!configuration_.advanced_options.rate_limits.empty())
+        {
+            rate_limit_engine_ = std::make_shared<RateLimitEngine>(configuration_.advanced_options.rate_limits);
+        }
+
+        // Batch the discoveries in a database of their own, so the DDS Pipe only sees their coalesced result.
+        // The coalescer is also the one that keeps track of the endpoints of the discovery cache
+        pipe_discovery_database_ = discovery_database_;
+        if (configuration_.advanced_options.discovery_batch_period > 0 ||
+                !configuration_.advanced_options.discovery_cache.empty())
+        {
+            pipe_discovery_database_ = std::make_shared<ddspipe::core::DiscoveryDatabase>();
+            discovery_coalescer_ = std::make_shared<DiscoveryCoalescer>(
+                discovery_database_,
+                pipe_discovery_database_,
+                configuration_.advanced_options.discovery_batch_period);
+            discovery_coalescer_->init();
+        }
+
+        if (configuration_.advanced_options.lazy_writers)
+        {
+            lazy_writer_engine_ = std::make_shared<LazyWriterEngine>(configuration_.advanced_options.writers_idle_ttl);
+            lazy_writer_engine_->track_readers(discovery_database_);
+        }
+
+        // The pool keeps the maximum number of threads, and the gate decides how many of them forward data at once
+        if (configuration_.advanced_options.max_threads > 0)
+        {
+            concurrency_gate_ = std::make_shared<ConcurrencyGate>(
+                configuration_.advanced_options.min_threads,
+                configuration_.advanced_options.max_threads,
+                configuration_.advanced_options.target_queue_latency,
+                CONCURRENCY_ADJUSTMENT_PERIOD);
+        }
+
+        // The profiler tags the threads with the slot they run
+        if (configuration_.advanced_options.thread_pool_monitor ||
+                configuration_.advanced_options.metrics_exporter.enabled ||
+                configuration_.advanced_options.profiler.enabled)
+        {
+            thread_pool_instrumentation_ = std::make_shared<ThreadPoolInstrumentation>();
+        }
+
+        if (configuration_.advanced_options.thread_pool_monitor)
+        {
+            thread_pool_monitor_ = std::unique_ptr<ThreadPoolMonitorProducer>(
+                new ThreadPoolMonitorProducer(
+                    thread_pool_instrumentation_,
+                    configuration_.advanced_options.thread_pool_monitor_period));
+        }
+
+        // Every endpoint is traced once enabled, so the topics traced can be reloaded
+        if (configuration_.advanced_options.tracing.enabled)
+        {
+            pipeline_tracer_ = std::make_shared<PipelineTracer>(configuration_.advanced_options.tracing);
+        }
+    }
+
+    // Measure the creation of every endpoint, including those of the builtin topics created along with the DDS Pipe
+    if (configuration_.advanced_options.warm_up)
+    {
+        readiness_tracker_ = std::make_shared<TopicReadinessTracker>();
+    }
+
     // Load Participants
-    init_participants_();
+    {
+        ScopedThreadConfiguration participant_threads(configuration_.advanced_options.participant_threads);
+        init_participants_();
+    }
+
+    // Spawn the threads of the pool before the DDS Pipe uses it
+    {
+        ScopedThreadConfiguration forwarding_threads(configuration_.advanced_options.forwarding_threads);
+        thread_pool_->enable();
+    }
 
     // Initialize the DdsPipe
     ddspipe_ = std::unique_ptr<ddspipe::core::DdsPipe>(new ddspipe::core::DdsPipe(
                         configuration_.ddspipe_configuration,
-                        discovery_database_,
+                        pipe_discovery_database_,
                         payload_pool_,
                         participants_database_,
                         thread_pool_));
 
+    // Create the bridges of the endpoints known from the previous execution while the live discovery catches up
+    if (!configuration_.advanced_options.discovery_cache.empty())
+    {
+        discovery_cache_ = std::unique_ptr<DiscoveryCache>(
+            new DiscoveryCache(configuration_.advanced_options.discovery_cache));
+        preload_discovery_cache_();
+    }
+
     logDebug(DDSROUTER, "DDS Router created.");
 }
 
+void DdsRouter::preload_discovery_cache_()
+{
+    std::vector<ddspipe::core::types::Endpoint> endpoints;
+
+    for (const auto& endpoint : discovery_cache_->load())
+    {
+        // Skip the endpoints of participants that are no longer configured
+        if (!participants_database_->get_participant(endpoint.discoverer_participant_id))
+        {
+            logDebug(DDSROUTER_DISCOVERY,
+                    "Skipping cached endpoint " << endpoint.guid << " of unknown participant "
+                                                << endpoint.discoverer_participant_id << ".");
+            continue;
+        }
+
+        endpoints.push_back(endpoint);
+    }
+
+    discovery_coalescer_->preload(endpoints, configuration_.advanced_options.discovery_cache_ttl);
+}
+
+void DdsRouter::warm_up_()
+{
+    const std::set<std::string> topics = builtin_topic_names_();
+
+    // The endpoints of the builtin topics are created along with the DDS Pipe, except for lazy writers
+    if (lazy_writer_engine_)
+    {
+        try
+        {
+            lazy_writer_engine_->warm_up(topics);
+        }
+        catch (const std::exception& e)
+        {
+            logWarning(DDSROUTER, "Failed to warm up the writers of the builtin topics: " << e.what());
+        }
+    }
+
+    for (const auto& readiness : readiness_tracker_->readiness(topics))
+    {
+        if (readiness.ready)
+        {
+            logInfo(DDSROUTER,
+                    "Topic " << readiness.topic << " ready with " << readiness.readers << " readers and "
+                             << readiness.writers << " writers in " << readiness.ready_ms << " ms ("
+                             << readiness.creation_ms << " ms creating them).");
+        }
+        else
+        {
+            logWarning(DDSROUTER,
+                    "Topic " << readiness.topic << " not ready: " << readiness.readers << " readers and "
+                             << readiness.writers << " writers created, " << readiness.failed << " failed.");
+        }
+    }
+}
+
+std::set<std::string> DdsRouter::builtin_topic_names_() const
+{
+    std::set<std::string> topics;
+    for (const auto& topic : configuration_.ddspipe_configuration.builtin_topics)
+    {
+        topics.insert(topic->topic_name());
+    }
+
+    return topics;
+}
+
 void DdsRouter::init_participants_()
 {
     for (std::pair<types::ParticipantKind,
@@ -90,6 +273,69 @@ void DdsRouter::init_participants_()
         logInfo(DDSROUTER, "Participant created with id: " << new_participant->id()
                                                            << " and kind " << participant_config.first << ".");
 
+        // Keep the sinks before decorating them
+        auto sink_participant = std::dynamic_pointer_cast<SinkParticipant>(new_participant);
+        if (sink_participant)
+        {
+            sink_participants_[sink_participant->id()] = sink_participant;
+        }
+
+        // Measure the actual creation of the endpoints, so it is the innermost decorator
+        if (readiness_tracker_)
+        {
+            new_participant = std::make_shared<ReadinessParticipant>(new_participant, readiness_tracker_);
+        }
+
+        // Create the writers only when they have something to send.
+        // Done before rate limiting, so messages dropped do not create writers
+        if (lazy_writer_engine_)
+        {
+            new_participant = std::make_shared<LazyParticipant>(new_participant, lazy_writer_engine_);
+        }
+
+        // Reserve the histories once per bridge, so lazy writers created again do not reserve them again
+        if (preallocated_payload_pool_)
+        {
+            new_participant = std::make_shared<PreallocatingParticipant>(new_participant, preallocated_payload_pool_);
+        }
+
+        // Filter the samples received before rate limiting, so samples dropped do not consume tokens
+        if (content_filter_engine_)
+        {
+            new_participant = std::make_shared<ContentFilteredParticipant>(new_participant, content_filter_engine_);
+        }
+
+        // Shape the traffic of the participant's readers and writers
+        if (rate_limit_engine_)
+        {
+            new_participant = std::make_shared<RateLimitedParticipant>(new_participant, rate_limit_engine_);
+        }
+
+        // Project the samples before rate limiting, so the limits of the writers count the bytes actually sent
+        if (projection_engine_)
+        {
+            new_participant = std::make_shared<ProjectedParticipant>(
+                new_participant, projection_engine_, payload_pool_);
+        }
+
+        // Measure the slots inside the gate, so the time waiting in it counts as queue latency
+        if (thread_pool_instrumentation_)
+        {
+            new_participant = std::make_shared<InstrumentedParticipant>(new_participant, thread_pool_instrumentation_);
+        }
+
+        // Trace inside the gate too, so the samples are dequeued once their thread passes it
+        if (pipeline_tracer_)
+        {
+            new_participant = std::make_shared<TracingParticipant>(new_participant, pipeline_tracer_);
+        }
+
+        // Gate the threads before anything else, so the wait of a message includes every decorator
+        if (concurrency_gate_)
+        {
+            new_participant = std::make_shared<GatedParticipant>(new_participant, concurrency_gate_);
+        }
+
         // Add this participant to the database. If it is repeated it will cause an exception
         try
         {
@@ -117,12 +363,27 @@ utils::ReturnCode DdsRouter::reload_configuration(
                       "Configuration for Reload DDS Router is invalid: " << error_msg);
     }
 
-    // Reload the DdsPipe configuration, since it is the only reconfigurable attribute.
+    // The topics traced are the only reconfigurable attribute of the DDS Router itself
+    if (pipeline_tracer_)
+    {
+        pipeline_tracer_->reload(new_configuration.advanced_options.tracing.topics);
+    }
+    else if (new_configuration.advanced_options.tracing.enabled)
+    {
+        logWarning(DDSROUTER, "Tracing can only be enabled at start up.");
+    }
+
+    // Reload the DdsPipe configuration
     return ddspipe_->reload_configuration(new_configuration.ddspipe_configuration);
 }
 
 utils::ReturnCode DdsRouter::start() noexcept
 {
+    if (readiness_tracker_)
+    {
+        warm_up_();
+    }
+
     utils::ReturnCode ret = ddspipe_->enable();
     if (ret == utils::ReturnCode::RETCODE_OK)
     {
@@ -138,11 +399,200 @@ utils::ReturnCode DdsRouter::stop() noexcept
     if (ret == utils::ReturnCode::RETCODE_OK)
     {
         logInfo(DDSROUTER, "Stopping DDS Router.");
+
+        for (const auto& statistics : rate_limit_statistics())
+        {
+            if (statistics.dropped_msgs > 0)
+            {
+                logInfo(DDSROUTER_RATE_LIMIT,
+                        "Rate limit of " << statistics.scope << " " << statistics.key << " dropped "
+                                         << statistics.dropped_msgs << " messages (" << statistics.dropped_bytes
+                                         << " bytes).");
+            }
+        }
+
+        for (const auto& statistics : content_filter_statistics())
+        {
+            logInfo(DDSROUTER_CONTENT_FILTER,
+                    "Content filter <" << statistics.expression << "> in topic " << statistics.topic << " forwarded "
+                                       << statistics.forwarded << " samples and dropped " << statistics.dropped
+                                       << " (" << statistics.malformed << " could not be evaluated).");
+        }
+
+        for (const auto& statistics : projection_statistics())
+        {
+            logInfo(DDSROUTER_PROJECTION,
+                    "Projection of topic " << statistics.topic << " to type " << statistics.type_name << " sent "
+                                           << statistics.projected << " samples (" << statistics.original_bytes
+                                           << " bytes reduced to " << statistics.projected_bytes << ") and dropped "
+                                           << statistics.dropped << ".");
+        }
+
+        if (lazy_writer_engine_)
+        {
+            const LazyWriterStatistics statistics = lazy_writer_statistics();
+            logInfo(DDSROUTER_LAZY_WRITER,
+                    statistics.active << " of " << statistics.writers << " writers created, "
+                                      << statistics.created << " creations and " << statistics.reaped
+                                      << " idle writers destroyed in total.");
+        }
+
+        if (preallocated_payload_pool_)
+        {
+            const PayloadPoolStatistics statistics = payload_pool_statistics();
+            logInfo(DDSROUTER_PAYLOAD_POOL,
+                    statistics.pooled << " payloads served from " << statistics.slots << " preallocated slots and "
+                                      << statistics.heap << " allocated in the heap.");
+        }
+
+        if (concurrency_gate_)
+        {
+            const ConcurrencyStatistics statistics = concurrency_statistics();
+            logInfo(DDSROUTER_CONCURRENCY,
+                    statistics.limit << " forwarding threads in use after growing " << statistics.grown
+                                     << " times and shrinking " << statistics.shrunk << " times.");
+        }
+
+        if (discovery_cache_)
+        {
+            discovery_cache_->save(discovery_coalescer_->endpoints());
+        }
+
+        if (discovery_coalescer_)
+        {
+            const DiscoveryCoalescerStatistics statistics = discovery_statistics();
+            logInfo(DDSROUTER_DISCOVERY,
+                    statistics.received << " discovery events received in " << statistics.batches << " batches, "
+                                        << statistics.coalesced << " of them coalesced.");
+        }
     }
 
     return ret;
 }
 
+std::vector<RateLimitStatistics> DdsRouter::rate_limit_statistics() const
+{
+    if (!rate_limit_engine_)
+    {
+        return {};
+    }
+
+    return rate_limit_engine_->statistics();
+}
+
+std::vector<ContentFilterStatistics> DdsRouter::content_filter_statistics() const
+{
+    if (!content_filter_engine_)
+    {
+        return {};
+    }
+
+    return content_filter_engine_->statistics();
+}
+
+std::vector<ProjectionStatistics> DdsRouter::projection_statistics() const
+{
+    if (!projection_engine_)
+    {
+        return {};
+    }
+
+    return projection_engine_->statistics();
+}
+
+LazyWriterStatistics DdsRouter::lazy_writer_statistics() const
+{
+    if (!lazy_writer_engine_)
+    {
+        return {};
+    }
+
+    return lazy_writer_engine_->statistics();
+}
+
+PayloadPoolStatistics DdsRouter::payload_pool_statistics() const
+{
+    if (!preallocated_payload_pool_)
+    {
+        return {};
+    }
+
+    return preallocated_payload_pool_->statistics();
+}
+
+ConcurrencyStatistics DdsRouter::concurrency_statistics() const
+{
+    if (!concurrency_gate_)
+    {
+        return {};
+    }
+
+    return concurrency_gate_->statistics();
+}
+
+std::vector<SlotStatistics> DdsRouter::thread_pool_statistics() const
+{
+    if (!thread_pool_instrumentation_)
+    {
+        return {};
+    }
+
+    return thread_pool_instrumentation_->statistics();
+}
+
+RouterMetrics DdsRouter::metrics() const
+{
+    RouterMetrics metrics;
+    metrics.slots = thread_pool_statistics();
+    metrics.rate_limits = rate_limit_statistics();
+    metrics.sinks = sink_reports();
+    metrics.payload_pool = payload_pool_statistics();
+    metrics.concurrency = concurrency_statistics();
+    return metrics;
+}
+
+std::vector<TopicReadiness> DdsRouter::topic_readiness() const
+{
+    if (!readiness_tracker_)
+    {
+        return {};
+    }
+
+    return readiness_tracker_->readiness(builtin_topic_names_());
+}
+
+DiscoveryCoalescerStatistics DdsRouter::discovery_statistics() const
+{
+    if (!discovery_coalescer_)
+    {
+        return {};
+    }
+
+    return discovery_coalescer_->statistics();
+}
+
+std::map<ddspipe::core::types::ParticipantId, SinkReport> DdsRouter::sink_reports() const
+{
+    std::map<ddspipe::core::types::ParticipantId, SinkReport> reports;
+
+    for (const auto& it : sink_participants_)
+    {
+        reports[it.first] = it.second->report();
+    }
+
+    return reports;
+}
+
+std::string DdsRouter::dump_trace() const
+{
+    if (!pipeline_tracer_)
+    {
+        return "";
+    }
+
+    return pipeline_tracer_->dump();
+}
+
 } /* namespace core */
 } /* namespace ddsrouter */
 } /* namespace eprosima */
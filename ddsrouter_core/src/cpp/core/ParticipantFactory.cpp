@@ -36,8 +36,20 @@
 #include <ddspipe_participants/participant/rtps/SimpleParticipant.hpp>
 #include <ddspipe_participants/participant/dds/XmlParticipant.hpp>
 
+#include <ddsrouter_core/configuration/GeneratorParticipantConfiguration.hpp>
+#include <ddsrouter_core/configuration/InProcessParticipantConfiguration.hpp>
+#include <ddsrouter_core/configuration/IpcParticipantConfiguration.hpp>
+#include <ddsrouter_core/configuration/RecorderParticipantConfiguration.hpp>
+#include <ddsrouter_core/configuration/ReplayerParticipantConfiguration.hpp>
+#include <ddsrouter_core/configuration/SinkParticipantConfiguration.hpp>
 #include <ddsrouter_core/types/ParticipantKind.hpp>
 #include <ddsrouter_core/core/ParticipantFactory.hpp>
+#include <ddsrouter_core/participants/generator/GeneratorParticipant.hpp>
+#include <ddsrouter_core/participants/inprocess/InProcessParticipant.hpp>
+#include <ddsrouter_core/participants/ipc/IpcParticipant.hpp>
+#include <ddsrouter_core/participants/recorder/RecorderParticipant.hpp>
+#include <ddsrouter_core/participants/replayer/ReplayerParticipant.hpp>
+#include <ddsrouter_core/participants/sink/SinkParticipant.hpp>
 
 namespace eprosima {
 namespace ddsrouter {
@@ -145,6 +157,72 @@ std::shared_ptr<ddspipe::core::IParticipant> ParticipantFactory::create_particip
                 discovery_database
                    );
 
+        case types::ParticipantKind::ipc:
+            return generic_create_participant_with_init<
+                IpcParticipantConfiguration,
+                IpcParticipant>
+                   (
+                kind,
+                participant_configuration,
+                payload_pool,
+                discovery_database
+                   );
+
+        case types::ParticipantKind::inprocess:
+            return generic_create_participant_with_init<
+                InProcessParticipantConfiguration,
+                InProcessParticipant>
+                   (
+                kind,
+                participant_configuration,
+                payload_pool,
+                discovery_database
+                   );
+
+        case types::ParticipantKind::recorder:
+            return generic_create_participant_with_init<
+                RecorderParticipantConfiguration,
+                RecorderParticipant>
+                   (
+                kind,
+                participant_configuration,
+                payload_pool,
+                discovery_database
+                   );
+
+        case types::ParticipantKind::replayer:
+            return generic_create_participant_with_init<
+                ReplayerParticipantConfiguration,
+                ReplayerParticipant>
+                   (
+                kind,
+                participant_configuration,
+                payload_pool,
+                discovery_database
+                   );
+
+        case types::ParticipantKind::generator:
+            return generic_create_participant_with_init<
+                GeneratorParticipantConfiguration,
+                GeneratorParticipant>
+                   (
+                kind,
+                participant_configuration,
+                payload_pool,
+                discovery_database
+                   );
+
+        case types::ParticipantKind::sink:
+            return generic_create_participant_with_init<
+                SinkParticipantConfiguration,
+                SinkParticipant>
+                   (
+                kind,
+                participant_configuration,
+                payload_pool,
+                discovery_database
+                   );
+
         default:
             // This should not happen as every kind must be in the switch
             utils::tsnh(
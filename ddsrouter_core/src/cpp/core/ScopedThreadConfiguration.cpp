@@ -0,0 +1,189 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ScopedThreadConfiguration.cpp
+ *
+ */
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif // defined(__linux__)
+
+#include <cstring>
+
+#include <cpp_utils/Log.hpp>
+
+#include <ddsrouter_core/core/ScopedThreadConfiguration.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+#if defined(__linux__)
+
+namespace {
+
+int to_native_policy(
+        types::ThreadPolicy policy) noexcept
+{
+    switch (policy)
+    {
+        case types::ThreadPolicy::fifo:
+            return SCHED_FIFO;
+
+        case types::ThreadPolicy::round_robin:
+            return SCHED_RR;
+
+        case types::ThreadPolicy::batch:
+            return SCHED_BATCH;
+
+        case types::ThreadPolicy::idle:
+            return SCHED_IDLE;
+
+        default:
+            return SCHED_OTHER;
+    }
+}
+
+} /* namespace */
+
+struct ScopedThreadConfiguration::PreviousSettings
+{
+    //! Previous name. Empty if not changed.
+    char name[16] = {};
+
+    bool affinity_changed = false;
+    cpu_set_t affinity;
+
+    bool policy_changed = false;
+    int policy = SCHED_OTHER;
+    sched_param parameters{};
+};
+
+ScopedThreadConfiguration::ScopedThreadConfiguration(
+        const ThreadConfiguration& configuration)
+{
+    if (!configuration.is_set())
+    {
+        return;
+    }
+
+    previous_ = std::unique_ptr<PreviousSettings>(new PreviousSettings());
+    const pthread_t self = pthread_self();
+
+    if (!configuration.name.empty())
+    {
+        if (pthread_getname_np(self, previous_->name, sizeof(previous_->name)) != 0 ||
+                pthread_setname_np(self, configuration.name.c_str()) != 0)
+        {
+            logWarning(DDSROUTER_THREADS, "Failed to name threads " << configuration.name << ".");
+            previous_->name[0] = '\0';
+        }
+    }
+
+    if (!configuration.affinity.empty())
+    {
+        cpu_set_t affinity;
+        CPU_ZERO(&affinity);
+        for (const uint32_t cpu : configuration.affinity)
+        {
+            CPU_SET(cpu, &affinity);
+        }
+
+        const int error = pthread_getaffinity_np(self, sizeof(previous_->affinity), &previous_->affinity);
+        const int set_error = error ? error : pthread_setaffinity_np(self, sizeof(affinity), &affinity);
+        if (set_error != 0)
+        {
+            logWarning(DDSROUTER_THREADS,
+                    "Failed to set the CPU affinity of threads " << configuration.name << ": "
+                                                                 << std::strerror(set_error) << ".");
+        }
+        previous_->affinity_changed = set_error == 0;
+    }
+
+    if (configuration.policy != types::ThreadPolicy::inherited)
+    {
+        sched_param parameters{};
+        parameters.sched_priority = configuration.priority;
+
+        const int error = pthread_getschedparam(self, &previous_->policy, &previous_->parameters);
+        const int set_error = error ? error :
+                pthread_setschedparam(self, to_native_policy(configuration.policy), &parameters);
+        if (set_error != 0)
+        {
+            logWarning(DDSROUTER_THREADS,
+                    "Failed to set the scheduling policy " << configuration.policy << " of threads "
+                                                           << configuration.name << ": " << std::strerror(set_error)
+                                                           << ".");
+        }
+        previous_->policy_changed = set_error == 0;
+    }
+
+    logDebug(DDSROUTER_THREADS,
+            "Creating threads " << configuration.name << " with " << configuration.affinity.size() << " CPUs and "
+                                << configuration.policy << " policy.");
+}
+
+ScopedThreadConfiguration::~ScopedThreadConfiguration()
+{
+    if (!previous_)
+    {
+        return;
+    }
+
+    const pthread_t self = pthread_self();
+
+    if (previous_->name[0] != '\0')
+    {
+        pthread_setname_np(self, previous_->name);
+    }
+
+    if (previous_->affinity_changed)
+    {
+        pthread_setaffinity_np(self, sizeof(previous_->affinity), &previous_->affinity);
+    }
+
+    if (previous_->policy_changed)
+    {
+        pthread_setschedparam(self, previous_->policy, &previous_->parameters);
+    }
+}
+
+#else
+
+struct ScopedThreadConfiguration::PreviousSettings
+{
+};
+
+ScopedThreadConfiguration::ScopedThreadConfiguration(
+        const ThreadConfiguration& configuration)
+{
+    if (configuration.is_set())
+    {
+        logWarning(DDSROUTER_THREADS,
+                "Thread configuration of threads " << configuration.name << " is only supported in Linux, ignored.");
+    }
+}
+
+ScopedThreadConfiguration::~ScopedThreadConfiguration()
+{
+}
+
+#endif // defined(__linux__)
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
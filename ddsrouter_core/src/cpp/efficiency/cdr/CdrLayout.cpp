@@ -0,0 +1,392 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file CdrLayout.cpp
+ *
+ */
+
+#include <set>
+
+#include <cpp_utils/exception/InitializationException.hpp>
+
+#include <ddsrouter_core/efficiency/cdr/CdrLayout.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+namespace {
+
+//! Size of the encapsulation of a sample.
+constexpr uint32_t ENCAPSULATION_SIZE = 4;
+
+//! Size of the DHEADER of appendable types and collections in XCDR2.
+constexpr uint32_t DHEADER_SIZE = 4;
+
+//! Representation identifiers of the encapsulations supported.
+constexpr uint8_t CDR_BE = 0x00;
+constexpr uint8_t CDR_LE = 0x01;
+constexpr uint8_t PLAIN_CDR2_BE = 0x06;
+constexpr uint8_t PLAIN_CDR2_LE = 0x07;
+constexpr uint8_t DELIMITED_CDR2_BE = 0x08;
+constexpr uint8_t DELIMITED_CDR2_LE = 0x09;
+
+//! Names of the kinds of element, in the order of \c CdrElementKind .
+constexpr const char* ELEMENT_NAMES[] = {
+    "boolean", "char", "int8", "uint8", "int16", "uint16", "int32", "uint32", "int64", "uint64", "float32",
+    "float64", "string"};
+
+std::string trim(
+        const std::string& text)
+{
+    const std::size_t begin = text.find_first_not_of(" \t");
+    if (begin == std::string::npos)
+    {
+        return "";
+    }
+    return text.substr(begin, text.find_last_not_of(" \t") - begin + 1);
+}
+
+CdrElementKind parse_element(
+        const std::string& type,
+        const std::string& name)
+{
+    for (std::size_t kind = 0; kind < sizeof(ELEMENT_NAMES) / sizeof(ELEMENT_NAMES[0]); ++kind)
+    {
+        if (name == ELEMENT_NAMES[kind])
+        {
+            return static_cast<CdrElementKind>(kind);
+        }
+    }
+
+    throw utils::InitializationException(utils::Formatter()
+                  << "Type " << type << " is not supported. Elements must be primitives or strings.");
+}
+
+//! Move \c offset past a string, checking it is in the sample.
+bool skip_string(
+        const uint8_t* data,
+        uint32_t size,
+        const CdrEncoding& encoding,
+        uint32_t& offset) noexcept
+{
+    offset = CdrLayout::align(offset, 4, encoding);
+    if (static_cast<uint64_t>(offset) + 4 > size)
+    {
+        return false;
+    }
+
+    const uint64_t end = static_cast<uint64_t>(offset) + 4 + CdrLayout::read<uint32_t>(data + offset,
+                    encoding.little_endian);
+    if (end > size)
+    {
+        return false;
+    }
+
+    offset = static_cast<uint32_t>(end);
+    return true;
+}
+
+//! Move \c offset past the DHEADER of a collection, checking it is in the sample.
+bool skip_dheader(
+        uint32_t size,
+        const CdrEncoding& encoding,
+        uint32_t& offset) noexcept
+{
+    offset = CdrLayout::align(offset, DHEADER_SIZE, encoding) + DHEADER_SIZE;
+    return offset <= size;
+}
+
+} /* namespace */
+
+uint32_t CdrFieldType::element_size() const noexcept
+{
+    switch (element)
+    {
+        case CdrElementKind::boolean:
+        case CdrElementKind::character:
+        case CdrElementKind::int8:
+        case CdrElementKind::uint8:
+            return 1;
+
+        case CdrElementKind::int16:
+        case CdrElementKind::uint16:
+            return 2;
+
+        case CdrElementKind::int32:
+        case CdrElementKind::uint32:
+        case CdrElementKind::float32:
+            return 4;
+
+        case CdrElementKind::int64:
+        case CdrElementKind::uint64:
+        case CdrElementKind::float64:
+            return 8;
+
+        case CdrElementKind::string:
+        default:
+            return 0;
+    }
+}
+
+bool CdrFieldType::fixed_size() const noexcept
+{
+    return element != CdrElementKind::string && container != CdrContainerKind::sequence;
+}
+
+CdrLayout::CdrLayout(
+        const std::vector<CdrFieldConfiguration>& fields)
+{
+    if (fields.empty())
+    {
+        throw utils::InitializationException(utils::Formatter() << "A CDR layout requires at least a field.");
+    }
+
+    std::set<std::string> names;
+    for (const auto& field : fields)
+    {
+        if (field.name.empty())
+        {
+            throw utils::InitializationException(utils::Formatter() << "Every field of a CDR layout requires a name.");
+        }
+
+        if (!names.insert(field.name).second)
+        {
+            throw utils::InitializationException(utils::Formatter()
+                          << "Field " << field.name << " is repeated in the CDR layout.");
+        }
+
+        fields_.push_back({field.name, parse_type(field.type)});
+    }
+
+    // Offsets of the fields do not change until the first one of variable size
+    for (std::size_t variant = 0; variant < CdrEncoding::VARIANTS; ++variant)
+    {
+        const CdrEncoding encoding = CdrLayout::encoding(static_cast<CdrEncoding::Variant>(variant));
+
+        uint32_t offset = encoding.first;
+        for (const auto& field : fields_)
+        {
+            if (!field.type.fixed_size())
+            {
+                break;
+            }
+
+            CdrSpan span;
+            span.begin = align(offset, field.type.element_size(), encoding);
+            span.end = span.begin + field.type.element_size() * field.type.length;
+            fixed_spans_[variant].push_back(span);
+            offset = span.end;
+        }
+        fixed_end_[variant] = offset;
+    }
+}
+
+CdrFieldType CdrLayout::parse_type(
+        const std::string& type)
+{
+    const std::string text = trim(type);
+    CdrFieldType result;
+
+    if (text.compare(0, 9, "sequence<") == 0 && text.back() == '>')
+    {
+        result.container = CdrContainerKind::sequence;
+        result.element = parse_element(type, trim(text.substr(9, text.size() - 10)));
+        return result;
+    }
+
+    const std::size_t bracket = text.find('[');
+    if (bracket != std::string::npos && text.back() == ']')
+    {
+        const std::string length = trim(text.substr(bracket + 1, text.size() - bracket - 2));
+        if (length.empty() || length.size() > 9 || length.find_first_not_of("0123456789") != std::string::npos ||
+                std::stoul(length) == 0)
+        {
+            throw utils::InitializationException(utils::Formatter()
+                          << "Type " << type << " is not supported. Arrays must have a positive length.");
+        }
+
+        result.container = CdrContainerKind::array;
+        result.length = static_cast<uint32_t>(std::stoul(length));
+        result.element = parse_element(type, trim(text.substr(0, bracket)));
+        return result;
+    }
+
+    result.element = parse_element(type, text);
+    return result;
+}
+
+bool CdrLayout::encoding(
+        const uint8_t* data,
+        uint32_t size,
+        CdrEncoding& encoding) noexcept
+{
+    if (size < ENCAPSULATION_SIZE || data[0] != 0x00)
+    {
+        return false;
+    }
+
+    switch (data[1])
+    {
+        case CDR_BE:
+        case CDR_LE:
+            encoding = CdrLayout::encoding(CdrEncoding::xcdr1);
+            break;
+
+        case PLAIN_CDR2_BE:
+        case PLAIN_CDR2_LE:
+            encoding = CdrLayout::encoding(CdrEncoding::plain_xcdr2);
+            break;
+
+        case DELIMITED_CDR2_BE:
+        case DELIMITED_CDR2_LE:
+            encoding = CdrLayout::encoding(CdrEncoding::delimited_xcdr2);
+            break;
+
+        default:
+            return false;
+    }
+
+    // Big endian identifiers are even
+    encoding.little_endian = (data[1] & 0x01) != 0;
+    return size >= encoding.first;
+}
+
+CdrEncoding CdrLayout::encoding(
+        CdrEncoding::Variant variant) noexcept
+{
+    CdrEncoding encoding;
+    encoding.variant = variant;
+    encoding.first = ENCAPSULATION_SIZE + (variant == CdrEncoding::delimited_xcdr2 ? DHEADER_SIZE : 0);
+    encoding.max_alignment = variant == CdrEncoding::xcdr1 ? 8 : 4;
+    encoding.delimited_collections = variant != CdrEncoding::xcdr1;
+    return encoding;
+}
+
+std::size_t CdrLayout::size() const noexcept
+{
+    return fields_.size();
+}
+
+const CdrField& CdrLayout::field(
+        std::size_t index) const
+{
+    return fields_.at(index);
+}
+
+const std::vector<CdrSpan>& CdrLayout::fixed_spans(
+        CdrEncoding::Variant variant) const noexcept
+{
+    return fixed_spans_[variant];
+}
+
+std::size_t CdrLayout::find(
+        const std::string& name) const noexcept
+{
+    for (std::size_t index = 0; index < fields_.size(); ++index)
+    {
+        if (fields_[index].name == name)
+        {
+            return index;
+        }
+    }
+
+    return NOT_FOUND;
+}
+
+uint32_t CdrLayout::align(
+        uint32_t offset,
+        uint32_t size,
+        const CdrEncoding& encoding) noexcept
+{
+    const uint32_t alignment = size < encoding.max_alignment ? size : encoding.max_alignment;
+    if (alignment <= 1)
+    {
+        return offset;
+    }
+
+    const uint32_t relative = offset - ENCAPSULATION_SIZE;
+    return ENCAPSULATION_SIZE + ((relative + alignment - 1) & ~(alignment - 1));
+}
+
+bool CdrLayout::advance_(
+        const uint8_t* data,
+        uint32_t size,
+        const CdrEncoding& encoding,
+        const CdrFieldType& type,
+        uint32_t& offset,
+        CdrSpan& span) noexcept
+{
+    const uint32_t element_size = type.element_size();
+    const bool strings = type.element == CdrElementKind::string;
+
+    uint64_t elements = type.length;
+
+    if (type.container == CdrContainerKind::single)
+    {
+        span.begin = align(offset, strings ? 4 : element_size, encoding);
+    }
+    else
+    {
+        span.begin = align(offset, type.container == CdrContainerKind::sequence ? 4 : element_size, encoding);
+        offset = span.begin;
+
+        if (strings && encoding.delimited_collections && !skip_dheader(size, encoding, offset))
+        {
+            return false;
+        }
+
+        if (type.container == CdrContainerKind::sequence)
+        {
+            offset = align(offset, 4, encoding);
+            if (static_cast<uint64_t>(offset) + 4 > size)
+            {
+                return false;
+            }
+            elements = read<uint32_t>(data + offset, encoding.little_endian);
+            offset += 4;
+        }
+    }
+
+    if (strings)
+    {
+        offset = type.container == CdrContainerKind::single ? span.begin : offset;
+        for (uint64_t element = 0; element < elements; ++element)
+        {
+            if (!skip_string(data, size, encoding, offset))
+            {
+                return false;
+            }
+        }
+    }
+    else
+    {
+        offset = elements > 0 ? align(type.container == CdrContainerKind::single ? span.begin : offset, element_size,
+                        encoding) : offset;
+        const uint64_t end = static_cast<uint64_t>(offset) + elements * element_size;
+        if (end > size)
+        {
+            return false;
+        }
+        offset = static_cast<uint32_t>(end);
+    }
+
+    span.end = offset;
+    return true;
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,227 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file CdrProjection.cpp
+ *
+ */
+
+#include <cstring>
+#include <set>
+
+#include <cpp_utils/exception/InitializationException.hpp>
+
+#include <ddsrouter_core/efficiency/cdr/CdrProjection.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+namespace {
+
+//! Size of the encapsulation header.
+constexpr uint32_t ENCAPSULATION_SIZE = 4;
+
+//! Offset of the DHEADER of the samples of appendable types in XCDR2.
+constexpr uint32_t DHEADER_OFFSET = 4;
+
+//! Bits of the encapsulation options with the padding added to the end of the sample.
+constexpr uint8_t PADDING_MASK = 0x03;
+
+//! Align \c offset in \c output , zeroing the padding so no stale bytes of the buffer are sent.
+uint32_t align_output(
+        uint8_t* output,
+        uint32_t offset,
+        uint32_t size,
+        const CdrEncoding& encoding) noexcept
+{
+    const uint32_t aligned = CdrLayout::align(offset, size, encoding);
+    std::memset(output + offset, 0, aligned - offset);
+    return aligned;
+}
+
+//! Write \c value in the endianness of a sample. Swapping bytes is symmetric, so reading it does the conversion.
+void write_uint32(
+        uint8_t* output,
+        uint32_t value,
+        bool little_endian) noexcept
+{
+    const uint32_t serialized = CdrLayout::read<uint32_t>(reinterpret_cast<const uint8_t*>(&value), little_endian);
+    std::memcpy(output, &serialized, sizeof(serialized));
+}
+
+} /* namespace */
+
+CdrProjection::CdrProjection(
+        const std::vector<CdrFieldConfiguration>& fields,
+        const std::vector<std::string>& stripped)
+    : layout_(fields)
+    , kept_(layout_.size(), true)
+{
+    if (stripped.empty())
+    {
+        throw utils::InitializationException(utils::Formatter() << "A projection requires a field to strip.");
+    }
+
+    for (const auto& name : stripped)
+    {
+        const std::size_t index = layout_.find(name);
+        if (index == CdrLayout::NOT_FOUND)
+        {
+            throw utils::InitializationException(utils::Formatter()
+                          << "Field " << name << " stripped is not in the CDR layout.");
+        }
+        kept_[index] = false;
+    }
+
+    if (std::set<std::string>(stripped.begin(), stripped.end()).size() == layout_.size())
+    {
+        throw utils::InitializationException(utils::Formatter() << "A projection must keep a field.");
+    }
+
+    // Fields of a fixed size are in the same place in every sample, so their copies are planned once
+    for (std::size_t variant = 0; variant < CdrEncoding::VARIANTS; ++variant)
+    {
+        const CdrEncoding encoding = CdrLayout::encoding(static_cast<CdrEncoding::Variant>(variant));
+        const std::vector<CdrSpan>& spans = layout_.fixed_spans(encoding.variant);
+        std::vector<Copy>& plan = plans_[variant];
+
+        uint32_t offset = encoding.first;
+        for (std::size_t index = 0; index < spans.size(); ++index)
+        {
+            if (!kept_[index])
+            {
+                continue;
+            }
+
+            const CdrSpan& span = spans[index];
+            const uint32_t target = CdrLayout::align(offset, alignment_(layout_.field(index).type), encoding);
+
+            // Fields moved by the same distance are copied at once, along with the padding between them
+            if (!plan.empty() && span.begin - plan.back().source == target - plan.back().target)
+            {
+                plan.back().length = span.end - plan.back().source;
+            }
+            else
+            {
+                plan.push_back({span.begin, target, span.end - span.begin, target - offset});
+            }
+
+            offset = target + (span.end - span.begin);
+        }
+
+        plan_end_[variant] = offset;
+    }
+}
+
+uint32_t CdrProjection::project(
+        const uint8_t* data,
+        uint32_t size,
+        uint8_t* output) const noexcept
+{
+    CdrEncoding encoding;
+    if (!CdrLayout::encoding(data, size, encoding))
+    {
+        return 0;
+    }
+
+    const std::size_t fixed_count = layout_.fixed_spans(encoding.variant).size();
+
+    uint32_t source_end = encoding.first;
+    uint32_t offset = plan_end_[encoding.variant];
+
+    const bool found = layout_.locate(data, size, encoding, layout_.size(),
+                    [&](std::size_t index, const CdrSpan& span)
+                    {
+                        source_end = span.end;
+                        if (index >= fixed_count && kept_[index])
+                        {
+                            offset = copy_(data, encoding, layout_.field(index).type, span, output, offset);
+                        }
+                    });
+
+    // Bytes after the last field, other than the final padding, belong to fields not declared
+    if (!found || size - source_end > MAX_PADDING)
+    {
+        return 0;
+    }
+
+    for (const Copy& copy : plans_[encoding.variant])
+    {
+        std::memset(output + copy.target - copy.padding, 0, copy.padding);
+        std::memcpy(output + copy.target, data + copy.source, copy.length);
+    }
+
+    // Pad the projection to a multiple of 4, and let the reader know in the encapsulation options
+    const uint32_t padding = (4 - offset % 4) % 4;
+    std::memset(output + offset, 0, padding);
+
+    std::memcpy(output, data, ENCAPSULATION_SIZE);
+    output[ENCAPSULATION_SIZE - 1] = static_cast<uint8_t>((data[ENCAPSULATION_SIZE - 1] & ~PADDING_MASK) | padding);
+
+    if (encoding.variant == CdrEncoding::delimited_xcdr2)
+    {
+        write_uint32(output + DHEADER_OFFSET, offset - encoding.first, encoding.little_endian);
+    }
+
+    return offset + padding;
+}
+
+uint32_t CdrProjection::copy_(
+        const uint8_t* data,
+        const CdrEncoding& encoding,
+        const CdrFieldType& type,
+        const CdrSpan& span,
+        uint8_t* output,
+        uint32_t offset) const noexcept
+{
+    const uint32_t alignment = alignment_(type);
+
+    // Spans of collections of strings in XCDR1 start before the padding of their first string
+    const uint32_t source = CdrLayout::align(span.begin, alignment, encoding);
+    const uint32_t target = align_output(output, offset, alignment, encoding);
+
+    // Elements of 8 bytes in XCDR1 are aligned independently of the length of their sequence
+    const uint32_t element_size = type.element_size();
+    if (type.container == CdrContainerKind::sequence && element_size > 4 && span.end - source > 4 &&
+            CdrLayout::align(target + 4, element_size, encoding) - target !=
+            CdrLayout::align(source + 4, element_size, encoding) - source)
+    {
+        std::memcpy(output + target, data + source, 4);
+
+        const uint32_t elements_source = CdrLayout::align(source + 4, element_size, encoding);
+        const uint32_t elements_target = align_output(output, target + 4, element_size, encoding);
+        std::memcpy(output + elements_target, data + elements_source, span.end - elements_source);
+        return elements_target + (span.end - elements_source);
+    }
+
+    std::memcpy(output + target, data + source, span.end - source);
+    return target + (span.end - source);
+}
+
+uint32_t CdrProjection::alignment_(
+        const CdrFieldType& type) noexcept
+{
+    // Strings and sequences start with their length, and collections of strings in XCDR2 with a DHEADER
+    if (type.element == CdrElementKind::string || type.container == CdrContainerKind::sequence)
+    {
+        return 4;
+    }
+
+    return type.element_size();
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
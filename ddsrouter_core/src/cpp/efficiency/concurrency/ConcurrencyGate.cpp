@@ -0,0 +1,187 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ConcurrencyGate.cpp
+ *
+ */
+
+#include <algorithm>
+
+#include <cpp_utils/Log.hpp>
+
+#include <ddsrouter_core/efficiency/concurrency/ConcurrencyGate.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+namespace {
+
+//! Readers pending from the counter of the gate, that is only negative while a notification is being counted.
+uint32_t readers_pending(
+        const std::atomic<int64_t>& pending) noexcept
+{
+    return static_cast<uint32_t>(std::max<int64_t>(pending.load(std::memory_order_relaxed), 0));
+}
+
+} /* namespace */
+
+ConcurrencyGate::ConcurrencyGate(
+        uint32_t min_threads,
+        uint32_t max_threads,
+        uint64_t target_wait_us,
+        utils::Duration_ms period)
+    : min_threads_(std::max<uint32_t>(min_threads, 1))
+    , max_threads_(std::max(max_threads, min_threads_))
+    , target_wait_us_(target_wait_us)
+    , limit_(min_threads_)
+    , active_(0)
+    , pending_(0)
+    , wait_sum_us_(0)
+    , wait_count_(0)
+    , mean_wait_us_(0)
+    , calm_periods_(0)
+    , grown_(0)
+    , shrunk_(0)
+{
+    if (period > 0)
+    {
+        logDebug(DDSROUTER_CONCURRENCY,
+                "Adapting forwarding threads between " << min_threads_ << " and " << max_threads_ << " every "
+                                                       << period << " ms.");
+
+        controller_ = std::make_unique<utils::event::PeriodicEventHandler>(
+            [this]()
+            {
+                adjust();
+            },
+            period);
+    }
+}
+
+ConcurrencyGate::~ConcurrencyGate()
+{
+    controller_.reset();
+}
+
+void ConcurrencyGate::enter() noexcept
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    condition_.wait(lock, [this]()
+            {
+                return active_ < limit_;
+            });
+    ++active_;
+}
+
+void ConcurrencyGate::exit() noexcept
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        --active_;
+    }
+    condition_.notify_one();
+}
+
+void ConcurrencyGate::data_pending() noexcept
+{
+    pending_.fetch_add(1, std::memory_order_relaxed);
+}
+
+void ConcurrencyGate::data_taken(
+        uint64_t wait_us) noexcept
+{
+    pending_.fetch_sub(1, std::memory_order_relaxed);
+    wait_sum_us_.fetch_add(wait_us, std::memory_order_relaxed);
+    wait_count_.fetch_add(1, std::memory_order_relaxed);
+}
+
+int64_t ConcurrencyGate::adjust() noexcept
+{
+    uint32_t previous_limit;
+    uint32_t new_limit;
+    uint64_t mean_wait_us;
+    const uint32_t pending = readers_pending(pending_);
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        // A wait notified meanwhile may be split between this period and the next, which barely moves the mean
+        const uint64_t wait_count = wait_count_.exchange(0, std::memory_order_relaxed);
+        const uint64_t wait_sum_us = wait_sum_us_.exchange(0, std::memory_order_relaxed);
+        mean_wait_us = wait_count > 0 ? wait_sum_us / wait_count : 0;
+        mean_wait_us_ = mean_wait_us;
+        previous_limit = limit_;
+
+        if ((mean_wait_us > target_wait_us_ || pending > limit_) && limit_ < max_threads_)
+        {
+            // Grow fast, so a burst is absorbed in a few periods
+            limit_ = std::min(max_threads_, limit_ + std::max<uint32_t>(limit_ / 2, 1));
+            calm_periods_ = 0;
+            ++grown_;
+        }
+        else if (mean_wait_us < target_wait_us_ / 2 && pending <= limit_ / 2)
+        {
+            // Shrink slowly, only once the load has been low for a while
+            if (++calm_periods_ >= SHRINK_PERIODS && limit_ > min_threads_)
+            {
+                --limit_;
+                calm_periods_ = 0;
+                ++shrunk_;
+            }
+        }
+        else
+        {
+            calm_periods_ = 0;
+        }
+
+        new_limit = limit_;
+    }
+
+    if (new_limit > previous_limit)
+    {
+        condition_.notify_all();
+        logInfo(DDSROUTER_CONCURRENCY,
+                "Growing forwarding threads from " << previous_limit << " to " << new_limit << ": data waited "
+                                                   << mean_wait_us << " us (target " << target_wait_us_ << " us) with "
+                                                   << pending << " readers pending.");
+    }
+    else if (new_limit < previous_limit)
+    {
+        logInfo(DDSROUTER_CONCURRENCY,
+                "Shrinking forwarding threads from " << previous_limit << " to " << new_limit << ": data waited "
+                                                     << mean_wait_us << " us (target " << target_wait_us_
+                                                     << " us) for " << SHRINK_PERIODS << " periods.");
+    }
+
+    return static_cast<int64_t>(new_limit) - static_cast<int64_t>(previous_limit);
+}
+
+ConcurrencyStatistics ConcurrencyGate::statistics() const noexcept
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    ConcurrencyStatistics statistics;
+    statistics.limit = limit_;
+    statistics.active = active_;
+    statistics.pending = readers_pending(pending_);
+    statistics.mean_wait_us = mean_wait_us_;
+    statistics.grown = grown_;
+    statistics.shrunk = shrunk_;
+    return statistics;
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,57 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file PerThreadCounter.cpp
+ *
+ */
+
+#include <ddsrouter_core/efficiency/counters/PerThreadCounter.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+PerThreadCounter::PerThreadCounter()
+    : slots_(new Slot[SLOTS])
+{
+}
+
+void PerThreadCounter::add(
+        uint64_t amount) noexcept
+{
+    // The slot may be shared with other threads, so the addition must still be atomic, but it is not contended
+    slots_[slot_index_()].value.fetch_add(amount, std::memory_order_relaxed);
+}
+
+uint64_t PerThreadCounter::value() const noexcept
+{
+    uint64_t value = 0;
+    for (std::size_t i = 0; i < SLOTS; ++i)
+    {
+        value += slots_[i].value.load(std::memory_order_relaxed);
+    }
+    return value;
+}
+
+std::size_t PerThreadCounter::slot_index_() noexcept
+{
+    static std::atomic<std::size_t> next_index{0};
+    thread_local const std::size_t index = next_index.fetch_add(1, std::memory_order_relaxed) % SLOTS;
+    return index;
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
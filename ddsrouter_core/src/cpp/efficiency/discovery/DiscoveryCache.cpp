@@ -0,0 +1,245 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file DiscoveryCache.cpp
+ *
+ */
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+#include <cpp_utils/Log.hpp>
+
+#include <ddsrouter_core/efficiency/discovery/DiscoveryCache.hpp>
+#include <ddsrouter_core/participants/ipc/IpcCodec.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+namespace {
+
+//! First bytes of a snapshot file.
+constexpr char DISCOVERY_CACHE_MAGIC[8] = {'D', 'D', 'S', 'R', 'D', 'I', 'S', 'C'};
+
+//! Version of the snapshot file format. Snapshots of other versions are ignored.
+constexpr uint32_t DISCOVERY_CACHE_VERSION = 1;
+
+//! Header of a snapshot file, followed by \c endpoints records prefixed by their size.
+struct DiscoveryCacheHeader
+{
+    char magic[sizeof(DISCOVERY_CACHE_MAGIC)];
+    uint32_t version;
+    uint32_t endpoints;
+};
+
+} /* namespace */
+
+DiscoveryCache::DiscoveryCache(
+        const std::string& file)
+    : file_(file)
+{
+}
+
+std::vector<ddspipe::core::types::Endpoint> DiscoveryCache::load() const noexcept
+{
+    std::vector<ddspipe::core::types::Endpoint> endpoints;
+
+    std::ifstream input(file_, std::ios::binary);
+    if (!input)
+    {
+        logInfo(DDSROUTER_DISCOVERY, "No discovery cache found in " << file_ << ".");
+        return endpoints;
+    }
+
+    try
+    {
+        const std::vector<uint8_t> content{std::istreambuf_iterator<char>(input), std::istreambuf_iterator<char>()};
+
+        IpcDecoder decoder(content.data(), content.size());
+
+        DiscoveryCacheHeader header;
+        if (!decoder.read(header) ||
+                std::memcmp(header.magic, DISCOVERY_CACHE_MAGIC, sizeof(DISCOVERY_CACHE_MAGIC)) != 0 ||
+                header.version != DISCOVERY_CACHE_VERSION)
+        {
+            logWarning(DDSROUTER_DISCOVERY, "Ignoring discovery cache " << file_ << " of an unknown format.");
+            return endpoints;
+        }
+
+        for (uint32_t i = 0; i < header.endpoints; ++i)
+        {
+            const uint8_t* record;
+            uint32_t size;
+            ddspipe::core::types::Endpoint endpoint;
+
+            if (!decoder.read_bytes(record, size) || !decode_(record, size, endpoint))
+            {
+                logWarning(DDSROUTER_DISCOVERY, "Ignoring discovery cache " << file_ << " truncated or corrupted.");
+                return {};
+            }
+
+            endpoints.push_back(endpoint);
+        }
+    }
+    catch (const std::exception& e)
+    {
+        logWarning(DDSROUTER_DISCOVERY, "Failed to load discovery cache " << file_ << ": " << e.what());
+        return {};
+    }
+
+    logInfo(DDSROUTER_DISCOVERY, "Loaded " << endpoints.size() << " endpoints from discovery cache " << file_ << ".");
+
+    return endpoints;
+}
+
+bool DiscoveryCache::save(
+        const std::vector<ddspipe::core::types::Endpoint>& endpoints) const noexcept
+{
+    const std::string temporary_file = file_ + ".tmp";
+
+    try
+    {
+        std::ofstream output(temporary_file, std::ios::binary | std::ios::trunc);
+        if (!output)
+        {
+            logWarning(DDSROUTER_DISCOVERY, "Failed to open discovery cache " << temporary_file << ".");
+            return false;
+        }
+
+        DiscoveryCacheHeader header;
+        std::memcpy(header.magic, DISCOVERY_CACHE_MAGIC, sizeof(DISCOVERY_CACHE_MAGIC));
+        header.version = DISCOVERY_CACHE_VERSION;
+        header.endpoints = static_cast<uint32_t>(endpoints.size());
+        output.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+        std::vector<uint8_t> buffer;
+        for (const auto& endpoint : endpoints)
+        {
+            encode_(endpoint, buffer);
+
+            const uint32_t size = static_cast<uint32_t>(buffer.size());
+            output.write(reinterpret_cast<const char*>(&size), sizeof(size));
+            output.write(reinterpret_cast<const char*>(buffer.data()), buffer.size());
+        }
+
+        output.close();
+        if (!output)
+        {
+            logWarning(DDSROUTER_DISCOVERY, "Failed to write discovery cache " << temporary_file << ".");
+            std::remove(temporary_file.c_str());
+            return false;
+        }
+    }
+    catch (const std::exception& e)
+    {
+        logWarning(DDSROUTER_DISCOVERY, "Failed to write discovery cache " << temporary_file << ": " << e.what());
+        std::remove(temporary_file.c_str());
+        return false;
+    }
+
+    if (std::rename(temporary_file.c_str(), file_.c_str()) != 0)
+    {
+        logWarning(DDSROUTER_DISCOVERY, "Failed to replace discovery cache " << file_ << ".");
+        std::remove(temporary_file.c_str());
+        return false;
+    }
+
+    logInfo(DDSROUTER_DISCOVERY, "Saved " << endpoints.size() << " endpoints in discovery cache " << file_ << ".");
+
+    return true;
+}
+
+void DiscoveryCache::encode_(
+        const ddspipe::core::types::Endpoint& endpoint,
+        std::vector<uint8_t>& buffer)
+{
+    const std::string& topic_name = endpoint.topic.m_topic_name;
+    const std::string& type_name = endpoint.topic.type_name;
+    const std::string participant_id = endpoint.discoverer_participant_id;
+
+    buffer.resize(
+        sizeof(uint8_t) +
+        sizeof(endpoint.guid.guidPrefix.value) + sizeof(endpoint.guid.entityId.value) +
+        IpcEncoder::bytes_size(topic_name.size()) + IpcEncoder::bytes_size(type_name.size()) +
+        IpcEncoder::bytes_size(participant_id.size()) +
+        3 * sizeof(uint8_t) + sizeof(uint32_t));
+
+    const auto& qos = endpoint.topic.topic_qos;
+
+    IpcEncoder encoder(buffer.data());
+    encoder.write(static_cast<uint8_t>(endpoint.kind == ddspipe::core::types::EndpointKind::writer));
+    encoder.write(endpoint.guid.guidPrefix.value);
+    encoder.write(endpoint.guid.entityId.value);
+    encoder.write_string(topic_name);
+    encoder.write_string(type_name);
+    encoder.write_string(participant_id);
+    encoder.write(static_cast<uint8_t>(
+        qos.reliability_qos.get_value() == ddspipe::core::types::ReliabilityKind::RELIABLE));
+    encoder.write(static_cast<uint8_t>(
+        qos.durability_qos.get_value() == ddspipe::core::types::DurabilityKind::TRANSIENT_LOCAL));
+    encoder.write(static_cast<uint8_t>(qos.keyed.get_value()));
+    encoder.write(static_cast<uint32_t>(qos.history_depth.get_value()));
+}
+
+bool DiscoveryCache::decode_(
+        const uint8_t* record,
+        uint64_t size,
+        ddspipe::core::types::Endpoint& endpoint)
+{
+    IpcDecoder decoder(record, size);
+
+    uint8_t is_writer;
+    std::string participant_id;
+    uint8_t reliable;
+    uint8_t transient_local;
+    uint8_t keyed;
+    uint32_t history_depth;
+
+    if (!decoder.read(is_writer) ||
+            !decoder.read(endpoint.guid.guidPrefix.value) ||
+            !decoder.read(endpoint.guid.entityId.value) ||
+            !decoder.read_string(endpoint.topic.m_topic_name) ||
+            !decoder.read_string(endpoint.topic.type_name) ||
+            !decoder.read_string(participant_id) ||
+            !decoder.read(reliable) ||
+            !decoder.read(transient_local) ||
+            !decoder.read(keyed) ||
+            !decoder.read(history_depth))
+    {
+        return false;
+    }
+
+    endpoint.kind = is_writer ? ddspipe::core::types::EndpointKind::writer :
+            ddspipe::core::types::EndpointKind::reader;
+    endpoint.active = true;
+    endpoint.discoverer_participant_id = participant_id;
+
+    auto& qos = endpoint.topic.topic_qos;
+    qos.reliability_qos = reliable ? ddspipe::core::types::ReliabilityKind::RELIABLE :
+            ddspipe::core::types::ReliabilityKind::BEST_EFFORT;
+    qos.durability_qos = transient_local ? ddspipe::core::types::DurabilityKind::TRANSIENT_LOCAL :
+            ddspipe::core::types::DurabilityKind::VOLATILE;
+    qos.keyed = keyed != 0;
+    qos.history_depth = history_depth;
+
+    return true;
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,378 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file DiscoveryCoalescer.cpp
+ *
+ */
+
+#include <chrono>
+
+#include <cpp_utils/Log.hpp>
+
+#include <ddsrouter_core/efficiency/discovery/DiscoveryCoalescer.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+DiscoveryCoalescer::DiscoveryCoalescer(
+        const std::shared_ptr<ddspipe::core::DiscoveryDatabase>& source,
+        const std::shared_ptr<ddspipe::core::DiscoveryDatabase>& target,
+        utils::Duration_ms period)
+    : source_(source)
+    , target_(target)
+    , period_(period)
+    , running_(false)
+    , expiring_(false)
+    , in_flight_(0)
+    , received_(0)
+    , added_(0)
+    , updated_(0)
+    , erased_(0)
+    , coalesced_(0)
+    , batches_(0)
+    , preloaded_count_(0)
+    , expired_(0)
+{
+}
+
+DiscoveryCoalescer::~DiscoveryCoalescer()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        running_ = false;
+    }
+    cv_.notify_all();
+
+    if (thread_.joinable())
+    {
+        thread_.join();
+    }
+}
+
+void DiscoveryCoalescer::init()
+{
+    std::weak_ptr<DiscoveryCoalescer> weak_this = shared_from_this();
+
+    source_->add_endpoint_discovered_callback(
+        [weak_this](ddspipe::core::types::Endpoint endpoint)
+        {
+            auto coalescer = weak_this.lock();
+            if (coalescer)
+            {
+                coalescer->on_event_(endpoint, true);
+            }
+        });
+
+    source_->add_endpoint_updated_callback(
+        [weak_this](ddspipe::core::types::Endpoint endpoint)
+        {
+            auto coalescer = weak_this.lock();
+            if (coalescer)
+            {
+                coalescer->on_event_(endpoint, true);
+            }
+        });
+
+    source_->add_endpoint_erased_callback(
+        [weak_this](ddspipe::core::types::Endpoint endpoint)
+        {
+            auto coalescer = weak_this.lock();
+            if (coalescer)
+            {
+                coalescer->on_event_(endpoint, false);
+            }
+        });
+
+    running_ = true;
+    thread_ = std::thread(&DiscoveryCoalescer::routine_, this);
+}
+
+void DiscoveryCoalescer::flush() noexcept
+{
+    std::lock_guard<std::mutex> forward_lock(forward_mutex_);
+
+    std::vector<PendingEndpoint> batch;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        batch.swap(pending_);
+        pending_index_.clear();
+        in_flight_ = batch.size();
+    }
+
+    if (!batch.empty())
+    {
+        forward_nts_(std::move(batch));
+    }
+}
+
+bool DiscoveryCoalescer::idle() const noexcept
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return pending_.empty() && in_flight_ == 0;
+}
+
+DiscoveryCoalescerStatistics DiscoveryCoalescer::statistics() const noexcept
+{
+    DiscoveryCoalescerStatistics statistics;
+    statistics.received = received_.load(std::memory_order_relaxed);
+    statistics.added = added_.load(std::memory_order_relaxed);
+    statistics.updated = updated_.load(std::memory_order_relaxed);
+    statistics.erased = erased_.load(std::memory_order_relaxed);
+    statistics.coalesced = coalesced_.load(std::memory_order_relaxed);
+    statistics.batches = batches_.load(std::memory_order_relaxed);
+    statistics.preloaded = preloaded_count_.load(std::memory_order_relaxed);
+    statistics.expired = expired_.load(std::memory_order_relaxed);
+    return statistics;
+}
+
+void DiscoveryCoalescer::preload(
+        const std::vector<ddspipe::core::types::Endpoint>& endpoints,
+        utils::Duration_ms ttl) noexcept
+{
+    {
+        std::lock_guard<std::mutex> forward_lock(forward_mutex_);
+
+        for (const auto& endpoint : endpoints)
+        {
+            if (forwarded_.find(endpoint.guid) != forwarded_.end())
+            {
+                continue;
+            }
+
+            try
+            {
+                target_->add_endpoint(endpoint);
+                forwarded_[endpoint.guid] = endpoint;
+                preloaded_.insert(endpoint.guid);
+                preloaded_count_.fetch_add(1, std::memory_order_relaxed);
+            }
+            catch (const std::exception& e)
+            {
+                logWarning(DDSROUTER_DISCOVERY,
+                        "Failed to preload endpoint " << endpoint.guid << ": " << e.what());
+            }
+        }
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        expiring_ = true;
+        expiration_ = std::chrono::steady_clock::now() + std::chrono::milliseconds(ttl);
+    }
+    cv_.notify_all();
+}
+
+std::vector<ddspipe::core::types::Endpoint> DiscoveryCoalescer::endpoints() const noexcept
+{
+    std::lock_guard<std::mutex> forward_lock(forward_mutex_);
+
+    std::vector<ddspipe::core::types::Endpoint> endpoints;
+    endpoints.reserve(forwarded_.size());
+    for (const auto& it : forwarded_)
+    {
+        endpoints.push_back(it.second);
+    }
+
+    return endpoints;
+}
+
+void DiscoveryCoalescer::on_event_(
+        const ddspipe::core::types::Endpoint& endpoint,
+        bool alive) noexcept
+{
+    received_.fetch_add(1, std::memory_order_relaxed);
+
+    bool first = false;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        auto it = pending_index_.find(endpoint.guid);
+        if (it == pending_index_.end())
+        {
+            first = pending_.empty();
+            pending_index_[endpoint.guid] = pending_.size();
+            pending_.push_back({endpoint, alive, 1});
+        }
+        else
+        {
+            // Only the latest state of the endpoint matters
+            PendingEndpoint& pending = pending_[it->second];
+            pending.endpoint = endpoint;
+            pending.alive = alive;
+            ++pending.events;
+        }
+    }
+
+    // Start the batch window
+    if (first)
+    {
+        cv_.notify_all();
+    }
+}
+
+void DiscoveryCoalescer::routine_() noexcept
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (running_)
+    {
+        const auto wake_up = [this]()
+                {
+                    return !running_ || !pending_.empty();
+                };
+
+        // Wait for the first event of a batch, or for the preloaded endpoints to expire
+        if (expiring_)
+        {
+            cv_.wait_until(lock, expiration_, wake_up);
+        }
+        else
+        {
+            cv_.wait(lock, wake_up);
+        }
+
+        if (!running_)
+        {
+            break;
+        }
+
+        if (!pending_.empty())
+        {
+            // Gather the events arriving during the window
+            cv_.wait_for(lock, std::chrono::milliseconds(period_), [this]()
+                    {
+                        return !running_;
+                    });
+
+            if (!running_)
+            {
+                break;
+            }
+
+            lock.unlock();
+            flush();
+            lock.lock();
+        }
+
+        if (expiring_ && std::chrono::steady_clock::now() >= expiration_)
+        {
+            expiring_ = false;
+
+            lock.unlock();
+            expire_preloaded_();
+            lock.lock();
+        }
+    }
+}
+
+void DiscoveryCoalescer::forward_nts_(
+        std::vector<PendingEndpoint>&& batch) noexcept
+{
+    uint64_t received = 0;
+    uint64_t forwarded = 0;
+    uint64_t failed = 0;
+
+    for (const auto& pending : batch)
+    {
+        received += pending.events;
+
+        const bool known = forwarded_.find(pending.endpoint.guid) != forwarded_.end();
+
+        // Discovered again, so it is no longer a guess from the cache
+        preloaded_.erase(pending.endpoint.guid);
+
+        try
+        {
+            if (!pending.alive)
+            {
+                if (known)
+                {
+                    target_->erase_endpoint(pending.endpoint);
+                    forwarded_.erase(pending.endpoint.guid);
+                    erased_.fetch_add(1, std::memory_order_relaxed);
+                    ++forwarded;
+                }
+            }
+            else if (!known)
+            {
+                target_->add_endpoint(pending.endpoint);
+                forwarded_[pending.endpoint.guid] = pending.endpoint;
+                added_.fetch_add(1, std::memory_order_relaxed);
+                ++forwarded;
+            }
+            else
+            {
+                target_->update_endpoint(pending.endpoint);
+                forwarded_[pending.endpoint.guid] = pending.endpoint;
+                updated_.fetch_add(1, std::memory_order_relaxed);
+                ++forwarded;
+            }
+        }
+        catch (const std::exception& e)
+        {
+            logWarning(DDSROUTER_DISCOVERY,
+                    "Failed to forward discovery of endpoint " << pending.endpoint.guid << ": " << e.what());
+            ++failed;
+        }
+    }
+
+    coalesced_.fetch_add(received - forwarded - failed, std::memory_order_relaxed);
+    batches_.fetch_add(1, std::memory_order_relaxed);
+
+    logDebug(DDSROUTER_DISCOVERY,
+            "Forwarded batch of " << received << " discovery events as " << forwarded << " endpoint changes.");
+
+    in_flight_ = 0;
+}
+
+void DiscoveryCoalescer::expire_preloaded_() noexcept
+{
+    std::lock_guard<std::mutex> forward_lock(forward_mutex_);
+
+    for (const auto& guid : preloaded_)
+    {
+        auto it = forwarded_.find(guid);
+        if (it == forwarded_.end())
+        {
+            continue;
+        }
+
+        try
+        {
+            target_->erase_endpoint(it->second);
+            erased_.fetch_add(1, std::memory_order_relaxed);
+            expired_.fetch_add(1, std::memory_order_relaxed);
+        }
+        catch (const std::exception& e)
+        {
+            logWarning(DDSROUTER_DISCOVERY,
+                    "Failed to expire preloaded endpoint " << guid << ": " << e.what());
+        }
+
+        forwarded_.erase(it);
+    }
+
+    if (!preloaded_.empty())
+    {
+        logInfo(DDSROUTER_DISCOVERY,
+                preloaded_.size() << " endpoints of the discovery cache expired without being discovered again.");
+    }
+
+    preloaded_.clear();
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,945 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file CdrPredicate.cpp
+ *
+ */
+
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+
+#include <cpp_utils/exception/InitializationException.hpp>
+
+#include <ddsrouter_core/efficiency/filter/CdrPredicate.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+namespace {
+
+//! Deepest nesting of conditions, so evaluating them cannot exhaust the stack.
+constexpr std::size_t MAX_DEPTH = 64;
+
+enum class TokenKind
+{
+    identifier,
+    number,
+    string,
+    parameter,
+    comparison,
+    open,
+    close,
+    comma,
+    end,
+};
+
+struct Token
+{
+    TokenKind kind;
+
+    std::string text;
+
+    //! Position in the expression, for the errors.
+    std::size_t position;
+};
+
+bool is_keyword(
+        const Token& token,
+        const char* keyword)
+{
+    if (token.kind != TokenKind::identifier || token.text.size() != std::strlen(keyword))
+    {
+        return false;
+    }
+
+    for (std::size_t i = 0; i < token.text.size(); ++i)
+    {
+        if (std::toupper(static_cast<unsigned char>(token.text[i])) != keyword[i])
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+//! Split \c text in tokens.
+std::vector<Token> tokenize(
+        const std::string& text)
+{
+    std::vector<Token> tokens;
+    std::size_t i = 0;
+
+    while (i < text.size())
+    {
+        const char c = text[i];
+        const std::size_t start = i;
+
+        if (std::isspace(static_cast<unsigned char>(c)))
+        {
+            ++i;
+        }
+        else if (std::isalpha(static_cast<unsigned char>(c)) || c == '_')
+        {
+            while (i < text.size() &&
+                    (std::isalnum(static_cast<unsigned char>(text[i])) || text[i] == '_' || text[i] == '.'))
+            {
+                ++i;
+            }
+            tokens.push_back({TokenKind::identifier, text.substr(start, i - start), start});
+        }
+        else if (std::isdigit(static_cast<unsigned char>(c)) ||
+                ((c == '-' || c == '+' || c == '.') && i + 1 < text.size() &&
+                (std::isdigit(static_cast<unsigned char>(text[i + 1])) || text[i + 1] == '.')))
+        {
+            ++i;
+            while (i < text.size() &&
+                    (std::isalnum(static_cast<unsigned char>(text[i])) || text[i] == '.' ||
+                    ((text[i] == '-' || text[i] == '+') && (text[i - 1] == 'e' || text[i - 1] == 'E'))))
+            {
+                ++i;
+            }
+            tokens.push_back({TokenKind::number, text.substr(start, i - start), start});
+        }
+        else if (c == '\'')
+        {
+            // Quotes inside strings are written twice
+            std::string value;
+            ++i;
+            while (true)
+            {
+                if (i >= text.size())
+                {
+                    throw utils::InitializationException(utils::Formatter()
+                                  << "String not terminated at position " << start << ".");
+                }
+                if (text[i] == '\'')
+                {
+                    if (i + 1 < text.size() && text[i + 1] == '\'')
+                    {
+                        value += '\'';
+                        i += 2;
+                        continue;
+                    }
+                    ++i;
+                    break;
+                }
+                value += text[i++];
+            }
+            tokens.push_back({TokenKind::string, value, start});
+        }
+        else if (c == '%')
+        {
+            ++i;
+            while (i < text.size() && std::isdigit(static_cast<unsigned char>(text[i])))
+            {
+                ++i;
+            }
+            if (i == start + 1 || i - start > 3)
+            {
+                throw utils::InitializationException(utils::Formatter()
+                              << "Parameters must be %0 to %99, at position " << start << ".");
+            }
+            tokens.push_back({TokenKind::parameter, text.substr(start + 1, i - start - 1), start});
+        }
+        else if (c == '=' || c == '<' || c == '>' || c == '!')
+        {
+            ++i;
+            if (i < text.size() && (text[i] == '=' || (c == '<' && text[i] == '>')))
+            {
+                ++i;
+            }
+            const std::string op = text.substr(start, i - start);
+            if (op == "!")
+            {
+                throw utils::InitializationException(utils::Formatter()
+                              << "Unexpected character ! at position " << start << ".");
+            }
+            tokens.push_back({TokenKind::comparison, op, start});
+        }
+        else if (c == '(' || c == ')' || c == ',')
+        {
+            ++i;
+            tokens.push_back({c == '(' ? TokenKind::open : (c == ')' ? TokenKind::close : TokenKind::comma),
+                              std::string(1, c), start});
+        }
+        else
+        {
+            throw utils::InitializationException(utils::Formatter()
+                          << "Unexpected character " << c << " at position " << start << ".");
+        }
+    }
+
+    tokens.push_back({TokenKind::end, "", text.size()});
+    return tokens;
+}
+
+//! Whether \c text matches \c pattern , where % matches any text and _ any character.
+bool like(
+        const char* text,
+        uint32_t text_length,
+        const char* pattern,
+        uint32_t pattern_length) noexcept
+{
+    uint32_t t = 0;
+    uint32_t p = 0;
+
+    // Position of the last % seen, and of the text it was matched against
+    uint32_t star = UINT32_MAX;
+    uint32_t star_text = 0;
+
+    while (t < text_length)
+    {
+        if (p < pattern_length && (pattern[p] == '_' || pattern[p] == text[t]))
+        {
+            ++t;
+            ++p;
+        }
+        else if (p < pattern_length && pattern[p] == '%')
+        {
+            star = p++;
+            star_text = t;
+        }
+        else if (star != UINT32_MAX)
+        {
+            p = star + 1;
+            t = ++star_text;
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    while (p < pattern_length && pattern[p] == '%')
+    {
+        ++p;
+    }
+    return p == pattern_length;
+}
+
+} /* namespace */
+
+/**
+ * Recursive descent parser of the expressions of \c CdrPredicate .
+ *
+ * condition   := conjunction { OR conjunction }
+ * conjunction := unary { AND unary }
+ * unary       := NOT unary | ( condition ) | predicate
+ * predicate   := operand ( comparison operand | [NOT] LIKE operand | [NOT] BETWEEN operand AND operand |
+ *                [NOT] IN ( operand { , operand } ) )
+ */
+class CdrPredicateParser
+{
+public:
+
+    using Value = CdrPredicate::Value;
+    using ValueKind = CdrPredicate::ValueKind;
+    using Operand = CdrPredicate::Operand;
+    using Node = CdrPredicate::Node;
+    using NodeKind = CdrPredicate::NodeKind;
+    using Operator = CdrPredicate::Operator;
+
+    CdrPredicateParser(
+            CdrPredicate& predicate,
+            const std::vector<std::string>& parameters)
+        : predicate_(predicate)
+        , parameters_(parameters)
+        , tokens_(tokenize(predicate.expression_))
+    {
+    }
+
+    void parse()
+    {
+        predicate_.root_ = condition_(0);
+        if (peek_().kind != TokenKind::end)
+        {
+            fail_("Unexpected " + peek_().text);
+        }
+    }
+
+protected:
+
+    std::size_t condition_(
+            std::size_t depth)
+    {
+        if (depth > MAX_DEPTH)
+        {
+            fail_("Conditions nested too deep");
+        }
+
+        std::size_t left = conjunction_(depth);
+        while (is_keyword(peek_(), "OR"))
+        {
+            next_();
+            left = join_(NodeKind::disjunction, left, conjunction_(depth));
+        }
+        return left;
+    }
+
+    std::size_t conjunction_(
+            std::size_t depth)
+    {
+        std::size_t left = unary_(depth);
+        while (is_keyword(peek_(), "AND"))
+        {
+            next_();
+            left = join_(NodeKind::conjunction, left, unary_(depth));
+        }
+        return left;
+    }
+
+    std::size_t unary_(
+            std::size_t depth)
+    {
+        if (depth > MAX_DEPTH)
+        {
+            fail_("Conditions nested too deep");
+        }
+
+        if (is_keyword(peek_(), "NOT"))
+        {
+            next_();
+            return negate_(unary_(depth + 1));
+        }
+
+        if (peek_().kind == TokenKind::open)
+        {
+            next_();
+            const std::size_t node = condition_(depth + 1);
+            expect_(TokenKind::close, ")");
+            return node;
+        }
+
+        return predicate_node_();
+    }
+
+    std::size_t predicate_node_()
+    {
+        const Operand left = operand_();
+
+        bool negated = false;
+        if (is_keyword(peek_(), "NOT"))
+        {
+            next_();
+            negated = true;
+        }
+
+        Node node;
+
+        if (is_keyword(peek_(), "BETWEEN"))
+        {
+            next_();
+            node.kind = NodeKind::between;
+            node.operands.push_back(left);
+            node.operands.push_back(operand_());
+            if (!is_keyword(peek_(), "AND"))
+            {
+                fail_("BETWEEN requires AND");
+            }
+            next_();
+            node.operands.push_back(operand_());
+            check_kinds_(node.operands[0], node.operands[1]);
+            check_kinds_(node.operands[0], node.operands[2]);
+        }
+        else if (is_keyword(peek_(), "IN"))
+        {
+            next_();
+            node.kind = NodeKind::membership;
+            node.operands.push_back(left);
+            expect_(TokenKind::open, "(");
+            while (true)
+            {
+                node.operands.push_back(operand_());
+                check_kinds_(node.operands[0], node.operands.back());
+                if (peek_().kind != TokenKind::comma)
+                {
+                    break;
+                }
+                next_();
+            }
+            expect_(TokenKind::close, ")");
+        }
+        else if (is_keyword(peek_(), "LIKE"))
+        {
+            next_();
+            node.kind = NodeKind::comparison;
+            node.op = Operator::like;
+            node.operands.push_back(left);
+            node.operands.push_back(operand_());
+            if (left.kind != ValueKind::string || node.operands[1].kind != ValueKind::string)
+            {
+                fail_("LIKE compares strings");
+            }
+        }
+        else if (!negated && peek_().kind == TokenKind::comparison)
+        {
+            node.kind = NodeKind::comparison;
+            node.op = comparison_(next_().text);
+            node.operands.push_back(left);
+            node.operands.push_back(operand_());
+            check_kinds_(node.operands[0], node.operands[1]);
+        }
+        else
+        {
+            fail_("Expected a comparison");
+        }
+
+        // As in DDS, every condition depends on the sample
+        if (std::none_of(node.operands.begin(), node.operands.end(), [](const Operand& operand)
+                {
+                    return operand.field;
+                }))
+        {
+            fail_("Condition does not reference any field");
+        }
+
+        predicate_.nodes_.push_back(node);
+        const std::size_t index = predicate_.nodes_.size() - 1;
+        return negated ? negate_(index) : index;
+    }
+
+    Operand operand_()
+    {
+        Token token = next_();
+
+        if (token.kind == TokenKind::parameter)
+        {
+            const std::size_t index = std::stoul(token.text);
+            if (index >= parameters_.size())
+            {
+                fail_("Parameter %" + token.text + " has no value");
+            }
+
+            const std::vector<Token> value = tokenize(parameters_[index]);
+            if (value.size() != 2 || !(value[0].kind == TokenKind::number || value[0].kind == TokenKind::string ||
+                    is_keyword(value[0], "TRUE") || is_keyword(value[0], "FALSE")))
+            {
+                fail_("Parameter %" + token.text + " is not a value: " + parameters_[index]);
+            }
+            token = value[0];
+        }
+
+        Operand operand;
+
+        if (token.kind == TokenKind::identifier && !is_keyword(token, "TRUE") && !is_keyword(token, "FALSE"))
+        {
+            operand.field = true;
+            operand.slot = slot_(token.text);
+            operand.kind = field_kind_(token.text);
+        }
+        else if (token.kind == TokenKind::identifier)
+        {
+            operand.kind = ValueKind::boolean;
+            operand.constant.kind = ValueKind::boolean;
+            operand.constant.unsigned_integer = is_keyword(token, "TRUE") ? 1 : 0;
+        }
+        else if (token.kind == TokenKind::string)
+        {
+            operand.kind = ValueKind::string;
+            operand.constant.kind = ValueKind::string;
+            operand.text = token.text;
+        }
+        else if (token.kind == TokenKind::number)
+        {
+            operand.constant = number_(token.text);
+            operand.kind = operand.constant.kind;
+        }
+        else
+        {
+            fail_("Expected a field or a value");
+        }
+
+        return operand;
+    }
+
+    Value number_(
+            const std::string& text)
+    {
+        Value value{};
+        char* end = nullptr;
+        errno = 0;
+
+        if (text.find_first_of(".eE") == std::string::npos)
+        {
+            if (text[0] == '-')
+            {
+                value.kind = ValueKind::signed_integer;
+                value.signed_integer = std::strtoll(text.c_str(), &end, 10);
+            }
+            else
+            {
+                value.kind = ValueKind::unsigned_integer;
+                value.unsigned_integer = std::strtoull(text.c_str(), &end, 10);
+            }
+        }
+        else
+        {
+            value.kind = ValueKind::floating;
+            value.floating = std::strtod(text.c_str(), &end);
+        }
+
+        if (errno != 0 || end != text.c_str() + text.size())
+        {
+            fail_("Invalid number " + text);
+        }
+        return value;
+    }
+
+    std::size_t slot_(
+            const std::string& name)
+    {
+        const std::size_t index = predicate_.layout_.find(name);
+        if (index == CdrLayout::NOT_FOUND)
+        {
+            fail_("Unknown field " + name);
+        }
+
+        if (predicate_.layout_.field(index).type.container != CdrContainerKind::single)
+        {
+            fail_("Field " + name + " is not a single value");
+        }
+
+        std::size_t& slot = predicate_.slots_[index];
+        if (slot == CdrPredicate::NO_SLOT)
+        {
+            slot = slots_++;
+            if (slots_ > CdrPredicate::MAX_FIELDS)
+            {
+                fail_("Too many fields referenced");
+            }
+            predicate_.fields_walked_ = std::max(predicate_.fields_walked_, index + 1);
+        }
+        return slot;
+    }
+
+    ValueKind field_kind_(
+            const std::string& name)
+    {
+        switch (predicate_.layout_.field(predicate_.layout_.find(name)).type.element)
+        {
+            case CdrElementKind::boolean:
+                return ValueKind::boolean;
+
+            case CdrElementKind::character:
+            case CdrElementKind::string:
+                return ValueKind::string;
+
+            case CdrElementKind::int8:
+            case CdrElementKind::int16:
+            case CdrElementKind::int32:
+            case CdrElementKind::int64:
+                return ValueKind::signed_integer;
+
+            case CdrElementKind::float32:
+            case CdrElementKind::float64:
+                return ValueKind::floating;
+
+            default:
+                return ValueKind::unsigned_integer;
+        }
+    }
+
+    Operator comparison_(
+            const std::string& text)
+    {
+        if (text == "=")
+        {
+            return Operator::equal;
+        }
+        if (text == "<>" || text == "!=")
+        {
+            return Operator::not_equal;
+        }
+        if (text == "<")
+        {
+            return Operator::less;
+        }
+        if (text == "<=")
+        {
+            return Operator::less_equal;
+        }
+        if (text == ">")
+        {
+            return Operator::greater;
+        }
+        if (text == ">=")
+        {
+            return Operator::greater_equal;
+        }
+
+        fail_("Unknown comparison " + text);
+        return Operator::equal;
+    }
+
+    //! Check two operands can be compared: numbers with numbers, strings with strings and booleans with booleans.
+    void check_kinds_(
+            const Operand& a,
+            const Operand& b)
+    {
+        const auto group = [](ValueKind kind)
+                {
+                    return kind == ValueKind::signed_integer || kind == ValueKind::unsigned_integer ||
+                           kind == ValueKind::floating ? ValueKind::floating : kind;
+                };
+
+        if (group(a.kind) != group(b.kind))
+        {
+            fail_("Values of different types are compared");
+        }
+    }
+
+    std::size_t join_(
+            NodeKind kind,
+            std::size_t left,
+            std::size_t right)
+    {
+        Node node;
+        node.kind = kind;
+        node.left = left;
+        node.right = right;
+        predicate_.nodes_.push_back(node);
+        return predicate_.nodes_.size() - 1;
+    }
+
+    std::size_t negate_(
+            std::size_t child)
+    {
+        return join_(NodeKind::negation, child, child);
+    }
+
+    const Token& peek_() const
+    {
+        return tokens_[position_];
+    }
+
+    Token next_()
+    {
+        const Token token = tokens_[position_];
+        if (token.kind != TokenKind::end)
+        {
+            ++position_;
+        }
+        return token;
+    }
+
+    void expect_(
+            TokenKind kind,
+            const char* text)
+    {
+        if (peek_().kind != kind)
+        {
+            fail_(std::string("Expected ") + text);
+        }
+        next_();
+    }
+
+    [[noreturn]] void fail_(
+            const std::string& reason) const
+    {
+        throw utils::InitializationException(utils::Formatter()
+                      << reason << " at position " << tokens_[position_ > 0 ? position_ - 1 : 0].position
+                      << " of filter expression: " << predicate_.expression_);
+    }
+
+    CdrPredicate& predicate_;
+
+    const std::vector<std::string>& parameters_;
+
+    const std::vector<Token> tokens_;
+
+    std::size_t position_ = 0;
+
+    std::size_t slots_ = 0;
+};
+
+CdrPredicate::CdrPredicate(
+        const std::string& expression,
+        const std::vector<std::string>& parameters,
+        const std::vector<CdrFieldConfiguration>& fields)
+    : expression_(expression)
+    , layout_(fields)
+    , slots_(layout_.size(), NO_SLOT)
+{
+    CdrPredicateParser(*this, parameters).parse();
+
+    elements_.reserve(layout_.size());
+    for (std::size_t index = 0; index < layout_.size(); ++index)
+    {
+        elements_.push_back(layout_.field(index).type.element);
+    }
+
+    // Nodes do not move anymore, so the strings of the constants can point to their text
+    for (auto& node : nodes_)
+    {
+        for (auto& operand : node.operands)
+        {
+            if (!operand.field && operand.kind == ValueKind::string)
+            {
+                operand.constant.string = operand.text.data();
+                operand.constant.length = static_cast<uint32_t>(operand.text.size());
+            }
+        }
+    }
+}
+
+CdrPredicateResult CdrPredicate::evaluate(
+        const uint8_t* data,
+        uint32_t size) const noexcept
+{
+    CdrEncoding encoding;
+    if (!CdrLayout::encoding(data, size, encoding))
+    {
+        return CdrPredicateResult::malformed;
+    }
+
+    Value values[MAX_FIELDS];
+
+    const bool found = layout_.locate(data, size, encoding, fields_walked_,
+                    [&](std::size_t index, const CdrSpan& span)
+                    {
+                        const std::size_t slot = slots_[index];
+                        if (slot == NO_SLOT)
+                        {
+                            return;
+                        }
+
+                        const uint8_t* field = data + span.begin;
+                        const bool little_endian = encoding.little_endian;
+                        Value& value = values[slot];
+
+                        switch (elements_[index])
+                        {
+                            case CdrElementKind::boolean:
+                                value.kind = ValueKind::boolean;
+                                value.unsigned_integer = field[0] != 0 ? 1 : 0;
+                                break;
+
+                            case CdrElementKind::character:
+                                value.kind = ValueKind::string;
+                                value.string = reinterpret_cast<const char*>(field);
+                                value.length = 1;
+                                break;
+
+                            case CdrElementKind::string:
+                            {
+                                // The length counts the terminating null character
+                                const uint32_t length = CdrLayout::read<uint32_t>(field, little_endian);
+                                value.kind = ValueKind::string;
+                                value.string = reinterpret_cast<const char*>(field + 4);
+                                value.length = length > 0 ? length - 1 : 0;
+                                break;
+                            }
+
+                            case CdrElementKind::int8:
+                                value.kind = ValueKind::signed_integer;
+                                value.signed_integer = static_cast<int8_t>(field[0]);
+                                break;
+
+                            case CdrElementKind::uint8:
+                                value.kind = ValueKind::unsigned_integer;
+                                value.unsigned_integer = field[0];
+                                break;
+
+                            case CdrElementKind::int16:
+                                value.kind = ValueKind::signed_integer;
+                                value.signed_integer = CdrLayout::read<int16_t>(field, little_endian);
+                                break;
+
+                            case CdrElementKind::uint16:
+                                value.kind = ValueKind::unsigned_integer;
+                                value.unsigned_integer = CdrLayout::read<uint16_t>(field, little_endian);
+                                break;
+
+                            case CdrElementKind::int32:
+                                value.kind = ValueKind::signed_integer;
+                                value.signed_integer = CdrLayout::read<int32_t>(field, little_endian);
+                                break;
+
+                            case CdrElementKind::uint32:
+                                value.kind = ValueKind::unsigned_integer;
+                                value.unsigned_integer = CdrLayout::read<uint32_t>(field, little_endian);
+                                break;
+
+                            case CdrElementKind::int64:
+                                value.kind = ValueKind::signed_integer;
+                                value.signed_integer = CdrLayout::read<int64_t>(field, little_endian);
+                                break;
+
+                            case CdrElementKind::uint64:
+                                value.kind = ValueKind::unsigned_integer;
+                                value.unsigned_integer = CdrLayout::read<uint64_t>(field, little_endian);
+                                break;
+
+                            case CdrElementKind::float32:
+                                value.kind = ValueKind::floating;
+                                value.floating = CdrLayout::read<float>(field, little_endian);
+                                break;
+
+                            case CdrElementKind::float64:
+                                value.kind = ValueKind::floating;
+                                value.floating = CdrLayout::read<double>(field, little_endian);
+                                break;
+                        }
+                    });
+
+    if (!found)
+    {
+        return CdrPredicateResult::malformed;
+    }
+
+    return evaluate_(root_, values) ? CdrPredicateResult::match : CdrPredicateResult::no_match;
+}
+
+const std::string& CdrPredicate::expression() const noexcept
+{
+    return expression_;
+}
+
+const CdrPredicate::Value& CdrPredicate::value_(
+        const Operand& operand,
+        const Value* values) noexcept
+{
+    return operand.field ? values[operand.slot] : operand.constant;
+}
+
+int CdrPredicate::compare_(
+        const Value& a,
+        const Value& b) noexcept
+{
+    using Kind = ValueKind;
+
+    if (a.kind == Kind::string)
+    {
+        const int result = std::memcmp(a.string, b.string, std::min(a.length, b.length));
+        if (result != 0)
+        {
+            return result < 0 ? -1 : 1;
+        }
+        return a.length < b.length ? -1 : (a.length > b.length ? 1 : 0);
+    }
+
+    if (a.kind == Kind::boolean)
+    {
+        return static_cast<int>(a.unsigned_integer) - static_cast<int>(b.unsigned_integer);
+    }
+
+    if (a.kind == Kind::floating || b.kind == Kind::floating)
+    {
+        const auto as_double = [](const Value& value)
+                {
+                    return value.kind == Kind::floating ? value.floating :
+                           (value.kind == Kind::signed_integer ? static_cast<double>(value.signed_integer) :
+                           static_cast<double>(value.unsigned_integer));
+                };
+        const double x = as_double(a);
+        const double y = as_double(b);
+        return x < y ? -1 : (x > y ? 1 : 0);
+    }
+
+    // Negative numbers are below every unsigned one, and the rest compare as unsigned
+    const bool a_negative = a.kind == Kind::signed_integer && a.signed_integer < 0;
+    const bool b_negative = b.kind == Kind::signed_integer && b.signed_integer < 0;
+    if (a_negative || b_negative)
+    {
+        if (a_negative && b_negative)
+        {
+            return a.signed_integer < b.signed_integer ? -1 : (a.signed_integer > b.signed_integer ? 1 : 0);
+        }
+        return a_negative ? -1 : 1;
+    }
+
+    const uint64_t x = a.kind == Kind::signed_integer ? static_cast<uint64_t>(a.signed_integer) : a.unsigned_integer;
+    const uint64_t y = b.kind == Kind::signed_integer ? static_cast<uint64_t>(b.signed_integer) : b.unsigned_integer;
+    return x < y ? -1 : (x > y ? 1 : 0);
+}
+
+bool CdrPredicate::evaluate_(
+        std::size_t index,
+        const Value* values) const noexcept
+{
+    const Node& node = nodes_[index];
+
+    switch (node.kind)
+    {
+        case NodeKind::conjunction:
+            return evaluate_(node.left, values) && evaluate_(node.right, values);
+
+        case NodeKind::disjunction:
+            return evaluate_(node.left, values) || evaluate_(node.right, values);
+
+        case NodeKind::negation:
+            return !evaluate_(node.left, values);
+
+        case NodeKind::between:
+        {
+            const Value& value = value_(node.operands[0], values);
+            return compare_(value, value_(node.operands[1], values)) >= 0 &&
+                   compare_(value, value_(node.operands[2], values)) <= 0;
+        }
+
+        case NodeKind::membership:
+        {
+            const Value& value = value_(node.operands[0], values);
+            for (std::size_t i = 1; i < node.operands.size(); ++i)
+            {
+                if (compare_(value, value_(node.operands[i], values)) == 0)
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        case NodeKind::comparison:
+        default:
+        {
+            const Value& a = value_(node.operands[0], values);
+            const Value& b = value_(node.operands[1], values);
+
+            switch (node.op)
+            {
+                case Operator::equal:
+                    return compare_(a, b) == 0;
+
+                case Operator::not_equal:
+                    return compare_(a, b) != 0;
+
+                case Operator::less:
+                    return compare_(a, b) < 0;
+
+                case Operator::less_equal:
+                    return compare_(a, b) <= 0;
+
+                case Operator::greater:
+                    return compare_(a, b) > 0;
+
+                case Operator::greater_equal:
+                    return compare_(a, b) >= 0;
+
+                case Operator::like:
+                default:
+                    return like(a.string, a.length, b.string, b.length);
+            }
+        }
+    }
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,73 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ContentFilter.cpp
+ *
+ */
+
+#include <ddsrouter_core/efficiency/filter/ContentFilter.hpp>
+#include <ddsrouter_core/logging/BinaryLog.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+ContentFilter::ContentFilter(
+        const std::shared_ptr<const CdrPredicate>& predicate,
+        const std::string& topic)
+    : predicate_(predicate)
+    , topic_(topic)
+{
+}
+
+bool ContentFilter::accept(
+        const uint8_t* data,
+        uint32_t size) noexcept
+{
+    switch (predicate_->evaluate(data, size))
+    {
+        case CdrPredicateResult::match:
+            forwarded_.fetch_add(1, std::memory_order_relaxed);
+            return true;
+
+        case CdrPredicateResult::no_match:
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+            return false;
+
+        case CdrPredicateResult::malformed:
+        default:
+            logBinaryWarning(DDSROUTER_CONTENT_FILTER,
+                    "Sample of {} bytes in topic {} does not follow the layout of the content filter, forwarding it.",
+                    size, topic_);
+            malformed_.fetch_add(1, std::memory_order_relaxed);
+            forwarded_.fetch_add(1, std::memory_order_relaxed);
+            return true;
+    }
+}
+
+ContentFilterStatistics ContentFilter::statistics() const
+{
+    ContentFilterStatistics statistics;
+    statistics.topic = topic_;
+    statistics.expression = predicate_->expression();
+    statistics.forwarded = forwarded_.load(std::memory_order_relaxed);
+    statistics.dropped = dropped_.load(std::memory_order_relaxed);
+    statistics.malformed = malformed_.load(std::memory_order_relaxed);
+    return statistics;
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
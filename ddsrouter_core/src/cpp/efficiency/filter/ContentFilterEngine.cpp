@@ -0,0 +1,94 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ContentFilterEngine.cpp
+ *
+ */
+
+#include <ddsrouter_core/efficiency/filter/ContentFilterEngine.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+ContentFilterEngine::ContentFilterEngine(
+        const std::vector<ContentFilterConfiguration>& configurations)
+    : configurations_(configurations)
+{
+    predicates_.reserve(configurations_.size());
+
+    for (const auto& rule : configurations_)
+    {
+        predicates_.push_back(std::make_shared<const CdrPredicate>(rule.expression, rule.parameters, rule.fields));
+    }
+}
+
+bool ContentFilterEngine::empty() const noexcept
+{
+    return configurations_.empty();
+}
+
+std::vector<std::shared_ptr<ContentFilter>> ContentFilterEngine::filters(
+        const ddspipe::core::types::DdsTopic& topic,
+        const ddspipe::core::types::ParticipantId& participant_id)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    std::vector<std::shared_ptr<ContentFilter>> filters;
+
+    for (std::size_t i = 0; i < configurations_.size(); ++i)
+    {
+        const auto& rule = configurations_[i];
+
+        if (!rule.topic.matches(topic))
+        {
+            continue;
+        }
+
+        if (!rule.participant_id.empty() && rule.participant_id != participant_id)
+        {
+            continue;
+        }
+
+        auto& filter = filters_[{i, topic.topic_name()}];
+        if (!filter)
+        {
+            filter = std::make_shared<ContentFilter>(predicates_[i], topic.topic_name());
+        }
+
+        filters.push_back(filter);
+    }
+
+    return filters;
+}
+
+std::vector<ContentFilterStatistics> ContentFilterEngine::statistics() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    std::vector<ContentFilterStatistics> statistics;
+    statistics.reserve(filters_.size());
+
+    for (const auto& filter : filters_)
+    {
+        statistics.push_back(filter.second->statistics());
+    }
+
+    return statistics;
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,125 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ThreadPoolInstrumentation.cpp
+ *
+ */
+
+#include <ddsrouter_core/efficiency/instrumentation/ThreadPoolInstrumentation.hpp>
+#include <ddsrouter_core/monitoring/SamplingProfiler.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+namespace {
+
+void store_max(
+        std::atomic<uint64_t>& max,
+        uint64_t value) noexcept
+{
+    uint64_t current = max.load(std::memory_order_relaxed);
+    while (value > current && !max.compare_exchange_weak(current, value, std::memory_order_relaxed))
+    {
+    }
+}
+
+} /* namespace */
+
+void SlotCounters::record_enqueue(
+        uint64_t queue_depth) noexcept
+{
+    // Notifications come from the reception threads, so the same slot may be notified from several threads
+    enqueued.fetch_add(1, std::memory_order_relaxed);
+    store_max(max_queue_depth, queue_depth);
+}
+
+void SlotCounters::record_start(
+        uint64_t latency_us) noexcept
+{
+    queue_latency_us.fetch_add(latency_us, std::memory_order_relaxed);
+    store_max(max_queue_latency_us, latency_us);
+}
+
+void SlotCounters::record_message(
+        uint64_t size) noexcept
+{
+    messages.fetch_add(1, std::memory_order_relaxed);
+    bytes.fetch_add(size, std::memory_order_relaxed);
+}
+
+void SlotCounters::record_end(
+        uint64_t time_us) noexcept
+{
+    executed.fetch_add(1, std::memory_order_relaxed);
+    task_time_us.fetch_add(time_us, std::memory_order_relaxed);
+    store_max(max_task_time_us, time_us);
+}
+
+std::shared_ptr<SlotCounters> ThreadPoolInstrumentation::register_slot(
+        const ddspipe::core::types::ParticipantId& participant_id,
+        const std::string& topic)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    // A reader created again, e.g. after its topic is rediscovered, keeps the counters of the previous one
+    auto it = slot_indexes_.find({participant_id, topic});
+    if (it != slot_indexes_.end())
+    {
+        return slots_[it->second].counters;
+    }
+
+    auto counters = std::make_shared<SlotCounters>();
+
+    // The registry keeps the counters while the instrumentation exists, so the tag never dangles
+    counters->profiler_tag = SamplingProfiler::tag(participant_id, topic);
+
+    slot_indexes_.emplace(std::make_pair(participant_id, topic), slots_.size());
+    slots_.push_back({participant_id, topic, counters});
+    return counters;
+}
+
+std::vector<SlotStatistics> ThreadPoolInstrumentation::statistics() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    std::vector<SlotStatistics> statistics;
+    statistics.reserve(slots_.size());
+
+    for (const auto& slot : slots_)
+    {
+        const SlotCounters& counters = *slot.counters;
+
+        SlotStatistics slot_statistics;
+        slot_statistics.participant_id = slot.participant_id;
+        slot_statistics.topic = slot.topic;
+        slot_statistics.enqueued = counters.enqueued.load(std::memory_order_relaxed);
+        slot_statistics.executed = counters.executed.load(std::memory_order_relaxed);
+        slot_statistics.messages = counters.messages.load(std::memory_order_relaxed);
+        slot_statistics.bytes = counters.bytes.load(std::memory_order_relaxed);
+        slot_statistics.max_queue_depth = counters.max_queue_depth.load(std::memory_order_relaxed);
+        slot_statistics.queue_latency_us = counters.queue_latency_us.load(std::memory_order_relaxed);
+        slot_statistics.max_queue_latency_us = counters.max_queue_latency_us.load(std::memory_order_relaxed);
+        slot_statistics.task_time_us = counters.task_time_us.load(std::memory_order_relaxed);
+        slot_statistics.max_task_time_us = counters.max_task_time_us.load(std::memory_order_relaxed);
+        statistics.push_back(slot_statistics);
+    }
+
+    return statistics;
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
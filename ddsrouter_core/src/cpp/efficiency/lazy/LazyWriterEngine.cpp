@@ -0,0 +1,275 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file LazyWriterEngine.cpp
+ *
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+#include <cpp_utils/Log.hpp>
+
+#include <ddsrouter_core/efficiency/lazy/LazyWriterEngine.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+LazyWriterEngine::LazyWriterEngine(
+        utils::Duration_ms idle_ttl)
+    : idle_ttl_(idle_ttl)
+    , counters_(std::make_shared<LazyWriterCounters>())
+    , discovered_readers_(std::make_shared<DiscoveredReaders>())
+{
+    if (idle_ttl_ > 0)
+    {
+        const utils::Duration_ms period = std::max<utils::Duration_ms>(idle_ttl_ / 2, 1);
+
+        logDebug(DDSROUTER_LAZY_WRITER, "Starting idle writer reaper with period " << period << " ms.");
+
+        reaper_ = std::make_unique<utils::event::PeriodicEventHandler>(
+            [this]()
+            {
+                reap_idle_writers();
+            },
+            period);
+    }
+}
+
+LazyWriterEngine::~LazyWriterEngine()
+{
+    // Stop the reaper before the writers it uses are released
+    reaper_.reset();
+}
+
+std::shared_ptr<ddspipe::core::IWriter> LazyWriterEngine::create_writer(
+        const std::shared_ptr<ddspipe::core::IParticipant>& participant,
+        const ddspipe::core::types::DdsTopic& topic)
+{
+    auto writer = std::make_shared<LazyWriter>(participant, topic, counters_);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    writers_.push_back(writer);
+
+    return writer;
+}
+
+uint64_t LazyWriterEngine::reap_idle_writers() noexcept
+{
+    const int64_t now = LazyWriter::now();
+    const int64_t idle_ttl = static_cast<int64_t>(idle_ttl_) * 1000000;
+
+    // Collect the writers alive, so they are reaped (and maybe destroyed) without holding the lock
+    std::vector<std::shared_ptr<LazyWriter>> writers;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        writers = alive_writers_nts_();
+    }
+
+    uint64_t reaped = 0;
+    for (const auto& writer : writers)
+    {
+        // A writer created again would lose the messages sent until its readers match it
+        if (has_readers(writer->participant_id(), writer->topic().m_topic_name))
+        {
+            continue;
+        }
+
+        if (writer->reap_if_idle(now, idle_ttl))
+        {
+            ++reaped;
+        }
+    }
+
+    if (reaped > 0)
+    {
+        logInfo(DDSROUTER_LAZY_WRITER, "Destroyed " << reaped << " idle writers.");
+    }
+
+    return reaped;
+}
+
+uint64_t LazyWriterEngine::warm_up(
+        const std::set<std::string>& topics)
+{
+    std::vector<std::shared_ptr<LazyWriter>> writers;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (const auto& writer : alive_writers_nts_())
+        {
+            if (topics.find(writer->topic().m_topic_name) != topics.end() && !writer->created())
+            {
+                writers.push_back(writer);
+            }
+        }
+    }
+
+    if (writers.empty())
+    {
+        return 0;
+    }
+
+    // Each worker takes the next writer until there are none left
+    std::atomic<std::size_t> next(0);
+    std::atomic<uint64_t> failed(0);
+
+    const std::size_t workers =
+            std::min<std::size_t>(writers.size(), std::max<unsigned int>(std::thread::hardware_concurrency(), 1));
+
+    std::vector<std::thread> threads;
+    threads.reserve(workers);
+    for (std::size_t i = 0; i < workers; ++i)
+    {
+        threads.emplace_back(
+            [&]()
+            {
+                for (std::size_t index = next++; index < writers.size(); index = next++)
+                {
+                    if (!writers[index]->warm_up())
+                    {
+                        ++failed;
+                    }
+                }
+            });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    logInfo(DDSROUTER_LAZY_WRITER,
+            "Warmed up " << writers.size() - failed.load() << " writers in " << topics.size() << " topics.");
+
+    return failed.load();
+}
+
+void LazyWriterEngine::track_readers(
+        const std::shared_ptr<ddspipe::core::DiscoveryDatabase>& discovery_database)
+{
+    std::shared_ptr<DiscoveredReaders> discovered_readers = discovered_readers_;
+
+    discovery_database->add_endpoint_discovered_callback(
+        [discovered_readers](ddspipe::core::types::Endpoint endpoint)
+        {
+            discovered_readers->update(endpoint, false);
+        });
+
+    discovery_database->add_endpoint_updated_callback(
+        [discovered_readers](ddspipe::core::types::Endpoint endpoint)
+        {
+            discovered_readers->update(endpoint, false);
+        });
+
+    discovery_database->add_endpoint_erased_callback(
+        [discovered_readers](ddspipe::core::types::Endpoint endpoint)
+        {
+            discovered_readers->update(endpoint, true);
+        });
+}
+
+bool LazyWriterEngine::has_readers(
+        const ddspipe::core::types::ParticipantId& participant_id,
+        const std::string& topic_name) const
+{
+    std::lock_guard<std::mutex> lock(discovered_readers_->mutex);
+    return discovered_readers_->counts.count({participant_id, topic_name}) > 0;
+}
+
+LazyWriterStatistics LazyWriterEngine::statistics() const
+{
+    LazyWriterStatistics statistics;
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        statistics.writers = std::count_if(
+            writers_.begin(),
+            writers_.end(),
+            [](const std::weak_ptr<LazyWriter>& writer)
+            {
+                return !writer.expired();
+            });
+    }
+
+    statistics.active = counters_->active.load(std::memory_order_relaxed);
+    statistics.created = counters_->created.load(std::memory_order_relaxed);
+    statistics.reaped = counters_->reaped.load(std::memory_order_relaxed);
+
+    return statistics;
+}
+
+void LazyWriterEngine::DiscoveredReaders::update(
+        const ddspipe::core::types::Endpoint& endpoint,
+        bool erased)
+{
+    if (endpoint.kind != ddspipe::core::types::EndpointKind::reader)
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+
+    // Forget the previous state of the reader, as an update may deactivate it
+    auto it = readers.find(endpoint.guid);
+    if (it != readers.end())
+    {
+        auto count = counts.find(it->second);
+        if (--count->second == 0)
+        {
+            counts.erase(count);
+        }
+        readers.erase(it);
+    }
+
+    if (!erased && endpoint.active)
+    {
+        std::pair<ddspipe::core::types::ParticipantId, std::string> key(
+            endpoint.discoverer_participant_id, endpoint.topic.m_topic_name);
+        readers[endpoint.guid] = key;
+        ++counts[key];
+    }
+}
+
+std::vector<std::shared_ptr<LazyWriter>> LazyWriterEngine::alive_writers_nts_()
+{
+    writers_.erase(
+        std::remove_if(
+            writers_.begin(),
+            writers_.end(),
+            [](const std::weak_ptr<LazyWriter>& writer)
+            {
+                return writer.expired();
+            }),
+        writers_.end());
+
+    std::vector<std::shared_ptr<LazyWriter>> writers;
+    writers.reserve(writers_.size());
+    for (const auto& weak_writer : writers_)
+    {
+        auto writer = weak_writer.lock();
+        if (writer)
+        {
+            writers.push_back(writer);
+        }
+    }
+
+    return writers;
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
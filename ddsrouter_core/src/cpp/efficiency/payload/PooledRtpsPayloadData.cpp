@@ -0,0 +1,100 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file PooledRtpsPayloadData.cpp
+ *
+ */
+
+#include <mutex>
+#include <new>
+
+#include <ddsrouter_core/efficiency/payload/PooledRtpsPayloadData.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+namespace {
+
+//! Maximum objects kept in the free list. Enough for the messages in flight of a loaded router.
+constexpr uint64_t MAX_CACHED_DATA = 4096;
+
+//! Node of the free list, stored in the memory of a released object.
+struct FreeNode
+{
+    FreeNode* next;
+};
+
+std::mutex free_list_mutex;
+
+FreeNode* free_list = nullptr;
+
+uint64_t free_list_size = 0;
+
+} /* namespace */
+
+void* PooledRtpsPayloadData::operator new(
+        std::size_t size)
+{
+    // Classes derived from this one do not fit in the memory recycled
+    if (size == sizeof(PooledRtpsPayloadData))
+    {
+        std::lock_guard<std::mutex> lock(free_list_mutex);
+
+        if (free_list)
+        {
+            FreeNode* node = free_list;
+            free_list = node->next;
+            --free_list_size;
+            return node;
+        }
+    }
+
+    return ::operator new(size);
+}
+
+void PooledRtpsPayloadData::operator delete(
+        void* memory,
+        std::size_t size) noexcept
+{
+    if (!memory)
+    {
+        return;
+    }
+
+    if (size == sizeof(PooledRtpsPayloadData))
+    {
+        std::lock_guard<std::mutex> lock(free_list_mutex);
+
+        if (free_list_size < MAX_CACHED_DATA)
+        {
+            free_list = new (memory) FreeNode{free_list};
+            ++free_list_size;
+            return;
+        }
+    }
+
+    ::operator delete(memory);
+}
+
+uint64_t PooledRtpsPayloadData::cached() noexcept
+{
+    std::lock_guard<std::mutex> lock(free_list_mutex);
+    return free_list_size;
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,320 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file PreallocatedPayloadPool.cpp
+ *
+ */
+
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+#include <cpp_utils/Log.hpp>
+
+#include <ddsrouter_core/efficiency/payload/PreallocatedPayloadPool.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+namespace {
+
+//! Reset a payload released, so it does not free its data when destroyed.
+void reset_payload(
+        ddspipe::core::types::Payload& payload) noexcept
+{
+    payload.data = nullptr;
+    payload.length = 0;
+    payload.max_size = 0;
+    payload.pos = 0;
+}
+
+//! Top of a free list with \c tag and \c index .
+uint64_t free_list_top(
+        uint32_t tag,
+        uint32_t index) noexcept
+{
+    return (static_cast<uint64_t>(tag) << 32) | index;
+}
+
+uint32_t free_list_tag(
+        uint64_t top) noexcept
+{
+    return static_cast<uint32_t>(top >> 32);
+}
+
+uint32_t free_list_index(
+        uint64_t top) noexcept
+{
+    return static_cast<uint32_t>(top);
+}
+
+} /* namespace */
+
+PreallocatedPayloadPool::PreallocatedPayloadPool(
+        uint32_t slot_size)
+    : slot_size_(slot_size)
+    , slot_stride_(sizeof(PayloadHeader) +
+            (static_cast<std::size_t>(slot_size) + alignof(PayloadHeader) - 1) / alignof(PayloadHeader) *
+            alignof(PayloadHeader))
+    , free_list_(free_list_top(0, NO_SLOT))
+    , free_slots_(0)
+    , slots_(0)
+    , pooled_(0)
+    , heap_(0)
+{
+    for (auto& segment : slot_table_)
+    {
+        segment.store(nullptr, std::memory_order_relaxed);
+    }
+}
+
+void PreallocatedPayloadPool::reserve(
+        uint64_t slots)
+{
+    if (slots == 0)
+    {
+        return;
+    }
+
+    std::unique_ptr<uint8_t[]> chunk(new uint8_t[slots * slot_stride_]);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    if (slots_ + slots > NO_SLOT)
+    {
+        logWarning(DDSROUTER_PAYLOAD_POOL,
+                "Can not reserve " << slots << " more payload slots, " << slots_ << " are already reserved.");
+        return;
+    }
+
+    for (uint64_t i = 0; i < slots; ++i)
+    {
+        PayloadHeader* header = new (chunk.get() + i * slot_stride_) PayloadHeader();
+        header->index = static_cast<uint32_t>(slots_ + i);
+        header->pooled = true;
+
+        uint32_t first_index;
+        const std::size_t segment = segment_(header->index, first_index);
+        if (!slot_table_[segment].load(std::memory_order_relaxed))
+        {
+            segments_.emplace_back(new PayloadHeader*[static_cast<std::size_t>(FIRST_SEGMENT_SLOTS) << segment]);
+            slot_table_[segment].store(segments_.back().get(), std::memory_order_release);
+        }
+        slot_table_[segment].load(std::memory_order_relaxed)[header->index - first_index] = header;
+
+        // The slot is published by the release of the free list
+        return_slot_(header);
+    }
+
+    chunks_.push_back(std::move(chunk));
+    slots_ += slots;
+
+    logDebug(DDSROUTER_PAYLOAD_POOL,
+            "Reserved " << slots << " payload slots of " << slot_size_ << " bytes, " << slots_ << " in total.");
+}
+
+bool PreallocatedPayloadPool::get_payload(
+        uint32_t size,
+        ddspipe::core::types::Payload& payload)
+{
+    PayloadHeader* header = size <= slot_size_ ? take_slot_() : nullptr;
+
+    if (header)
+    {
+        payload.max_size = slot_size_;
+        pooled_.fetch_add(1, std::memory_order_relaxed);
+    }
+    else
+    {
+        void* memory = std::malloc(sizeof(PayloadHeader) + size);
+        if (!memory)
+        {
+            logWarning(DDSROUTER_PAYLOAD_POOL, "Failed to allocate payload of " << size << " bytes.");
+            return false;
+        }
+
+        header = new (memory) PayloadHeader();
+        header->pooled = false;
+        payload.max_size = size;
+        heap_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    header->references.store(1, std::memory_order_relaxed);
+
+    payload.data = reinterpret_cast<uint8_t*>(header + 1);
+    payload.length = 0;
+    payload.pos = 0;
+
+    return true;
+}
+
+bool PreallocatedPayloadPool::get_payload(
+        const ddspipe::core::types::Payload& src_payload,
+        fastrtps::rtps::IPayloadPool*& data_owner,
+        ddspipe::core::types::Payload& target_payload)
+{
+    // A payload of this pool is shared
+    if (data_owner == this)
+    {
+        header_(src_payload.data)->references.fetch_add(1, std::memory_order_relaxed);
+
+        target_payload.data = src_payload.data;
+        target_payload.length = src_payload.length;
+        target_payload.max_size = src_payload.max_size;
+        target_payload.pos = src_payload.pos;
+        return true;
+    }
+
+    // A payload of another pool is copied
+    if (!get_payload(src_payload.length, target_payload))
+    {
+        return false;
+    }
+
+    if (src_payload.length > 0)
+    {
+        std::memcpy(target_payload.data, src_payload.data, src_payload.length);
+    }
+    target_payload.length = src_payload.length;
+    target_payload.pos = src_payload.pos;
+
+    return true;
+}
+
+bool PreallocatedPayloadPool::release_payload(
+        ddspipe::core::types::Payload& payload)
+{
+    if (!payload.data)
+    {
+        return false;
+    }
+
+    PayloadHeader* header = header_(payload.data);
+    reset_payload(payload);
+
+    // Other readers or writers still hold the payload
+    if (header->references.fetch_sub(1, std::memory_order_acq_rel) != 1)
+    {
+        return true;
+    }
+
+    if (header->pooled)
+    {
+        return_slot_(header);
+    }
+    else
+    {
+        header->~PayloadHeader();
+        std::free(header);
+    }
+
+    return true;
+}
+
+uint32_t PreallocatedPayloadPool::slot_size() const noexcept
+{
+    return slot_size_;
+}
+
+PayloadPoolStatistics PreallocatedPayloadPool::statistics() const noexcept
+{
+    PayloadPoolStatistics statistics;
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        statistics.slots = slots_;
+    }
+
+    statistics.free_slots = free_slots_.load(std::memory_order_relaxed);
+
+    statistics.pooled = pooled_.load(std::memory_order_relaxed);
+    statistics.heap = heap_.load(std::memory_order_relaxed);
+
+    return statistics;
+}
+
+PreallocatedPayloadPool::PayloadHeader* PreallocatedPayloadPool::header_(
+        uint8_t* data) noexcept
+{
+    return reinterpret_cast<PayloadHeader*>(data) - 1;
+}
+
+std::size_t PreallocatedPayloadPool::segment_(
+        uint32_t index,
+        uint32_t& first_index) noexcept
+{
+    // Segment k holds FIRST_SEGMENT_SLOTS << k slots from index FIRST_SEGMENT_SLOTS * (2^k - 1)
+    const uint64_t position = index / FIRST_SEGMENT_SLOTS + 1;
+
+    std::size_t segment = 0;
+    while ((position >> (segment + 1)) != 0)
+    {
+        ++segment;
+    }
+
+    first_index = static_cast<uint32_t>(FIRST_SEGMENT_SLOTS * ((uint64_t(1) << segment) - 1));
+    return segment;
+}
+
+PreallocatedPayloadPool::PayloadHeader* PreallocatedPayloadPool::slot_(
+        uint32_t index) const noexcept
+{
+    uint32_t first_index;
+    const std::size_t segment = segment_(index, first_index);
+    return slot_table_[segment].load(std::memory_order_acquire)[index - first_index];
+}
+
+PreallocatedPayloadPool::PayloadHeader* PreallocatedPayloadPool::take_slot_() noexcept
+{
+    uint64_t top = free_list_.load(std::memory_order_acquire);
+
+    while (free_list_index(top) != NO_SLOT)
+    {
+        // Slots are never freed, so the header can be read even if another thread takes it meanwhile, in which case
+        // the tag of the top has changed and the exchange fails
+        PayloadHeader* header = slot_(free_list_index(top));
+        const uint32_t next = header->next.load(std::memory_order_relaxed);
+
+        if (free_list_.compare_exchange_weak(top, free_list_top(free_list_tag(top) + 1, next),
+                std::memory_order_acquire, std::memory_order_acquire))
+        {
+            free_slots_.fetch_sub(1, std::memory_order_relaxed);
+            return header;
+        }
+    }
+
+    return nullptr;
+}
+
+void PreallocatedPayloadPool::return_slot_(
+        PayloadHeader* header) noexcept
+{
+    // Counted before it can be taken, so the counter never goes below zero
+    free_slots_.fetch_add(1, std::memory_order_relaxed);
+
+    uint64_t top = free_list_.load(std::memory_order_relaxed);
+
+    do
+    {
+        header->next.store(free_list_index(top), std::memory_order_relaxed);
+    }
+    while (!free_list_.compare_exchange_weak(top, free_list_top(free_list_tag(top) + 1, header->index),
+            std::memory_order_release, std::memory_order_relaxed));
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
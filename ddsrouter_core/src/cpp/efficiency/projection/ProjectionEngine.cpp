@@ -0,0 +1,93 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ProjectionEngine.cpp
+ *
+ */
+
+#include <ddsrouter_core/efficiency/projection/ProjectionEngine.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+ProjectionEngine::ProjectionEngine(
+        const std::vector<ProjectionConfiguration>& configurations)
+    : configurations_(configurations)
+{
+    rewriters_.reserve(configurations_.size());
+
+    for (const auto& rule : configurations_)
+    {
+        rewriters_.push_back(std::make_shared<const CdrProjection>(rule.fields, rule.strip));
+    }
+}
+
+bool ProjectionEngine::empty() const noexcept
+{
+    return configurations_.empty();
+}
+
+std::shared_ptr<TopicProjection> ProjectionEngine::projection(
+        const ddspipe::core::types::DdsTopic& topic,
+        const ddspipe::core::types::ParticipantId& participant_id)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    for (std::size_t i = 0; i < configurations_.size(); ++i)
+    {
+        const auto& rule = configurations_[i];
+
+        if (!rule.topic.matches(topic))
+        {
+            continue;
+        }
+
+        if (!rule.participant_id.empty() && rule.participant_id != participant_id)
+        {
+            continue;
+        }
+
+        auto& projection = projections_[{i, topic.topic_name()}];
+        if (!projection)
+        {
+            projection = std::make_shared<TopicProjection>(
+                rewriters_[i], topic.topic_name(), rule.derived_type_name(topic.type_name));
+        }
+
+        return projection;
+    }
+
+    return nullptr;
+}
+
+std::vector<ProjectionStatistics> ProjectionEngine::statistics() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    std::vector<ProjectionStatistics> statistics;
+    statistics.reserve(projections_.size());
+
+    for (const auto& projection : projections_)
+    {
+        statistics.push_back(projection.second->statistics());
+    }
+
+    return statistics;
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,87 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file TopicProjection.cpp
+ *
+ */
+
+#include <ddsrouter_core/efficiency/projection/TopicProjection.hpp>
+#include <ddsrouter_core/logging/BinaryLog.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+TopicProjection::TopicProjection(
+        const std::shared_ptr<const CdrProjection>& projection,
+        const std::string& topic,
+        const std::string& type_name)
+    : projection_(projection)
+    , topic_(topic)
+    , type_name_(type_name)
+{
+}
+
+const std::string& TopicProjection::type_name() const noexcept
+{
+    return type_name_;
+}
+
+bool TopicProjection::project(
+        const ddspipe::core::types::Payload& source,
+        ddspipe::core::PayloadPool& pool,
+        ddspipe::core::types::Payload& target) noexcept
+{
+    if (!pool.get_payload(source.length + CdrProjection::MAX_PADDING, target))
+    {
+        logBinaryWarning(DDSROUTER_PROJECTION, "Failed to allocate payload to project sample in topic {}.", topic_);
+        dropped_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    const uint32_t length = projection_->project(source.data, source.length, target.data);
+    if (length == 0)
+    {
+        logBinaryWarning(DDSROUTER_PROJECTION,
+                "Sample of {} bytes in topic {} does not follow the layout of the projection, dropping it.",
+                source.length, topic_);
+        pool.release_payload(target);
+        dropped_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    target.length = length;
+
+    projected_.fetch_add(1, std::memory_order_relaxed);
+    original_bytes_.fetch_add(source.length, std::memory_order_relaxed);
+    projected_bytes_.fetch_add(length, std::memory_order_relaxed);
+    return true;
+}
+
+ProjectionStatistics TopicProjection::statistics() const
+{
+    ProjectionStatistics statistics;
+    statistics.topic = topic_;
+    statistics.type_name = type_name_;
+    statistics.projected = projected_.load(std::memory_order_relaxed);
+    statistics.dropped = dropped_.load(std::memory_order_relaxed);
+    statistics.original_bytes = original_bytes_.load(std::memory_order_relaxed);
+    statistics.projected_bytes = projected_bytes_.load(std::memory_order_relaxed);
+    return statistics;
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,239 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file InstanceSampleTable.cpp
+ *
+ */
+
+#include <ddsrouter_core/efficiency/rate_limit/InstanceSampleTable.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+InstanceSampleTable::InstanceSampleTable(
+        std::size_t initial_capacity /* = 16 */)
+    : used_(0)
+    , pending_(0)
+{
+    // Capacity must be a power of two so the hash can be masked
+    std::size_t capacity = 1;
+    while (capacity < initial_capacity)
+    {
+        capacity <<= 1;
+    }
+
+    slots_.resize(capacity);
+    mask_ = capacity - 1;
+}
+
+std::unique_ptr<ddspipe::core::IRoutingData> InstanceSampleTable::store(
+        const Key& key,
+        std::unique_ptr<ddspipe::core::IRoutingData>&& sample)
+{
+    Slot& slot = slots_[find_or_insert_(key)];
+
+    std::unique_ptr<ddspipe::core::IRoutingData> replaced = std::move(slot.sample);
+    slot.sample = std::move(sample);
+
+    if (!replaced)
+    {
+        // New pending instance, it goes to the back of the round-robin
+        queue_.push_back(key);
+        ++pending_;
+    }
+
+    return replaced;
+}
+
+std::unique_ptr<ddspipe::core::IRoutingData> InstanceSampleTable::erase(
+        const Key& key)
+{
+    std::size_t i = find_(key);
+    if (i == slots_.size())
+    {
+        return nullptr;
+    }
+
+    std::unique_ptr<ddspipe::core::IRoutingData> sample = std::move(slots_[i].sample);
+    if (sample)
+    {
+        // Its queue entry is left behind, and skipped when it reaches the front
+        --pending_;
+    }
+
+    slots_[i] = Slot();
+    --used_;
+
+    // Backward shift the following slots of the cluster, so no tombstone is needed
+    std::size_t j = i;
+    while (true)
+    {
+        j = (j + 1) & mask_;
+        if (!slots_[j].used)
+        {
+            break;
+        }
+
+        // Move the slot only if its home is not cyclically in (i, j]
+        const std::size_t home = hash_(slots_[j].key) & mask_;
+        const bool home_in_range = (i <= j) ? (i < home && home <= j) : (i < home || home <= j);
+        if (!home_in_range)
+        {
+            slots_[i] = std::move(slots_[j]);
+            slots_[j] = Slot();
+            i = j;
+        }
+    }
+
+    return sample;
+}
+
+ddspipe::core::IRoutingData* InstanceSampleTable::front()
+{
+    discard_stale_front_();
+
+    if (queue_.empty())
+    {
+        return nullptr;
+    }
+
+    return slots_[find_(queue_.front())].sample.get();
+}
+
+std::unique_ptr<ddspipe::core::IRoutingData> InstanceSampleTable::pop()
+{
+    discard_stale_front_();
+
+    if (queue_.empty())
+    {
+        return nullptr;
+    }
+
+    std::unique_ptr<ddspipe::core::IRoutingData> sample = std::move(slots_[find_(queue_.front())].sample);
+    queue_.pop_front();
+    --pending_;
+
+    return sample;
+}
+
+std::size_t InstanceSampleTable::pending() const noexcept
+{
+    return pending_;
+}
+
+std::size_t InstanceSampleTable::instances() const noexcept
+{
+    return used_;
+}
+
+std::size_t InstanceSampleTable::hash_(
+        const Key& key) noexcept
+{
+    // FNV-1a over the 16 bytes of the handle
+    uint64_t hash = 14695981039346656037ULL;
+    for (std::size_t i = 0; i < 16; ++i)
+    {
+        hash ^= static_cast<uint8_t>(key.value[i]);
+        hash *= 1099511628211ULL;
+    }
+
+    return static_cast<std::size_t>(hash);
+}
+
+std::size_t InstanceSampleTable::find_(
+        const Key& key) const noexcept
+{
+    std::size_t i = hash_(key) & mask_;
+
+    while (slots_[i].used)
+    {
+        if (slots_[i].key == key)
+        {
+            return i;
+        }
+
+        i = (i + 1) & mask_;
+    }
+
+    return slots_.size();
+}
+
+std::size_t InstanceSampleTable::find_or_insert_(
+        const Key& key)
+{
+    std::size_t i = find_(key);
+    if (i != slots_.size())
+    {
+        return i;
+    }
+
+    // Keep the load factor under 1/2 so the clusters stay short
+    if (2 * (used_ + 1) > slots_.size())
+    {
+        grow_();
+    }
+
+    i = hash_(key) & mask_;
+    while (slots_[i].used)
+    {
+        i = (i + 1) & mask_;
+    }
+
+    slots_[i].key = key;
+    slots_[i].used = true;
+    ++used_;
+
+    return i;
+}
+
+void InstanceSampleTable::grow_()
+{
+    std::vector<Slot> old_slots(slots_.size() * 2);
+    old_slots.swap(slots_);
+    mask_ = slots_.size() - 1;
+
+    for (auto& slot : old_slots)
+    {
+        if (slot.used)
+        {
+            std::size_t i = hash_(slot.key) & mask_;
+            while (slots_[i].used)
+            {
+                i = (i + 1) & mask_;
+            }
+
+            slots_[i] = std::move(slot);
+        }
+    }
+}
+
+void InstanceSampleTable::discard_stale_front_()
+{
+    while (!queue_.empty())
+    {
+        const std::size_t i = find_(queue_.front());
+        if (i != slots_.size() && slots_[i].sample)
+        {
+            return;
+        }
+
+        queue_.pop_front();
+    }
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,269 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file RateLimitEngine.cpp
+ *
+ */
+
+#include <algorithm>
+
+#include <cpp_utils/Log.hpp>
+
+#include <ddsrouter_core/efficiency/rate_limit/RateLimitEngine.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+namespace {
+
+thread_local uint32_t current_source_index = RateLimitEngine::NO_SOURCE;
+
+//! Bounds of the pacer period in milliseconds.
+constexpr utils::Duration_ms MIN_PACING_PERIOD = 1;
+constexpr utils::Duration_ms MAX_PACING_PERIOD = 100;
+
+} /* namespace */
+
+RateLimitEngine::RateLimitEngine(
+        const std::vector<RateLimitConfiguration>& configurations)
+    : configurations_(configurations)
+    , pacing_period_(MAX_PACING_PERIOD)
+{
+    // Wake up as often as the fastest per instance rule gets a new token
+    for (const auto& rule : configurations_)
+    {
+        if (rule.per_instance && rule.max_msgs_per_second > 0)
+        {
+            const double period = 1000.0 / rule.max_msgs_per_second;
+            pacing_period_ = std::min(
+                pacing_period_,
+                std::max(MIN_PACING_PERIOD, static_cast<utils::Duration_ms>(period)));
+        }
+    }
+}
+
+bool RateLimitEngine::empty() const noexcept
+{
+    return configurations_.empty();
+}
+
+uint32_t RateLimitEngine::participant_index(
+        const ddspipe::core::types::ParticipantId& participant_id)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    auto it = participant_indexes_.find(participant_id);
+    if (it != participant_indexes_.end())
+    {
+        return it->second;
+    }
+
+    const uint32_t index = static_cast<uint32_t>(participant_indexes_.size());
+    participant_indexes_[participant_id] = index;
+    return index;
+}
+
+bool RateLimitEngine::has_route_rules() const noexcept
+{
+    for (const auto& rule : configurations_)
+    {
+        if (rule.scope == types::RateLimitScope::route)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+std::vector<std::shared_ptr<RateLimiter>> RateLimitEngine::reception_limiters(
+        const ddspipe::core::types::DdsTopic& topic)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    std::vector<std::shared_ptr<RateLimiter>> limiters;
+
+    for (std::size_t i = 0; i < configurations_.size(); ++i)
+    {
+        const auto& rule = configurations_[i];
+
+        if (rule.scope == types::RateLimitScope::topic && rule.topic.matches(topic) &&
+                !is_per_instance_(rule, topic))
+        {
+            limiters.push_back(get_limiter_nts_(i, topic.topic_name()));
+        }
+    }
+
+    return limiters;
+}
+
+std::vector<std::shared_ptr<RateLimiter>> RateLimitEngine::instance_limiters(
+        const ddspipe::core::types::DdsTopic& topic)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    std::vector<std::shared_ptr<RateLimiter>> limiters;
+
+    for (std::size_t i = 0; i < configurations_.size(); ++i)
+    {
+        const auto& rule = configurations_[i];
+
+        if (rule.scope == types::RateLimitScope::topic && rule.topic.matches(topic) &&
+                is_per_instance_(rule, topic))
+        {
+            limiters.push_back(get_limiter_nts_(i, topic.topic_name()));
+        }
+    }
+
+    return limiters;
+}
+
+void RateLimitEngine::register_pacing_callback(
+        std::function<bool()> callback)
+{
+    std::lock_guard<std::mutex> lock(pacing_mutex_);
+
+    pacing_callbacks_.push_back(callback);
+
+    if (!pacer_)
+    {
+        logDebug(DDSROUTER_RATE_LIMIT, "Starting rate limit pacer with period " << pacing_period_ << " ms.");
+
+        pacer_ = std::make_unique<utils::event::PeriodicEventHandler>(
+            [this]()
+            {
+                pace_();
+            },
+            pacing_period_);
+    }
+}
+
+TransmissionLimiters RateLimitEngine::transmission_limiters(
+        const ddspipe::core::types::DdsTopic& topic,
+        const ddspipe::core::types::ParticipantId& destination)
+{
+    // Get the source indexes before locking, as participant_index locks too
+    std::vector<std::pair<std::size_t, uint32_t>> route_rules;
+    for (std::size_t i = 0; i < configurations_.size(); ++i)
+    {
+        const auto& rule = configurations_[i];
+
+        if (rule.scope == types::RateLimitScope::route &&
+                rule.destination_participant_id == destination &&
+                rule.topic.matches(topic))
+        {
+            route_rules.push_back({i, participant_index(rule.source_participant_id)});
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    TransmissionLimiters limiters;
+
+    for (std::size_t i = 0; i < configurations_.size(); ++i)
+    {
+        const auto& rule = configurations_[i];
+
+        if (rule.scope == types::RateLimitScope::participant &&
+                rule.participant_id == destination &&
+                rule.topic.matches(topic))
+        {
+            limiters.participant.push_back(get_limiter_nts_(i, destination));
+        }
+    }
+
+    for (const auto& route_rule : route_rules)
+    {
+        const auto& rule = configurations_[route_rule.first];
+
+        limiters.route.push_back(
+            {
+                route_rule.second,
+                get_limiter_nts_(route_rule.first, rule.source_participant_id + "->" + destination)
+            });
+    }
+
+    return limiters;
+}
+
+std::vector<RateLimitStatistics> RateLimitEngine::statistics() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    std::vector<RateLimitStatistics> statistics;
+    statistics.reserve(limiters_.size());
+
+    for (const auto& limiter : limiters_)
+    {
+        statistics.push_back(limiter.second->statistics());
+    }
+
+    return statistics;
+}
+
+void RateLimitEngine::set_current_source(
+        uint32_t participant_index) noexcept
+{
+    current_source_index = participant_index;
+}
+
+uint32_t RateLimitEngine::current_source() noexcept
+{
+    return current_source_index;
+}
+
+void RateLimitEngine::pace_() noexcept
+{
+    std::lock_guard<std::mutex> lock(pacing_mutex_);
+
+    pacing_callbacks_.erase(
+        std::remove_if(
+            pacing_callbacks_.begin(),
+            pacing_callbacks_.end(),
+            [](const std::function<bool()>& callback)
+            {
+                return !callback();
+            }),
+        pacing_callbacks_.end());
+}
+
+bool RateLimitEngine::is_per_instance_(
+        const RateLimitConfiguration& rule,
+        const ddspipe::core::types::DdsTopic& topic) noexcept
+{
+    return rule.per_instance && topic.topic_qos.keyed;
+}
+
+std::shared_ptr<RateLimiter> RateLimitEngine::get_limiter_nts_(
+        std::size_t rule_index,
+        const std::string& key)
+{
+    auto& limiter = limiters_[{rule_index, key}];
+
+    if (!limiter)
+    {
+        logDebug(DDSROUTER_RATE_LIMIT,
+                "Creating " << configurations_[rule_index].scope << " rate limiter for " << key << ".");
+
+        limiter = std::make_shared<RateLimiter>(configurations_[rule_index], key);
+    }
+
+    return limiter;
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,101 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file RateLimiter.cpp
+ *
+ */
+
+#include <ddsrouter_core/efficiency/rate_limit/RateLimiter.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+RateLimiter::RateLimiter(
+        const RateLimitConfiguration& configuration,
+        const std::string& key)
+    : scope_(configuration.scope)
+    , key_(key)
+    , msgs_bucket_(configuration.max_msgs_per_second, configuration.burst_msgs)
+    , bytes_bucket_(configuration.max_bytes_per_second, configuration.burst_bytes)
+{
+}
+
+bool RateLimiter::accept(
+        uint64_t size,
+        int64_t now) noexcept
+{
+    if (!try_accept(size, now))
+    {
+        drop(size);
+        return false;
+    }
+
+    return true;
+}
+
+bool RateLimiter::try_accept(
+        uint64_t size,
+        int64_t now) noexcept
+{
+    if (!msgs_bucket_.try_consume(1, now))
+    {
+        return false;
+    }
+
+    if (!bytes_bucket_.try_consume(size, now))
+    {
+        // Give back the message token, as the message is not going to be sent
+        msgs_bucket_.refund(1);
+        return false;
+    }
+
+    accepted_msgs_.fetch_add(1, std::memory_order_relaxed);
+    accepted_bytes_.fetch_add(size, std::memory_order_relaxed);
+    return true;
+}
+
+void RateLimiter::drop(
+        uint64_t size) noexcept
+{
+    dropped_msgs_.fetch_add(1, std::memory_order_relaxed);
+    dropped_bytes_.fetch_add(size, std::memory_order_relaxed);
+}
+
+void RateLimiter::refund(
+        uint64_t size) noexcept
+{
+    msgs_bucket_.refund(1);
+    bytes_bucket_.refund(size);
+
+    // The message has been dropped after all
+    accepted_msgs_.fetch_sub(1, std::memory_order_relaxed);
+    accepted_bytes_.fetch_sub(size, std::memory_order_relaxed);
+}
+
+RateLimitStatistics RateLimiter::statistics() const noexcept
+{
+    return {
+        scope_,
+        key_,
+        accepted_msgs_.load(std::memory_order_relaxed),
+        accepted_bytes_.load(std::memory_order_relaxed),
+        dropped_msgs_.load(std::memory_order_relaxed),
+        dropped_bytes_.load(std::memory_order_relaxed)};
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
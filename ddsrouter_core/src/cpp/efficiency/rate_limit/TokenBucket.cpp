@@ -0,0 +1,100 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file TokenBucket.cpp
+ *
+ */
+
+#include <algorithm>
+#include <chrono>
+
+#include <ddsrouter_core/efficiency/rate_limit/TokenBucket.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+TokenBucket::TokenBucket(
+        double rate,
+        double burst /* = 0 */)
+    : nanoseconds_per_token_(rate > 0 ? 1e9 / rate : 0)
+    , tolerance_(0)
+    , theoretical_arrival_time_(0)
+{
+    if (rate > 0)
+    {
+        // By default allow a burst of one second worth of tokens
+        const double burst_tokens = burst > 0 ? burst : rate;
+        tolerance_ = static_cast<int64_t>(burst_tokens * nanoseconds_per_token_);
+    }
+}
+
+bool TokenBucket::try_consume(
+        uint64_t tokens,
+        int64_t now) noexcept
+{
+    if (unlimited())
+    {
+        return true;
+    }
+
+    const int64_t increment = static_cast<int64_t>(tokens * nanoseconds_per_token_);
+
+    int64_t tat = theoretical_arrival_time_.load(std::memory_order_relaxed);
+    int64_t new_tat;
+
+    do
+    {
+        new_tat = std::max(tat, now) + increment;
+
+        // NOTE: a request bigger than the burst is accepted if the bucket is full, so it never starves
+        if (new_tat - now > tolerance_ && tat > now)
+        {
+            // Not enough tokens
+            return false;
+        }
+    }
+    while (!theoretical_arrival_time_.compare_exchange_weak(tat, new_tat, std::memory_order_relaxed));
+
+    return true;
+}
+
+void TokenBucket::refund(
+        uint64_t tokens) noexcept
+{
+    if (unlimited())
+    {
+        return;
+    }
+
+    theoretical_arrival_time_.fetch_sub(
+        static_cast<int64_t>(tokens * nanoseconds_per_token_),
+        std::memory_order_relaxed);
+}
+
+bool TokenBucket::unlimited() const noexcept
+{
+    return nanoseconds_per_token_ == 0;
+}
+
+int64_t TokenBucket::now() noexcept
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
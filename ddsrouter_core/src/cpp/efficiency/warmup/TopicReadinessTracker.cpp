@@ -0,0 +1,93 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file TopicReadinessTracker.cpp
+ *
+ */
+
+#include <algorithm>
+
+#include <ddsrouter_core/efficiency/warmup/TopicReadinessTracker.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+TopicReadinessTracker::TopicReadinessTracker()
+    : origin_(std::chrono::steady_clock::now())
+{
+}
+
+void TopicReadinessTracker::endpoint_created(
+        const std::string& topic,
+        bool is_writer,
+        std::chrono::steady_clock::duration duration,
+        bool success) noexcept
+{
+    const double ready_ms =
+            std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - origin_).count();
+
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    TopicReadiness& readiness = topics_[topic];
+    readiness.creation_ms += std::chrono::duration<double, std::milli>(duration).count();
+
+    if (!success)
+    {
+        ++readiness.failed;
+        return;
+    }
+
+    if (is_writer)
+    {
+        ++readiness.writers;
+    }
+    else
+    {
+        ++readiness.readers;
+    }
+
+    readiness.ready_ms = std::max(readiness.ready_ms, ready_ms);
+}
+
+std::vector<TopicReadiness> TopicReadinessTracker::readiness(
+        const std::set<std::string>& topics) const
+{
+    std::vector<TopicReadiness> result;
+    result.reserve(topics.size());
+
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    for (const auto& topic : topics)
+    {
+        TopicReadiness readiness;
+
+        auto it = topics_.find(topic);
+        if (it != topics_.end())
+        {
+            readiness = it->second;
+        }
+
+        readiness.topic = topic;
+        readiness.ready = readiness.failed == 0 && readiness.readers + readiness.writers > 0;
+        result.push_back(readiness);
+    }
+
+    return result;
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,686 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file BinaryLog.cpp
+ *
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <ctime>
+#include <new>
+
+#include <cpp_utils/exception/InitializationException.hpp>
+#include <cpp_utils/Log.hpp>
+
+#include <ddsrouter_core/logging/BinaryLog.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+namespace {
+
+//! Binary log of the process. nullptr if there is none.
+std::atomic<BinaryLog*> active_binary_log{nullptr};
+
+//! Binary logs created in the process, to tell them apart in the buffers cached by each thread.
+std::atomic<uint64_t> binary_log_counter{0};
+
+//! Buffer of each thread in the last binary log it logged entries in.
+struct CachedBuffer
+{
+    uint64_t binary_log = 0;
+
+    void* buffer = nullptr;
+};
+
+thread_local CachedBuffer cached_buffer;
+
+//! Sites registered in the process, by id minus 1. Sites are static, so they are never removed.
+std::mutex& sites_mutex()
+{
+    static std::mutex mutex;
+    return mutex;
+}
+
+std::vector<const LogSite*>& sites()
+{
+    static std::vector<const LogSite*> registered;
+    return registered;
+}
+
+//! Site registered with \c site_id . nullptr if there is none.
+const LogSite* find_site(
+        uint32_t site_id)
+{
+    std::lock_guard<std::mutex> lock(sites_mutex());
+    return site_id > 0 && site_id <= sites().size() ? sites()[site_id - 1] : nullptr;
+}
+
+//! Current time in nanoseconds since epoch.
+int64_t now()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+//! Local time, to name the file of the log.
+std::string timestamp()
+{
+    const std::time_t now = std::time(nullptr);
+    std::tm local{};
+    localtime_r(&now, &local);
+
+    char buffer[32];
+    std::strftime(buffer, sizeof(buffer), "%Y%m%d_%H%M%S", &local);
+    return buffer;
+}
+
+//! Local time of an entry, with microseconds so the lines decoded sort by time.
+std::string entry_time(
+        int64_t nanoseconds)
+{
+    const std::time_t seconds = static_cast<std::time_t>(nanoseconds / 1000000000);
+    std::tm local{};
+    localtime_r(&seconds, &local);
+
+    char date[32];
+    std::strftime(date, sizeof(date), "%Y-%m-%d %H:%M:%S", &local);
+
+    char buffer[48];
+    std::snprintf(buffer, sizeof(buffer), "%s.%06lld", date,
+            static_cast<long long>((nanoseconds % 1000000000) / 1000));
+    return buffer;
+}
+
+const char* kind_name(
+        uint8_t kind)
+{
+    switch (static_cast<BinaryLogKind>(kind))
+    {
+        case BinaryLogKind::error:
+            return "Error";
+
+        case BinaryLogKind::warning:
+            return "Warning";
+
+        case BinaryLogKind::info:
+            return "Info";
+
+        default:
+            return "Unknown";
+    }
+}
+
+//! Name of the file, without its directories.
+std::string file_name(
+        const std::string& path)
+{
+    const std::size_t separator = path.find_last_of("/\\");
+    return separator == std::string::npos ? path : path.substr(separator + 1);
+}
+
+//! Arguments of an entry as strings. Stops at the first argument malformed.
+std::vector<std::string> decode_arguments(
+        const uint8_t* data,
+        uint64_t size)
+{
+    std::vector<std::string> arguments;
+    uint64_t position = 0;
+
+    while (position < size)
+    {
+        const uint8_t type = data[position++];
+        const uint64_t left = size - position;
+
+        if (type == BINARY_LOG_STRING)
+        {
+            uint16_t length;
+            if (left < sizeof(length))
+            {
+                break;
+            }
+            std::memcpy(&length, data + position, sizeof(length));
+            position += sizeof(length);
+
+            if (size - position < length)
+            {
+                break;
+            }
+            arguments.emplace_back(reinterpret_cast<const char*>(data + position), length);
+            position += length;
+        }
+        else if (type == BINARY_LOG_BOOLEAN)
+        {
+            if (left < 1)
+            {
+                break;
+            }
+            arguments.emplace_back(data[position] ? "true" : "false");
+            position += 1;
+        }
+        else if (type == BINARY_LOG_SIGNED || type == BINARY_LOG_UNSIGNED || type == BINARY_LOG_FLOATING)
+        {
+            if (left < 8)
+            {
+                break;
+            }
+
+            std::ostringstream stream;
+            if (type == BINARY_LOG_SIGNED)
+            {
+                int64_t number;
+                std::memcpy(&number, data + position, sizeof(number));
+                stream << number;
+            }
+            else if (type == BINARY_LOG_UNSIGNED)
+            {
+                uint64_t number;
+                std::memcpy(&number, data + position, sizeof(number));
+                stream << number;
+            }
+            else
+            {
+                double number;
+                std::memcpy(&number, data + position, sizeof(number));
+                stream << number;
+            }
+            arguments.push_back(stream.str());
+            position += 8;
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    return arguments;
+}
+
+} /* namespace */
+
+BinaryLog::BinaryLog(
+        const BinaryLogConfiguration& configuration)
+    : configuration_(configuration)
+    , capacity_(configuration.buffer_size & ~(BINARY_LOG_ALIGNMENT - 1))
+    , id_(++binary_log_counter)
+{
+    path_ = configuration_.output_directory + "/ddsrouter_log_" + timestamp() + "_" + std::to_string(id_) +
+            BINARY_LOG_EXTENSION;
+
+    file_.open(path_, std::ios::binary | std::ios::trunc);
+
+    BinaryLogFileHeader header{};
+    std::memcpy(header.magic, BINARY_LOG_MAGIC, sizeof(header.magic));
+    header.version = BINARY_LOG_FORMAT_VERSION;
+    header.creation_time = now();
+    file_.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file_.flush();
+
+    if (!file_)
+    {
+        throw utils::InitializationException(utils::Formatter()
+                      << "Failed to create binary log " << path_ << ".");
+    }
+
+    BinaryLog* expected = nullptr;
+    if (!active_binary_log.compare_exchange_strong(expected, this))
+    {
+        file_.close();
+        std::remove(path_.c_str());
+        throw utils::InitializationException(utils::Formatter()
+                      << "There is already a binary log in the process, written in " << expected->path() << ".");
+    }
+
+    thread_ = std::thread(&BinaryLog::routine_, this);
+
+    logInfo(DDSROUTER_BINARY_LOG, "Binary log written in " << path_ << ".");
+}
+
+BinaryLog::~BinaryLog()
+{
+    BinaryLog* expected = this;
+    active_binary_log.compare_exchange_strong(expected, nullptr);
+
+    {
+        std::lock_guard<std::mutex> lock(stop_mutex_);
+        stop_ = true;
+    }
+    stop_cv_.notify_all();
+    thread_.join();
+
+    std::lock_guard<std::mutex> lock(file_mutex_);
+
+    try
+    {
+        write_nts_();
+    }
+    catch (const std::exception& e)
+    {
+        logWarning(DDSROUTER_BINARY_LOG, "Failed to write the binary log " << path_ << ": " << e.what());
+    }
+
+    const BinaryLogRecordHeader end{};
+    file_.write(reinterpret_cast<const char*>(&end), sizeof(end));
+    file_.close();
+
+    logInfo(DDSROUTER_BINARY_LOG,
+            "Binary log " << path_ << " closed, " << written_ << " entries written and "
+                          << dropped_.load(std::memory_order_relaxed) << " dropped.");
+}
+
+void BinaryLog::flush()
+{
+    std::lock_guard<std::mutex> lock(file_mutex_);
+    write_nts_();
+}
+
+const std::string& BinaryLog::path() const noexcept
+{
+    return path_;
+}
+
+BinaryLogStatistics BinaryLog::statistics() const
+{
+    BinaryLogStatistics statistics;
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        statistics.threads = buffers_.size();
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(file_mutex_);
+        statistics.written = written_;
+        statistics.bytes = bytes_;
+    }
+
+    statistics.dropped = dropped_.load(std::memory_order_relaxed);
+    return statistics;
+}
+
+uint64_t BinaryLog::decode(
+        std::istream& input,
+        std::ostream& output)
+{
+    struct DecodedSite
+    {
+        uint8_t kind;
+        uint32_t line;
+        std::string category;
+        std::string format;
+        std::string file;
+    };
+
+    BinaryLogFileHeader file_header;
+    if (!input.read(reinterpret_cast<char*>(&file_header), sizeof(file_header)) ||
+            std::memcmp(file_header.magic, BINARY_LOG_MAGIC, sizeof(file_header.magic)) != 0 ||
+            file_header.version != BINARY_LOG_FORMAT_VERSION)
+    {
+        throw utils::InitializationException(utils::Formatter()
+                      << "Input is not a binary log of a supported version.");
+    }
+
+    std::vector<DecodedSite> decoded_sites;
+    std::vector<uint8_t> body;
+    uint64_t entries = 0;
+
+    // A log that has not been closed properly ends without a header of type BINARY_LOG_END, maybe in a partial record
+    BinaryLogRecordHeader header;
+    while (input.read(reinterpret_cast<char*>(&header), sizeof(header)) && header.type != BINARY_LOG_END)
+    {
+        body.resize(binary_log_aligned_size(header.size) - sizeof(header));
+        if (!input.read(reinterpret_cast<char*>(body.data()), body.size()))
+        {
+            break;
+        }
+
+        if (header.type == BINARY_LOG_SITE && header.size >= sizeof(BinaryLogSite))
+        {
+            BinaryLogSite site;
+            std::memcpy(&site, body.data(), sizeof(site));
+
+            if (sizeof(site) + site.category_size + site.format_size + site.file_size > header.size)
+            {
+                continue;
+            }
+
+            const char* strings = reinterpret_cast<const char*>(body.data() + sizeof(site));
+            if (decoded_sites.size() < site.site_id)
+            {
+                decoded_sites.resize(site.site_id);
+            }
+            decoded_sites[site.site_id - 1] = {
+                site.kind,
+                site.line,
+                std::string(strings, site.category_size),
+                std::string(strings + site.category_size, site.format_size),
+                std::string(strings + site.category_size + site.format_size, site.file_size)};
+        }
+        else if (header.type == BINARY_LOG_ENTRY && header.size >= sizeof(BinaryLogEntry))
+        {
+            BinaryLogEntry entry;
+            std::memcpy(&entry, body.data(), sizeof(entry));
+
+            const std::vector<std::string> arguments =
+                    decode_arguments(body.data() + sizeof(entry), header.size - sizeof(entry));
+
+            output << entry_time(entry.timestamp) << " ";
+            if (entry.site_id == 0 || entry.site_id > decoded_sites.size())
+            {
+                output << "[Unknown] Entry of undeclared site " << entry.site_id << " (thread " << entry.thread
+                       << ")\n";
+            }
+            else
+            {
+                const DecodedSite& site = decoded_sites[entry.site_id - 1];
+                output << "[" << site.category << " " << kind_name(site.kind) << "] "
+                       << format_message(site.format.c_str(), arguments) << " (" << file_name(site.file) << ":"
+                       << site.line << ", thread " << entry.thread << ")\n";
+            }
+
+            ++entries;
+        }
+    }
+
+    return entries;
+}
+
+std::string BinaryLog::format_message(
+        const char* format,
+        const std::vector<std::string>& arguments)
+{
+    std::string message;
+    std::size_t next = 0;
+
+    for (const char* c = format; *c != '\0'; ++c)
+    {
+        if (c[0] == '{' && c[1] == '}' && next < arguments.size())
+        {
+            message += arguments[next++];
+            ++c;
+        }
+        else
+        {
+            message += *c;
+        }
+    }
+
+    return message;
+}
+
+bool BinaryLog::accepts_(
+        BinaryLogKind kind) noexcept
+{
+    return static_cast<int>(kind) <= static_cast<int>(utils::Log::GetVerbosity());
+}
+
+BinaryLog* BinaryLog::active_() noexcept
+{
+    return active_binary_log.load(std::memory_order_acquire);
+}
+
+void BinaryLog::push_(
+        LogSite& site,
+        const BinaryLogArguments& arguments) noexcept
+{
+    const uint32_t site_id = register_site_(site);
+    ThreadBuffer* buffer = thread_buffer_();
+    if (site_id == 0 || !buffer)
+    {
+        dropped_.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    const uint64_t body_size = sizeof(BinaryLogEntry) + arguments.size();
+    const uint64_t size = binary_log_aligned_size(body_size);
+
+    uint64_t head = buffer->head.load(std::memory_order_relaxed);
+    const uint64_t tail = buffer->tail.load(std::memory_order_acquire);
+
+    // Records are never split, so the end of the buffer is skipped if the entry does not fit before it
+    const uint64_t offset = head % capacity_;
+    const uint64_t padding = offset + size > capacity_ ? capacity_ - offset : 0;
+
+    if (head + padding + size - tail > capacity_)
+    {
+        dropped_.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    if (padding > 0)
+    {
+        const BinaryLogRecordHeader skip{static_cast<uint32_t>(padding - sizeof(BinaryLogRecordHeader)),
+                                         BINARY_LOG_PADDING, 0};
+        std::memcpy(buffer->data.get() + offset, &skip, sizeof(skip));
+        head += padding;
+    }
+
+    uint8_t* record = buffer->data.get() + head % capacity_;
+
+    const BinaryLogRecordHeader header{static_cast<uint32_t>(body_size), BINARY_LOG_ENTRY, 0};
+    const BinaryLogEntry entry{now(), site_id, buffer->index};
+
+    std::memcpy(record, &header, sizeof(header));
+    std::memcpy(record + sizeof(header), &entry, sizeof(entry));
+    std::memcpy(record + sizeof(header) + sizeof(entry), arguments.data(), arguments.size());
+    std::memset(record + sizeof(header) + body_size, 0, size - sizeof(header) - body_size);
+
+    buffer->head.store(head + size, std::memory_order_release);
+}
+
+void BinaryLog::queue_(
+        const LogSite& site,
+        const std::vector<std::string>& arguments) noexcept
+{
+    try
+    {
+        utils::Log::QueueLog(
+            format_message(site.format, arguments),
+            utils::Log::Context{site.file, static_cast<int>(site.line), "", site.category},
+            static_cast<utils::Log::Kind>(site.kind));
+    }
+    catch (...)
+    {
+        // Logging must never fail on the hot path
+    }
+}
+
+uint32_t BinaryLog::register_site_(
+        LogSite& site) noexcept
+{
+    const uint32_t id = site.id.load(std::memory_order_acquire);
+    if (id != 0)
+    {
+        return id;
+    }
+
+    std::lock_guard<std::mutex> lock(sites_mutex());
+
+    // Another thread may have registered it meanwhile
+    if (site.id.load(std::memory_order_relaxed) == 0)
+    {
+        try
+        {
+            sites().push_back(&site);
+        }
+        catch (const std::bad_alloc&)
+        {
+            return 0;
+        }
+        site.id.store(static_cast<uint32_t>(sites().size()), std::memory_order_release);
+    }
+
+    return site.id.load(std::memory_order_relaxed);
+}
+
+BinaryLog::ThreadBuffer* BinaryLog::thread_buffer_() noexcept
+{
+    if (cached_buffer.binary_log == id_)
+    {
+        return static_cast<ThreadBuffer*>(cached_buffer.buffer);
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    // A thread that has exited leaves its buffer to the next thread with its id
+    const std::thread::id thread = std::this_thread::get_id();
+    auto it = std::find_if(buffers_.begin(), buffers_.end(), [&thread](const std::unique_ptr<ThreadBuffer>& buffer)
+                    {
+                        return buffer->thread == thread;
+                    });
+
+    if (it == buffers_.end())
+    {
+        try
+        {
+            std::unique_ptr<ThreadBuffer> buffer(new ThreadBuffer());
+            buffer->thread = thread;
+            buffer->index = static_cast<uint32_t>(buffers_.size() + 1);
+            buffer->data.reset(new uint8_t[capacity_]);
+            buffers_.push_back(std::move(buffer));
+            it = std::prev(buffers_.end());
+        }
+        catch (const std::bad_alloc&)
+        {
+            return nullptr;
+        }
+    }
+
+    cached_buffer.binary_log = id_;
+    cached_buffer.buffer = it->get();
+    return it->get();
+}
+
+void BinaryLog::write_nts_()
+{
+    // Threads keep logging while their buffers are written, so the lock only protects the list
+    std::vector<ThreadBuffer*> buffers;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (const auto& buffer : buffers_)
+        {
+            buffers.push_back(buffer.get());
+        }
+    }
+
+    for (ThreadBuffer* buffer : buffers)
+    {
+        const uint64_t head = buffer->head.load(std::memory_order_acquire);
+        uint64_t tail = buffer->tail.load(std::memory_order_relaxed);
+
+        while (tail < head)
+        {
+            const uint8_t* record = buffer->data.get() + tail % capacity_;
+
+            BinaryLogRecordHeader header;
+            std::memcpy(&header, record, sizeof(header));
+            const uint64_t size = binary_log_aligned_size(header.size);
+
+            if (header.type == BINARY_LOG_ENTRY)
+            {
+                BinaryLogEntry entry;
+                std::memcpy(&entry, record + sizeof(header), sizeof(entry));
+                declare_site_nts_(entry.site_id);
+
+                file_.write(reinterpret_cast<const char*>(record), size);
+                ++written_;
+                bytes_ += size;
+            }
+
+            tail += size;
+        }
+
+        buffer->tail.store(tail, std::memory_order_release);
+    }
+
+    file_.flush();
+}
+
+void BinaryLog::declare_site_nts_(
+        uint32_t site_id)
+{
+    if (site_id < declared_sites_.size() && declared_sites_[site_id])
+    {
+        return;
+    }
+
+    const LogSite* site = find_site(site_id);
+    if (!site)
+    {
+        return;
+    }
+
+    const uint16_t category_size = static_cast<uint16_t>(std::min<std::size_t>(std::strlen(site->category), 0xffff));
+    const uint16_t format_size = static_cast<uint16_t>(std::min<std::size_t>(std::strlen(site->format), 0xffff));
+    const uint16_t file_size = static_cast<uint16_t>(std::min<std::size_t>(std::strlen(site->file), 0xffff));
+
+    BinaryLogSite body{};
+    body.site_id = site_id;
+    body.kind = static_cast<uint8_t>(site->kind);
+    body.line = site->line;
+    body.category_size = category_size;
+    body.format_size = format_size;
+    body.file_size = file_size;
+
+    const uint64_t body_size = sizeof(body) + category_size + format_size + file_size;
+    const BinaryLogRecordHeader header{static_cast<uint32_t>(body_size), BINARY_LOG_SITE, 0};
+    const char padding[BINARY_LOG_ALIGNMENT] = {};
+
+    file_.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file_.write(reinterpret_cast<const char*>(&body), sizeof(body));
+    file_.write(site->category, category_size);
+    file_.write(site->format, format_size);
+    file_.write(site->file, file_size);
+    file_.write(padding, binary_log_aligned_size(body_size) - sizeof(header) - body_size);
+    bytes_ += binary_log_aligned_size(body_size);
+
+    if (declared_sites_.size() <= site_id)
+    {
+        declared_sites_.resize(site_id + 1, false);
+    }
+    declared_sites_[site_id] = true;
+}
+
+void BinaryLog::routine_()
+{
+    std::unique_lock<std::mutex> lock(stop_mutex_);
+
+    while (!stop_)
+    {
+        stop_cv_.wait_for(lock, std::chrono::milliseconds(configuration_.period), [this]()
+                {
+                    return stop_;
+                });
+
+        lock.unlock();
+
+        try
+        {
+            flush();
+        }
+        catch (const std::exception& e)
+        {
+            logWarning(DDSROUTER_BINARY_LOG, "Failed to write the binary log " << path_ << ": " << e.what());
+        }
+
+        lock.lock();
+    }
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,244 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file LogThrottle.cpp
+ *
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+#include <cpp_utils/exception/InitializationException.hpp>
+#include <cpp_utils/Log.hpp>
+#include <cpp_utils/utils.hpp>
+
+#include <ddsrouter_core/logging/LogThrottle.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+namespace {
+
+//! Log throttle of the process. nullptr if there is none.
+std::atomic<LogThrottle*> active_log_throttle{nullptr};
+
+//! Threads that found a log throttle active and may be using it, which its destructor waits for.
+std::atomic<uint32_t> log_throttle_users{0};
+
+//! Log throttles created in the process, to tell them apart in the limits cached by each site.
+std::atomic<uint64_t> log_throttle_counter{0};
+
+//! Current time in nanoseconds, only used to measure windows.
+int64_t now()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+} /* namespace */
+
+LogThrottle::LogThrottle(
+        const std::vector<LogThrottleConfiguration>& rules,
+        unsigned int window)
+    : rules_(rules)
+    , window_(static_cast<int64_t>(std::max(window, 1u)) * 1000000)
+    , id_(++log_throttle_counter)
+{
+    LogThrottle* expected = nullptr;
+    if (!active_log_throttle.compare_exchange_strong(expected, this))
+    {
+        throw utils::InitializationException(utils::Formatter()
+                      << "There is already a log throttle in the process.");
+    }
+
+    thread_ = std::thread(&LogThrottle::routine_, this);
+}
+
+LogThrottle::~LogThrottle()
+{
+    LogThrottle* expected = this;
+    active_log_throttle.compare_exchange_strong(expected, nullptr);
+
+    // Threads that loaded this throttle before it was deactivated may still be using it
+    while (log_throttle_users.load(std::memory_order_seq_cst) != 0)
+    {
+        std::this_thread::yield();
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(stop_mutex_);
+        stop_ = true;
+    }
+    stop_cv_.notify_all();
+    thread_.join();
+
+    report();
+}
+
+bool LogThrottle::accepts(
+        LogSite& site) noexcept
+{
+    // Entries without a log throttle do not touch the shared counter of users
+    if (!active_log_throttle.load(std::memory_order_acquire))
+    {
+        return true;
+    }
+
+    // Either the destructor sees this thread as a user, or this thread sees the throttle deactivated
+    log_throttle_users.fetch_add(1, std::memory_order_seq_cst);
+    LogThrottle* throttle = active_log_throttle.load(std::memory_order_seq_cst);
+    const bool accepted = !throttle || throttle->accepts_(site);
+    log_throttle_users.fetch_sub(1, std::memory_order_release);
+
+    return accepted;
+}
+
+void LogThrottle::report() noexcept
+{
+    std::vector<LogSite*> sites;
+    {
+        std::lock_guard<std::mutex> lock(pending_mutex_);
+        sites.swap(pending_);
+    }
+
+    for (LogSite* site : sites)
+    {
+        // Entries suppressed from now on add the site to the pending ones again
+        const uint64_t suppressed = site->suppressed.exchange(0, std::memory_order_relaxed);
+        if (suppressed == 0)
+        {
+            continue;
+        }
+
+        try
+        {
+            utils::Log::QueueLog(
+                (utils::Formatter() << site->format << " [repeated " << suppressed << " times in the last "
+                                    << window_ / 1000000 << " ms, suppressed by the log throttle]").to_string(),
+                utils::Log::Context{site->file, static_cast<int>(site->line), "", site->category},
+                static_cast<utils::Log::Kind>(site->kind));
+            reports_.fetch_add(1, std::memory_order_relaxed);
+        }
+        catch (...)
+        {
+            // Reports are lost rather than failing
+        }
+    }
+}
+
+LogThrottleStatistics LogThrottle::statistics() const noexcept
+{
+    LogThrottleStatistics statistics;
+    statistics.suppressed = suppressed_.load(std::memory_order_relaxed);
+    statistics.reports = reports_.load(std::memory_order_relaxed);
+    return statistics;
+}
+
+bool LogThrottle::accepts_(
+        LogSite& site) noexcept
+{
+    const uint32_t limit = limit_(site);
+    if (limit == 0)
+    {
+        return true;
+    }
+
+    // Only the thread that moves the window resets its entries.
+    // Entries of other threads in between may be counted in either window.
+    const int64_t time = now();
+    int64_t start = site.window_start.load(std::memory_order_relaxed);
+    if (time - start >= window_ &&
+            site.window_start.compare_exchange_strong(start, time, std::memory_order_relaxed))
+    {
+        site.window_entries.store(0, std::memory_order_relaxed);
+    }
+
+    if (site.window_entries.fetch_add(1, std::memory_order_relaxed) < limit)
+    {
+        return true;
+    }
+
+    suppressed_.fetch_add(1, std::memory_order_relaxed);
+
+    if (site.suppressed.fetch_add(1, std::memory_order_relaxed) == 0)
+    {
+        try
+        {
+            std::lock_guard<std::mutex> lock(pending_mutex_);
+            pending_.push_back(&site);
+        }
+        catch (...)
+        {
+            // The entries of the site are reported with the next one suppressed after a report
+            site.suppressed.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    return false;
+}
+
+uint32_t LogThrottle::limit_(
+        LogSite& site) noexcept
+{
+    if (site.throttle.load(std::memory_order_acquire) == id_)
+    {
+        return site.limit.load(std::memory_order_relaxed);
+    }
+
+    uint32_t limit = 0;
+    for (const auto& rule : rules_)
+    {
+        if (utils::match_pattern(rule.category, site.category))
+        {
+            // Limits are per second, but at least an entry of each window is logged, e.g. with windows shorter
+            // than a second. Rules with no entries per second are rejected by their configuration
+            const uint64_t per_window = static_cast<uint64_t>(rule.max_per_second) * (window_ / 1000000) / 1000;
+            limit = static_cast<uint32_t>(std::min<uint64_t>(std::max<uint64_t>(per_window, 1), UINT32_MAX));
+            break;
+        }
+    }
+
+    // Counters of a previous throttle are not reported by this one
+    site.window_start.store(0, std::memory_order_relaxed);
+    site.window_entries.store(0, std::memory_order_relaxed);
+    site.suppressed.store(0, std::memory_order_relaxed);
+    site.limit.store(limit, std::memory_order_relaxed);
+    site.throttle.store(id_, std::memory_order_release);
+
+    return limit;
+}
+
+void LogThrottle::routine_()
+{
+    std::unique_lock<std::mutex> lock(stop_mutex_);
+
+    while (!stop_)
+    {
+        stop_cv_.wait_for(lock, std::chrono::nanoseconds(window_), [this]()
+                {
+                    return stop_;
+                });
+
+        lock.unlock();
+        report();
+        lock.lock();
+    }
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,383 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file MetricsExporter.cpp
+ *
+ */
+
+#include <algorithm>
+#include <iomanip>
+#include <limits>
+#include <map>
+#include <sstream>
+#include <utility>
+
+#include <cpp_utils/Log.hpp>
+
+#include <ddsrouter_core/monitoring/MetricsExporter.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+namespace {
+
+//! Escape a label value: backslashes, double quotes and line feeds.
+std::string escape(
+        const std::string& value)
+{
+    std::string escaped;
+    escaped.reserve(value.size());
+    for (const char c : value)
+    {
+        switch (c)
+        {
+            case '\\':
+                escaped += "\\\\";
+                break;
+
+            case '"':
+                escaped += "\\\"";
+                break;
+
+            case '\n':
+                escaped += "\\n";
+                break;
+
+            default:
+                escaped += c;
+        }
+    }
+    return escaped;
+}
+
+template <typename T>
+std::string to_string(
+        const T& value)
+{
+    std::ostringstream stream;
+    stream << value;
+    return stream.str();
+}
+
+void family(
+        std::ostream& out,
+        const char* name,
+        const char* type,
+        const char* help)
+{
+    out << "# TYPE " << name << " " << type << "\n";
+    out << "# HELP " << name << " " << help << "\n";
+}
+
+//! Slots with the same participant and topic added up, so each label set is written once in a family.
+std::vector<SlotStatistics> merge_slots(
+        const std::vector<SlotStatistics>& slots)
+{
+    std::vector<SlotStatistics> merged;
+    std::map<std::pair<std::string, std::string>, std::size_t> indexes;
+
+    for (const auto& slot : slots)
+    {
+        auto it = indexes.find({slot.participant_id, slot.topic});
+        if (it == indexes.end())
+        {
+            indexes.emplace(std::make_pair(slot.participant_id, slot.topic), merged.size());
+            merged.push_back(slot);
+            continue;
+        }
+
+        SlotStatistics& total = merged[it->second];
+        total.enqueued += slot.enqueued;
+        total.executed += slot.executed;
+        total.messages += slot.messages;
+        total.bytes += slot.bytes;
+        total.max_queue_depth = std::max(total.max_queue_depth, slot.max_queue_depth);
+        total.queue_latency_us += slot.queue_latency_us;
+        total.max_queue_latency_us = std::max(total.max_queue_latency_us, slot.max_queue_latency_us);
+        total.task_time_us += slot.task_time_us;
+        total.max_task_time_us = std::max(total.max_task_time_us, slot.max_task_time_us);
+    }
+
+    return merged;
+}
+
+//! Rate limits with the same scope and key, i.e. from several rules, added up as \c merge_slots does.
+std::vector<RateLimitStatistics> merge_rate_limits(
+        const std::vector<RateLimitStatistics>& limits)
+{
+    std::vector<RateLimitStatistics> merged;
+    std::map<std::pair<std::string, std::string>, std::size_t> indexes;
+
+    for (const auto& limit : limits)
+    {
+        const std::string scope = to_string(limit.scope);
+        auto it = indexes.find({scope, limit.key});
+        if (it == indexes.end())
+        {
+            indexes.emplace(std::make_pair(scope, limit.key), merged.size());
+            merged.push_back(limit);
+            continue;
+        }
+
+        RateLimitStatistics& total = merged[it->second];
+        total.accepted_msgs += limit.accepted_msgs;
+        total.accepted_bytes += limit.accepted_bytes;
+        total.dropped_msgs += limit.dropped_msgs;
+        total.dropped_bytes += limit.dropped_bytes;
+    }
+
+    return merged;
+}
+
+//! Seconds of a time in microseconds.
+double from_us(
+        uint64_t microseconds)
+{
+    return static_cast<double>(microseconds) / 1e6;
+}
+
+//! Seconds of a time in nanoseconds.
+double from_ns(
+        int64_t nanoseconds)
+{
+    return static_cast<double>(nanoseconds) / 1e9;
+}
+
+} /* namespace */
+
+MetricsExporter::MetricsExporter(
+        const MetricsExporterConfiguration& configuration,
+        MetricsProvider metrics)
+    : metrics_(std::move(metrics))
+{
+    refresh();
+
+    server_ = std::unique_ptr<MetricsHttpServer>(new MetricsHttpServer(
+                        configuration.address,
+                        configuration.port,
+                        [this]()
+                        {
+                            return snapshot();
+                        }));
+
+    refresher_ = std::make_unique<utils::event::PeriodicEventHandler>(
+        [this]()
+        {
+            refresh();
+        },
+        configuration.period);
+}
+
+MetricsExporter::~MetricsExporter()
+{
+    refresher_.reset();
+    server_.reset();
+}
+
+void MetricsExporter::refresh()
+{
+    auto new_snapshot = std::make_shared<const std::string>(serialize(metrics_()));
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    snapshot_ = std::move(new_snapshot);
+}
+
+std::shared_ptr<const std::string> MetricsExporter::snapshot() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return snapshot_;
+}
+
+uint16_t MetricsExporter::port() const noexcept
+{
+    return server_->port();
+}
+
+std::string MetricsExporter::serialize(
+        const RouterMetrics& metrics)
+{
+    std::ostringstream out;
+
+    // Sums in seconds grow for as long as the router runs, so they need every digit of a double to keep their
+    // microseconds. Integers are not affected
+    out << std::setprecision(std::numeric_limits<double>::max_digits10);
+
+    // OpenMetrics forbids repeating a label set in a family
+    const std::vector<SlotStatistics> slots = merge_slots(metrics.slots);
+    const std::vector<RateLimitStatistics> rate_limits = merge_rate_limits(metrics.rate_limits);
+
+    // Messages and bytes of each reader
+    if (!slots.empty())
+    {
+        family(out, "ddsrouter_topic_messages", "counter", "Messages received by the readers of the router.");
+        for (const auto& slot : slots)
+        {
+            out << "ddsrouter_topic_messages_total{participant=\"" << escape(slot.participant_id) << "\",topic=\""
+                << escape(slot.topic) << "\"} " << slot.messages << "\n";
+        }
+
+        family(out, "ddsrouter_topic_bytes", "counter", "Bytes of payload received by the readers of the router.");
+        for (const auto& slot : slots)
+        {
+            out << "ddsrouter_topic_bytes_total{participant=\"" << escape(slot.participant_id) << "\",topic=\""
+                << escape(slot.topic) << "\"} " << slot.bytes << "\n";
+        }
+
+        family(out, "ddsrouter_thread_pool_enqueued", "counter", "Times each reader queued its slot of the pool.");
+        for (const auto& slot : slots)
+        {
+            out << "ddsrouter_thread_pool_enqueued_total{participant=\"" << escape(slot.participant_id)
+                << "\",topic=\"" << escape(slot.topic) << "\"} " << slot.enqueued << "\n";
+        }
+
+        family(out, "ddsrouter_thread_pool_queue_latency_seconds", "summary",
+                "Time from the data being notified to a thread taking it.");
+        for (const auto& slot : slots)
+        {
+            const std::string labels = "{participant=\"" + escape(slot.participant_id) + "\",topic=\"" +
+                    escape(slot.topic) + "\"}";
+            out << "ddsrouter_thread_pool_queue_latency_seconds_count" << labels << " " << slot.executed << "\n";
+            out << "ddsrouter_thread_pool_queue_latency_seconds_sum" << labels << " "
+                << from_us(slot.queue_latency_us) << "\n";
+        }
+
+        family(out, "ddsrouter_thread_pool_task_seconds", "summary", "Time that a thread spent in a transmission.");
+        for (const auto& slot : slots)
+        {
+            const std::string labels = "{participant=\"" + escape(slot.participant_id) + "\",topic=\"" +
+                    escape(slot.topic) + "\"}";
+            out << "ddsrouter_thread_pool_task_seconds_count" << labels << " " << slot.executed << "\n";
+            out << "ddsrouter_thread_pool_task_seconds_sum" << labels << " " << from_us(slot.task_time_us) << "\n";
+        }
+
+        family(out, "ddsrouter_thread_pool_max_queue_depth", "gauge",
+                "Maximum messages waiting in each reader when it notified data.");
+        for (const auto& slot : slots)
+        {
+            out << "ddsrouter_thread_pool_max_queue_depth{participant=\"" << escape(slot.participant_id)
+                << "\",topic=\"" << escape(slot.topic) << "\"} " << slot.max_queue_depth << "\n";
+        }
+    }
+
+    // Drops of the rate limits
+    if (!rate_limits.empty())
+    {
+        family(out, "ddsrouter_rate_limit_messages", "counter", "Messages accepted and dropped by each rate limit.");
+        for (const auto& limit : rate_limits)
+        {
+            const std::string labels = "scope=\"" + escape(to_string(limit.scope)) + "\",key=\"" +
+                    escape(limit.key) + "\"";
+            out << "ddsrouter_rate_limit_messages_total{" << labels << ",result=\"accepted\"} "
+                << limit.accepted_msgs << "\n";
+            out << "ddsrouter_rate_limit_messages_total{" << labels << ",result=\"dropped\"} "
+                << limit.dropped_msgs << "\n";
+        }
+
+        family(out, "ddsrouter_rate_limit_bytes", "counter", "Bytes accepted and dropped by each rate limit.");
+        for (const auto& limit : rate_limits)
+        {
+            const std::string labels = "scope=\"" + escape(to_string(limit.scope)) + "\",key=\"" +
+                    escape(limit.key) + "\"";
+            out << "ddsrouter_rate_limit_bytes_total{" << labels << ",result=\"accepted\"} "
+                << limit.accepted_bytes << "\n";
+            out << "ddsrouter_rate_limit_bytes_total{" << labels << ",result=\"dropped\"} "
+                << limit.dropped_bytes << "\n";
+        }
+    }
+
+    // Messages, losses and latencies of the sinks
+    if (!metrics.sinks.empty())
+    {
+        family(out, "ddsrouter_sink_messages", "counter", "Messages received by each Sink Participant.");
+        for (const auto& sink : metrics.sinks)
+        {
+            for (const auto& topic : sink.second.topics)
+            {
+                out << "ddsrouter_sink_messages_total{participant=\"" << escape(sink.first) << "\",topic=\""
+                    << escape(topic.first) << "\"} " << topic.second.messages << "\n";
+            }
+        }
+
+        family(out, "ddsrouter_sink_bytes", "counter", "Bytes of payload received by each Sink Participant.");
+        for (const auto& sink : metrics.sinks)
+        {
+            for (const auto& topic : sink.second.topics)
+            {
+                out << "ddsrouter_sink_bytes_total{participant=\"" << escape(sink.first) << "\",topic=\""
+                    << escape(topic.first) << "\"} " << topic.second.bytes << "\n";
+            }
+        }
+
+        family(out, "ddsrouter_sink_lost", "counter", "Generated messages lost before reaching each Sink Participant.");
+        for (const auto& sink : metrics.sinks)
+        {
+            for (const auto& topic : sink.second.topics)
+            {
+                out << "ddsrouter_sink_lost_total{participant=\"" << escape(sink.first) << "\",topic=\""
+                    << escape(topic.first) << "\"} " << topic.second.lost << "\n";
+            }
+        }
+
+        family(out, "ddsrouter_sink_latency_seconds", "summary",
+                "Latency from a Generator Participant to each Sink Participant.");
+        for (const auto& sink : metrics.sinks)
+        {
+            const SinkReport& report = sink.second;
+            const std::string participant = escape(sink.first);
+            out << "ddsrouter_sink_latency_seconds{participant=\"" << participant << "\",quantile=\"0.5\"} "
+                << from_ns(report.latency_p50) << "\n";
+            out << "ddsrouter_sink_latency_seconds{participant=\"" << participant << "\",quantile=\"0.99\"} "
+                << from_ns(report.latency_p99) << "\n";
+            out << "ddsrouter_sink_latency_seconds_count{participant=\"" << participant << "\"} "
+                << report.generated << "\n";
+            out << "ddsrouter_sink_latency_seconds_sum{participant=\"" << participant << "\"} "
+                << from_ns(report.latency_mean) * static_cast<double>(report.generated) << "\n";
+        }
+    }
+
+    // Usage of the payload pool
+    if (metrics.payload_pool.slots > 0)
+    {
+        family(out, "ddsrouter_payload_pool_slots", "gauge", "Payload slots preallocated, in use or free.");
+        out << "ddsrouter_payload_pool_slots{state=\"used\"} "
+            << metrics.payload_pool.slots - metrics.payload_pool.free_slots << "\n";
+        out << "ddsrouter_payload_pool_slots{state=\"free\"} " << metrics.payload_pool.free_slots << "\n";
+
+        family(out, "ddsrouter_payload_pool_payloads", "counter", "Payloads served from a slot or from the heap.");
+        out << "ddsrouter_payload_pool_payloads_total{source=\"pooled\"} " << metrics.payload_pool.pooled << "\n";
+        out << "ddsrouter_payload_pool_payloads_total{source=\"heap\"} " << metrics.payload_pool.heap << "\n";
+    }
+
+    // Adaptive forwarding threads
+    if (metrics.concurrency.limit > 0)
+    {
+        family(out, "ddsrouter_forwarding_threads", "gauge", "Threads allowed to forward data at once, and in use.");
+        out << "ddsrouter_forwarding_threads{state=\"allowed\"} " << metrics.concurrency.limit << "\n";
+        out << "ddsrouter_forwarding_threads{state=\"active\"} " << metrics.concurrency.active << "\n";
+
+        family(out, "ddsrouter_forwarding_thread_changes", "counter", "Times the threads allowed have changed.");
+        out << "ddsrouter_forwarding_thread_changes_total{direction=\"grown\"} " << metrics.concurrency.grown << "\n";
+        out << "ddsrouter_forwarding_thread_changes_total{direction=\"shrunk\"} " << metrics.concurrency.shrunk
+            << "\n";
+    }
+
+    out << "# EOF\n";
+    return out.str();
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
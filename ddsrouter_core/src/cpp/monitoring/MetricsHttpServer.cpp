@@ -0,0 +1,253 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file MetricsHttpServer.cpp
+ *
+ */
+
+#if defined(__linux__)
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+#endif // defined(__linux__)
+
+#include <cerrno>
+#include <cstring>
+#include <sstream>
+
+#include <cpp_utils/exception/InitializationException.hpp>
+#include <cpp_utils/Formatter.hpp>
+#include <cpp_utils/Log.hpp>
+
+#include <ddsrouter_core/monitoring/MetricsHttpServer.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+#if defined(__linux__)
+namespace {
+
+//! Time between checks of whether the server must stop.
+constexpr int ACCEPT_TIMEOUT_MS = 100;
+
+//! Time that a client has to send its request, or to receive its response.
+constexpr int CONNECTION_TIMEOUT_S = 1;
+
+//! Maximum size of a request. Scrapers send a few hundred bytes.
+constexpr std::size_t MAX_REQUEST_SIZE = 8192;
+
+bool send_all(
+        int connection,
+        const char* data,
+        std::size_t size) noexcept
+{
+    while (size > 0)
+    {
+        const ssize_t sent = send(connection, data, size, MSG_NOSIGNAL);
+        if (sent < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (sent <= 0)
+        {
+            return false;
+        }
+        data += sent;
+        size -= static_cast<std::size_t>(sent);
+    }
+    return true;
+}
+
+void send_response(
+        int connection,
+        const char* status,
+        const char* content_type,
+        const std::string& body) noexcept
+{
+    std::ostringstream header_stream;
+    header_stream << "HTTP/1.1 " << status << "\r\n"
+                  << "Content-Type: " << content_type << "\r\n"
+                  << "Content-Length: " << body.size() << "\r\n"
+                  << "Connection: close\r\n\r\n";
+    const std::string header = header_stream.str();
+
+    if (send_all(connection, header.data(), header.size()))
+    {
+        send_all(connection, body.data(), body.size());
+    }
+}
+
+} /* namespace */
+#endif // defined(__linux__)
+
+MetricsHttpServer::MetricsHttpServer(
+        const std::string& address,
+        uint16_t port,
+        BodyProvider body)
+    : body_(std::move(body))
+    , fd_(-1)
+    , port_(port)
+    , stop_(false)
+{
+#if defined(__linux__)
+    sockaddr_in socket_address{};
+    socket_address.sin_family = AF_INET;
+    socket_address.sin_port = htons(port);
+    if (inet_pton(AF_INET, address.c_str(), &socket_address.sin_addr) != 1)
+    {
+        throw utils::InitializationException(utils::Formatter()
+                      << "Metrics exporter address " << address << " is not a valid IPv4 address.");
+    }
+
+    fd_ = socket(AF_INET, SOCK_STREAM, 0);
+    if (fd_ < 0)
+    {
+        throw utils::InitializationException(utils::Formatter()
+                      << "Failed to create the socket of the metrics exporter: " << std::strerror(errno));
+    }
+
+    // Let the router restart right away, without waiting for the connections of the previous one to expire
+    const int reuse = 1;
+    setsockopt(fd_, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+    if (bind(fd_, reinterpret_cast<sockaddr*>(&socket_address), sizeof(socket_address)) != 0 ||
+            listen(fd_, SOMAXCONN) != 0)
+    {
+        const int error = errno;
+        close(fd_);
+        throw utils::InitializationException(utils::Formatter()
+                      << "Failed to listen in " << address << ":" << port << " for the metrics exporter: "
+                      << std::strerror(error));
+    }
+
+    socklen_t length = sizeof(socket_address);
+    if (getsockname(fd_, reinterpret_cast<sockaddr*>(&socket_address), &length) == 0)
+    {
+        port_ = ntohs(socket_address.sin_port);
+    }
+
+    logInfo(DDSROUTER_METRICS, "Serving metrics in http://" << address << ":" << port_ << "/metrics .");
+
+    thread_ = std::thread(&MetricsHttpServer::serve_, this);
+#else
+    throw utils::InitializationException(utils::Formatter()
+                  << "Serving metrics in " << address << ":" << port << " is only supported in Linux.");
+#endif // defined(__linux__)
+}
+
+MetricsHttpServer::~MetricsHttpServer()
+{
+    stop_ = true;
+    if (thread_.joinable())
+    {
+        thread_.join();
+    }
+#if defined(__linux__)
+    close(fd_);
+#endif // defined(__linux__)
+}
+
+uint16_t MetricsHttpServer::port() const noexcept
+{
+    return port_;
+}
+
+#if defined(__linux__)
+void MetricsHttpServer::serve_() noexcept
+{
+    pollfd listener{};
+    listener.fd = fd_;
+    listener.events = POLLIN;
+
+    while (!stop_)
+    {
+        if (poll(&listener, 1, ACCEPT_TIMEOUT_MS) <= 0)
+        {
+            continue;
+        }
+
+        const int connection = accept(fd_, nullptr, nullptr);
+        if (connection < 0)
+        {
+            continue;
+        }
+
+        handle_(connection);
+        close(connection);
+    }
+}
+
+void MetricsHttpServer::handle_(
+        int connection) noexcept
+{
+    // A client that does not complete its request must not block the server
+    timeval timeout{};
+    timeout.tv_sec = CONNECTION_TIMEOUT_S;
+    setsockopt(connection, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+    setsockopt(connection, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+
+    std::string request;
+    char buffer[1024];
+    while (request.find("\r\n\r\n") == std::string::npos && request.size() < MAX_REQUEST_SIZE)
+    {
+        const ssize_t received = recv(connection, buffer, sizeof(buffer), 0);
+        if (received < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (received <= 0)
+        {
+            return;
+        }
+        request.append(buffer, static_cast<std::size_t>(received));
+    }
+
+    // Request line: METHOD SP TARGET SP VERSION
+    const std::size_t method_end = request.find(' ');
+    const std::size_t target_end = method_end == std::string::npos ? method_end : request.find(' ', method_end + 1);
+    if (target_end == std::string::npos)
+    {
+        send_response(connection, "400 Bad Request", "text/plain", "Bad request\n");
+        return;
+    }
+
+    const std::string method = request.substr(0, method_end);
+    std::string target = request.substr(method_end + 1, target_end - method_end - 1);
+    target = target.substr(0, target.find('?'));
+
+    if (method != "GET")
+    {
+        send_response(connection, "405 Method Not Allowed", "text/plain", "Only GET is allowed\n");
+        return;
+    }
+
+    if (target != "/metrics")
+    {
+        send_response(connection, "404 Not Found", "text/plain", "Metrics are served in /metrics\n");
+        return;
+    }
+
+    const std::shared_ptr<const std::string> body = body_();
+    send_response(connection, "200 OK", CONTENT_TYPE, body ? *body : std::string("# EOF\n"));
+}
+#endif // defined(__linux__)
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,408 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file PipelineTracer.cpp
+ *
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <ctime>
+#include <fstream>
+#include <new>
+
+#include <cpp_utils/Log.hpp>
+
+#include <ddsrouter_core/monitoring/PipelineTracer.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+namespace {
+
+//! Tracers created in the process, to tell them apart in the buffers cached by each thread.
+std::atomic<uint64_t> tracer_counter{0};
+
+//! Traces dumped in the process, to name their files.
+std::atomic<uint64_t> dump_counter{0};
+
+//! Buffer of each thread in the last tracer it recorded events in.
+struct CachedBuffer
+{
+    uint64_t tracer = 0;
+
+    void* buffer = nullptr;
+};
+
+thread_local CachedBuffer cached_buffer;
+
+//! Sample that each thread is forwarding.
+thread_local const TracedEndpoint* current_source_endpoint = nullptr;
+thread_local uint32_t current_source_sample = 0;
+
+//! String as a JSON string, quotes included.
+std::string json_string(
+        const std::string& value)
+{
+    std::string json = "\"";
+    for (const char c : value)
+    {
+        if (c == '"' || c == '\\')
+        {
+            json += '\\';
+            json += c;
+        }
+        else if (static_cast<unsigned char>(c) < 0x20)
+        {
+            char escaped[8];
+            std::snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned int>(c));
+            json += escaped;
+        }
+        else
+        {
+            json += c;
+        }
+    }
+    json += '"';
+    return json;
+}
+
+//! Time in nanoseconds as microseconds, the unit of the trace events.
+std::string json_microseconds(
+        int64_t nanoseconds)
+{
+    char buffer[32];
+    std::snprintf(buffer, sizeof(buffer), "%lld.%03lld",
+            static_cast<long long>(nanoseconds / 1000), static_cast<long long>(nanoseconds % 1000));
+    return buffer;
+}
+
+//! Local time, to name the files of the traces.
+std::string timestamp()
+{
+    const std::time_t now = std::time(nullptr);
+    std::tm local{};
+    localtime_r(&now, &local);
+
+    char buffer[32];
+    std::strftime(buffer, sizeof(buffer), "%Y%m%d_%H%M%S", &local);
+    return buffer;
+}
+
+} /* namespace */
+
+const char* to_string(
+        TraceStage stage) noexcept
+{
+    switch (stage)
+    {
+        case TraceStage::notification:
+            return "notification";
+
+        case TraceStage::enqueue:
+            return "enqueue";
+
+        case TraceStage::dequeue:
+            return "dequeue";
+
+        case TraceStage::payload_copy:
+            return "payload copy";
+
+        case TraceStage::write:
+            return "write";
+
+        default:
+            return "unknown";
+    }
+}
+
+PipelineTracer::PipelineTracer(
+        const TracingConfiguration& configuration)
+    : configuration_(configuration)
+    , id_(++tracer_counter)
+    , topics_(configuration.topics)
+{
+}
+
+std::shared_ptr<TracedEndpoint> PipelineTracer::register_endpoint(
+        const ddspipe::core::types::ParticipantId& participant_id,
+        const ddspipe::core::types::DdsTopic& topic)
+{
+    auto endpoint = std::make_shared<TracedEndpoint>();
+    endpoint->participant_id = participant_id;
+    endpoint->topic = topic;
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    endpoint->index = static_cast<uint32_t>(endpoints_.size());
+    endpoint->enabled.store(traced_nts_(topic), std::memory_order_relaxed);
+    endpoints_.push_back(endpoint);
+    return endpoint;
+}
+
+void PipelineTracer::reload(
+        const std::vector<ddspipe::core::types::WildcardDdsFilterTopic>& topics)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    topics_ = topics;
+
+    for (const auto& endpoint : endpoints_)
+    {
+        const bool traced = traced_nts_(endpoint->topic);
+        if (traced != endpoint->enabled.load(std::memory_order_relaxed))
+        {
+            logInfo(DDSROUTER_TRACING,
+                    (traced ? "Tracing" : "Not tracing anymore") << " endpoint of participant "
+                                                                 << endpoint->participant_id << " in topic "
+                                                                 << endpoint->topic << ".");
+            endpoint->enabled.store(traced, std::memory_order_relaxed);
+        }
+    }
+}
+
+void PipelineTracer::record(
+        const TracedEndpoint& endpoint,
+        TraceStage stage,
+        int64_t begin,
+        int64_t end,
+        const TracedEndpoint* source /* = nullptr */,
+        uint32_t sample /* = 0 */) noexcept
+{
+    ThreadBuffer* buffer = thread_buffer_();
+    if (!buffer)
+    {
+        return;
+    }
+
+    // Announce the slot being overwritten before writing it, so a dump copying it at once discards it
+    const uint64_t position = buffer->written.load(std::memory_order_relaxed);
+    buffer->reserved.store(position + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    Event& event = buffer->events[position % configuration_.buffer_size];
+    event.begin.store(begin, std::memory_order_relaxed);
+    event.end.store(end, std::memory_order_relaxed);
+    event.stage_endpoint.store(
+        (static_cast<uint64_t>(stage) << 32) | endpoint.index, std::memory_order_relaxed);
+    event.source_sample.store(
+        (static_cast<uint64_t>(source ? source->index + 1 : 0) << 32) | sample, std::memory_order_relaxed);
+
+    buffer->written.store(position + 1, std::memory_order_release);
+}
+
+void PipelineTracer::dump(
+        std::ostream& output) const
+{
+    struct CopiedEvent
+    {
+        int64_t begin;
+        int64_t end;
+        uint64_t stage_endpoint;
+        uint64_t source_sample;
+    };
+
+    // Threads keep recording while their buffers are copied, so the lock only protects the lists
+    std::vector<std::shared_ptr<TracedEndpoint>> endpoints;
+    std::vector<const ThreadBuffer*> buffers;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        endpoints = endpoints_;
+        for (const auto& buffer : buffers_)
+        {
+            buffers.push_back(buffer.get());
+        }
+    }
+
+    const uint64_t capacity = configuration_.buffer_size;
+
+    output << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n";
+    output << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,\"args\":{\"name\":\"DDS Router\"}}";
+
+    std::vector<CopiedEvent> events;
+    for (const ThreadBuffer* buffer : buffers)
+    {
+        output << ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << buffer->index
+               << ",\"args\":{\"name\":\"thread " << buffer->index << "\"}}";
+
+        const uint64_t written = buffer->written.load(std::memory_order_acquire);
+        uint64_t first = written > capacity ? written - capacity : 0;
+
+        events.clear();
+        for (uint64_t position = first; position < written; ++position)
+        {
+            const Event& event = buffer->events[position % capacity];
+            events.push_back({
+                        event.begin.load(std::memory_order_relaxed),
+                        event.end.load(std::memory_order_relaxed),
+                        event.stage_endpoint.load(std::memory_order_relaxed),
+                        event.source_sample.load(std::memory_order_relaxed)});
+        }
+
+        // Discard the events that the thread started to overwrite while they were copied
+        std::atomic_thread_fence(std::memory_order_acquire);
+        const uint64_t reserved = buffer->reserved.load(std::memory_order_relaxed);
+        const uint64_t skipped = reserved > capacity + first ? reserved - capacity - first : 0;
+
+        for (std::size_t i = std::min<uint64_t>(skipped, events.size()); i < events.size(); ++i)
+        {
+            const CopiedEvent& event = events[i];
+            const auto stage = static_cast<TraceStage>(event.stage_endpoint >> 32);
+            const uint32_t endpoint_index = static_cast<uint32_t>(event.stage_endpoint);
+            const uint32_t source_index = static_cast<uint32_t>(event.source_sample >> 32);
+            const uint32_t sample = static_cast<uint32_t>(event.source_sample);
+
+            if (endpoint_index >= endpoints.size() || source_index > endpoints.size())
+            {
+                continue;
+            }
+
+            const TracedEndpoint& endpoint = *endpoints[endpoint_index];
+
+            output << ",\n{\"name\":\"" << to_string(stage) << "\",\"cat\":\"ddsrouter\"";
+            if (event.end > event.begin)
+            {
+                output << ",\"ph\":\"X\",\"ts\":" << json_microseconds(event.begin)
+                       << ",\"dur\":" << json_microseconds(event.end - event.begin);
+            }
+            else
+            {
+                output << ",\"ph\":\"i\",\"s\":\"t\",\"ts\":" << json_microseconds(event.begin);
+            }
+            output << ",\"pid\":1,\"tid\":" << buffer->index
+                   << ",\"args\":{\"participant\":" << json_string(endpoint.participant_id)
+                   << ",\"topic\":" << json_string(endpoint.topic.topic_name());
+            if (source_index > 0)
+            {
+                output << ",\"source\":" << json_string(endpoints[source_index - 1]->participant_id)
+                       << ",\"sample\":" << sample;
+            }
+            output << "}}";
+        }
+    }
+
+    output << "\n]}\n";
+}
+
+std::string PipelineTracer::dump() const
+{
+    const std::string path = configuration_.output_directory + "/ddsrouter_trace_" + timestamp() + "_" +
+            std::to_string(++dump_counter) + ".json";
+
+    std::ofstream file(path);
+    dump(file);
+    file.close();
+
+    if (!file)
+    {
+        logWarning(DDSROUTER_TRACING, "Failed to write the trace in " << path << ".");
+        return "";
+    }
+
+    logInfo(DDSROUTER_TRACING, "Trace written in " << path << ".");
+    return path;
+}
+
+TraceStatistics PipelineTracer::statistics() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    TraceStatistics statistics;
+    statistics.threads = buffers_.size();
+    for (const auto& buffer : buffers_)
+    {
+        const uint64_t written = buffer->written.load(std::memory_order_relaxed);
+        statistics.recorded += written;
+        statistics.overwritten += written > configuration_.buffer_size ? written - configuration_.buffer_size : 0;
+    }
+
+    return statistics;
+}
+
+int64_t PipelineTracer::now() noexcept
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void PipelineTracer::set_current_sample(
+        const TracedEndpoint* source,
+        uint32_t sample) noexcept
+{
+    current_source_endpoint = source;
+    current_source_sample = sample;
+}
+
+const TracedEndpoint* PipelineTracer::current_source() noexcept
+{
+    return current_source_endpoint;
+}
+
+uint32_t PipelineTracer::current_sample() noexcept
+{
+    return current_source_sample;
+}
+
+PipelineTracer::ThreadBuffer* PipelineTracer::thread_buffer_() noexcept
+{
+    if (cached_buffer.tracer == id_)
+    {
+        return static_cast<ThreadBuffer*>(cached_buffer.buffer);
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    // The thread may have recorded events in this tracer before recording them in another one
+    const std::thread::id thread = std::this_thread::get_id();
+    auto it = std::find_if(buffers_.begin(), buffers_.end(), [&thread](const std::unique_ptr<ThreadBuffer>& buffer)
+                    {
+                        return buffer->thread == thread;
+                    });
+
+    if (it == buffers_.end())
+    {
+        try
+        {
+            std::unique_ptr<ThreadBuffer> buffer(new ThreadBuffer());
+            buffer->thread = thread;
+            buffer->index = static_cast<uint32_t>(buffers_.size() + 1);
+            buffer->events.reset(new Event[configuration_.buffer_size]);
+            buffers_.push_back(std::move(buffer));
+            it = std::prev(buffers_.end());
+        }
+        catch (const std::bad_alloc&)
+        {
+            return nullptr;
+        }
+    }
+
+    cached_buffer.tracer = id_;
+    cached_buffer.buffer = it->get();
+    return it->get();
+}
+
+bool PipelineTracer::traced_nts_(
+        const ddspipe::core::types::DdsTopic& topic) const noexcept
+{
+    return std::any_of(topics_.begin(), topics_.end(), [&topic](
+                       const ddspipe::core::types::WildcardDdsFilterTopic& filter)
+                   {
+                       return filter.matches(topic);
+                   });
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
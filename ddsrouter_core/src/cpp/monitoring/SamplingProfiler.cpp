@@ -0,0 +1,455 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file SamplingProfiler.cpp
+ *
+ */
+
+#if defined(__linux__)
+#include <cxxabi.h>
+#include <dlfcn.h>
+#include <execinfo.h>
+#include <signal.h>
+#include <sys/time.h>
+#include <unistd.h>
+#endif // defined(__linux__)
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <cpp_utils/exception/InitializationException.hpp>
+#include <cpp_utils/Formatter.hpp>
+#include <cpp_utils/Log.hpp>
+
+#include <ddsrouter_core/monitoring/SamplingProfiler.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+namespace {
+
+//! Profiler of the process. Only one may exist at a time.
+std::atomic<SamplingProfiler*> profiler_instance{nullptr};
+
+//! Tag of the samples of each thread. nullptr if the thread is not tagged.
+thread_local const char* thread_tag = nullptr;
+
+//! Sessions run in the process, to name their files.
+std::atomic<uint64_t> session_counter{0};
+
+} /* namespace */
+
+#if defined(__linux__)
+
+namespace {
+
+//! Maximum frames of a stack sampled.
+constexpr int MAX_DEPTH = 64;
+
+//! Frames of the signal handler on top of every stack sampled: the handler itself and the signal trampoline.
+constexpr int HANDLER_FRAMES = 2;
+
+//! Maximum samples of a session, so a session never reserves more than a few tens of MB.
+constexpr std::size_t MAX_SAMPLES = 32768;
+
+struct Sample
+{
+    int depth;
+
+    void* frames[MAX_DEPTH];
+
+    char tag[SamplingProfiler::MAX_TAG_SIZE + 1];
+};
+
+//! Memory of a session, written by the signal handler.
+struct Session
+{
+    std::unique_ptr<Sample[]> samples;
+
+    std::size_t capacity = 0;
+
+    //! Next sample to write. May exceed \c capacity , in which case samples are dropped.
+    std::atomic<std::size_t> next{0};
+};
+
+//! Session being sampled. nullptr if none.
+std::atomic<Session*> active_session{nullptr};
+
+//! Signal handlers running, so a session is not released while a handler writes in it.
+std::atomic<uint32_t> running_handlers{0};
+
+void handle_profiling_signal(
+        int /* signal */)
+{
+    const int saved_errno = errno;
+
+    // Sequentially consistent with the release of the session in profile: either the handler sees it released, or
+    // profile sees the handler running and waits for it
+    running_handlers.fetch_add(1, std::memory_order_seq_cst);
+
+    Session* session = active_session.load(std::memory_order_seq_cst);
+    if (session)
+    {
+        const std::size_t index = session->next.fetch_add(1, std::memory_order_relaxed);
+        if (index < session->capacity)
+        {
+            Sample& sample = session->samples[index];
+            sample.depth = backtrace(sample.frames, MAX_DEPTH);
+
+            // The tag is only changed by this same thread, so it can not change while it is copied
+            std::size_t length = 0;
+            const char* tag = thread_tag;
+            while (tag && tag[length] != '\0' && length < SamplingProfiler::MAX_TAG_SIZE)
+            {
+                sample.tag[length] = tag[length];
+                ++length;
+            }
+            sample.tag[length] = '\0';
+        }
+    }
+
+    running_handlers.fetch_sub(1, std::memory_order_release);
+    errno = saved_errno;
+}
+
+//! Name of the function of \c address , or its module and offset if it has no dynamic symbol.
+std::string symbol(
+        void* address)
+{
+    Dl_info info{};
+    if (dladdr(address, &info) == 0)
+    {
+        std::ostringstream name;
+        name << address;
+        return name.str();
+    }
+
+    if (info.dli_sname)
+    {
+        int status = 0;
+        char* demangled = abi::__cxa_demangle(info.dli_sname, nullptr, nullptr, &status);
+        std::string name = (status == 0 && demangled) ? demangled : info.dli_sname;
+        std::free(demangled);
+        return name;
+    }
+
+    const char* module = info.dli_fname ? std::strrchr(info.dli_fname, '/') : nullptr;
+    std::ostringstream name;
+    name << (module ? module + 1 : (info.dli_fname ? info.dli_fname : "?")) << "+0x" << std::hex
+         << (static_cast<char*>(address) - static_cast<char*>(info.dli_fbase));
+    return name.str();
+}
+
+//! Frames must not contain the separator of the folded stacks.
+std::string sanitize(
+        std::string frame)
+{
+    std::replace(frame.begin(), frame.end(), ';', ':');
+    std::replace(frame.begin(), frame.end(), '\n', ' ');
+    return frame;
+}
+
+//! Local time, to name the files of the sessions.
+std::string timestamp()
+{
+    const std::time_t now = std::time(nullptr);
+    std::tm local{};
+    localtime_r(&now, &local);
+
+    char buffer[32];
+    std::strftime(buffer, sizeof(buffer), "%Y%m%d_%H%M%S", &local);
+    return buffer;
+}
+
+} /* namespace */
+
+SamplingProfiler::SamplingProfiler(
+        const ProfilerConfiguration& configuration)
+    : configuration_(configuration)
+    , stop_(false)
+{
+    SamplingProfiler* expected = nullptr;
+    if (!profiler_instance.compare_exchange_strong(expected, this))
+    {
+        throw utils::InitializationException(utils::Formatter() << "Only one sampling profiler may exist at a time.");
+    }
+
+    // The first backtrace loads the unwinder, which is not safe within a signal handler
+    void* frames[1];
+    backtrace(frames, 1);
+
+    trigger_.reset(new SignalTrigger([this]()
+            {
+                profile();
+            }));
+}
+
+SamplingProfiler::~SamplingProfiler()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    cv_.notify_all();
+
+    // Wait for the session running in the background, which has just been stopped
+    trigger_.reset();
+
+    profiler_instance.store(nullptr, std::memory_order_release);
+}
+
+std::string SamplingProfiler::profile()
+{
+    std::lock_guard<std::mutex> session_lock(session_mutex_);
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (stop_)
+        {
+            return "";
+        }
+    }
+
+    const unsigned int hardware_threads = std::max(1u, std::thread::hardware_concurrency());
+
+    // Samples are taken per CPU time, so every thread running at once may add the frequency configured
+    Session session;
+    session.capacity = std::min<std::size_t>(
+        MAX_SAMPLES,
+        static_cast<std::size_t>(configuration_.frequency) * configuration_.duration / 1000 * hardware_threads + 1);
+    session.samples.reset(new Sample[session.capacity]);
+
+    struct sigaction action{};
+    struct sigaction previous_action{};
+    action.sa_handler = handle_profiling_signal;
+    action.sa_flags = SA_RESTART;
+    sigemptyset(&action.sa_mask);
+    if (sigaction(SIGPROF, &action, &previous_action) != 0)
+    {
+        logWarning(DDSROUTER_PROFILER, "Failed to handle the profiling signal: " << std::strerror(errno) << ".");
+        return "";
+    }
+
+    logInfo(DDSROUTER_PROFILER,
+            "Profiling for " << configuration_.duration << " ms at " << configuration_.frequency << " Hz.");
+
+    active_session.store(&session, std::memory_order_release);
+
+    // A period of a whole second or more does not fit in the microseconds of the timer
+    const unsigned int period_us = 1000000 / configuration_.frequency;
+    itimerval timer{};
+    timer.it_interval.tv_sec = static_cast<time_t>(period_us / 1000000);
+    timer.it_interval.tv_usec = static_cast<suseconds_t>(period_us % 1000000);
+    timer.it_value = timer.it_interval;
+
+    const bool started = setitimer(ITIMER_PROF, &timer, nullptr) == 0;
+    if (!started)
+    {
+        logWarning(DDSROUTER_PROFILER, "Failed to start the profiling timer: " << std::strerror(errno) << ".");
+    }
+    else
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        cv_.wait_for(lock, std::chrono::milliseconds(configuration_.duration), [this]()
+                {
+                    return stop_;
+                });
+    }
+
+    timer = itimerval{};
+    const bool stopped = setitimer(ITIMER_PROF, &timer, nullptr) == 0;
+    if (!stopped)
+    {
+        // The previous action of the signal may terminate the process, so the handler stays, without a session
+        logWarning(DDSROUTER_PROFILER,
+                "Failed to stop the profiling timer: " << std::strerror(errno) << ". Keeping its signal handled.");
+    }
+
+    // Wait for the handlers that already took the session, before reading it. Sequentially consistent, as the
+    // handler first announces itself and then reads the session, the other way round
+    active_session.store(nullptr, std::memory_order_seq_cst);
+    while (running_handlers.load(std::memory_order_seq_cst) > 0)
+    {
+        std::this_thread::yield();
+    }
+
+    if (stopped)
+    {
+        sigaction(SIGPROF, &previous_action, nullptr);
+    }
+
+    if (!started || !stopped)
+    {
+        logWarning(DDSROUTER_PROFILER, "Profiling session aborted.");
+        return "";
+    }
+
+    const std::size_t taken = session.next.load(std::memory_order_relaxed);
+    const std::size_t samples = std::min(taken, session.capacity);
+
+    // Fold the stacks, root first, resolving each address once
+    std::map<std::string, uint64_t> stacks;
+    std::unordered_map<void*, std::string> symbols;
+    for (std::size_t i = 0; i < samples; ++i)
+    {
+        const Sample& sample = session.samples[i];
+
+        // The tag already separates its own frames
+        std::string stack = sample.tag;
+        std::replace(stack.begin(), stack.end(), '\n', ' ');
+        for (int frame = sample.depth - 1; frame >= HANDLER_FRAMES; --frame)
+        {
+            // Every frame but the one interrupted is a return address, that may already belong to the next line
+            void* address = sample.frames[frame];
+            if (frame > HANDLER_FRAMES)
+            {
+                address = static_cast<char*>(address) - 1;
+            }
+
+            auto it = symbols.find(address);
+            if (it == symbols.end())
+            {
+                it = symbols.emplace(address, sanitize(symbol(address))).first;
+            }
+
+            if (!stack.empty())
+            {
+                stack += ';';
+            }
+            stack += it->second;
+        }
+
+        ++stacks[stack];
+    }
+
+    const std::string path = configuration_.output_directory + "/ddsrouter_profile_" + timestamp() + "_" +
+            std::to_string(++session_counter) + ".folded";
+
+    std::ofstream file(path);
+    for (const auto& stack : stacks)
+    {
+        file << stack.first << " " << stack.second << "\n";
+    }
+    file.close();
+
+    if (!file)
+    {
+        logWarning(DDSROUTER_PROFILER, "Failed to write the profile in " << path << ".");
+        return "";
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        ++statistics_.sessions;
+        statistics_.samples += samples;
+        statistics_.dropped += taken - samples;
+        statistics_.last_profile = path;
+    }
+
+    logInfo(DDSROUTER_PROFILER,
+            "Profile of " << samples << " samples (" << taken - samples << " dropped) written in " << path << ".");
+
+    return path;
+}
+
+#else
+
+SamplingProfiler::SamplingProfiler(
+        const ProfilerConfiguration& configuration)
+    : configuration_(configuration)
+    , stop_(false)
+{
+    SamplingProfiler* expected = nullptr;
+    if (!profiler_instance.compare_exchange_strong(expected, this))
+    {
+        throw utils::InitializationException(utils::Formatter() << "Only one sampling profiler may exist at a time.");
+    }
+
+    logWarning(DDSROUTER_PROFILER, "Profiling is only supported in Linux.");
+
+    trigger_.reset(new SignalTrigger([this]()
+            {
+                profile();
+            }));
+}
+
+SamplingProfiler::~SamplingProfiler()
+{
+    profiler_instance.store(nullptr, std::memory_order_release);
+}
+
+std::string SamplingProfiler::profile()
+{
+    return "";
+}
+
+#endif // defined(__linux__)
+
+void SamplingProfiler::trigger() noexcept
+{
+    trigger_->trigger();
+}
+
+void SamplingProfiler::trigger_on_signal(
+        int signal)
+{
+    trigger_->trigger_on_signal(signal);
+}
+
+ProfilerStatistics SamplingProfiler::statistics() const noexcept
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return statistics_;
+}
+
+void SamplingProfiler::tag_thread(
+        const char* tag) noexcept
+{
+    thread_tag = tag;
+}
+
+void SamplingProfiler::untag_thread() noexcept
+{
+    thread_tag = nullptr;
+}
+
+std::string SamplingProfiler::tag(
+        const ddspipe::core::types::ParticipantId& participant_id,
+        const std::string& topic)
+{
+    // Each of them is a frame, so they must not contain the separator
+    std::string participant_frame = "participant " + participant_id;
+    std::string topic_frame = "topic " + topic;
+    std::replace(participant_frame.begin(), participant_frame.end(), ';', ':');
+    std::replace(topic_frame.begin(), topic_frame.end(), ';', ':');
+
+    return participant_frame + ";" + topic_frame;
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
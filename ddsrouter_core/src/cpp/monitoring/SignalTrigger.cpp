@@ -0,0 +1,185 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file SignalTrigger.cpp
+ *
+ */
+
+#if defined(__linux__)
+#include <signal.h>
+#endif // defined(__linux__)
+
+#include <cerrno>
+#include <cstring>
+
+#include <cpp_utils/exception/InitializationException.hpp>
+#include <cpp_utils/Formatter.hpp>
+#include <cpp_utils/Log.hpp>
+
+#include <ddsrouter_core/monitoring/SignalTrigger.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+#if defined(__linux__)
+
+namespace {
+
+//! Trigger of each signal. nullptr if the signal triggers nothing.
+std::atomic<SignalTrigger*> signal_triggers[NSIG];
+
+void handle_signal(
+        int signal)
+{
+    SignalTrigger* signal_trigger = signal_triggers[signal].load(std::memory_order_acquire);
+    if (signal_trigger)
+    {
+        signal_trigger->trigger();
+    }
+}
+
+} /* namespace */
+
+SignalTrigger::SignalTrigger(
+        std::function<void()> callback)
+    : callback_(std::move(callback))
+    , stop_(false)
+    , triggered_(false)
+    , signal_(0)
+    , previous_()
+{
+    sem_init(&semaphore_, 0, 0);
+    thread_ = std::thread(&SignalTrigger::routine_, this);
+}
+
+SignalTrigger::~SignalTrigger()
+{
+    if (signal_ != 0)
+    {
+        sigaction(signal_, &previous_, nullptr);
+        signal_triggers[signal_].store(nullptr, std::memory_order_release);
+    }
+
+    stop_.store(true);
+    sem_post(&semaphore_);
+
+    thread_.join();
+    sem_destroy(&semaphore_);
+}
+
+void SignalTrigger::trigger() noexcept
+{
+    if (!triggered_.exchange(true))
+    {
+        sem_post(&semaphore_);
+    }
+}
+
+void SignalTrigger::trigger_on_signal(
+        int signal)
+{
+    if (signal <= 0 || signal >= NSIG)
+    {
+        throw utils::InitializationException(utils::Formatter() << "Invalid signal " << signal << ".");
+    }
+
+    SignalTrigger* expected = nullptr;
+    if (!signal_triggers[signal].compare_exchange_strong(expected, this))
+    {
+        throw utils::InitializationException(utils::Formatter()
+                      << "Signal " << signal << " already triggers another callback.");
+    }
+
+    struct sigaction action{};
+    action.sa_handler = handle_signal;
+    action.sa_flags = SA_RESTART;
+    sigemptyset(&action.sa_mask);
+
+    if (sigaction(signal, &action, &previous_) != 0)
+    {
+        signal_triggers[signal].store(nullptr, std::memory_order_release);
+        throw utils::InitializationException(utils::Formatter()
+                      << "Failed to handle signal " << signal << ": " << std::strerror(errno));
+    }
+
+    signal_ = signal;
+}
+
+void SignalTrigger::routine_() noexcept
+{
+    while (true)
+    {
+        if (sem_wait(&semaphore_) != 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            return;
+        }
+
+        if (stop_.load())
+        {
+            return;
+        }
+
+        try
+        {
+            callback_();
+        }
+        catch (const std::exception& e)
+        {
+            logWarning(DDSROUTER_MONITOR, "Failed to run the callback triggered: " << e.what());
+        }
+
+        triggered_.store(false);
+    }
+}
+
+#else
+
+SignalTrigger::SignalTrigger(
+        std::function<void()> callback)
+    : callback_(std::move(callback))
+    , stop_(false)
+    , triggered_(false)
+    , signal_(0)
+{
+}
+
+SignalTrigger::~SignalTrigger()
+{
+}
+
+void SignalTrigger::trigger() noexcept
+{
+}
+
+void SignalTrigger::trigger_on_signal(
+        int /* signal */)
+{
+    logWarning(DDSROUTER_MONITOR, "Triggering by signals is only supported in Linux.");
+}
+
+void SignalTrigger::routine_() noexcept
+{
+}
+
+#endif // defined(__linux__)
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
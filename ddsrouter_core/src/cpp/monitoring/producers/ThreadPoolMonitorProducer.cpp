@@ -0,0 +1,112 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ThreadPoolMonitorProducer.cpp
+ *
+ */
+
+#include <cpp_utils/Log.hpp>
+
+#include <ddsrouter_core/monitoring/producers/ThreadPoolMonitorProducer.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+ThreadPoolMonitorProducer::ThreadPoolMonitorProducer(
+        const std::shared_ptr<ThreadPoolInstrumentation>& instrumentation,
+        utils::Duration_ms period)
+    : instrumentation_(instrumentation)
+{
+    if (period > 0)
+    {
+        logDebug(DDSROUTER_MONITOR, "Monitoring the thread pool every " << period << " ms.");
+
+        event_handler_ = std::make_unique<utils::event::PeriodicEventHandler>(
+            [this]()
+            {
+                produce_and_consume();
+            },
+            period);
+    }
+}
+
+ThreadPoolMonitorProducer::~ThreadPoolMonitorProducer()
+{
+    event_handler_.reset();
+}
+
+void ThreadPoolMonitorProducer::produce_and_consume()
+{
+    produce();
+    consume();
+}
+
+void ThreadPoolMonitorProducer::produce()
+{
+    std::vector<SlotStatistics> current = instrumentation_->statistics();
+
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    data_ = current;
+
+    // Slots are only appended, so the same index is the same slot in every production
+    for (std::size_t i = 0; i < previous_.size() && i < data_.size(); ++i)
+    {
+        data_[i].enqueued -= previous_[i].enqueued;
+        data_[i].executed -= previous_[i].executed;
+        data_[i].messages -= previous_[i].messages;
+        data_[i].bytes -= previous_[i].bytes;
+        data_[i].queue_latency_us -= previous_[i].queue_latency_us;
+        data_[i].task_time_us -= previous_[i].task_time_us;
+    }
+
+    previous_ = std::move(current);
+}
+
+void ThreadPoolMonitorProducer::consume()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    for (const auto& slot : data_)
+    {
+        if (slot.enqueued == 0 && slot.executed == 0)
+        {
+            continue;
+        }
+
+        const uint64_t queue_latency_us = slot.executed > 0 ? slot.queue_latency_us / slot.executed : 0;
+        const uint64_t task_time_us = slot.executed > 0 ? slot.task_time_us / slot.executed : 0;
+
+        logInfo(MONITOR_DATA,
+                "Thread pool slot of participant " << slot.participant_id << " in topic " << slot.topic << ": "
+                                                   << slot.enqueued << " enqueued, " << slot.executed
+                                                   << " executed, " << slot.messages << " messages ("
+                                                   << slot.bytes << " bytes), queue latency " << queue_latency_us
+                                                   << " us (max " << slot.max_queue_latency_us << " us), task time "
+                                                   << task_time_us << " us (max " << slot.max_task_time_us
+                                                   << " us), max queue depth " << slot.max_queue_depth << ".");
+    }
+}
+
+std::vector<SlotStatistics> ThreadPoolMonitorProducer::data() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return data_;
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
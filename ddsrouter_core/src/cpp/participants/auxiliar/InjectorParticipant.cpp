@@ -0,0 +1,259 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file InjectorParticipant.cpp
+ *
+ */
+
+#include <cstring>
+#include <random>
+
+#include <cpp_utils/Log.hpp>
+
+#include <ddspipe_participants/reader/auxiliar/BlankReader.hpp>
+#include <ddspipe_participants/writer/auxiliar/BlankWriter.hpp>
+
+#include <ddsrouter_core/participants/auxiliar/InjectorParticipant.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+namespace {
+
+//! Time to wait for the DDS Router to create the reader of an announced topic before announcing it again.
+constexpr std::chrono::milliseconds INJECTOR_ANNOUNCE_PERIOD(500);
+
+//! Times a topic is announced before considering that the DDS Router does not forward it.
+constexpr unsigned int INJECTOR_ANNOUNCE_ATTEMPTS = 4;
+
+//! Random number drawn once per process, that tells apart the guids of this process from the ones of others.
+uint32_t process_nonce()
+{
+    static const uint32_t nonce = std::random_device()();
+    return nonce;
+}
+
+} /* namespace */
+
+InjectorParticipant::InjectorParticipant(
+        const ddspipe::core::types::ParticipantId& id,
+        const std::shared_ptr<ddspipe::core::PayloadPool>& payload_pool,
+        const std::shared_ptr<ddspipe::core::DiscoveryDatabase>& discovery_database,
+        uint8_t guid_tag)
+    : id_(id)
+    , payload_pool_(payload_pool)
+    , discovery_database_(discovery_database)
+    , guid_tag_(guid_tag)
+    , running_(false)
+    , entity_counter_(0)
+{
+}
+
+InjectorParticipant::~InjectorParticipant()
+{
+    for (const auto& endpoint : announced_)
+    {
+        discovery_database_->erase_endpoint(endpoint);
+    }
+}
+
+ddspipe::core::types::ParticipantId InjectorParticipant::id() const noexcept
+{
+    return id_;
+}
+
+bool InjectorParticipant::is_repeater() const noexcept
+{
+    return false;
+}
+
+bool InjectorParticipant::is_rtps_kind() const noexcept
+{
+    return false;
+}
+
+ddspipe::core::types::TopicQoS InjectorParticipant::topic_qos() const noexcept
+{
+    return ddspipe::core::types::TopicQoS();
+}
+
+std::shared_ptr<ddspipe::core::IWriter> InjectorParticipant::create_writer(
+        const ddspipe::core::ITopic& /* topic */)
+{
+    // Nothing is written in an injector
+    return std::make_shared<ddspipe::participants::BlankWriter>();
+}
+
+std::shared_ptr<ddspipe::core::IReader> InjectorParticipant::create_reader(
+        const ddspipe::core::ITopic& topic)
+{
+    const auto* dds_topic = dynamic_cast<const ddspipe::core::types::DdsTopic*>(&topic);
+    if (!dds_topic)
+    {
+        logDebug(DDSROUTER_INJECTOR, "Not creating Reader for topic " << topic.topic_name());
+        return std::make_shared<ddspipe::participants::BlankReader>();
+    }
+
+    auto reader = std::make_shared<InjectorReader>(
+        id(),
+        *dds_topic,
+        new_guid_(ddspipe::core::types::EndpointKind::reader),
+        [this]()
+        {
+            // Take the lock so the injecting thread does not miss the notification between check and wait
+            std::lock_guard<std::mutex> lock(mutex_);
+            cv_.notify_all();
+        });
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        readers_[{dds_topic->m_topic_name, dds_topic->type_name}] = reader;
+    }
+    cv_.notify_all();
+
+    return reader;
+}
+
+void InjectorParticipant::announce_(
+        InjectedTopic& topic)
+{
+    auto& endpoint = topic.endpoint;
+    endpoint.kind = ddspipe::core::types::EndpointKind::writer;
+    endpoint.guid = new_guid_(endpoint.kind);
+    endpoint.topic = topic.topic;
+    endpoint.active = true;
+    endpoint.discoverer_participant_id = id();
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        announced_.push_back(endpoint);
+    }
+
+    logInfo(DDSROUTER_INJECTOR, "Participant " << id() << " announcing topic " << topic.topic << ".");
+    discovery_database_->add_endpoint(endpoint);
+}
+
+bool InjectorParticipant::wait_forwarding_(
+        InjectedTopic& topic,
+        std::chrono::steady_clock::duration& waited) noexcept
+{
+    waited = std::chrono::steady_clock::duration::zero();
+
+    if (topic.skipped)
+    {
+        return false;
+    }
+
+    if (topic.reader && topic.reader->forwarding())
+    {
+        return true;
+    }
+
+    const auto wait_start = std::chrono::steady_clock::now();
+    const TopicKey key{topic.topic.m_topic_name, topic.topic.type_name};
+
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    // The DDS Router may not be listening to discovery yet when the topic is announced, so announce it again
+    for (unsigned int attempt = 1; !topic.reader; ++attempt)
+    {
+        cv_.wait_for(lock, INJECTOR_ANNOUNCE_PERIOD, [&]()
+                {
+                    return readers_.find(key) != readers_.end() || !running_;
+                });
+
+        if (!running_)
+        {
+            return false;
+        }
+
+        auto reader_it = readers_.find(key);
+        if (reader_it != readers_.end())
+        {
+            topic.reader = reader_it->second;
+        }
+        else if (attempt >= INJECTOR_ANNOUNCE_ATTEMPTS)
+        {
+            logWarning(DDSROUTER_INJECTOR,
+                    "Topic " << topic.topic << " is not forwarded by the DDS Router, skipping its messages.");
+            topic.skipped = true;
+            return false;
+        }
+        else
+        {
+            lock.unlock();
+            discovery_database_->update_endpoint(topic.endpoint);
+            lock.lock();
+        }
+    }
+
+    cv_.wait(lock, [&]()
+            {
+                return topic.reader->forwarding() || !running_;
+            });
+
+    waited = std::chrono::steady_clock::now() - wait_start;
+
+    return running_;
+}
+
+bool InjectorParticipant::wait_until_(
+        const std::chrono::steady_clock::time_point& time) noexcept
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    return !cv_.wait_until(lock, time, [this]()
+                   {
+                       return !running_;
+                   });
+}
+
+void InjectorParticipant::stop_() noexcept
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        running_ = false;
+    }
+    cv_.notify_all();
+}
+
+ddspipe::core::types::Guid InjectorParticipant::new_guid_(
+        ddspipe::core::types::EndpointKind kind) noexcept
+{
+    ddspipe::core::types::Guid guid;
+
+    // Prefix: eProsima vendor id, the tag of the injector and process nonce
+    const uint32_t nonce = process_nonce();
+    guid.guidPrefix.value[0] = 0x01;
+    guid.guidPrefix.value[1] = 0x0f;
+    guid.guidPrefix.value[2] = guid_tag_;
+    std::memcpy(&guid.guidPrefix.value[4], &nonce, sizeof(nonce));
+
+    // Several injectors in the same process are told apart by their address
+    const uint32_t instance = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(this) >> 4);
+    std::memcpy(&guid.guidPrefix.value[8], &instance, sizeof(instance));
+
+    const uint32_t entity = ++entity_counter_;
+    guid.entityId.value[0] = static_cast<uint8_t>(entity >> 16);
+    guid.entityId.value[1] = static_cast<uint8_t>(entity >> 8);
+    guid.entityId.value[2] = static_cast<uint8_t>(entity);
+    guid.entityId.value[3] = kind == ddspipe::core::types::EndpointKind::writer ? 0x02 : 0x07;
+
+    return guid;
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,68 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file InjectorReader.cpp
+ *
+ */
+
+#include <ddsrouter_core/participants/auxiliar/InjectorReader.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+InjectorReader::InjectorReader(
+        const ddspipe::core::types::ParticipantId& participant_id,
+        const ddspipe::core::types::DdsTopic& topic,
+        const ddspipe::core::types::Guid& guid,
+        std::function<void()> on_enabled_change)
+    : ddspipe::participants::InternalReader(participant_id)
+    , topic_(topic)
+    , guid_(guid)
+    , on_enabled_change_(std::move(on_enabled_change))
+    , forwarding_(false)
+{
+}
+
+ddspipe::core::types::Guid InjectorReader::guid() const
+{
+    return guid_;
+}
+
+ddspipe::core::types::DdsTopic InjectorReader::topic() const
+{
+    return topic_;
+}
+
+bool InjectorReader::forwarding() const noexcept
+{
+    return forwarding_.load();
+}
+
+void InjectorReader::enable_nts_() noexcept
+{
+    forwarding_ = true;
+    on_enabled_change_();
+}
+
+void InjectorReader::disable_nts_() noexcept
+{
+    forwarding_ = false;
+    on_enabled_change_();
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,43 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file GatedParticipant.cpp
+ *
+ */
+
+#include <ddsrouter_core/participants/concurrency/GatedParticipant.hpp>
+#include <ddsrouter_core/participants/concurrency/GatedReader.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+GatedParticipant::GatedParticipant(
+        const std::shared_ptr<ddspipe::core::IParticipant>& participant,
+        const std::shared_ptr<ConcurrencyGate>& gate)
+    : ParticipantDecorator(participant)
+    , gate_(gate)
+{
+}
+
+std::shared_ptr<ddspipe::core::IReader> GatedParticipant::create_reader(
+        const ddspipe::core::ITopic& topic)
+{
+    return std::make_shared<GatedReader>(participant_->create_reader(topic), gate_);
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,112 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file GatedReader.cpp
+ *
+ */
+
+#include <chrono>
+
+#include <ddsrouter_core/participants/concurrency/GatedReader.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+GatedReader::GatedReader(
+        const std::shared_ptr<ddspipe::core::IReader>& reader,
+        const std::shared_ptr<ConcurrencyGate>& gate)
+    : ReaderDecorator(reader)
+    , gate_(gate)
+    , pending_since_(0)
+    , holding_gate_(false)
+{
+}
+
+GatedReader::~GatedReader()
+{
+    release_gate_();
+}
+
+void GatedReader::disable() noexcept
+{
+    ReaderDecorator::disable();
+
+    // The transmission may have stopped before the reader ran out of data
+    release_gate_();
+}
+
+void GatedReader::set_on_data_available_callback(
+        std::function<void()> on_data_available_lambda) noexcept
+{
+    reader_->set_on_data_available_callback(
+        [this, on_data_available_lambda]()
+        {
+            // Only the oldest data not taken counts, as the thread that takes it takes the rest too
+            int64_t expected = 0;
+            if (pending_since_.compare_exchange_strong(expected, now_us_()))
+            {
+                gate_->data_pending();
+            }
+
+            on_data_available_lambda();
+        });
+}
+
+utils::ReturnCode GatedReader::take(
+        std::unique_ptr<ddspipe::core::IRoutingData>& data) noexcept
+{
+    // Only one thread takes the data of a reader at a time, so the gate is held by the reader and not by the thread
+    if (!holding_gate_.load(std::memory_order_acquire))
+    {
+        gate_->enter();
+        holding_gate_.store(true, std::memory_order_release);
+    }
+
+    const int64_t pending_since = pending_since_.exchange(0);
+    if (pending_since > 0)
+    {
+        const int64_t wait = now_us_() - pending_since;
+        gate_->data_taken(wait > 0 ? static_cast<uint64_t>(wait) : 0);
+    }
+
+    utils::ReturnCode ret = reader_->take(data);
+
+    if (ret != utils::ReturnCode::RETCODE_OK)
+    {
+        // The transmission is over, let another thread in
+        release_gate_();
+    }
+
+    return ret;
+}
+
+int64_t GatedReader::now_us_() noexcept
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void GatedReader::release_gate_() noexcept
+{
+    if (holding_gate_.exchange(false, std::memory_order_acq_rel))
+    {
+        gate_->exit();
+    }
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,71 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ParticipantDecorator.cpp
+ *
+ */
+
+#include <ddsrouter_core/participants/decorator/ParticipantDecorator.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+ParticipantDecorator::ParticipantDecorator(
+        const std::shared_ptr<ddspipe::core::IParticipant>& participant)
+    : participant_(participant)
+{
+}
+
+ddspipe::core::types::ParticipantId ParticipantDecorator::id() const noexcept
+{
+    return participant_->id();
+}
+
+bool ParticipantDecorator::is_repeater() const noexcept
+{
+    return participant_->is_repeater();
+}
+
+bool ParticipantDecorator::is_rtps_kind() const noexcept
+{
+    return participant_->is_rtps_kind();
+}
+
+ddspipe::core::types::TopicQoS ParticipantDecorator::topic_qos() const noexcept
+{
+    return participant_->topic_qos();
+}
+
+std::shared_ptr<ddspipe::core::IWriter> ParticipantDecorator::create_writer(
+        const ddspipe::core::ITopic& topic)
+{
+    return participant_->create_writer(topic);
+}
+
+std::shared_ptr<ddspipe::core::IReader> ParticipantDecorator::create_reader(
+        const ddspipe::core::ITopic& topic)
+{
+    return participant_->create_reader(topic);
+}
+
+std::shared_ptr<ddspipe::core::IParticipant> ParticipantDecorator::inner() const noexcept
+{
+    return participant_;
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,86 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ReaderDecorator.cpp
+ *
+ */
+
+#include <ddsrouter_core/participants/decorator/ReaderDecorator.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+ReaderDecorator::ReaderDecorator(
+        const std::shared_ptr<ddspipe::core::IReader>& reader)
+    : reader_(reader)
+{
+}
+
+void ReaderDecorator::enable() noexcept
+{
+    reader_->enable();
+}
+
+void ReaderDecorator::disable() noexcept
+{
+    reader_->disable();
+}
+
+void ReaderDecorator::set_on_data_available_callback(
+        std::function<void()> on_data_available_lambda) noexcept
+{
+    reader_->set_on_data_available_callback(on_data_available_lambda);
+}
+
+void ReaderDecorator::unset_on_data_available_callback() noexcept
+{
+    reader_->unset_on_data_available_callback();
+}
+
+utils::ReturnCode ReaderDecorator::take(
+        std::unique_ptr<ddspipe::core::IRoutingData>& data) noexcept
+{
+    return reader_->take(data);
+}
+
+ddspipe::core::types::Guid ReaderDecorator::guid() const
+{
+    return reader_->guid();
+}
+
+fastrtps::RecursiveTimedMutex& ReaderDecorator::get_rtps_mutex() const
+{
+    return reader_->get_rtps_mutex();
+}
+
+uint64_t ReaderDecorator::get_unread_count() const
+{
+    return reader_->get_unread_count();
+}
+
+ddspipe::core::types::DdsTopic ReaderDecorator::topic() const
+{
+    return reader_->topic();
+}
+
+ddspipe::core::types::ParticipantId ReaderDecorator::participant_id() const
+{
+    return reader_->participant_id();
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
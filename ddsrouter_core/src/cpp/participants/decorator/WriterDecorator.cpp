@@ -0,0 +1,50 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file WriterDecorator.cpp
+ *
+ */
+
+#include <ddsrouter_core/participants/decorator/WriterDecorator.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+WriterDecorator::WriterDecorator(
+        const std::shared_ptr<ddspipe::core::IWriter>& writer)
+    : writer_(writer)
+{
+}
+
+void WriterDecorator::enable() noexcept
+{
+    writer_->enable();
+}
+
+void WriterDecorator::disable() noexcept
+{
+    writer_->disable();
+}
+
+utils::ReturnCode WriterDecorator::write(
+        ddspipe::core::IRoutingData& data) noexcept
+{
+    return writer_->write(data);
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
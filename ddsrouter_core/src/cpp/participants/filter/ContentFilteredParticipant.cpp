@@ -0,0 +1,64 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ContentFilteredParticipant.cpp
+ *
+ */
+
+#include <cpp_utils/Log.hpp>
+
+#include <ddspipe_core/types/topic/dds/DdsTopic.hpp>
+
+#include <ddsrouter_core/participants/filter/ContentFilteredParticipant.hpp>
+#include <ddsrouter_core/participants/filter/ContentFilteredReader.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+ContentFilteredParticipant::ContentFilteredParticipant(
+        const std::shared_ptr<ddspipe::core::IParticipant>& participant,
+        const std::shared_ptr<ContentFilterEngine>& engine)
+    : ParticipantDecorator(participant)
+    , engine_(engine)
+{
+}
+
+std::shared_ptr<ddspipe::core::IReader> ContentFilteredParticipant::create_reader(
+        const ddspipe::core::ITopic& topic)
+{
+    std::shared_ptr<ddspipe::core::IReader> reader = participant_->create_reader(topic);
+
+    const auto* dds_topic = dynamic_cast<const ddspipe::core::types::DdsTopic*>(&topic);
+    if (!dds_topic)
+    {
+        return reader;
+    }
+
+    std::vector<std::shared_ptr<ContentFilter>> filters = engine_->filters(*dds_topic, id());
+    if (filters.empty())
+    {
+        return reader;
+    }
+
+    logDebug(DDSROUTER_CONTENT_FILTER,
+            "Filtering content of reader of participant " << id() << " in topic " << *dds_topic << ".");
+
+    return std::make_shared<ContentFilteredReader>(reader, filters);
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
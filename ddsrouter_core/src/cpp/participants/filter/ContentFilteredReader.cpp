@@ -0,0 +1,79 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ContentFilteredReader.cpp
+ *
+ */
+
+#include <ddsrouter_core/participants/decorator/routing_data.hpp>
+#include <ddsrouter_core/participants/filter/ContentFilteredReader.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+ContentFilteredReader::ContentFilteredReader(
+        const std::shared_ptr<ddspipe::core::IReader>& reader,
+        const std::vector<std::shared_ptr<ContentFilter>>& filters)
+    : ReaderDecorator(reader)
+    , filters_(filters)
+{
+}
+
+utils::ReturnCode ContentFilteredReader::take(
+        std::unique_ptr<ddspipe::core::IRoutingData>& data) noexcept
+{
+    while (true)
+    {
+        utils::ReturnCode ret = reader_->take(data);
+
+        if (ret != utils::ReturnCode::RETCODE_OK)
+        {
+            return ret;
+        }
+
+        if (accept_(*data))
+        {
+            return ret;
+        }
+
+        // Release the sample, so its payload returns to the pool before reaching any writer
+        data.reset();
+    }
+}
+
+bool ContentFilteredReader::accept_(
+        const ddspipe::core::IRoutingData& data) noexcept
+{
+    const auto* rtps_data = as_rtps_data(data);
+    if (!rtps_data || !carries_user_data(*rtps_data))
+    {
+        return true;
+    }
+
+    for (const auto& filter : filters_)
+    {
+        if (!filter->accept(rtps_data->payload.data, rtps_data->payload.length))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,249 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file GeneratorParticipant.cpp
+ *
+ */
+
+#include <algorithm>
+#include <cstring>
+
+#include <fastdds/rtps/common/ChangeKind_t.hpp>
+#include <fastdds/rtps/common/Time_t.h>
+
+#include <cpp_utils/Log.hpp>
+
+#include <ddspipe_core/types/data/RtpsPayloadData.hpp>
+
+#include <ddsrouter_core/efficiency/payload/PooledRtpsPayloadData.hpp>
+#include <ddsrouter_core/logging/BinaryLog.hpp>
+#include <ddsrouter_core/participants/generator/GeneratedPayload.hpp>
+#include <ddsrouter_core/participants/generator/GeneratorParticipant.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+namespace {
+
+//! Delay after which a topic that cannot keep its rate stops trying to catch up.
+constexpr std::chrono::seconds GENERATOR_MAX_DELAY(1);
+
+} /* namespace */
+
+GeneratorParticipant::GeneratorParticipant(
+        const std::shared_ptr<GeneratorParticipantConfiguration>& participant_configuration,
+        const std::shared_ptr<ddspipe::core::PayloadPool>& payload_pool,
+        const std::shared_ptr<ddspipe::core::DiscoveryDatabase>& discovery_database)
+    : InjectorParticipant(participant_configuration->id, payload_pool, discovery_database, 'G')
+    , configuration_(participant_configuration)
+    , random_(std::random_device()())
+    , generated_(0)
+    , finished_(false)
+{
+}
+
+GeneratorParticipant::~GeneratorParticipant()
+{
+    stop_();
+
+    if (generate_thread_.joinable())
+    {
+        generate_thread_.join();
+    }
+}
+
+void GeneratorParticipant::init()
+{
+    for (const auto& topic_configuration : configuration_->topics)
+    {
+        GeneratedTopic topic;
+        topic.configuration = topic_configuration;
+        topic.topic.m_topic_name = topic_configuration.topic_name;
+        topic.topic.type_name = topic_configuration.effective_type_name();
+        topic.topic.topic_qos.keyed = topic_configuration.keys > 0;
+
+        if (topic_configuration.rate > 0)
+        {
+            topic.burst_period = std::chrono::nanoseconds(
+                static_cast<int64_t>(1e9 * topic_configuration.burst / topic_configuration.rate));
+        }
+
+        topics_.push_back(std::move(topic));
+    }
+
+    if (topics_.empty())
+    {
+        finished_ = true;
+        return;
+    }
+
+    for (auto& topic : topics_)
+    {
+        announce_(topic);
+    }
+
+    running_ = true;
+    generate_thread_ = std::thread(&GeneratorParticipant::generate_routine_, this);
+}
+
+uint64_t GeneratorParticipant::generated() const noexcept
+{
+    return generated_.load();
+}
+
+bool GeneratorParticipant::finished() const noexcept
+{
+    return finished_.load();
+}
+
+void GeneratorParticipant::generate_routine_() noexcept
+{
+    const auto start = std::chrono::steady_clock::now();
+    for (auto& topic : topics_)
+    {
+        topic.next_burst = start;
+    }
+
+    while (running_)
+    {
+        // Next topic to generate: the one whose burst is due first
+        GeneratedTopic* next = nullptr;
+        for (auto& topic : topics_)
+        {
+            if (!topic.done && (!next || topic.next_burst < next->next_burst))
+            {
+                next = &topic;
+            }
+        }
+
+        if (!next)
+        {
+            break;
+        }
+
+        if (next->burst_period.count() > 0 && !wait_until_(next->next_burst))
+        {
+            break;
+        }
+
+        std::chrono::steady_clock::duration waited;
+        if (!wait_forwarding_(*next, waited))
+        {
+            // Not forwarded, or stopping
+            next->done = true;
+            continue;
+        }
+
+        generate_burst_(*next);
+
+        const auto now = std::chrono::steady_clock::now();
+        if (next->burst_period.count() == 0 || waited.count() > 0)
+        {
+            // As fast as possible, or the generation has just been resumed
+            next->next_burst = now;
+        }
+        else
+        {
+            next->next_burst += next->burst_period;
+
+            if (now - next->next_burst > GENERATOR_MAX_DELAY)
+            {
+                logDebug(DDSROUTER_GENERATOR,
+                        "Generator " << id() << " cannot keep the rate of topic " << next->topic << ".");
+                next->next_burst = now;
+            }
+        }
+    }
+
+    finished_ = true;
+    logInfo(DDSROUTER_GENERATOR, "Generator " << id() << " finished, " << generated() << " messages generated.");
+}
+
+void GeneratorParticipant::generate_burst_(
+        GeneratedTopic& topic) noexcept
+{
+    for (uint32_t i = 0; i < topic.configuration.burst; ++i)
+    {
+        if (topic.configuration.samples > 0 && topic.sequence >= topic.configuration.samples)
+        {
+            topic.done = true;
+            return;
+        }
+
+        if (!generate_message_(topic))
+        {
+            return;
+        }
+    }
+
+    if (topic.configuration.samples > 0 && topic.sequence >= topic.configuration.samples)
+    {
+        topic.done = true;
+    }
+}
+
+bool GeneratorParticipant::generate_message_(
+        GeneratedTopic& topic) noexcept
+{
+    const auto& configuration = topic.configuration;
+
+    uint32_t size = configuration.size;
+    if (configuration.max_size > configuration.size)
+    {
+        size = std::uniform_int_distribution<uint32_t>(configuration.size, configuration.max_size)(random_);
+    }
+
+    auto data = std::make_unique<PooledRtpsPayloadData>();
+
+    if (!payload_pool_->get_payload(size, data->payload))
+    {
+        logBinaryWarning(DDSROUTER_GENERATOR, "Failed to allocate payload for generated message in topic {}.", topic.topic);
+        return false;
+    }
+
+    data->payload_owner = payload_pool_.get();
+    data->payload.length = size;
+
+    const uint64_t sequence = ++topic.sequence;
+
+    // Keys go from 1 so no instance handle is all zeros
+    const uint32_t key = configuration.keys > 0 ? static_cast<uint32_t>((sequence - 1) % configuration.keys) + 1 : 0;
+
+    std::memset(data->payload.data + GENERATED_PAYLOAD_MIN_SIZE, static_cast<uint8_t>(sequence),
+            size - GENERATED_PAYLOAD_MIN_SIZE);
+    write_generated_payload_header(data->payload.data, size, key, sequence, generated_payload_now());
+
+    if (key > 0)
+    {
+        // Same key hash as DDS for a key of 4 bytes: the key in big endian, padded with zeros
+        data->instanceHandle.value[0] = static_cast<uint8_t>(key >> 24);
+        data->instanceHandle.value[1] = static_cast<uint8_t>(key >> 16);
+        data->instanceHandle.value[2] = static_cast<uint8_t>(key >> 8);
+        data->instanceHandle.value[3] = static_cast<uint8_t>(key);
+    }
+
+    data->kind = fastrtps::rtps::ALIVE;
+    fastrtps::rtps::Time_t::now(data->source_timestamp);
+
+    topic.reader->simulate_data_reception(std::move(data));
+    ++generated_;
+
+    return true;
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,416 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file InProcessChannel.cpp
+ *
+ */
+
+#include <atomic>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include <fastdds/rtps/common/Time_t.h>
+
+#include <cpp_utils/exception/InitializationException.hpp>
+#include <cpp_utils/Log.hpp>
+
+#include <ddsrouter_core/efficiency/payload/PooledRtpsPayloadData.hpp>
+#include <ddsrouter_core/logging/BinaryLog.hpp>
+#include <ddsrouter_core/participants/inprocess/InProcessChannel.hpp>
+#include <ddsrouter_core/participants/inprocess/InProcessReader.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+namespace {
+
+//! Number of channels created in this process.
+std::atomic<uint32_t> channels_created(0);
+
+//! Random number drawn once per process, that tells apart the guids of this process from the ones of others.
+uint32_t process_nonce()
+{
+    static const uint32_t nonce = std::random_device()();
+    return nonce;
+}
+
+} /* namespace */
+
+std::shared_ptr<InProcessChannel> InProcessChannel::get(
+        const std::string& name)
+{
+    static std::mutex registry_mutex;
+    static std::map<std::string, std::weak_ptr<InProcessChannel>> registry;
+
+    std::lock_guard<std::mutex> lock(registry_mutex);
+
+    auto channel = registry[name].lock();
+    if (!channel)
+    {
+        channel = std::make_shared<InProcessChannel>(name);
+        registry[name] = channel;
+    }
+
+    return channel;
+}
+
+InProcessChannel::InProcessChannel(
+        const std::string& name)
+    : name_(name)
+    , index_(channels_created.fetch_add(1, std::memory_order_relaxed))
+    , entity_counter_(0)
+{
+}
+
+InProcessChannel::~InProcessChannel()
+{
+    detach();
+}
+
+const std::string& InProcessChannel::name() const noexcept
+{
+    return name_;
+}
+
+bool InProcessChannel::attached() const noexcept
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return discovery_database_ != nullptr;
+}
+
+void InProcessChannel::announce_publication(
+        const ddspipe::core::types::DdsTopic& topic)
+{
+    announce_(publications_, topic, ddspipe::core::types::EndpointKind::writer);
+}
+
+void InProcessChannel::withdraw_publication(
+        const ddspipe::core::types::DdsTopic& topic)
+{
+    withdraw_(publications_, topic);
+}
+
+void InProcessChannel::subscribe(
+        const ddspipe::core::types::DdsTopic& topic,
+        DataCallback callback)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        callbacks_[key_(topic)] = std::make_shared<DataCallback>(std::move(callback));
+    }
+
+    announce_(subscriptions_, topic, ddspipe::core::types::EndpointKind::reader);
+}
+
+void InProcessChannel::unsubscribe(
+        const ddspipe::core::types::DdsTopic& topic)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        callbacks_.erase(key_(topic));
+    }
+
+    withdraw_(subscriptions_, topic);
+}
+
+std::unique_ptr<ddspipe::core::types::RtpsPayloadData> InProcessChannel::loan(
+        uint32_t size)
+{
+    std::shared_ptr<ddspipe::core::PayloadPool> payload_pool;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        payload_pool = payload_pool_;
+    }
+
+    if (!payload_pool)
+    {
+        return nullptr;
+    }
+
+    auto data = std::make_unique<PooledRtpsPayloadData>();
+
+    if (!payload_pool->get_payload(size, data->payload))
+    {
+        logBinaryWarning(DDSROUTER_INPROCESS, "Failed to loan a payload of {} bytes in channel {}.", size, name_);
+        return nullptr;
+    }
+
+    data->payload_owner = payload_pool.get();
+    fastrtps::rtps::Time_t::now(data->source_timestamp);
+
+    return data;
+}
+
+utils::ReturnCode InProcessChannel::publish(
+        const ddspipe::core::types::DdsTopic& topic,
+        std::unique_ptr<ddspipe::core::types::RtpsPayloadData>&& data)
+{
+    if (!data)
+    {
+        return utils::ReturnCode::RETCODE_BAD_PARAMETER;
+    }
+
+    std::shared_ptr<InProcessReader> reader;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = readers_.find(topic);
+        if (it != readers_.end())
+        {
+            reader = it->second.lock();
+        }
+    }
+
+    if (!reader)
+    {
+        return utils::ReturnCode::RETCODE_NOT_ENABLED;
+    }
+
+    reader->simulate_data_reception(std::move(data));
+    return utils::ReturnCode::RETCODE_OK;
+}
+
+utils::ReturnCode InProcessChannel::publish(
+        const ddspipe::core::types::DdsTopic& topic,
+        const void* serialized_data,
+        uint32_t size)
+{
+    auto data = loan(size);
+    if (!data)
+    {
+        return utils::ReturnCode::RETCODE_NOT_ENABLED;
+    }
+
+    std::memcpy(data->payload.data, serialized_data, size);
+    data->payload.length = size;
+
+    return publish(topic, std::move(data));
+}
+
+void InProcessChannel::attach(
+        const ddspipe::core::types::ParticipantId& participant_id,
+        const std::shared_ptr<ddspipe::core::PayloadPool>& payload_pool,
+        const std::shared_ptr<ddspipe::core::DiscoveryDatabase>& discovery_database)
+{
+    std::vector<ddspipe::core::types::Endpoint> endpoints;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        if (discovery_database_)
+        {
+            throw utils::InitializationException(utils::Formatter()
+                          << "In process channel " << name_ << " is already attached to participant "
+                          << participant_id_ << ".");
+        }
+
+        participant_id_ = participant_id;
+        payload_pool_ = payload_pool;
+        discovery_database_ = discovery_database;
+
+        for (auto* application_endpoints : {&publications_, &subscriptions_})
+        {
+            for (auto& it : *application_endpoints)
+            {
+                it.second.discoverer_participant_id = participant_id_;
+                endpoints.push_back(it.second);
+            }
+        }
+    }
+
+    // The database is used without the lock, as the DDS Pipe may create readers (and register them) in reaction
+    for (const auto& endpoint : endpoints)
+    {
+        discovery_database->add_endpoint(endpoint);
+    }
+
+    logInfo(DDSROUTER_INPROCESS, "In process channel " << name_ << " attached to participant " << participant_id << ".");
+}
+
+void InProcessChannel::detach()
+{
+    std::shared_ptr<ddspipe::core::DiscoveryDatabase> discovery_database;
+    std::vector<ddspipe::core::types::Endpoint> endpoints;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        if (!discovery_database_)
+        {
+            return;
+        }
+
+        discovery_database.swap(discovery_database_);
+        payload_pool_.reset();
+        readers_.clear();
+        participant_id_.clear();
+
+        for (auto* application_endpoints : {&publications_, &subscriptions_})
+        {
+            for (const auto& it : *application_endpoints)
+            {
+                endpoints.push_back(it.second);
+            }
+        }
+    }
+
+    for (const auto& endpoint : endpoints)
+    {
+        discovery_database->erase_endpoint(endpoint);
+    }
+}
+
+void InProcessChannel::register_reader(
+        const ddspipe::core::types::DdsTopic& topic,
+        const std::shared_ptr<InProcessReader>& reader)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    readers_[key_(topic)] = reader;
+}
+
+void InProcessChannel::deliver(
+        const ddspipe::core::types::DdsTopic& topic,
+        const ddspipe::core::types::RtpsPayloadData& data)
+{
+    std::shared_ptr<DataCallback> callback;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = callbacks_.find(topic);
+        if (it != callbacks_.end())
+        {
+            callback = it->second;
+        }
+    }
+
+    // Called without the lock, so the application may use the channel inside the callback
+    if (callback)
+    {
+        (*callback)(topic, data);
+    }
+}
+
+ddspipe::core::types::Guid InProcessChannel::new_guid(
+        ddspipe::core::types::EndpointKind kind) noexcept
+{
+    ddspipe::core::types::Guid guid;
+
+    // Prefix: eProsima vendor id, 'P', process nonce and channel index
+    const uint32_t nonce = process_nonce();
+    guid.guidPrefix.value[0] = 0x01;
+    guid.guidPrefix.value[1] = 0x0f;
+    guid.guidPrefix.value[2] = 'P';
+    std::memcpy(&guid.guidPrefix.value[4], &nonce, sizeof(nonce));
+    std::memcpy(&guid.guidPrefix.value[8], &index_, sizeof(index_));
+
+    uint32_t entity;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        entity = ++entity_counter_;
+    }
+
+    guid.entityId.value[0] = static_cast<uint8_t>(entity >> 16);
+    guid.entityId.value[1] = static_cast<uint8_t>(entity >> 8);
+    guid.entityId.value[2] = static_cast<uint8_t>(entity);
+    guid.entityId.value[3] = kind == ddspipe::core::types::EndpointKind::writer ? 0x02 : 0x07;
+
+    return guid;
+}
+
+InProcessChannel::TopicKey InProcessChannel::key_(
+        const ddspipe::core::types::DdsTopic& topic)
+{
+    return {topic.m_topic_name, topic.type_name};
+}
+
+void InProcessChannel::announce_(
+        TopicMap<ddspipe::core::types::Endpoint>& endpoints,
+        const ddspipe::core::types::DdsTopic& topic,
+        ddspipe::core::types::EndpointKind kind)
+{
+    const ddspipe::core::types::Guid guid = new_guid(kind);
+
+    std::shared_ptr<ddspipe::core::DiscoveryDatabase> discovery_database;
+    ddspipe::core::types::Endpoint endpoint;
+    bool exists;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        auto it = endpoints.find(topic);
+        exists = it != endpoints.end();
+
+        if (exists)
+        {
+            // Keep the guid, so the update refers to the same endpoint
+            it->second.topic = topic;
+        }
+        else
+        {
+            ddspipe::core::types::Endpoint new_endpoint;
+            new_endpoint.kind = kind;
+            new_endpoint.guid = guid;
+            new_endpoint.topic = topic;
+            new_endpoint.active = true;
+            it = endpoints.emplace(key_(topic), new_endpoint).first;
+        }
+
+        it->second.discoverer_participant_id = participant_id_;
+        endpoint = it->second;
+        discovery_database = discovery_database_;
+    }
+
+    if (!discovery_database)
+    {
+        // Announced when a participant attaches
+        return;
+    }
+
+    if (exists)
+    {
+        discovery_database->update_endpoint(endpoint);
+    }
+    else
+    {
+        discovery_database->add_endpoint(endpoint);
+    }
+}
+
+void InProcessChannel::withdraw_(
+        TopicMap<ddspipe::core::types::Endpoint>& endpoints,
+        const ddspipe::core::types::DdsTopic& topic)
+{
+    std::shared_ptr<ddspipe::core::DiscoveryDatabase> discovery_database;
+    ddspipe::core::types::Endpoint endpoint;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        auto it = endpoints.find(topic);
+        if (it == endpoints.end())
+        {
+            return;
+        }
+
+        endpoint = it->second;
+        endpoints.erase(it);
+        discovery_database = discovery_database_;
+    }
+
+    if (discovery_database)
+    {
+        discovery_database->erase_endpoint(endpoint);
+    }
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,113 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file InProcessParticipant.cpp
+ *
+ */
+
+#include <cpp_utils/Log.hpp>
+
+#include <ddspipe_core/types/topic/dds/DdsTopic.hpp>
+#include <ddspipe_participants/reader/auxiliar/BlankReader.hpp>
+#include <ddspipe_participants/writer/auxiliar/BlankWriter.hpp>
+
+#include <ddsrouter_core/participants/inprocess/InProcessParticipant.hpp>
+#include <ddsrouter_core/participants/inprocess/InProcessReader.hpp>
+#include <ddsrouter_core/participants/inprocess/InProcessWriter.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+InProcessParticipant::InProcessParticipant(
+        const std::shared_ptr<InProcessParticipantConfiguration>& participant_configuration,
+        const std::shared_ptr<ddspipe::core::PayloadPool>& payload_pool,
+        const std::shared_ptr<ddspipe::core::DiscoveryDatabase>& discovery_database)
+    : configuration_(participant_configuration)
+    , payload_pool_(payload_pool)
+    , discovery_database_(discovery_database)
+{
+}
+
+InProcessParticipant::~InProcessParticipant()
+{
+    if (channel_)
+    {
+        channel_->detach();
+    }
+}
+
+void InProcessParticipant::init()
+{
+    auto channel = InProcessChannel::get(configuration_->channel);
+    channel->attach(id(), payload_pool_, discovery_database_);
+    channel_ = channel;
+}
+
+ddspipe::core::types::ParticipantId InProcessParticipant::id() const noexcept
+{
+    return configuration_->id;
+}
+
+bool InProcessParticipant::is_repeater() const noexcept
+{
+    return configuration_->is_repeater;
+}
+
+bool InProcessParticipant::is_rtps_kind() const noexcept
+{
+    return false;
+}
+
+ddspipe::core::types::TopicQoS InProcessParticipant::topic_qos() const noexcept
+{
+    return ddspipe::core::types::TopicQoS();
+}
+
+std::shared_ptr<ddspipe::core::IWriter> InProcessParticipant::create_writer(
+        const ddspipe::core::ITopic& topic)
+{
+    const auto* dds_topic = dynamic_cast<const ddspipe::core::types::DdsTopic*>(&topic);
+    if (!dds_topic)
+    {
+        logDebug(DDSROUTER_INPROCESS, "Not creating Writer for topic " << topic.topic_name());
+        return std::make_shared<ddspipe::participants::BlankWriter>();
+    }
+
+    return std::make_shared<InProcessWriter>(id(), *dds_topic, channel_);
+}
+
+std::shared_ptr<ddspipe::core::IReader> InProcessParticipant::create_reader(
+        const ddspipe::core::ITopic& topic)
+{
+    const auto* dds_topic = dynamic_cast<const ddspipe::core::types::DdsTopic*>(&topic);
+    if (!dds_topic)
+    {
+        logDebug(DDSROUTER_INPROCESS, "Not creating Reader for topic " << topic.topic_name());
+        return std::make_shared<ddspipe::participants::BlankReader>();
+    }
+
+    auto reader = std::make_shared<InProcessReader>(
+        id(),
+        *dds_topic,
+        channel_->new_guid(ddspipe::core::types::EndpointKind::reader));
+    channel_->register_reader(*dds_topic, reader);
+
+    return reader;
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,48 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file InProcessReader.cpp
+ *
+ */
+
+#include <ddsrouter_core/participants/inprocess/InProcessReader.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+InProcessReader::InProcessReader(
+        const ddspipe::core::types::ParticipantId& participant_id,
+        const ddspipe::core::types::DdsTopic& topic,
+        const ddspipe::core::types::Guid& guid)
+    : ddspipe::participants::InternalReader(participant_id)
+    , topic_(topic)
+    , guid_(guid)
+{
+}
+
+ddspipe::core::types::Guid InProcessReader::guid() const
+{
+    return guid_;
+}
+
+ddspipe::core::types::DdsTopic InProcessReader::topic() const
+{
+    return topic_;
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
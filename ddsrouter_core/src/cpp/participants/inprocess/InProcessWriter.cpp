@@ -0,0 +1,67 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file InProcessWriter.cpp
+ *
+ */
+
+#include <cpp_utils/Log.hpp>
+
+#include <ddsrouter_core/logging/BinaryLog.hpp>
+#include <ddsrouter_core/participants/decorator/routing_data.hpp>
+#include <ddsrouter_core/participants/inprocess/InProcessWriter.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+InProcessWriter::InProcessWriter(
+        const ddspipe::core::types::ParticipantId& participant_id,
+        const ddspipe::core::types::DdsTopic& topic,
+        const std::shared_ptr<InProcessChannel>& channel)
+    : ddspipe::participants::BaseWriter(participant_id)
+    , topic_(topic)
+    , channel_(channel)
+{
+}
+
+utils::ReturnCode InProcessWriter::write_nts_(
+        ddspipe::core::IRoutingData& data) noexcept
+{
+    const auto* rtps_data = as_rtps_data(data);
+    if (!rtps_data)
+    {
+        logDevError(DDSROUTER_INPROCESS,
+                "In process writer in topic " << topic_ << " received data of an unknown kind.");
+        return utils::ReturnCode::RETCODE_ERROR;
+    }
+
+    try
+    {
+        channel_->deliver(topic_, *rtps_data);
+    }
+    catch (const std::exception& e)
+    {
+        logBinaryWarning(DDSROUTER_INPROCESS,
+                "Application callback in topic {} failed: {}", topic_.topic_name(), e.what());
+        return utils::ReturnCode::RETCODE_ERROR;
+    }
+
+    return utils::ReturnCode::RETCODE_OK;
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
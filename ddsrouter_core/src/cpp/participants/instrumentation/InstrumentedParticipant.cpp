@@ -0,0 +1,45 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file InstrumentedParticipant.cpp
+ *
+ */
+
+#include <ddsrouter_core/participants/instrumentation/InstrumentedParticipant.hpp>
+#include <ddsrouter_core/participants/instrumentation/InstrumentedReader.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+InstrumentedParticipant::InstrumentedParticipant(
+        const std::shared_ptr<ddspipe::core::IParticipant>& participant,
+        const std::shared_ptr<ThreadPoolInstrumentation>& instrumentation)
+    : ParticipantDecorator(participant)
+    , instrumentation_(instrumentation)
+{
+}
+
+std::shared_ptr<ddspipe::core::IReader> InstrumentedParticipant::create_reader(
+        const ddspipe::core::ITopic& topic)
+{
+    return std::make_shared<InstrumentedReader>(
+        participant_->create_reader(topic),
+        instrumentation_->register_slot(id(), topic.topic_name()));
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,102 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file InstrumentedReader.cpp
+ *
+ */
+
+#include <chrono>
+
+#include <ddsrouter_core/monitoring/SamplingProfiler.hpp>
+#include <ddsrouter_core/participants/decorator/routing_data.hpp>
+#include <ddsrouter_core/participants/instrumentation/InstrumentedReader.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+InstrumentedReader::InstrumentedReader(
+        const std::shared_ptr<ddspipe::core::IReader>& reader,
+        const std::shared_ptr<SlotCounters>& counters)
+    : ReaderDecorator(reader)
+    , counters_(counters)
+    , enqueued_since_(0)
+    , started_at_(0)
+{
+}
+
+void InstrumentedReader::set_on_data_available_callback(
+        std::function<void()> on_data_available_lambda) noexcept
+{
+    reader_->set_on_data_available_callback(
+        [this, on_data_available_lambda]()
+        {
+            counters_->record_enqueue(reader_->get_unread_count());
+
+            // The latency is measured from the oldest data not taken yet
+            int64_t expected = 0;
+            enqueued_since_.compare_exchange_strong(expected, now_us_(), std::memory_order_relaxed);
+
+            on_data_available_lambda();
+        });
+}
+
+utils::ReturnCode InstrumentedReader::take(
+        std::unique_ptr<ddspipe::core::IRoutingData>& data) noexcept
+{
+    // Only the thread of the slot takes, so the start of the transmission has a single writer
+    int64_t started_at = started_at_.load(std::memory_order_relaxed);
+    if (started_at == 0)
+    {
+        started_at = now_us_();
+        started_at_.store(started_at, std::memory_order_relaxed);
+
+        // Samples taken while the thread forwards the data of the slot belong to its participant and topic
+        SamplingProfiler::tag_thread(counters_->profiler_tag.c_str());
+
+        const int64_t enqueued_since = enqueued_since_.exchange(0, std::memory_order_relaxed);
+        if (enqueued_since > 0)
+        {
+            counters_->record_start(started_at > enqueued_since ? started_at - enqueued_since : 0);
+        }
+    }
+
+    utils::ReturnCode ret = reader_->take(data);
+
+    if (ret == utils::ReturnCode::RETCODE_OK)
+    {
+        const auto* rtps_data = data ? as_rtps_data(*data) : nullptr;
+        counters_->record_message(rtps_data ? rtps_data->payload.length : 0);
+    }
+    else
+    {
+        const int64_t now = now_us_();
+        counters_->record_end(now > started_at ? now - started_at : 0);
+        started_at_.store(0, std::memory_order_relaxed);
+        SamplingProfiler::untag_thread();
+    }
+
+    return ret;
+}
+
+int64_t InstrumentedReader::now_us_() noexcept
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
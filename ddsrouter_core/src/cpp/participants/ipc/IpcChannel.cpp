@@ -0,0 +1,327 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file IpcChannel.cpp
+ *
+ */
+
+#if defined(__linux__)
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif // defined(__linux__)
+
+#include <cerrno>
+#include <cstring>
+#include <new>
+
+#include <cpp_utils/exception/InitializationException.hpp>
+#include <cpp_utils/Log.hpp>
+
+#include <ddsrouter_core/participants/ipc/IpcChannel.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+namespace {
+
+//! Written last by the creator of the segment, once the header is initialized.
+constexpr uint64_t IPC_CHANNEL_MAGIC = 0x4444535249504331ULL; // "DDSRIPC1"
+
+//! Increased every time the layout of the segment changes.
+constexpr uint64_t IPC_CHANNEL_VERSION = 1;
+
+//! Maximum time to wait for the creator of the segment to initialize it.
+constexpr std::chrono::milliseconds IPC_CHANNEL_INITIALIZATION_TIMEOUT(1000);
+
+#if defined(__linux__)
+bool process_alive(
+        int32_t pid) noexcept
+{
+    return kill(pid, 0) == 0 || errno != ESRCH;
+}
+#endif // defined(__linux__)
+
+} /* namespace */
+
+/**
+ * Header at the beginning of the shared memory segment, followed by the data of both rings.
+ */
+struct IpcChannelHeader
+{
+    std::atomic<uint64_t> magic;
+
+    uint64_t version;
+
+    uint64_t ring_size;
+
+    //! Pid of the process that owns each side, 0 if free.
+    std::atomic<int32_t> owner[2];
+
+    //! Number of times each side has been claimed.
+    std::atomic<uint32_t> epoch[2];
+
+    //! Control of the ring written by each side.
+    SpscRingControl rings[2];
+};
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free, "IPC channel requires lock-free 64 bits atomics");
+static_assert(std::atomic<int32_t>::is_always_lock_free, "IPC channel requires lock-free 32 bits atomics");
+
+//! Size of the header, rounded so the ring data starts in a new cache line.
+constexpr uint64_t IPC_CHANNEL_HEADER_SIZE = (sizeof(IpcChannelHeader) + 63) & ~static_cast<uint64_t>(63);
+
+#if defined(__linux__)
+
+IpcChannel::IpcChannel(
+        const std::string& name,
+        uint64_t ring_size,
+        std::chrono::milliseconds max_blocking_time)
+    : segment_name_("/ddsrouter_ipc_" + name)
+    , ring_size_(ring_size)
+    , max_blocking_time_(max_blocking_time)
+    , fd_(-1)
+    , segment_(nullptr)
+    , header_(nullptr)
+    , side_(0)
+    , epoch_(0)
+{
+    // Only one process succeeds creating the segment, and it is the one that initializes it
+    bool creator = true;
+    fd_ = shm_open(segment_name_.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+
+    if (fd_ < 0 && errno == EEXIST)
+    {
+        creator = false;
+        fd_ = shm_open(segment_name_.c_str(), O_RDWR, 0600);
+    }
+
+    if (fd_ < 0)
+    {
+        throw utils::InitializationException(utils::Formatter()
+                      << "Failed to open shared memory segment " << segment_name_ << ": " << std::strerror(errno));
+    }
+
+    const auto deadline = std::chrono::steady_clock::now() + IPC_CHANNEL_INITIALIZATION_TIMEOUT;
+
+    if (creator)
+    {
+        if (ftruncate(fd_, static_cast<off_t>(segment_size_())) != 0)
+        {
+            const int error = errno;
+            close(fd_);
+            shm_unlink(segment_name_.c_str());
+            throw utils::InitializationException(utils::Formatter()
+                          << "Failed to allocate shared memory segment " << segment_name_ << ": "
+                          << std::strerror(error));
+        }
+    }
+    else
+    {
+        // The creator may not have set the size yet
+        struct stat segment_stat {};
+        while (fstat(fd_, &segment_stat) == 0 && segment_stat.st_size == 0 &&
+                std::chrono::steady_clock::now() < deadline)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+
+        if (static_cast<uint64_t>(segment_stat.st_size) != segment_size_())
+        {
+            close(fd_);
+            throw utils::InitializationException(utils::Formatter()
+                          << "Shared memory segment " << segment_name_ << " has size " << segment_stat.st_size
+                          << " but " << segment_size_() << " was expected. Check that every participant of channel "
+                          << name << " uses the same ring size.");
+        }
+    }
+
+    segment_ = mmap(nullptr, segment_size_(), PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+    if (segment_ == MAP_FAILED)
+    {
+        const int error = errno;
+        close(fd_);
+        throw utils::InitializationException(utils::Formatter()
+                      << "Failed to map shared memory segment " << segment_name_ << ": " << std::strerror(error));
+    }
+
+    if (creator)
+    {
+        // The segment is zero filled by ftruncate, so the indexes and owners start at 0
+        header_ = new (segment_) IpcChannelHeader();
+        header_->version = IPC_CHANNEL_VERSION;
+        header_->ring_size = ring_size_;
+        header_->magic.store(IPC_CHANNEL_MAGIC, std::memory_order_release);
+    }
+    else
+    {
+        header_ = static_cast<IpcChannelHeader*>(segment_);
+        while (header_->magic.load(std::memory_order_acquire) != IPC_CHANNEL_MAGIC &&
+                std::chrono::steady_clock::now() < deadline)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+
+    if (header_->magic.load(std::memory_order_acquire) != IPC_CHANNEL_MAGIC ||
+            header_->version != IPC_CHANNEL_VERSION ||
+            header_->ring_size != ring_size_)
+    {
+        munmap(segment_, segment_size_());
+        close(fd_);
+        throw utils::InitializationException(utils::Formatter()
+                      << "Shared memory segment " << segment_name_ << " is not a compatible IPC channel.");
+    }
+
+    if (!claim_side_())
+    {
+        munmap(segment_, segment_size_());
+        close(fd_);
+        throw utils::InitializationException(utils::Formatter()
+                      << "IPC channel " << name << " already has two participants attached.");
+    }
+
+    uint8_t* data = static_cast<uint8_t*>(segment_) + IPC_CHANNEL_HEADER_SIZE;
+    outbound_ = std::make_unique<SpscRing>(&header_->rings[side_], data + side_ * ring_size_, ring_size_);
+    inbound_ = std::make_unique<SpscRing>(&header_->rings[1 - side_], data + (1 - side_) * ring_size_, ring_size_);
+
+    // Records sent to a previous owner of this side are not for this process
+    inbound_->reset_consumer();
+
+    epoch_ = header_->epoch[side_].fetch_add(1, std::memory_order_acq_rel) + 1;
+
+    logInfo(DDSROUTER_IPC,
+            "IPC channel " << name << " opened in side " << side_ << " with epoch " << epoch_ << ".");
+}
+
+IpcChannel::~IpcChannel()
+{
+    header_->owner[side_].store(0, std::memory_order_release);
+    const bool last = !peer_attached();
+
+    munmap(segment_, segment_size_());
+    close(fd_);
+
+    if (last)
+    {
+        shm_unlink(segment_name_.c_str());
+    }
+}
+
+#else
+
+IpcChannel::IpcChannel(
+        const std::string& /* name */,
+        uint64_t ring_size,
+        std::chrono::milliseconds max_blocking_time)
+    : ring_size_(ring_size)
+    , max_blocking_time_(max_blocking_time)
+    , fd_(-1)
+    , segment_(nullptr)
+    , header_(nullptr)
+    , side_(0)
+    , epoch_(0)
+{
+    throw utils::InitializationException(utils::Formatter() << "IPC channels are only supported in Linux.");
+}
+
+IpcChannel::~IpcChannel()
+{
+}
+
+#endif // defined(__linux__)
+
+uint32_t IpcChannel::side() const noexcept
+{
+    return side_;
+}
+
+uint32_t IpcChannel::epoch() const noexcept
+{
+    return epoch_;
+}
+
+bool IpcChannel::peer_attached() const noexcept
+{
+    return header_->owner[1 - side_].load(std::memory_order_acquire) != 0;
+}
+
+uint32_t IpcChannel::peer_epoch() const noexcept
+{
+    return header_->epoch[1 - side_].load(std::memory_order_acquire);
+}
+
+uint64_t IpcChannel::max_record_size() const noexcept
+{
+    return outbound_->max_record_size();
+}
+
+const uint8_t* IpcChannel::try_receive(
+        uint32_t& type,
+        uint64_t& size) noexcept
+{
+    return inbound_->try_peek(type, size);
+}
+
+void IpcChannel::release_received() noexcept
+{
+    inbound_->release();
+}
+
+bool IpcChannel::claim_side_() noexcept
+{
+#if defined(__linux__)
+    const int32_t pid = static_cast<int32_t>(getpid());
+
+    for (uint32_t side = 0; side < 2; ++side)
+    {
+        int32_t expected = 0;
+        if (header_->owner[side].compare_exchange_strong(expected, pid, std::memory_order_acq_rel))
+        {
+            side_ = side;
+            return true;
+        }
+    }
+
+    // Both sides are claimed, but their owners may have died without releasing them
+    for (uint32_t side = 0; side < 2; ++side)
+    {
+        int32_t expected = header_->owner[side].load(std::memory_order_acquire);
+        if (expected != 0 && !process_alive(expected) &&
+                header_->owner[side].compare_exchange_strong(expected, pid, std::memory_order_acq_rel))
+        {
+            logWarning(DDSROUTER_IPC,
+                    "Reclaiming side " << side << " of IPC channel " << segment_name_ << " left by process "
+                                       << expected << ".");
+            side_ = side;
+            return true;
+        }
+    }
+#endif // defined(__linux__)
+
+    return false;
+}
+
+uint64_t IpcChannel::segment_size_() const noexcept
+{
+    return IPC_CHANNEL_HEADER_SIZE + 2 * ring_size_;
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,208 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file IpcDiscovery.cpp
+ *
+ */
+
+#if defined(__linux__)
+#include <unistd.h>
+#endif // defined(__linux__)
+
+#include <cstring>
+#include <string>
+
+#include <cpp_utils/Log.hpp>
+
+#include <ddsrouter_core/logging/BinaryLog.hpp>
+#include <ddsrouter_core/participants/ipc/IpcCodec.hpp>
+#include <ddsrouter_core/participants/ipc/IpcDiscovery.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+namespace {
+
+//! Entity kinds of user defined writers and readers with key, as in RTPS.
+constexpr uint8_t IPC_WRITER_ENTITY_KIND = 0x02;
+constexpr uint8_t IPC_READER_ENTITY_KIND = 0x07;
+
+//! Offset of the channel epoch in the guid prefix.
+constexpr std::size_t IPC_GUID_EPOCH_OFFSET = 8;
+
+} /* namespace */
+
+IpcDiscovery::IpcDiscovery(
+        const std::shared_ptr<IpcChannel>& channel)
+    : channel_(channel)
+    , entity_counter_(0)
+{
+}
+
+ddspipe::core::types::Guid IpcDiscovery::new_guid(
+        ddspipe::core::types::EndpointKind kind) noexcept
+{
+    ddspipe::core::types::Guid guid;
+
+    // Prefix: eProsima vendor id, 'I', side, pid and epoch
+#if defined(__linux__)
+    const uint32_t pid = static_cast<uint32_t>(getpid());
+#else
+    // IPC channels can not be opened in other platforms, so there is no endpoint to tell apart
+    const uint32_t pid = 0;
+#endif // defined(__linux__)
+    const uint32_t epoch = channel_->epoch();
+    guid.guidPrefix.value[0] = 0x01;
+    guid.guidPrefix.value[1] = 0x0f;
+    guid.guidPrefix.value[2] = 'I';
+    guid.guidPrefix.value[3] = static_cast<uint8_t>(channel_->side());
+    std::memcpy(&guid.guidPrefix.value[4], &pid, sizeof(pid));
+    std::memcpy(&guid.guidPrefix.value[IPC_GUID_EPOCH_OFFSET], &epoch, sizeof(epoch));
+
+    const uint32_t entity = entity_counter_.fetch_add(1, std::memory_order_relaxed) + 1;
+    guid.entityId.value[0] = static_cast<uint8_t>(entity >> 16);
+    guid.entityId.value[1] = static_cast<uint8_t>(entity >> 8);
+    guid.entityId.value[2] = static_cast<uint8_t>(entity);
+    guid.entityId.value[3] =
+            kind == ddspipe::core::types::EndpointKind::writer ? IPC_WRITER_ENTITY_KIND : IPC_READER_ENTITY_KIND;
+
+    return guid;
+}
+
+void IpcDiscovery::announce(
+        const ddspipe::core::types::Endpoint& endpoint)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    endpoints_[endpoint.guid] = endpoint;
+    send_nts_(endpoint);
+}
+
+void IpcDiscovery::withdraw(
+        const ddspipe::core::types::Endpoint& endpoint)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    endpoints_.erase(endpoint.guid);
+
+    ddspipe::core::types::Endpoint withdrawn = endpoint;
+    withdrawn.active = false;
+    send_nts_(withdrawn);
+}
+
+void IpcDiscovery::reannounce()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    for (const auto& it : endpoints_)
+    {
+        send_nts_(it.second);
+    }
+}
+
+void IpcDiscovery::send_nts_(
+        const ddspipe::core::types::Endpoint& endpoint)
+{
+    const std::string& topic_name = endpoint.topic.m_topic_name;
+    const std::string& type_name = endpoint.topic.type_name;
+
+    const uint64_t size =
+            2 * sizeof(uint8_t) +
+            sizeof(endpoint.guid.guidPrefix.value) + sizeof(endpoint.guid.entityId.value) +
+            IpcEncoder::bytes_size(topic_name.size()) + IpcEncoder::bytes_size(type_name.size()) +
+            3 * sizeof(uint8_t) + sizeof(uint32_t);
+
+    const bool sent = channel_->send(IPC_ENDPOINT_RECORD, size,
+                    [&](uint8_t* buffer)
+                    {
+                        const auto& qos = endpoint.topic.topic_qos;
+
+                        IpcEncoder encoder(buffer);
+                        encoder.write(static_cast<uint8_t>(endpoint.kind == ddspipe::core::types::EndpointKind::writer));
+                        encoder.write(static_cast<uint8_t>(endpoint.active));
+                        encoder.write(endpoint.guid.guidPrefix.value);
+                        encoder.write(endpoint.guid.entityId.value);
+                        encoder.write_string(topic_name);
+                        encoder.write_string(type_name);
+                        encoder.write(static_cast<uint8_t>(
+                            qos.reliability_qos.get_value() == ddspipe::core::types::ReliabilityKind::RELIABLE));
+                        encoder.write(static_cast<uint8_t>(
+                            qos.durability_qos.get_value() == ddspipe::core::types::DurabilityKind::TRANSIENT_LOCAL));
+                        encoder.write(static_cast<uint8_t>(qos.keyed.get_value()));
+                        encoder.write(static_cast<uint32_t>(qos.history_depth.get_value()));
+                    });
+
+    // If the peer is not attached, the endpoint is announced again when it attaches
+    if (!sent && channel_->peer_attached())
+    {
+        logBinaryWarning(DDSROUTER_IPC, "Failed to announce endpoint {} through IPC channel.", endpoint.guid);
+    }
+}
+
+bool IpcDiscovery::decode(
+        const uint8_t* record,
+        uint64_t size,
+        ddspipe::core::types::Endpoint& endpoint)
+{
+    IpcDecoder decoder(record, size);
+
+    uint8_t is_writer;
+    uint8_t active;
+    uint8_t reliable;
+    uint8_t transient_local;
+    uint8_t keyed;
+    uint32_t history_depth;
+
+    if (!decoder.read(is_writer) ||
+            !decoder.read(active) ||
+            !decoder.read(endpoint.guid.guidPrefix.value) ||
+            !decoder.read(endpoint.guid.entityId.value) ||
+            !decoder.read_string(endpoint.topic.m_topic_name) ||
+            !decoder.read_string(endpoint.topic.type_name) ||
+            !decoder.read(reliable) ||
+            !decoder.read(transient_local) ||
+            !decoder.read(keyed) ||
+            !decoder.read(history_depth))
+    {
+        return false;
+    }
+
+    endpoint.kind = is_writer ? ddspipe::core::types::EndpointKind::writer :
+            ddspipe::core::types::EndpointKind::reader;
+    endpoint.active = active != 0;
+
+    auto& qos = endpoint.topic.topic_qos;
+    qos.reliability_qos = reliable ? ddspipe::core::types::ReliabilityKind::RELIABLE :
+            ddspipe::core::types::ReliabilityKind::BEST_EFFORT;
+    qos.durability_qos = transient_local ? ddspipe::core::types::DurabilityKind::TRANSIENT_LOCAL :
+            ddspipe::core::types::DurabilityKind::VOLATILE;
+    qos.keyed = keyed != 0;
+    qos.history_depth = history_depth;
+
+    return true;
+}
+
+uint32_t IpcDiscovery::epoch_of(
+        const ddspipe::core::types::Guid& guid) noexcept
+{
+    uint32_t epoch;
+    std::memcpy(&epoch, &guid.guidPrefix.value[IPC_GUID_EPOCH_OFFSET], sizeof(epoch));
+    return epoch;
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,341 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file IpcParticipant.cpp
+ *
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+#include <fastdds/rtps/common/ChangeKind_t.hpp>
+#include <fastdds/rtps/common/Time_t.h>
+
+#include <cpp_utils/Log.hpp>
+
+#include <ddspipe_core/types/data/RtpsPayloadData.hpp>
+#include <ddspipe_core/types/topic/dds/DdsTopic.hpp>
+#include <ddspipe_participants/reader/auxiliar/BlankReader.hpp>
+#include <ddspipe_participants/writer/auxiliar/BlankWriter.hpp>
+
+#include <ddsrouter_core/efficiency/payload/PooledRtpsPayloadData.hpp>
+#include <ddsrouter_core/logging/BinaryLog.hpp>
+#include <ddsrouter_core/participants/ipc/IpcCodec.hpp>
+#include <ddsrouter_core/participants/ipc/IpcParticipant.hpp>
+#include <ddsrouter_core/participants/ipc/IpcWriter.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+namespace {
+
+//! Period to check whether the peer has attached, restarted or left.
+constexpr std::chrono::milliseconds IPC_PEER_CHECK_PERIOD(100);
+
+//! Number of empty polls before the receiving thread starts sleeping.
+constexpr unsigned int IPC_SPIN_POLLS = 64;
+
+//! Maximum sleep of the receiving thread when there is nothing to receive.
+constexpr std::chrono::microseconds IPC_MAX_IDLE_SLEEP(1000);
+
+} /* namespace */
+
+IpcParticipant::IpcParticipant(
+        const std::shared_ptr<IpcParticipantConfiguration>& participant_configuration,
+        const std::shared_ptr<ddspipe::core::PayloadPool>& payload_pool,
+        const std::shared_ptr<ddspipe::core::DiscoveryDatabase>& discovery_database)
+    : configuration_(participant_configuration)
+    , payload_pool_(payload_pool)
+    , discovery_database_(discovery_database)
+    , known_peer_epoch_(0)
+    , running_(false)
+{
+}
+
+IpcParticipant::~IpcParticipant()
+{
+    running_ = false;
+    if (receive_thread_.joinable())
+    {
+        receive_thread_.join();
+    }
+
+    erase_remote_endpoints_();
+}
+
+void IpcParticipant::init()
+{
+    channel_ = std::make_shared<IpcChannel>(
+        configuration_->channel,
+        configuration_->ring_size,
+        std::chrono::milliseconds(configuration_->max_blocking_time));
+    discovery_ = std::make_shared<IpcDiscovery>(channel_);
+
+    running_ = true;
+    receive_thread_ = std::thread(&IpcParticipant::receive_routine_, this);
+}
+
+ddspipe::core::types::ParticipantId IpcParticipant::id() const noexcept
+{
+    return configuration_->id;
+}
+
+bool IpcParticipant::is_repeater() const noexcept
+{
+    return configuration_->is_repeater;
+}
+
+bool IpcParticipant::is_rtps_kind() const noexcept
+{
+    return false;
+}
+
+ddspipe::core::types::TopicQoS IpcParticipant::topic_qos() const noexcept
+{
+    return ddspipe::core::types::TopicQoS();
+}
+
+std::shared_ptr<ddspipe::core::IWriter> IpcParticipant::create_writer(
+        const ddspipe::core::ITopic& topic)
+{
+    const auto* dds_topic = dynamic_cast<const ddspipe::core::types::DdsTopic*>(&topic);
+    if (!dds_topic)
+    {
+        logDebug(DDSROUTER_IPC, "Not creating Writer for topic " << topic.topic_name());
+        return std::make_shared<ddspipe::participants::BlankWriter>();
+    }
+
+    return std::make_shared<IpcWriter>(id(), *dds_topic, channel_, discovery_);
+}
+
+std::shared_ptr<ddspipe::core::IReader> IpcParticipant::create_reader(
+        const ddspipe::core::ITopic& topic)
+{
+    const auto* dds_topic = dynamic_cast<const ddspipe::core::types::DdsTopic*>(&topic);
+    if (!dds_topic)
+    {
+        logDebug(DDSROUTER_IPC, "Not creating Reader for topic " << topic.topic_name());
+        return std::make_shared<ddspipe::participants::BlankReader>();
+    }
+
+    auto reader = std::make_shared<IpcReader>(id(), *dds_topic, discovery_);
+
+    std::lock_guard<std::mutex> lock(readers_mutex_);
+    readers_[{dds_topic->m_topic_name, dds_topic->type_name}] = reader;
+
+    return reader;
+}
+
+void IpcParticipant::receive_routine_() noexcept
+{
+    unsigned int empty_polls = 0;
+    auto next_peer_check = std::chrono::steady_clock::now();
+
+    while (running_)
+    {
+        const auto now = std::chrono::steady_clock::now();
+        if (now >= next_peer_check)
+        {
+            check_peer_();
+            next_peer_check = now + IPC_PEER_CHECK_PERIOD;
+        }
+
+        uint32_t type;
+        uint64_t size;
+        const uint8_t* record = channel_->try_receive(type, size);
+
+        if (!record)
+        {
+            // Spin first to keep the latency low in bursts, then sleep longer the longer the channel is idle
+            if (++empty_polls < IPC_SPIN_POLLS)
+            {
+                std::this_thread::yield();
+            }
+            else
+            {
+                std::this_thread::sleep_for(std::min(
+                            std::chrono::microseconds(empty_polls - IPC_SPIN_POLLS + 1) * 10,
+                            IPC_MAX_IDLE_SLEEP));
+            }
+            continue;
+        }
+
+        empty_polls = 0;
+
+        switch (type)
+        {
+            case IPC_DATA_RECORD:
+                receive_data_(record, size);
+                break;
+
+            case IPC_ENDPOINT_RECORD:
+                receive_endpoint_(record, size);
+                break;
+
+            default:
+                logBinaryWarning(DDSROUTER_IPC, "Discarding IPC record of unknown type {}.", type);
+                break;
+        }
+
+        channel_->release_received();
+    }
+}
+
+void IpcParticipant::receive_data_(
+        const uint8_t* record,
+        uint64_t size) noexcept
+{
+    IpcDecoder decoder(record, size);
+
+    // Reuse the strings of the previous record, so routing a message does not allocate them
+    std::pair<std::string, std::string>& topic_key = received_topic_key_;
+    auto data = std::make_unique<PooledRtpsPayloadData>();
+    uint8_t kind;
+    int32_t seconds;
+    uint32_t nanoseconds;
+    const uint8_t* payload;
+    uint32_t payload_size;
+
+    if (!decoder.read_string(topic_key.first) ||
+            !decoder.read_string(topic_key.second) ||
+            !decoder.read(data->instanceHandle.value) ||
+            !decoder.read(kind) ||
+            !decoder.read(seconds) ||
+            !decoder.read(nanoseconds) ||
+            !decoder.read_bytes(payload, payload_size))
+    {
+        logBinaryWarning(DDSROUTER_IPC, "Discarding malformed IPC data record.");
+        return;
+    }
+
+    std::shared_ptr<IpcReader> reader;
+    {
+        std::lock_guard<std::mutex> lock(readers_mutex_);
+        auto it = readers_.find(topic_key);
+        if (it != readers_.end())
+        {
+            reader = it->second.lock();
+        }
+    }
+
+    if (!reader)
+    {
+        // The reader has not been created yet or has already been destroyed
+        return;
+    }
+
+    data->kind = static_cast<fastrtps::rtps::ChangeKind_t>(kind);
+    data->source_timestamp = fastrtps::rtps::Time_t(seconds, nanoseconds);
+
+    // Instance state changes do not carry payload
+    if (payload_size > 0)
+    {
+        if (!payload_pool_->get_payload(payload_size, data->payload))
+        {
+            logBinaryWarning(DDSROUTER_IPC, "Failed to allocate payload for IPC message in topic {}.", topic_key.first);
+            return;
+        }
+
+        std::memcpy(data->payload.data, payload, payload_size);
+        data->payload.length = payload_size;
+        data->payload_owner = payload_pool_.get();
+    }
+
+    reader->simulate_data_reception(std::move(data));
+}
+
+void IpcParticipant::receive_endpoint_(
+        const uint8_t* record,
+        uint64_t size) noexcept
+{
+    ddspipe::core::types::Endpoint endpoint;
+    if (!IpcDiscovery::decode(record, size, endpoint))
+    {
+        logBinaryWarning(DDSROUTER_IPC, "Discarding malformed IPC endpoint record.");
+        return;
+    }
+
+    // Announcements of a previous owner of the other side left in the ring
+    if (IpcDiscovery::epoch_of(endpoint.guid) != channel_->peer_epoch())
+    {
+        return;
+    }
+
+    // The peer may have announced its endpoints before the periodic check noticed that it attached
+    if (known_peer_epoch_ != channel_->peer_epoch())
+    {
+        check_peer_();
+    }
+
+    endpoint.discoverer_participant_id = id();
+
+    if (endpoint.active)
+    {
+        if (discovery_database_->endpoint_exists(endpoint.guid))
+        {
+            discovery_database_->update_endpoint(endpoint);
+        }
+        else
+        {
+            discovery_database_->add_endpoint(endpoint);
+        }
+
+        remote_endpoints_[endpoint.guid] = endpoint;
+    }
+    else if (remote_endpoints_.erase(endpoint.guid) > 0)
+    {
+        discovery_database_->erase_endpoint(endpoint);
+    }
+}
+
+void IpcParticipant::check_peer_() noexcept
+{
+    if (!channel_->peer_attached())
+    {
+        if (!remote_endpoints_.empty())
+        {
+            logInfo(DDSROUTER_IPC, "Peer of IPC Participant " << id() << " has left.");
+            erase_remote_endpoints_();
+        }
+        return;
+    }
+
+    const uint32_t peer_epoch = channel_->peer_epoch();
+    if (peer_epoch == known_peer_epoch_)
+    {
+        return;
+    }
+
+    // The peer has attached or restarted: its old endpoints are gone, and it does not know ours
+    logInfo(DDSROUTER_IPC, "Peer of IPC Participant " << id() << " attached with epoch " << peer_epoch << ".");
+    erase_remote_endpoints_();
+    known_peer_epoch_ = peer_epoch;
+    discovery_->reannounce();
+}
+
+void IpcParticipant::erase_remote_endpoints_() noexcept
+{
+    for (const auto& it : remote_endpoints_)
+    {
+        discovery_database_->erase_endpoint(it.second);
+    }
+    remote_endpoints_.clear();
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,59 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file IpcReader.cpp
+ *
+ */
+
+#include <ddsrouter_core/participants/ipc/IpcReader.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+IpcReader::IpcReader(
+        const ddspipe::core::types::ParticipantId& participant_id,
+        const ddspipe::core::types::DdsTopic& topic,
+        const std::shared_ptr<IpcDiscovery>& discovery)
+    : ddspipe::participants::InternalReader(participant_id)
+    , discovery_(discovery)
+{
+    endpoint_.kind = ddspipe::core::types::EndpointKind::reader;
+    endpoint_.guid = discovery_->new_guid(endpoint_.kind);
+    endpoint_.topic = topic;
+    endpoint_.active = true;
+    endpoint_.discoverer_participant_id = participant_id;
+
+    discovery_->announce(endpoint_);
+}
+
+IpcReader::~IpcReader()
+{
+    discovery_->withdraw(endpoint_);
+}
+
+ddspipe::core::types::Guid IpcReader::guid() const
+{
+    return endpoint_.guid;
+}
+
+ddspipe::core::types::DdsTopic IpcReader::topic() const
+{
+    return endpoint_.topic;
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,107 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file IpcWriter.cpp
+ *
+ */
+
+#include <cpp_utils/Log.hpp>
+
+#include <ddsrouter_core/logging/BinaryLog.hpp>
+#include <ddsrouter_core/participants/decorator/routing_data.hpp>
+#include <ddsrouter_core/participants/ipc/IpcCodec.hpp>
+#include <ddsrouter_core/participants/ipc/IpcWriter.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+IpcWriter::IpcWriter(
+        const ddspipe::core::types::ParticipantId& participant_id,
+        const ddspipe::core::types::DdsTopic& topic,
+        const std::shared_ptr<IpcChannel>& channel,
+        const std::shared_ptr<IpcDiscovery>& discovery)
+    : ddspipe::participants::BaseWriter(participant_id)
+    , topic_(topic)
+    , channel_(channel)
+    , discovery_(discovery)
+{
+    endpoint_.kind = ddspipe::core::types::EndpointKind::writer;
+    endpoint_.guid = discovery_->new_guid(endpoint_.kind);
+    endpoint_.topic = topic_;
+    endpoint_.active = true;
+    endpoint_.discoverer_participant_id = participant_id;
+
+    discovery_->announce(endpoint_);
+}
+
+IpcWriter::~IpcWriter()
+{
+    discovery_->withdraw(endpoint_);
+}
+
+utils::ReturnCode IpcWriter::write_nts_(
+        ddspipe::core::IRoutingData& data) noexcept
+{
+    const auto* rtps_data = as_rtps_data(data);
+    if (!rtps_data)
+    {
+        logDevError(DDSROUTER_IPC, "IPC writer in topic " << topic_ << " received data of an unknown kind.");
+        return utils::ReturnCode::RETCODE_ERROR;
+    }
+
+    // Nobody reads from the channel yet, the topic will be announced again when the peer attaches
+    if (!channel_->peer_attached())
+    {
+        return utils::ReturnCode::RETCODE_OK;
+    }
+
+    const auto& payload = rtps_data->payload;
+
+    const uint64_t size =
+            IpcEncoder::bytes_size(topic_.m_topic_name.size()) +
+            IpcEncoder::bytes_size(topic_.type_name.size()) +
+            sizeof(rtps_data->instanceHandle.value) +
+            sizeof(uint8_t) +
+            sizeof(int32_t) + sizeof(uint32_t) +
+            IpcEncoder::bytes_size(payload.length);
+
+    const bool sent = channel_->send(IPC_DATA_RECORD, size,
+                    [&](uint8_t* buffer)
+                    {
+                        IpcEncoder encoder(buffer);
+                        encoder.write_string(topic_.m_topic_name);
+                        encoder.write_string(topic_.type_name);
+                        encoder.write(rtps_data->instanceHandle.value);
+                        encoder.write(static_cast<uint8_t>(rtps_data->kind));
+                        encoder.write(static_cast<int32_t>(rtps_data->source_timestamp.seconds()));
+                        encoder.write(static_cast<uint32_t>(rtps_data->source_timestamp.nanosec()));
+                        encoder.write_bytes(payload.data, payload.length);
+                    });
+
+    if (!sent)
+    {
+        logBinaryDebug(DDSROUTER_IPC,
+                "IPC channel full or message too big in topic {}, message of {} bytes dropped.",
+                topic_.topic_name(), payload.length);
+        return utils::ReturnCode::RETCODE_ERROR;
+    }
+
+    return utils::ReturnCode::RETCODE_OK;
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,142 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file SpscRing.cpp
+ *
+ */
+
+#include <ddsrouter_core/participants/ipc/SpscRing.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+SpscRing::SpscRing(
+        SpscRingControl* control,
+        uint8_t* data,
+        uint64_t capacity) noexcept
+    : control_(control)
+    , data_(data)
+    , capacity_(capacity)
+    , reserved_position_(0)
+    , reserved_size_(0)
+    , peeked_footprint_(0)
+{
+}
+
+uint64_t SpscRing::max_record_size() const noexcept
+{
+    // A record bigger than half the ring could never fit after a padding record
+    return capacity_ / 2 - RECORD_HEADER_SIZE;
+}
+
+uint8_t* SpscRing::try_reserve(
+        uint64_t size) noexcept
+{
+    if (size > max_record_size())
+    {
+        return nullptr;
+    }
+
+    const uint64_t head = control_->head.load(std::memory_order_relaxed);
+    const uint64_t tail = control_->tail.load(std::memory_order_acquire);
+
+    const uint64_t offset = head & (capacity_ - 1);
+    const uint64_t until_end = capacity_ - offset;
+    const uint64_t footprint = record_footprint_(size);
+
+    // If the record does not fit before the end, the remaining space is wasted in a padding record
+    const uint64_t padding = footprint > until_end ? until_end : 0;
+
+    if (capacity_ - (head - tail) < padding + footprint)
+    {
+        return nullptr;
+    }
+
+    if (padding > 0)
+    {
+        // The consumer does not read it until the head is moved in commit
+        auto* header = reinterpret_cast<RecordHeader*>(data_ + offset);
+        header->size = static_cast<uint32_t>(padding - RECORD_HEADER_SIZE);
+        header->type = PADDING_RECORD;
+    }
+
+    reserved_position_ = head + padding;
+    reserved_size_ = size;
+
+    return data_ + (reserved_position_ & (capacity_ - 1)) + RECORD_HEADER_SIZE;
+}
+
+void SpscRing::commit(
+        uint32_t type) noexcept
+{
+    auto* header = reinterpret_cast<RecordHeader*>(data_ + (reserved_position_ & (capacity_ - 1)));
+    header->size = static_cast<uint32_t>(reserved_size_);
+    header->type = type;
+
+    control_->head.store(reserved_position_ + record_footprint_(reserved_size_), std::memory_order_release);
+}
+
+const uint8_t* SpscRing::try_peek(
+        uint32_t& type,
+        uint64_t& size) noexcept
+{
+    uint64_t tail = control_->tail.load(std::memory_order_relaxed);
+    const uint64_t head = control_->head.load(std::memory_order_acquire);
+
+    while (tail != head)
+    {
+        const auto* header = reinterpret_cast<const RecordHeader*>(data_ + (tail & (capacity_ - 1)));
+
+        if (header->type == PADDING_RECORD)
+        {
+            tail += RECORD_HEADER_SIZE + header->size;
+            control_->tail.store(tail, std::memory_order_release);
+            continue;
+        }
+
+        type = header->type;
+        size = header->size;
+        peeked_footprint_ = record_footprint_(size);
+
+        return reinterpret_cast<const uint8_t*>(header) + RECORD_HEADER_SIZE;
+    }
+
+    return nullptr;
+}
+
+void SpscRing::release() noexcept
+{
+    control_->tail.store(
+        control_->tail.load(std::memory_order_relaxed) + peeked_footprint_,
+        std::memory_order_release);
+    peeked_footprint_ = 0;
+}
+
+void SpscRing::reset_consumer() noexcept
+{
+    control_->tail.store(control_->head.load(std::memory_order_acquire), std::memory_order_release);
+    peeked_footprint_ = 0;
+}
+
+uint64_t SpscRing::record_footprint_(
+        uint64_t size) noexcept
+{
+    return (RECORD_HEADER_SIZE + size + 7) & ~static_cast<uint64_t>(7);
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,51 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file LazyParticipant.cpp
+ *
+ */
+
+#include <ddspipe_core/types/topic/dds/DdsTopic.hpp>
+
+#include <ddsrouter_core/participants/lazy/LazyParticipant.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+LazyParticipant::LazyParticipant(
+        const std::shared_ptr<ddspipe::core::IParticipant>& participant,
+        const std::shared_ptr<LazyWriterEngine>& engine)
+    : ParticipantDecorator(participant)
+    , engine_(engine)
+{
+}
+
+std::shared_ptr<ddspipe::core::IWriter> LazyParticipant::create_writer(
+        const ddspipe::core::ITopic& topic)
+{
+    // The lazy writer keeps a copy of the topic to create the inner writer, which is only possible for DDS topics
+    const auto* dds_topic = dynamic_cast<const ddspipe::core::types::DdsTopic*>(&topic);
+    if (!dds_topic)
+    {
+        return participant_->create_writer(topic);
+    }
+
+    return engine_->create_writer(participant_, *dds_topic);
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
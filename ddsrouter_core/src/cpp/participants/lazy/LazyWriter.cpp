@@ -0,0 +1,189 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file LazyWriter.cpp
+ *
+ */
+
+#include <chrono>
+#include <mutex>
+
+#include <cpp_utils/Log.hpp>
+
+#include <ddsrouter_core/logging/BinaryLog.hpp>
+#include <ddsrouter_core/participants/lazy/LazyWriter.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+LazyWriter::LazyWriter(
+        const std::shared_ptr<ddspipe::core::IParticipant>& participant,
+        const ddspipe::core::types::DdsTopic& topic,
+        const std::shared_ptr<LazyWriterCounters>& counters)
+    : participant_(participant)
+    , topic_(topic)
+    , counters_(counters)
+    , enabled_(false)
+    , last_write_(now())
+{
+}
+
+LazyWriter::~LazyWriter()
+{
+    if (writer_)
+    {
+        counters_->active.fetch_sub(1, std::memory_order_relaxed);
+    }
+}
+
+void LazyWriter::enable() noexcept
+{
+    std::unique_lock<std::shared_timed_mutex> lock(mutex_);
+
+    enabled_ = true;
+    if (writer_)
+    {
+        writer_->enable();
+    }
+}
+
+void LazyWriter::disable() noexcept
+{
+    std::unique_lock<std::shared_timed_mutex> lock(mutex_);
+
+    enabled_ = false;
+    if (writer_)
+    {
+        writer_->disable();
+    }
+}
+
+utils::ReturnCode LazyWriter::write(
+        ddspipe::core::IRoutingData& data) noexcept
+{
+    last_write_.store(now(), std::memory_order_relaxed);
+
+    {
+        std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+        if (writer_)
+        {
+            return writer_->write(data);
+        }
+    }
+
+    // First message since the writer was created or reaped
+    std::unique_lock<std::shared_timed_mutex> lock(mutex_);
+    if (!writer_ && !create_nts_())
+    {
+        return utils::ReturnCode::RETCODE_ERROR;
+    }
+
+    return writer_->write(data);
+}
+
+bool LazyWriter::reap_if_idle(
+        int64_t now,
+        int64_t idle_ttl) noexcept
+{
+    if (now - last_write_.load(std::memory_order_relaxed) < idle_ttl)
+    {
+        return false;
+    }
+
+    // A writer that can not be locked is writing
+    std::unique_lock<std::shared_timed_mutex> lock(mutex_, std::try_to_lock);
+    if (!lock.owns_lock() || !writer_)
+    {
+        return false;
+    }
+
+    logDebug(DDSROUTER_LAZY_WRITER,
+            "Destroying idle writer of participant " << participant_->id() << " in topic " << topic_ << ".");
+
+    writer_->disable();
+    writer_.reset();
+
+    counters_->active.fetch_sub(1, std::memory_order_relaxed);
+    counters_->reaped.fetch_add(1, std::memory_order_relaxed);
+
+    return true;
+}
+
+bool LazyWriter::warm_up() noexcept
+{
+    last_write_.store(now(), std::memory_order_relaxed);
+
+    std::unique_lock<std::shared_timed_mutex> lock(mutex_);
+    return writer_ || create_nts_();
+}
+
+bool LazyWriter::created() const noexcept
+{
+    std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+    return writer_ != nullptr;
+}
+
+const ddspipe::core::types::DdsTopic& LazyWriter::topic() const noexcept
+{
+    return topic_;
+}
+
+ddspipe::core::types::ParticipantId LazyWriter::participant_id() const noexcept
+{
+    return participant_->id();
+}
+
+int64_t LazyWriter::now() noexcept
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+bool LazyWriter::create_nts_() noexcept
+{
+    logDebug(DDSROUTER_LAZY_WRITER,
+            "Creating writer of participant " << participant_->id() << " in topic " << topic_ << ".");
+
+    try
+    {
+        writer_ = participant_->create_writer(topic_);
+    }
+    catch (const std::exception& e)
+    {
+        logBinaryWarning(DDSROUTER_LAZY_WRITER,
+                "Failed to create writer of participant {} in topic {}: {}", participant_->id(), topic_, e.what());
+        return false;
+    }
+
+    if (!writer_)
+    {
+        return false;
+    }
+
+    if (enabled_)
+    {
+        writer_->enable();
+    }
+
+    counters_->created.fetch_add(1, std::memory_order_relaxed);
+    counters_->active.fetch_add(1, std::memory_order_relaxed);
+
+    return true;
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
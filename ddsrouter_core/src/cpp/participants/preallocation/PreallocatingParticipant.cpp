@@ -0,0 +1,92 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file PreallocatingParticipant.cpp
+ *
+ */
+
+#include <cpp_utils/Log.hpp>
+
+#include <ddspipe_core/types/topic/dds/DdsTopic.hpp>
+
+#include <ddsrouter_core/participants/preallocation/PreallocatingParticipant.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+PreallocatingParticipant::PreallocatingParticipant(
+        const std::shared_ptr<ddspipe::core::IParticipant>& participant,
+        const std::shared_ptr<PreallocatedPayloadPool>& payload_pool)
+    : ParticipantDecorator(participant)
+    , payload_pool_(payload_pool)
+{
+}
+
+std::shared_ptr<ddspipe::core::IWriter> PreallocatingParticipant::create_writer(
+        const ddspipe::core::ITopic& topic)
+{
+    auto writer = participant_->create_writer(topic);
+    reserve_history_(topic, writer_topics_);
+    return writer;
+}
+
+std::shared_ptr<ddspipe::core::IReader> PreallocatingParticipant::create_reader(
+        const ddspipe::core::ITopic& topic)
+{
+    auto reader = participant_->create_reader(topic);
+    reserve_history_(topic, reader_topics_);
+    return reader;
+}
+
+void PreallocatingParticipant::reserve_history_(
+        const ddspipe::core::ITopic& topic,
+        std::set<std::string>& reserved_topics)
+{
+    const auto* dds_topic = dynamic_cast<const ddspipe::core::types::DdsTopic*>(&topic);
+    if (!dds_topic)
+    {
+        return;
+    }
+
+    const auto& qos = dds_topic->topic_qos;
+    const bool keeps_samples =
+            qos.reliability_qos.get_value() == ddspipe::core::types::ReliabilityKind::RELIABLE ||
+            qos.durability_qos.get_value() == ddspipe::core::types::DurabilityKind::TRANSIENT_LOCAL;
+
+    const uint64_t depth = static_cast<uint64_t>(qos.history_depth.get_value());
+    if (!keeps_samples || depth == 0)
+    {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!reserved_topics.insert(dds_topic->m_topic_name).second)
+        {
+            // Already reserved by a previous endpoint of this topic
+            return;
+        }
+    }
+
+    logDebug(DDSROUTER_PAYLOAD_POOL,
+            "Reserving " << depth << " payload slots for participant " << id() << " in topic " << *dds_topic << ".");
+
+    payload_pool_->reserve(depth);
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,69 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ProjectedParticipant.cpp
+ *
+ */
+
+#include <cpp_utils/Log.hpp>
+
+#include <ddspipe_core/types/topic/dds/DdsTopic.hpp>
+
+#include <ddsrouter_core/participants/projection/ProjectedParticipant.hpp>
+#include <ddsrouter_core/participants/projection/ProjectedWriter.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+ProjectedParticipant::ProjectedParticipant(
+        const std::shared_ptr<ddspipe::core::IParticipant>& participant,
+        const std::shared_ptr<ProjectionEngine>& engine,
+        const std::shared_ptr<ddspipe::core::PayloadPool>& payload_pool)
+    : ParticipantDecorator(participant)
+    , engine_(engine)
+    , payload_pool_(payload_pool)
+{
+}
+
+std::shared_ptr<ddspipe::core::IWriter> ProjectedParticipant::create_writer(
+        const ddspipe::core::ITopic& topic)
+{
+    const auto* dds_topic = dynamic_cast<const ddspipe::core::types::DdsTopic*>(&topic);
+    if (!dds_topic)
+    {
+        return participant_->create_writer(topic);
+    }
+
+    std::shared_ptr<TopicProjection> projection = engine_->projection(*dds_topic, id());
+    if (!projection)
+    {
+        return participant_->create_writer(topic);
+    }
+
+    // The samples sent are not of the type of the topic anymore, but of the derived one
+    ddspipe::core::types::DdsTopic projected_topic = *dds_topic;
+    projected_topic.type_name = projection->type_name();
+
+    logDebug(DDSROUTER_PROJECTION,
+            "Projecting writer of participant " << id() << " in topic " << *dds_topic << " to type "
+                                                << projected_topic.type_name << ".");
+
+    return std::make_shared<ProjectedWriter>(participant_->create_writer(projected_topic), projection, payload_pool_);
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
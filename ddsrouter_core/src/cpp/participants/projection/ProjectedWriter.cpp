@@ -0,0 +1,85 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ProjectedWriter.cpp
+ *
+ */
+
+#include <utility>
+
+#include <ddsrouter_core/participants/decorator/routing_data.hpp>
+#include <ddsrouter_core/participants/projection/ProjectedWriter.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+namespace {
+
+//! Exchange the buffers of two payloads, leaving the rest of their attributes untouched.
+void swap_buffers(
+        ddspipe::core::types::Payload& a,
+        ddspipe::core::types::Payload& b) noexcept
+{
+    std::swap(a.data, b.data);
+    std::swap(a.length, b.length);
+    std::swap(a.max_size, b.max_size);
+}
+
+} /* namespace */
+
+ProjectedWriter::ProjectedWriter(
+        const std::shared_ptr<ddspipe::core::IWriter>& writer,
+        const std::shared_ptr<TopicProjection>& projection,
+        const std::shared_ptr<ddspipe::core::PayloadPool>& payload_pool)
+    : WriterDecorator(writer)
+    , projection_(projection)
+    , payload_pool_(payload_pool)
+{
+}
+
+utils::ReturnCode ProjectedWriter::write(
+        ddspipe::core::IRoutingData& data) noexcept
+{
+    auto* rtps_data = as_rtps_data(data);
+    if (!rtps_data || !carries_user_data(*rtps_data))
+    {
+        return writer_->write(data);
+    }
+
+    ddspipe::core::types::Payload projected;
+    if (!projection_->project(rtps_data->payload, *payload_pool_, projected))
+    {
+        // Dropping the sample is the expected behaviour, not an error
+        return utils::ReturnCode::RETCODE_OK;
+    }
+
+    // Send the projection from the pool it belongs to, so the inner writer can reference it instead of copying it
+    auto* original_owner = rtps_data->payload_owner;
+    swap_buffers(rtps_data->payload, projected);
+    rtps_data->payload_owner = payload_pool_.get();
+
+    const utils::ReturnCode ret = writer_->write(data);
+
+    swap_buffers(rtps_data->payload, projected);
+    rtps_data->payload_owner = original_owner;
+
+    payload_pool_->release_payload(projected);
+    return ret;
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,167 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file InstanceRateLimitedReader.cpp
+ *
+ */
+
+#include <ddsrouter_core/efficiency/rate_limit/TokenBucket.hpp>
+#include <ddsrouter_core/participants/decorator/routing_data.hpp>
+#include <ddsrouter_core/participants/rate_limit/InstanceRateLimitedReader.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+InstanceRateLimitedReader::InstanceRateLimitedReader(
+        const std::shared_ptr<ddspipe::core::IReader>& reader,
+        const std::vector<std::shared_ptr<RateLimiter>>& limiters)
+    : ReaderDecorator(reader)
+    , limiters_(limiters)
+    , pending_(0)
+{
+}
+
+void InstanceRateLimitedReader::set_on_data_available_callback(
+        std::function<void()> on_data_available_lambda) noexcept
+{
+    {
+        std::lock_guard<std::mutex> lock(callback_mutex_);
+        on_data_available_ = on_data_available_lambda;
+    }
+
+    reader_->set_on_data_available_callback(on_data_available_lambda);
+}
+
+void InstanceRateLimitedReader::unset_on_data_available_callback() noexcept
+{
+    reader_->unset_on_data_available_callback();
+
+    std::lock_guard<std::mutex> lock(callback_mutex_);
+    on_data_available_ = nullptr;
+}
+
+utils::ReturnCode InstanceRateLimitedReader::take(
+        std::unique_ptr<ddspipe::core::IRoutingData>& data) noexcept
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    drain_nts_();
+
+    if (!bypass_.empty())
+    {
+        data = std::move(bypass_.front());
+        bypass_.pop_front();
+        return utils::ReturnCode::RETCODE_OK;
+    }
+
+    ddspipe::core::IRoutingData* next = table_.front();
+    if (!next || !accept_nts_(*next))
+    {
+        // Nothing to send yet, the pacer will wake the pipe up again
+        return utils::ReturnCode::RETCODE_NO_DATA;
+    }
+
+    data = table_.pop();
+    pending_.store(table_.pending(), std::memory_order_relaxed);
+
+    return utils::ReturnCode::RETCODE_OK;
+}
+
+uint64_t InstanceRateLimitedReader::get_unread_count() const
+{
+    return reader_->get_unread_count() + pending_.load(std::memory_order_relaxed);
+}
+
+void InstanceRateLimitedReader::wake() noexcept
+{
+    if (pending_.load(std::memory_order_relaxed) == 0)
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(callback_mutex_);
+
+    if (on_data_available_)
+    {
+        on_data_available_();
+    }
+}
+
+void InstanceRateLimitedReader::drain_nts_() noexcept
+{
+    std::unique_ptr<ddspipe::core::IRoutingData> data;
+
+    while (reader_->take(data) == utils::ReturnCode::RETCODE_OK)
+    {
+        const auto* rtps_data = as_rtps_data(*data);
+
+        if (!rtps_data)
+        {
+            bypass_.push_back(std::move(data));
+            continue;
+        }
+
+        std::unique_ptr<ddspipe::core::IRoutingData> replaced;
+
+        if (carries_user_data(*rtps_data))
+        {
+            replaced = table_.store(rtps_data->instanceHandle, std::move(data));
+        }
+        else
+        {
+            // The instance is gone, so its pending sample is not sent
+            replaced = table_.erase(rtps_data->instanceHandle);
+            bypass_.push_back(std::move(data));
+        }
+
+        if (replaced)
+        {
+            const uint64_t size = as_rtps_data(*replaced)->payload.length;
+            for (const auto& limiter : limiters_)
+            {
+                limiter->drop(size);
+            }
+        }
+    }
+
+    pending_.store(table_.pending(), std::memory_order_relaxed);
+}
+
+bool InstanceRateLimitedReader::accept_nts_(
+        const ddspipe::core::IRoutingData& data) noexcept
+{
+    const uint64_t size = as_rtps_data(data)->payload.length;
+    const int64_t now = TokenBucket::now();
+
+    for (auto it = limiters_.begin(); it != limiters_.end(); ++it)
+    {
+        if (!(*it)->try_accept(size, now))
+        {
+            // Undo the limiters that had already accepted the message
+            for (auto accepted = limiters_.begin(); accepted != it; ++accepted)
+            {
+                (*accepted)->refund(size);
+            }
+            return false;
+        }
+    }
+
+    return true;
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
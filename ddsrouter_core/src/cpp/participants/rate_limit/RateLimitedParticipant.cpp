@@ -0,0 +1,118 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file RateLimitedParticipant.cpp
+ *
+ */
+
+#include <cpp_utils/Log.hpp>
+
+#include <ddspipe_core/types/topic/dds/DdsTopic.hpp>
+
+#include <ddsrouter_core/participants/rate_limit/InstanceRateLimitedReader.hpp>
+#include <ddsrouter_core/participants/rate_limit/RateLimitedParticipant.hpp>
+#include <ddsrouter_core/participants/rate_limit/RateLimitedReader.hpp>
+#include <ddsrouter_core/participants/rate_limit/RateLimitedWriter.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+RateLimitedParticipant::RateLimitedParticipant(
+        const std::shared_ptr<ddspipe::core::IParticipant>& participant,
+        const std::shared_ptr<RateLimitEngine>& engine)
+    : ParticipantDecorator(participant)
+    , engine_(engine)
+    , participant_index_(engine->participant_index(participant->id()))
+{
+}
+
+std::shared_ptr<ddspipe::core::IWriter> RateLimitedParticipant::create_writer(
+        const ddspipe::core::ITopic& topic)
+{
+    std::shared_ptr<ddspipe::core::IWriter> writer = participant_->create_writer(topic);
+
+    const auto* dds_topic = dynamic_cast<const ddspipe::core::types::DdsTopic*>(&topic);
+    if (!dds_topic)
+    {
+        return writer;
+    }
+
+    TransmissionLimiters limiters = engine_->transmission_limiters(*dds_topic, id());
+    if (limiters.empty())
+    {
+        return writer;
+    }
+
+    logDebug(DDSROUTER_RATE_LIMIT,
+            "Rate limiting writer of participant " << id() << " in topic " << *dds_topic << ".");
+
+    return std::make_shared<RateLimitedWriter>(writer, limiters);
+}
+
+std::shared_ptr<ddspipe::core::IReader> RateLimitedParticipant::create_reader(
+        const ddspipe::core::ITopic& topic)
+{
+    std::shared_ptr<ddspipe::core::IReader> reader = participant_->create_reader(topic);
+
+    const auto* dds_topic = dynamic_cast<const ddspipe::core::types::DdsTopic*>(&topic);
+    if (!dds_topic)
+    {
+        return reader;
+    }
+
+    // Keyed topics limited per instance keep the samples over the rate, and the pacer retries them
+    std::vector<std::shared_ptr<RateLimiter>> instance_limiters = engine_->instance_limiters(*dds_topic);
+    if (!instance_limiters.empty())
+    {
+        logDebug(DDSROUTER_RATE_LIMIT,
+                "Rate limiting per instance reader of participant " << id() << " in topic " << *dds_topic << ".");
+
+        auto instance_reader = std::make_shared<InstanceRateLimitedReader>(reader, instance_limiters);
+        std::weak_ptr<InstanceRateLimitedReader> weak_reader = instance_reader;
+
+        engine_->register_pacing_callback(
+            [weak_reader]()
+            {
+                auto reader = weak_reader.lock();
+                if (!reader)
+                {
+                    return false;
+                }
+
+                reader->wake();
+                return true;
+            });
+
+        reader = instance_reader;
+    }
+
+    // Readers must be wrapped either to check the topic limiters, or to let the writers know the message source.
+    // Every reader publishes its source if any route is limited, so a thread never keeps the one of a previous message
+    std::vector<std::shared_ptr<RateLimiter>> limiters = engine_->reception_limiters(*dds_topic);
+    if (limiters.empty() && !engine_->has_route_rules())
+    {
+        return reader;
+    }
+
+    logDebug(DDSROUTER_RATE_LIMIT,
+            "Rate limiting reader of participant " << id() << " in topic " << *dds_topic << ".");
+
+    return std::make_shared<RateLimitedReader>(reader, limiters, participant_index_);
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,101 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file RateLimitedReader.cpp
+ *
+ */
+
+#include <ddsrouter_core/efficiency/rate_limit/RateLimitEngine.hpp>
+#include <ddsrouter_core/efficiency/rate_limit/TokenBucket.hpp>
+#include <ddsrouter_core/participants/decorator/routing_data.hpp>
+#include <ddsrouter_core/participants/rate_limit/RateLimitedReader.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+RateLimitedReader::RateLimitedReader(
+        const std::shared_ptr<ddspipe::core::IReader>& reader,
+        const std::vector<std::shared_ptr<RateLimiter>>& limiters,
+        uint32_t participant_index)
+    : ReaderDecorator(reader)
+    , limiters_(limiters)
+    , participant_index_(participant_index)
+{
+}
+
+utils::ReturnCode RateLimitedReader::take(
+        std::unique_ptr<ddspipe::core::IRoutingData>& data) noexcept
+{
+    // Forget the source of the last message processed by this thread, in case no message is taken now
+    RateLimitEngine::set_current_source(RateLimitEngine::NO_SOURCE);
+
+    while (true)
+    {
+        utils::ReturnCode ret = reader_->take(data);
+
+        if (ret != utils::ReturnCode::RETCODE_OK)
+        {
+            return ret;
+        }
+
+        if (accept_(*data))
+        {
+            // Let the writers of this thread know which participant received the message
+            RateLimitEngine::set_current_source(participant_index_);
+            return ret;
+        }
+
+        // Release the message, so its payload returns to the pool before reaching any writer
+        data.reset();
+    }
+}
+
+bool RateLimitedReader::accept_(
+        const ddspipe::core::IRoutingData& data) noexcept
+{
+    if (limiters_.empty())
+    {
+        return true;
+    }
+
+    const auto* rtps_data = as_rtps_data(data);
+    if (!rtps_data || !carries_user_data(*rtps_data))
+    {
+        return true;
+    }
+
+    const uint64_t size = rtps_data->payload.length;
+    const int64_t now = TokenBucket::now();
+
+    for (auto it = limiters_.begin(); it != limiters_.end(); ++it)
+    {
+        if (!(*it)->accept(size, now))
+        {
+            // Undo the limiters that had already accepted the message
+            for (auto accepted = limiters_.begin(); accepted != it; ++accepted)
+            {
+                (*accepted)->refund(size);
+            }
+            return false;
+        }
+    }
+
+    return true;
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,105 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file RateLimitedWriter.cpp
+ *
+ */
+
+#include <ddsrouter_core/efficiency/rate_limit/TokenBucket.hpp>
+#include <ddsrouter_core/participants/decorator/routing_data.hpp>
+#include <ddsrouter_core/participants/rate_limit/RateLimitedWriter.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+RateLimitedWriter::RateLimitedWriter(
+        const std::shared_ptr<ddspipe::core::IWriter>& writer,
+        const TransmissionLimiters& limiters)
+    : WriterDecorator(writer)
+    , limiters_(limiters)
+{
+}
+
+utils::ReturnCode RateLimitedWriter::write(
+        ddspipe::core::IRoutingData& data) noexcept
+{
+    const auto* rtps_data = as_rtps_data(data);
+
+    if (rtps_data && carries_user_data(*rtps_data) && !accept_(rtps_data->payload.length))
+    {
+        // Dropping the message is the expected behaviour, not an error
+        return utils::ReturnCode::RETCODE_OK;
+    }
+
+    return writer_->write(data);
+}
+
+bool RateLimitedWriter::accept_(
+        uint64_t size) noexcept
+{
+    const int64_t now = TokenBucket::now();
+    const uint32_t source = RateLimitEngine::current_source();
+
+    // Limiters that have accepted the message so far, in case it must be undone
+    std::size_t participant_accepted = 0;
+    std::size_t route_accepted = 0;
+    bool accepted = true;
+
+    for (; participant_accepted < limiters_.participant.size(); ++participant_accepted)
+    {
+        if (!limiters_.participant[participant_accepted]->accept(size, now))
+        {
+            accepted = false;
+            break;
+        }
+    }
+
+    if (accepted)
+    {
+        for (; route_accepted < limiters_.route.size(); ++route_accepted)
+        {
+            const auto& route = limiters_.route[route_accepted];
+
+            if (route.first == source && !route.second->accept(size, now))
+            {
+                accepted = false;
+                break;
+            }
+        }
+    }
+
+    if (!accepted)
+    {
+        for (std::size_t i = 0; i < participant_accepted; ++i)
+        {
+            limiters_.participant[i]->refund(size);
+        }
+
+        for (std::size_t i = 0; i < route_accepted; ++i)
+        {
+            if (limiters_.route[i].first == source)
+            {
+                limiters_.route[i].second->refund(size);
+            }
+        }
+    }
+
+    return accepted;
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
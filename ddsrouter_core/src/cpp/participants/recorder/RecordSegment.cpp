@@ -0,0 +1,313 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file RecordSegment.cpp
+ *
+ */
+
+#if defined(__linux__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif // defined(__linux__)
+
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+
+#include <cpp_utils/exception/InitializationException.hpp>
+#include <cpp_utils/Log.hpp>
+
+#include <ddsrouter_core/participants/recorder/RecordSegment.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+namespace {
+
+RecordFileHeader file_header(
+        const char (&magic)[8]) noexcept
+{
+    RecordFileHeader header{};
+    std::memcpy(header.magic, magic, sizeof(header.magic));
+    header.version = RECORD_FORMAT_VERSION;
+    header.creation_time = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+    return header;
+}
+
+#if defined(__linux__)
+//! Write the whole buffer, retrying on partial writes.
+bool write_all(
+        int fd,
+        const void* buffer,
+        size_t size) noexcept
+{
+    const auto* data = static_cast<const uint8_t*>(buffer);
+
+    while (size > 0)
+    {
+        const ssize_t written = ::write(fd, data, size);
+        if (written < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            return false;
+        }
+
+        data += written;
+        size -= static_cast<size_t>(written);
+    }
+
+    return true;
+}
+#endif // defined(__linux__)
+
+} /* namespace */
+
+RecordSegment::RecordSegment(
+        const std::string& path,
+        uint64_t capacity)
+    : path_(path)
+    , capacity_(capacity)
+    , segment_fd_(-1)
+    , index_fd_(-1)
+    , data_(nullptr)
+    , written_(sizeof(RecordFileHeader))
+    , synced_(0)
+    , reserved_(0)
+{
+#if defined(__linux__)
+    const std::string segment_path = path_ + RECORD_SEGMENT_EXTENSION;
+    const std::string index_path = path_ + RECORD_INDEX_EXTENSION;
+
+    segment_fd_ = ::open(segment_path.c_str(), O_CREAT | O_EXCL | O_RDWR | O_CLOEXEC, 0644);
+    if (segment_fd_ < 0)
+    {
+        throw utils::InitializationException(utils::Formatter()
+                      << "Failed to create segment file " << segment_path << ": " << std::strerror(errno));
+    }
+
+    // Allocate the blocks now, so running out of disk is detected here and not when writing to the mapping
+    const int allocate_error = posix_fallocate(segment_fd_, 0, static_cast<off_t>(capacity_));
+    if (allocate_error != 0)
+    {
+        ::close(segment_fd_);
+        ::unlink(segment_path.c_str());
+        throw utils::InitializationException(utils::Formatter()
+                      << "Failed to allocate segment file " << segment_path << ": " << std::strerror(allocate_error));
+    }
+
+    void* mapping = mmap(nullptr, capacity_, PROT_READ | PROT_WRITE, MAP_SHARED, segment_fd_, 0);
+    if (mapping == MAP_FAILED)
+    {
+        const int error = errno;
+        ::close(segment_fd_);
+        ::unlink(segment_path.c_str());
+        throw utils::InitializationException(utils::Formatter()
+                      << "Failed to map segment file " << segment_path << ": " << std::strerror(error));
+    }
+
+    data_ = static_cast<uint8_t*>(mapping);
+
+    // The segment is only appended, so tell the kernel to read ahead and evict behind
+    madvise(data_, capacity_, MADV_SEQUENTIAL);
+
+    index_fd_ = ::open(index_path.c_str(), O_CREAT | O_EXCL | O_WRONLY | O_APPEND | O_CLOEXEC, 0644);
+    if (index_fd_ < 0)
+    {
+        const int error = errno;
+        munmap(data_, capacity_);
+        ::close(segment_fd_);
+        ::unlink(segment_path.c_str());
+        throw utils::InitializationException(utils::Formatter()
+                      << "Failed to create index file " << index_path << ": " << std::strerror(error));
+    }
+
+    const RecordFileHeader segment_header = file_header(RECORD_SEGMENT_MAGIC);
+    std::memcpy(data_, &segment_header, sizeof(segment_header));
+
+    const RecordFileHeader index_header = file_header(RECORD_INDEX_MAGIC);
+    if (!write_all(index_fd_, &index_header, sizeof(index_header)))
+    {
+        const int error = errno;
+        munmap(data_, capacity_);
+        ::close(segment_fd_);
+        ::close(index_fd_);
+        ::unlink(segment_path.c_str());
+        ::unlink(index_path.c_str());
+        throw utils::InitializationException(utils::Formatter()
+                      << "Failed to write index file " << index_path << ": " << std::strerror(error));
+    }
+#else
+    throw utils::InitializationException(utils::Formatter()
+                  << "Failed to create segment " << path_ << ": recording is only supported in Linux.");
+#endif // defined(__linux__)
+}
+
+RecordSegment::~RecordSegment()
+{
+    close();
+}
+
+uint8_t* RecordSegment::reserve(
+        uint32_t size,
+        uint64_t& offset) noexcept
+{
+    if (!data_)
+    {
+        return nullptr;
+    }
+
+    offset = written_.load(std::memory_order_relaxed);
+
+    // Leave room for the end mark after the record
+    if (offset + record_aligned_size(size) + sizeof(RecordHeader) > capacity_)
+    {
+        return nullptr;
+    }
+
+    reserved_ = offset;
+    return data_ + offset + sizeof(RecordHeader);
+}
+
+void RecordSegment::commit(
+        RecordType type,
+        uint32_t size) noexcept
+{
+    RecordHeader header{};
+    header.size = size;
+    header.type = type;
+
+    // The header is written after the body, so a record is never seen half written
+    std::memcpy(data_ + reserved_, &header, sizeof(header));
+    written_.store(reserved_ + record_aligned_size(size), std::memory_order_release);
+}
+
+void RecordSegment::add_index(
+        const RecordIndexEntry& entry)
+{
+    std::lock_guard<std::mutex> lock(index_mutex_);
+    pending_index_.push_back(entry);
+}
+
+bool RecordSegment::sync() noexcept
+{
+    std::lock_guard<std::mutex> sync_lock(sync_mutex_);
+
+    if (!data_)
+    {
+        return true;
+    }
+
+#if defined(__linux__)
+    bool success = true;
+
+    const uint64_t written = written_.load(std::memory_order_acquire);
+    if (written > synced_)
+    {
+        // msync requires the address to be aligned to a page
+        static const uint64_t page_size = static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+        const uint64_t begin = synced_ & ~(page_size - 1);
+
+        if (msync(data_ + begin, written - begin, MS_SYNC) == 0)
+        {
+            synced_ = written;
+        }
+        else
+        {
+            logWarning(DDSROUTER_RECORDER,
+                    "Failed to synchronize segment " << path_ << ": " << std::strerror(errno) << ".");
+            success = false;
+        }
+    }
+
+    std::vector<RecordIndexEntry> entries;
+    {
+        std::lock_guard<std::mutex> lock(index_mutex_);
+        entries.swap(pending_index_);
+    }
+
+    if (!entries.empty())
+    {
+        if (!write_all(index_fd_, entries.data(), entries.size() * sizeof(RecordIndexEntry)) ||
+                fdatasync(index_fd_) != 0)
+        {
+            logWarning(DDSROUTER_RECORDER,
+                    "Failed to write index of segment " << path_ << ": " << std::strerror(errno) << ".");
+            success = false;
+        }
+    }
+
+    return success;
+#else
+    return true;
+#endif // defined(__linux__)
+}
+
+void RecordSegment::close() noexcept
+{
+    sync();
+
+    std::lock_guard<std::mutex> sync_lock(sync_mutex_);
+
+    if (!data_)
+    {
+        return;
+    }
+
+#if defined(__linux__)
+    munmap(data_, capacity_);
+    data_ = nullptr;
+
+    // Give back the space not used, keeping room for the end mark
+    const uint64_t used = written_.load(std::memory_order_acquire) + sizeof(RecordHeader);
+    if (ftruncate(segment_fd_, static_cast<off_t>(used)) != 0 || fsync(segment_fd_) != 0)
+    {
+        logWarning(DDSROUTER_RECORDER,
+                "Failed to shrink segment " << path_ << ": " << std::strerror(errno) << ".");
+    }
+
+    ::close(segment_fd_);
+    ::close(index_fd_);
+    segment_fd_ = -1;
+    index_fd_ = -1;
+#endif // defined(__linux__)
+}
+
+const std::string& RecordSegment::path() const noexcept
+{
+    return path_;
+}
+
+uint64_t RecordSegment::size() const noexcept
+{
+    return written_.load(std::memory_order_relaxed);
+}
+
+uint64_t RecordSegment::max_record_size(
+        uint64_t capacity) noexcept
+{
+    // File header, record header and end mark
+    const uint64_t overhead = sizeof(RecordFileHeader) + 2 * sizeof(RecordHeader);
+    return capacity > overhead ? (capacity - overhead) & ~(RECORD_ALIGNMENT - 1) : 0;
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
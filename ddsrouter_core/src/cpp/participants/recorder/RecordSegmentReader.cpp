@@ -0,0 +1,230 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file RecordSegmentReader.cpp
+ *
+ */
+
+#if defined(__linux__)
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif // defined(__linux__)
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
+#include <cpp_utils/exception/InitializationException.hpp>
+#include <cpp_utils/Log.hpp>
+
+#include <ddsrouter_core/participants/recorder/RecordSegmentReader.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+namespace {
+
+uint64_t page_size() noexcept
+{
+#if defined(__linux__)
+    static const uint64_t size = static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+#else
+    static const uint64_t size = 4096;
+#endif // defined(__linux__)
+    return size;
+}
+
+} /* namespace */
+
+RecordSegmentReader::RecordSegmentReader(
+        const std::string& path,
+        uint64_t prefetch_size)
+    : path_(path)
+    , prefetch_size_(std::max(prefetch_size, page_size()))
+    , data_(nullptr)
+    , size_(0)
+    , offset_(sizeof(RecordFileHeader))
+    , prefetched_(0)
+    , released_(0)
+{
+#if defined(__linux__)
+    const std::string segment_path = path_ + RECORD_SEGMENT_EXTENSION;
+
+    const int fd = ::open(segment_path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+    {
+        throw utils::InitializationException(utils::Formatter()
+                      << "Failed to open segment file " << segment_path << ": " << std::strerror(errno));
+    }
+
+    struct stat segment_stat {};
+    if (fstat(fd, &segment_stat) != 0 || static_cast<uint64_t>(segment_stat.st_size) < sizeof(RecordFileHeader))
+    {
+        ::close(fd);
+        throw utils::InitializationException(utils::Formatter()
+                      << "Segment file " << segment_path << " is too small.");
+    }
+
+    size_ = static_cast<uint64_t>(segment_stat.st_size);
+
+    void* mapping = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+
+    // The mapping keeps the file open
+    ::close(fd);
+
+    if (mapping == MAP_FAILED)
+    {
+        throw utils::InitializationException(utils::Formatter()
+                      << "Failed to map segment file " << segment_path << ": " << std::strerror(errno));
+    }
+
+    data_ = static_cast<uint8_t*>(mapping);
+
+    RecordFileHeader header;
+    std::memcpy(&header, data_, sizeof(header));
+
+    if (std::memcmp(header.magic, RECORD_SEGMENT_MAGIC, sizeof(header.magic)) != 0 ||
+            header.version != RECORD_FORMAT_VERSION)
+    {
+        munmap(data_, size_);
+        throw utils::InitializationException(utils::Formatter()
+                      << "File " << segment_path << " is not a segment of a supported version.");
+    }
+
+    madvise(data_, size_, MADV_SEQUENTIAL);
+    prefetch_();
+#else
+    throw utils::InitializationException(utils::Formatter()
+                  << "Failed to open segment " << path_ << ": replaying is only supported in Linux.");
+#endif // defined(__linux__)
+}
+
+RecordSegmentReader::~RecordSegmentReader()
+{
+#if defined(__linux__)
+    munmap(data_, size_);
+#endif // defined(__linux__)
+}
+
+bool RecordSegmentReader::next(
+        RecordType& type,
+        const uint8_t*& body,
+        uint32_t& size) noexcept
+{
+    if (offset_ + sizeof(RecordHeader) > size_)
+    {
+        return false;
+    }
+
+    RecordHeader header;
+    std::memcpy(&header, data_ + offset_, sizeof(header));
+
+    if (header.type == RECORD_END)
+    {
+        return false;
+    }
+
+    if (offset_ + sizeof(RecordHeader) + header.size > size_)
+    {
+        logWarning(DDSROUTER_RECORDER,
+                "Segment " << path_ << " is truncated at offset " << offset_ << ", ignoring the rest of it.");
+        return false;
+    }
+
+    type = static_cast<RecordType>(header.type);
+    body = data_ + offset_ + sizeof(RecordHeader);
+    size = header.size;
+
+    // Prefetch before moving on, so the record returned is not released
+    if (offset_ + prefetch_size_ / 2 > prefetched_)
+    {
+        prefetch_();
+    }
+
+    offset_ += record_aligned_size(header.size);
+
+    return true;
+}
+
+const std::string& RecordSegmentReader::path() const noexcept
+{
+    return path_;
+}
+
+std::vector<std::string> RecordSegmentReader::list_segments(
+        const std::string& directory)
+{
+#if defined(__linux__)
+    std::vector<std::string> segments;
+    const std::string extension = RECORD_SEGMENT_EXTENSION;
+
+    DIR* dir = opendir(directory.c_str());
+    if (!dir)
+    {
+        throw utils::InitializationException(utils::Formatter()
+                      << "Failed to open directory " << directory << ": " << std::strerror(errno));
+    }
+
+    while (const dirent* entry = readdir(dir))
+    {
+        const std::string name = entry->d_name;
+        if (name.size() > extension.size() &&
+                name.compare(name.size() - extension.size(), extension.size(), extension) == 0)
+        {
+            segments.push_back(directory + "/" + name.substr(0, name.size() - extension.size()));
+        }
+    }
+
+    closedir(dir);
+
+    std::sort(segments.begin(), segments.end());
+    return segments;
+#else
+    throw utils::InitializationException(utils::Formatter()
+                  << "Replaying from " << directory << " is only supported in Linux.");
+#endif // defined(__linux__)
+}
+
+void RecordSegmentReader::prefetch_() noexcept
+{
+#if defined(__linux__)
+    // Request the pages of the next window, so they are read while the current one is consumed
+    const uint64_t begin = prefetched_;
+    const uint64_t end = std::min(offset_ + prefetch_size_, size_);
+
+    if (end > begin)
+    {
+        madvise(data_ + begin, end - begin, MADV_WILLNEED);
+        prefetched_ = (end + page_size() - 1) & ~(page_size() - 1);
+    }
+
+    // Release the pages before the current record
+    const uint64_t read = offset_ & ~(page_size() - 1);
+
+    if (read > released_)
+    {
+        madvise(data_ + released_, read - released_, MADV_DONTNEED);
+        released_ = read;
+    }
+#endif // defined(__linux__)
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,89 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file RecorderParticipant.cpp
+ *
+ */
+
+#include <cpp_utils/Log.hpp>
+
+#include <ddspipe_core/types/topic/dds/DdsTopic.hpp>
+#include <ddspipe_participants/reader/auxiliar/BlankReader.hpp>
+#include <ddspipe_participants/writer/auxiliar/BlankWriter.hpp>
+
+#include <ddsrouter_core/participants/recorder/RecorderParticipant.hpp>
+#include <ddsrouter_core/participants/recorder/RecorderWriter.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+RecorderParticipant::RecorderParticipant(
+        const std::shared_ptr<RecorderParticipantConfiguration>& participant_configuration,
+        const std::shared_ptr<ddspipe::core::PayloadPool>& payload_pool,
+        const std::shared_ptr<ddspipe::core::DiscoveryDatabase>& /* discovery_database */)
+    : configuration_(participant_configuration)
+    , recorder_(std::make_shared<SegmentRecorder>(participant_configuration, payload_pool))
+{
+}
+
+void RecorderParticipant::init()
+{
+    recorder_->start();
+}
+
+ddspipe::core::types::ParticipantId RecorderParticipant::id() const noexcept
+{
+    return configuration_->id;
+}
+
+bool RecorderParticipant::is_repeater() const noexcept
+{
+    return false;
+}
+
+bool RecorderParticipant::is_rtps_kind() const noexcept
+{
+    return false;
+}
+
+ddspipe::core::types::TopicQoS RecorderParticipant::topic_qos() const noexcept
+{
+    return ddspipe::core::types::TopicQoS();
+}
+
+std::shared_ptr<ddspipe::core::IWriter> RecorderParticipant::create_writer(
+        const ddspipe::core::ITopic& topic)
+{
+    const auto* dds_topic = dynamic_cast<const ddspipe::core::types::DdsTopic*>(&topic);
+    if (!dds_topic)
+    {
+        logDebug(DDSROUTER_RECORDER, "Not creating Writer for topic " << topic.topic_name());
+        return std::make_shared<ddspipe::participants::BlankWriter>();
+    }
+
+    return std::make_shared<RecorderWriter>(id(), *dds_topic, recorder_);
+}
+
+std::shared_ptr<ddspipe::core::IReader> RecorderParticipant::create_reader(
+        const ddspipe::core::ITopic& /* topic */)
+{
+    // Nothing is published from a recording
+    return std::make_shared<ddspipe::participants::BlankReader>();
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,64 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file RecorderWriter.cpp
+ *
+ */
+
+#include <cpp_utils/Log.hpp>
+
+#include <ddsrouter_core/logging/BinaryLog.hpp>
+#include <ddsrouter_core/participants/decorator/routing_data.hpp>
+#include <ddsrouter_core/participants/recorder/RecorderWriter.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+RecorderWriter::RecorderWriter(
+        const ddspipe::core::types::ParticipantId& participant_id,
+        const ddspipe::core::types::DdsTopic& topic,
+        const std::shared_ptr<SegmentRecorder>& recorder)
+    : ddspipe::participants::BaseWriter(participant_id)
+    , topic_(topic)
+    , recorder_(recorder)
+    , topic_id_(recorder_->register_topic(topic_))
+{
+}
+
+utils::ReturnCode RecorderWriter::write_nts_(
+        ddspipe::core::IRoutingData& data) noexcept
+{
+    const auto* rtps_data = as_rtps_data(data);
+    if (!rtps_data)
+    {
+        logDevError(DDSROUTER_RECORDER, "Recorder writer in topic " << topic_ << " received data of an unknown kind.");
+        return utils::ReturnCode::RETCODE_ERROR;
+    }
+
+    if (!recorder_->record(topic_id_, *rtps_data))
+    {
+        logBinaryDebug(DDSROUTER_RECORDER,
+                "Recorder queue full in topic {}, message of {} bytes not recorded.",
+                topic_.topic_name(), rtps_data->payload.length);
+        return utils::ReturnCode::RETCODE_ERROR;
+    }
+
+    return utils::ReturnCode::RETCODE_OK;
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,506 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file SegmentRecorder.cpp
+ *
+ */
+
+#if defined(__linux__)
+#include <sys/stat.h>
+#endif // defined(__linux__)
+
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+
+#include <fastdds/rtps/common/Time_t.h>
+
+#include <cpp_utils/exception/InitializationException.hpp>
+#include <cpp_utils/Log.hpp>
+
+#include <ddsrouter_core/efficiency/payload/PooledRtpsPayloadData.hpp>
+#include <ddsrouter_core/logging/BinaryLog.hpp>
+#include <ddsrouter_core/participants/recorder/SegmentRecorder.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+namespace {
+
+//! Create \c path and every missing parent directory.
+void create_directories(
+        const std::string& path)
+{
+#if defined(__linux__)
+    for (size_t position = path.find('/', 1); ; position = path.find('/', position + 1))
+    {
+        const std::string directory = path.substr(0, position);
+
+        if (!directory.empty() && mkdir(directory.c_str(), 0755) != 0 && errno != EEXIST)
+        {
+            throw utils::InitializationException(utils::Formatter()
+                          << "Failed to create directory " << directory << ": " << std::strerror(errno));
+        }
+
+        if (position == std::string::npos)
+        {
+            break;
+        }
+    }
+#else
+    throw utils::InitializationException(utils::Formatter()
+                  << "Recording in " << path << " is only supported in Linux.");
+#endif // defined(__linux__)
+}
+
+int64_t nanoseconds(
+        const fastrtps::rtps::Time_t& time) noexcept
+{
+    return static_cast<int64_t>(time.seconds()) * 1000000000 + time.nanosec();
+}
+
+int64_t now_nanoseconds() noexcept
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+} /* namespace */
+
+SegmentRecorder::SegmentRecorder(
+        const std::shared_ptr<RecorderParticipantConfiguration>& configuration,
+        const std::shared_ptr<ddspipe::core::PayloadPool>& payload_pool)
+    : configuration_(configuration)
+    , payload_pool_(payload_pool)
+    , segment_count_(0)
+    , next_topic_id_(0)
+    , pending_size_(0)
+    , written_count_(0)
+    , queued_count_(0)
+    , sync_started_(0)
+    , sync_finished_(0)
+    , sync_requested_(false)
+    , recorded_(0)
+    , dropped_(0)
+    , writing_(false)
+    , syncing_(false)
+{
+}
+
+SegmentRecorder::~SegmentRecorder()
+{
+    // Stop the writing thread first, it exits once the queue is empty
+    {
+        std::lock_guard<std::mutex> lock(queue_mutex_);
+        writing_ = false;
+    }
+    queue_cv_.notify_all();
+
+    if (write_thread_.joinable())
+    {
+        write_thread_.join();
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(segments_mutex_);
+        syncing_ = false;
+    }
+    segments_cv_.notify_all();
+
+    if (sync_thread_.joinable())
+    {
+        sync_thread_.join();
+    }
+
+    for (auto& segment : retired_segments_)
+    {
+        segment->close();
+    }
+
+    if (current_segment_)
+    {
+        current_segment_->close();
+    }
+
+    // Release the payloads never written, if the threads were never started
+    queue_.clear();
+}
+
+void SegmentRecorder::start()
+{
+    create_directories(configuration_->output_directory);
+
+    char start_time[32];
+    const std::time_t now = std::time(nullptr);
+    std::tm now_tm {};
+    localtime_r(&now, &now_tm);
+    std::strftime(start_time, sizeof(start_time), "%Y%m%d_%H%M%S", &now_tm);
+
+    recording_prefix_ = configuration_->output_directory + "/" + configuration_->id + "_" + start_time;
+
+    current_segment_ = open_segment_();
+
+    writing_ = true;
+    syncing_ = true;
+    write_thread_ = std::thread(&SegmentRecorder::write_routine_, this);
+    sync_thread_ = std::thread(&SegmentRecorder::sync_routine_, this);
+}
+
+uint32_t SegmentRecorder::register_topic(
+        const ddspipe::core::types::DdsTopic& topic)
+{
+    auto recorded_topic = std::make_shared<RecordedTopic>();
+    recorded_topic->id = next_topic_id_++;
+    recorded_topic->name = topic.m_topic_name;
+    recorded_topic->type = topic.type_name;
+    recorded_topic->keyed = topic.topic_qos.keyed.get_value();
+    recorded_topic->reliable =
+            topic.topic_qos.reliability_qos.get_value() == ddspipe::core::types::ReliabilityKind::RELIABLE;
+    recorded_topic->transient_local =
+            topic.topic_qos.durability_qos.get_value() == ddspipe::core::types::DurabilityKind::TRANSIENT_LOCAL;
+
+    PendingRecord record;
+    record.topic = recorded_topic;
+    record.topic_id = recorded_topic->id;
+    record.reception_timestamp = now_nanoseconds();
+
+    // Declarations are never dropped, otherwise the messages of the topic could not be read back
+    {
+        std::lock_guard<std::mutex> lock(queue_mutex_);
+        queue_.push_back(std::move(record));
+        ++queued_count_;
+    }
+    // Flushes wait on the same condition, so waking only one thread could leave the writing thread asleep
+    queue_cv_.notify_all();
+
+    return recorded_topic->id;
+}
+
+bool SegmentRecorder::record(
+        uint32_t topic_id,
+        const ddspipe::core::types::RtpsPayloadData& data) noexcept
+{
+    const uint64_t payload_size = data.payload.length;
+
+    if (sizeof(RecordData) + payload_size > RecordSegment::max_record_size(configuration_->segment_size))
+    {
+        logBinaryWarning(DDSROUTER_RECORDER, "Message of {} bytes does not fit in a segment of {} bytes, not recorded.",
+                payload_size, configuration_->segment_size);
+        ++dropped_;
+        return false;
+    }
+
+    // Take a reference to the payload instead of copying it
+    auto reference = std::make_unique<PooledRtpsPayloadData>();
+    fastrtps::rtps::IPayloadPool* owner = data.payload_owner;
+    if (!payload_pool_->get_payload(data.payload, owner, reference->payload))
+    {
+        logDevError(DDSROUTER_RECORDER, "Failed to get a reference to a payload to record.");
+        ++dropped_;
+        return false;
+    }
+
+    reference->payload_owner = payload_pool_.get();
+    reference->kind = data.kind;
+    reference->instanceHandle = data.instanceHandle;
+    reference->source_timestamp = data.source_timestamp;
+
+    PendingRecord record;
+    record.topic_id = topic_id;
+    record.reception_timestamp = now_nanoseconds();
+
+    {
+        std::lock_guard<std::mutex> lock(queue_mutex_);
+
+        // A message bigger than the limit is still accepted when nothing else is pending
+        if (pending_size_ > 0 && pending_size_ + payload_size > configuration_->max_pending_size)
+        {
+            // The reference is released once the lock is released
+            ++dropped_;
+            return false;
+        }
+
+        record.data = std::move(reference);
+        queue_.push_back(std::move(record));
+        pending_size_ += payload_size;
+        ++queued_count_;
+    }
+    queue_cv_.notify_all();
+
+    return true;
+}
+
+void SegmentRecorder::flush()
+{
+    {
+        std::unique_lock<std::mutex> lock(queue_mutex_);
+        const uint64_t target = queued_count_;
+        queue_cv_.wait(lock, [&]()
+                {
+                    return written_count_ >= target || !writing_;
+                });
+    }
+
+    std::unique_lock<std::mutex> lock(segments_mutex_);
+
+    // A synchronization already running may have missed the last records, so wait for the next one
+    const uint64_t target = sync_started_ + 1;
+    sync_requested_ = true;
+    segments_cv_.notify_all();
+
+    segments_cv_.wait(lock, [&]()
+            {
+                return sync_finished_ >= target || !syncing_;
+            });
+}
+
+uint64_t SegmentRecorder::recorded() const noexcept
+{
+    return recorded_.load(std::memory_order_relaxed);
+}
+
+uint64_t SegmentRecorder::dropped() const noexcept
+{
+    return dropped_.load(std::memory_order_relaxed);
+}
+
+void SegmentRecorder::write_routine_() noexcept
+{
+    std::unique_lock<std::mutex> lock(queue_mutex_);
+
+    while (true)
+    {
+        queue_cv_.wait(lock, [this]()
+                {
+                    return !queue_.empty() || !writing_;
+                });
+
+        if (queue_.empty())
+        {
+            // Not writing anymore and nothing left
+            break;
+        }
+
+        // Take the whole queue at once, so the forwarding threads only contend on the lock briefly
+        std::deque<PendingRecord> batch;
+        batch.swap(queue_);
+        lock.unlock();
+
+        uint64_t batch_size = 0;
+        for (const auto& record : batch)
+        {
+            if (record.topic)
+            {
+                topics_[record.topic_id] = record.topic;
+                if (declared_in_segment_.size() <= record.topic_id)
+                {
+                    declared_in_segment_.resize(record.topic_id + 1, false);
+                }
+            }
+            else
+            {
+                write_data_(record);
+                batch_size += record.data->payload.length;
+            }
+        }
+
+        const uint64_t batch_count = batch.size();
+
+        // Release the payloads without holding the lock
+        batch.clear();
+
+        lock.lock();
+        pending_size_ -= batch_size;
+        written_count_ += batch_count;
+        queue_cv_.notify_all();
+    }
+}
+
+void SegmentRecorder::sync_routine_() noexcept
+{
+    const std::chrono::milliseconds period(configuration_->fsync_period);
+
+    std::unique_lock<std::mutex> lock(segments_mutex_);
+
+    while (true)
+    {
+        segments_cv_.wait_for(lock, period, [this]()
+                {
+                    return sync_requested_ || !retired_segments_.empty() || !syncing_;
+                });
+
+        const bool stop = !syncing_;
+        sync_requested_ = false;
+        ++sync_started_;
+
+        std::shared_ptr<RecordSegment> current = current_segment_;
+        std::vector<std::shared_ptr<RecordSegment>> retired;
+        retired.swap(retired_segments_);
+
+        // Flush every record written in the period at once
+        lock.unlock();
+
+        for (auto& segment : retired)
+        {
+            segment->close();
+            logDebug(DDSROUTER_RECORDER, "Segment " << segment->path() << " closed.");
+        }
+
+        if (current)
+        {
+            current->sync();
+        }
+
+        lock.lock();
+        ++sync_finished_;
+        segments_cv_.notify_all();
+
+        if (stop)
+        {
+            break;
+        }
+    }
+}
+
+void SegmentRecorder::write_data_(
+        const PendingRecord& record) noexcept
+{
+    const auto topic_it = topics_.find(record.topic_id);
+    if (topic_it == topics_.end())
+    {
+        logDevError(DDSROUTER_RECORDER, "Recording a message of unknown topic " << record.topic_id << ".");
+        ++dropped_;
+        return;
+    }
+
+    const auto& data = *record.data;
+    const uint32_t size = static_cast<uint32_t>(sizeof(RecordData) + data.payload.length);
+
+    // If it does not fit in the current segment, it does in the next one
+    for (int attempt = 0; attempt < 2; ++attempt)
+    {
+        if (current_segment_ && (declared_in_segment_[record.topic_id] || write_topic_(*topic_it->second)))
+        {
+            uint64_t offset;
+            uint8_t* buffer = current_segment_->reserve(size, offset);
+
+            if (buffer)
+            {
+                RecordData header{};
+                header.topic_id = record.topic_id;
+                header.kind = static_cast<uint8_t>(data.kind);
+                header.source_timestamp = nanoseconds(data.source_timestamp);
+                header.reception_timestamp = record.reception_timestamp;
+                std::memcpy(header.instance_handle, data.instanceHandle.value, sizeof(header.instance_handle));
+                header.payload_size = data.payload.length;
+
+                std::memcpy(buffer, &header, sizeof(header));
+                std::memcpy(buffer + sizeof(header), data.payload.data, data.payload.length);
+                current_segment_->commit(RECORD_DATA, size);
+
+                RecordIndexEntry entry{};
+                entry.timestamp = record.reception_timestamp;
+                entry.topic_id = record.topic_id;
+                entry.size = size;
+                entry.offset = offset;
+                current_segment_->add_index(entry);
+
+                ++recorded_;
+                return;
+            }
+        }
+
+        if (!rotate_())
+        {
+            break;
+        }
+    }
+
+    ++dropped_;
+}
+
+bool SegmentRecorder::write_topic_(
+        const RecordedTopic& topic) noexcept
+{
+    const uint32_t size = static_cast<uint32_t>(sizeof(RecordTopic) + topic.name.size() + topic.type.size());
+
+    uint64_t offset;
+    uint8_t* buffer = current_segment_->reserve(size, offset);
+    if (!buffer)
+    {
+        return false;
+    }
+
+    RecordTopic header{};
+    header.topic_id = topic.id;
+    header.keyed = topic.keyed;
+    header.reliable = topic.reliable;
+    header.transient_local = topic.transient_local;
+    header.name_size = static_cast<uint32_t>(topic.name.size());
+    header.type_size = static_cast<uint32_t>(topic.type.size());
+
+    std::memcpy(buffer, &header, sizeof(header));
+    std::memcpy(buffer + sizeof(header), topic.name.data(), topic.name.size());
+    std::memcpy(buffer + sizeof(header) + topic.name.size(), topic.type.data(), topic.type.size());
+    current_segment_->commit(RECORD_TOPIC, size);
+
+    declared_in_segment_[topic.id] = true;
+    return true;
+}
+
+bool SegmentRecorder::rotate_() noexcept
+{
+    std::shared_ptr<RecordSegment> next;
+    try
+    {
+        next = open_segment_();
+    }
+    catch (const utils::InitializationException& e)
+    {
+        logWarning(DDSROUTER_RECORDER, "Failed to start a new segment, messages are not recorded: " << e.what());
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(segments_mutex_);
+        if (current_segment_)
+        {
+            retired_segments_.push_back(current_segment_);
+        }
+        current_segment_ = next;
+    }
+    segments_cv_.notify_all();
+
+    declared_in_segment_.assign(declared_in_segment_.size(), false);
+
+    return next != nullptr;
+}
+
+std::shared_ptr<RecordSegment> SegmentRecorder::open_segment_()
+{
+    char number[16];
+    std::snprintf(number, sizeof(number), "_%04u", segment_count_++);
+
+    auto segment = std::make_shared<RecordSegment>(recording_prefix_ + number, configuration_->segment_size);
+    logInfo(DDSROUTER_RECORDER, "Recording in segment " << segment->path() << ".");
+
+    return segment;
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,264 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ReplayerParticipant.cpp
+ *
+ */
+
+#include <cstring>
+
+#include <fastdds/rtps/common/ChangeKind_t.hpp>
+#include <fastdds/rtps/common/Time_t.h>
+
+#include <cpp_utils/exception/InitializationException.hpp>
+#include <cpp_utils/Log.hpp>
+
+#include <ddspipe_core/types/data/RtpsPayloadData.hpp>
+#include <ddspipe_core/types/topic/dds/DdsTopic.hpp>
+
+#include <ddsrouter_core/efficiency/payload/PooledRtpsPayloadData.hpp>
+#include <ddsrouter_core/participants/recorder/RecordFormat.hpp>
+#include <ddsrouter_core/participants/recorder/RecordSegmentReader.hpp>
+#include <ddsrouter_core/participants/replayer/ReplayerParticipant.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+ReplayerParticipant::ReplayerParticipant(
+        const std::shared_ptr<ReplayerParticipantConfiguration>& participant_configuration,
+        const std::shared_ptr<ddspipe::core::PayloadPool>& payload_pool,
+        const std::shared_ptr<ddspipe::core::DiscoveryDatabase>& discovery_database)
+    : InjectorParticipant(participant_configuration->id, payload_pool, discovery_database, 'R')
+    , configuration_(participant_configuration)
+    , recording_start_(0)
+    , started_(false)
+    , replayed_(0)
+    , finished_(false)
+{
+}
+
+ReplayerParticipant::~ReplayerParticipant()
+{
+    stop_();
+
+    if (replay_thread_.joinable())
+    {
+        replay_thread_.join();
+    }
+}
+
+void ReplayerParticipant::init()
+{
+    segments_ = RecordSegmentReader::list_segments(configuration_->input_directory);
+
+    if (segments_.empty())
+    {
+        // Not an error, so a router can be configured before the recording exists
+        logWarning(DDSROUTER_REPLAYER, "No recorded segments in " << configuration_->input_directory << ".");
+        finished_ = true;
+        return;
+    }
+
+    running_ = true;
+    replay_thread_ = std::thread(&ReplayerParticipant::replay_routine_, this);
+}
+
+uint64_t ReplayerParticipant::replayed() const noexcept
+{
+    return replayed_.load();
+}
+
+bool ReplayerParticipant::finished() const noexcept
+{
+    return finished_.load();
+}
+
+void ReplayerParticipant::replay_routine_() noexcept
+{
+    for (const auto& path : segments_)
+    {
+        std::unique_ptr<RecordSegmentReader> segment;
+        try
+        {
+            segment = std::make_unique<RecordSegmentReader>(path, configuration_->prefetch_size);
+        }
+        catch (const utils::InitializationException& e)
+        {
+            logWarning(DDSROUTER_REPLAYER, "Skipping segment " << path << ": " << e.what());
+            continue;
+        }
+
+        logInfo(DDSROUTER_REPLAYER, "Replaying segment " << path << ".");
+
+        RecordType type;
+        const uint8_t* body;
+        uint32_t size;
+
+        while (running_ && segment->next(type, body, size))
+        {
+            switch (type)
+            {
+                case RECORD_TOPIC:
+                    replay_topic_(body, size);
+                    break;
+
+                case RECORD_DATA:
+                    replay_data_(body, size);
+                    break;
+
+                default:
+                    logWarning(DDSROUTER_REPLAYER, "Skipping record of unknown type " << type << " in " << path << ".");
+                    break;
+            }
+        }
+
+        if (!running_)
+        {
+            return;
+        }
+    }
+
+    finished_ = true;
+    logInfo(DDSROUTER_REPLAYER,
+            "Replay of " << configuration_->input_directory << " finished, " << replayed() << " messages replayed.");
+}
+
+void ReplayerParticipant::replay_topic_(
+        const uint8_t* body,
+        uint32_t size) noexcept
+{
+    RecordTopic header;
+    if (size < sizeof(header))
+    {
+        logWarning(DDSROUTER_REPLAYER, "Skipping truncated topic record.");
+        return;
+    }
+
+    std::memcpy(&header, body, sizeof(header));
+
+    if (sizeof(header) + static_cast<uint64_t>(header.name_size) + header.type_size > size)
+    {
+        logWarning(DDSROUTER_REPLAYER, "Skipping truncated topic record.");
+        return;
+    }
+
+    // Every segment declares its topics again
+    if (topics_.find(header.topic_id) != topics_.end())
+    {
+        return;
+    }
+
+    InjectedTopic& replayed_topic = topics_[header.topic_id];
+
+    auto& topic = replayed_topic.topic;
+    const char* names = reinterpret_cast<const char*>(body + sizeof(header));
+    topic.m_topic_name.assign(names, header.name_size);
+    topic.type_name.assign(names + header.name_size, header.type_size);
+    topic.topic_qos.reliability_qos = header.reliable ? ddspipe::core::types::ReliabilityKind::RELIABLE :
+            ddspipe::core::types::ReliabilityKind::BEST_EFFORT;
+    topic.topic_qos.durability_qos = header.transient_local ? ddspipe::core::types::DurabilityKind::TRANSIENT_LOCAL :
+            ddspipe::core::types::DurabilityKind::VOLATILE;
+    topic.topic_qos.keyed = header.keyed != 0;
+
+    announce_(replayed_topic);
+}
+
+void ReplayerParticipant::replay_data_(
+        const uint8_t* body,
+        uint32_t size) noexcept
+{
+    RecordData header;
+    if (size < sizeof(header))
+    {
+        logWarning(DDSROUTER_REPLAYER, "Skipping truncated data record.");
+        return;
+    }
+
+    std::memcpy(&header, body, sizeof(header));
+
+    if (sizeof(header) + static_cast<uint64_t>(header.payload_size) > size)
+    {
+        logWarning(DDSROUTER_REPLAYER, "Skipping truncated data record.");
+        return;
+    }
+
+    auto topic_it = topics_.find(header.topic_id);
+    if (topic_it == topics_.end())
+    {
+        logWarning(DDSROUTER_REPLAYER, "Skipping message of undeclared topic " << header.topic_id << ".");
+        return;
+    }
+
+    std::chrono::steady_clock::duration waited;
+    if (!wait_forwarding_(topic_it->second, waited))
+    {
+        return;
+    }
+
+    // The time waiting for the DDS Router is not part of the replay
+    replay_start_ += waited;
+
+    // Keep the original time between messages, scaled by the speed
+    if (configuration_->speed > 0)
+    {
+        if (!started_)
+        {
+            started_ = true;
+            replay_start_ = std::chrono::steady_clock::now();
+            recording_start_ = header.reception_timestamp;
+        }
+        else
+        {
+            const auto target = replay_start_ + std::chrono::nanoseconds(static_cast<int64_t>(
+                                (header.reception_timestamp - recording_start_) / configuration_->speed));
+
+            if (!wait_until_(target))
+            {
+                return;
+            }
+        }
+    }
+
+    auto data = std::make_unique<PooledRtpsPayloadData>();
+
+    // Instance state changes do not carry payload
+    if (header.payload_size > 0)
+    {
+        if (!payload_pool_->get_payload(header.payload_size, data->payload))
+        {
+            logWarning(DDSROUTER_REPLAYER,
+                    "Failed to allocate payload for recorded message in topic " << topic_it->second.topic << ".");
+            return;
+        }
+
+        std::memcpy(data->payload.data, body + sizeof(header), header.payload_size);
+        data->payload.length = header.payload_size;
+        data->payload_owner = payload_pool_.get();
+    }
+
+    data->kind = static_cast<fastrtps::rtps::ChangeKind_t>(header.kind);
+    std::memcpy(data->instanceHandle.value, header.instance_handle, sizeof(header.instance_handle));
+    data->source_timestamp = fastrtps::rtps::Time_t(
+        static_cast<int32_t>(header.source_timestamp / 1000000000),
+        static_cast<uint32_t>(header.source_timestamp % 1000000000));
+
+    topic_it->second.reader->simulate_data_reception(std::move(data));
+    ++replayed_;
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
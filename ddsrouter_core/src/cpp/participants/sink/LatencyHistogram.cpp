@@ -0,0 +1,164 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file LatencyHistogram.cpp
+ *
+ */
+
+#include <algorithm>
+#include <limits>
+
+#include <ddsrouter_core/participants/sink/LatencyHistogram.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+namespace {
+
+//! Bits of the value that select the sub bucket.
+constexpr uint32_t SUB_BUCKET_BITS = 3;
+
+static_assert((1u << SUB_BUCKET_BITS) == LatencyHistogram::SUB_BUCKETS, "SUB_BUCKETS must be 2^SUB_BUCKET_BITS");
+
+uint32_t highest_bit(
+        uint64_t value) noexcept
+{
+    uint32_t bit = 0;
+    while (value >>= 1)
+    {
+        ++bit;
+    }
+    return bit;
+}
+
+} /* namespace */
+
+LatencyHistogram::LatencyHistogram()
+    : min_(std::numeric_limits<int64_t>::max())
+    , max_(0)
+{
+    for (auto& bucket : buckets_)
+    {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+}
+
+void LatencyHistogram::add(
+        int64_t nanoseconds) noexcept
+{
+    nanoseconds = std::max<int64_t>(nanoseconds, 0);
+
+    buckets_[bucket_(static_cast<uint64_t>(nanoseconds))].fetch_add(1, std::memory_order_relaxed);
+    count_.add();
+    sum_.add(static_cast<uint64_t>(nanoseconds));
+
+    int64_t current = min_.load(std::memory_order_relaxed);
+    while (nanoseconds < current && !min_.compare_exchange_weak(current, nanoseconds, std::memory_order_relaxed))
+    {
+    }
+
+    current = max_.load(std::memory_order_relaxed);
+    while (nanoseconds > current && !max_.compare_exchange_weak(current, nanoseconds, std::memory_order_relaxed))
+    {
+    }
+}
+
+uint64_t LatencyHistogram::count() const noexcept
+{
+    return count_.value();
+}
+
+int64_t LatencyHistogram::min() const noexcept
+{
+    return count() ? min_.load(std::memory_order_relaxed) : 0;
+}
+
+int64_t LatencyHistogram::max() const noexcept
+{
+    return max_.load(std::memory_order_relaxed);
+}
+
+int64_t LatencyHistogram::mean() const noexcept
+{
+    const uint64_t n = count();
+    return n ? static_cast<int64_t>(sum_.value() / n) : 0;
+}
+
+int64_t LatencyHistogram::percentile(
+        double quantile) const noexcept
+{
+    const uint64_t n = count();
+    if (n == 0)
+    {
+        return 0;
+    }
+
+    quantile = std::min(std::max(quantile, 0.0), 1.0);
+    const uint64_t target = std::max<uint64_t>(1, static_cast<uint64_t>(quantile * n + 0.5));
+
+    uint64_t accumulated = 0;
+    for (uint32_t bucket = 0; bucket < BUCKETS; ++bucket)
+    {
+        accumulated += buckets_[bucket].load(std::memory_order_relaxed);
+        if (accumulated >= target)
+        {
+            const uint64_t lower = bucket_lower_bound_(bucket);
+            const uint64_t upper = bucket + 1 < BUCKETS ? bucket_lower_bound_(bucket + 1) : lower + 1;
+            const int64_t middle = static_cast<int64_t>(lower + (upper - lower) / 2);
+
+            // The exact extremes are known, so never report beyond them
+            return std::min(std::max(middle, min()), max());
+        }
+    }
+
+    return max();
+}
+
+uint32_t LatencyHistogram::bucket_(
+        uint64_t value) noexcept
+{
+    // Values below SUB_BUCKETS have a bucket each
+    if (value < SUB_BUCKETS)
+    {
+        return static_cast<uint32_t>(value);
+    }
+
+    const uint32_t exponent = highest_bit(value);
+    if (exponent > MAX_EXPONENT)
+    {
+        return BUCKETS - 1;
+    }
+
+    const uint32_t sub_bucket = static_cast<uint32_t>(value >> (exponent - SUB_BUCKET_BITS)) & (SUB_BUCKETS - 1);
+    return (exponent - SUB_BUCKET_BITS + 1) * SUB_BUCKETS + sub_bucket;
+}
+
+uint64_t LatencyHistogram::bucket_lower_bound_(
+        uint32_t bucket) noexcept
+{
+    if (bucket < SUB_BUCKETS)
+    {
+        return bucket;
+    }
+
+    const uint32_t exponent = bucket / SUB_BUCKETS + SUB_BUCKET_BITS - 1;
+    const uint64_t sub_bucket = bucket % SUB_BUCKETS;
+    return (uint64_t(1) << exponent) + (sub_bucket << (exponent - SUB_BUCKET_BITS));
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,197 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file SinkParticipant.cpp
+ *
+ */
+
+#include <chrono>
+
+#include <cpp_utils/Log.hpp>
+
+#include <ddspipe_core/monitoring/producers/TopicsMonitorProducer.hpp>
+#include <ddspipe_participants/reader/auxiliar/BlankReader.hpp>
+#include <ddspipe_participants/writer/auxiliar/BlankWriter.hpp>
+
+#include <ddsrouter_core/participants/sink/SinkParticipant.hpp>
+#include <ddsrouter_core/participants/sink/SinkWriter.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+SinkParticipant::SinkParticipant(
+        const std::shared_ptr<SinkParticipantConfiguration>& participant_configuration,
+        const std::shared_ptr<ddspipe::core::PayloadPool>& /* payload_pool */,
+        const std::shared_ptr<ddspipe::core::DiscoveryDatabase>& /* discovery_database */)
+    : configuration_(participant_configuration)
+    , statistics_(std::make_shared<SinkStatistics>())
+    , running_(false)
+{
+}
+
+SinkParticipant::~SinkParticipant()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        running_ = false;
+    }
+    cv_.notify_all();
+
+    if (report_thread_.joinable())
+    {
+        report_thread_.join();
+    }
+}
+
+void SinkParticipant::init()
+{
+    // The thread also notifies the topics monitor, so it runs even if no report is logged
+    running_ = true;
+    report_thread_ = std::thread(&SinkParticipant::report_routine_, this);
+}
+
+ddspipe::core::types::ParticipantId SinkParticipant::id() const noexcept
+{
+    return configuration_->id;
+}
+
+bool SinkParticipant::is_repeater() const noexcept
+{
+    return false;
+}
+
+bool SinkParticipant::is_rtps_kind() const noexcept
+{
+    return false;
+}
+
+ddspipe::core::types::TopicQoS SinkParticipant::topic_qos() const noexcept
+{
+    return ddspipe::core::types::TopicQoS();
+}
+
+std::shared_ptr<ddspipe::core::IWriter> SinkParticipant::create_writer(
+        const ddspipe::core::ITopic& topic)
+{
+    const auto* dds_topic = dynamic_cast<const ddspipe::core::types::DdsTopic*>(&topic);
+    if (!dds_topic)
+    {
+        logDebug(DDSROUTER_SINK, "Not creating Writer for topic " << topic.topic_name());
+        return std::make_shared<ddspipe::participants::BlankWriter>();
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(monitored_topics_mutex_);
+
+        // Writers of the same topic name share their counters, so notify them once
+        bool monitored = false;
+        for (const auto& monitored_topic : monitored_topics_)
+        {
+            monitored = monitored || monitored_topic.topic.m_topic_name == dds_topic->m_topic_name;
+        }
+
+        if (!monitored)
+        {
+            monitored_topics_.push_back({*dds_topic, statistics_->topic(dds_topic->m_topic_name), SinkTopicReport()});
+        }
+    }
+
+    return std::make_shared<SinkWriter>(id(), *dds_topic, statistics_, configuration_->check_sequence);
+}
+
+std::shared_ptr<ddspipe::core::IReader> SinkParticipant::create_reader(
+        const ddspipe::core::ITopic& /* topic */)
+{
+    // Nothing is published from a sink
+    return std::make_shared<ddspipe::participants::BlankReader>();
+}
+
+SinkReport SinkParticipant::report() const noexcept
+{
+    return statistics_->report();
+}
+
+void SinkParticipant::report_routine_() noexcept
+{
+    const bool log_reports = configuration_->report_period > 0;
+    const std::chrono::milliseconds period(log_reports ? configuration_->report_period : MONITOR_PERIOD);
+
+    SinkReport last = report();
+    auto last_time = std::chrono::steady_clock::now();
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (!cv_.wait_for(lock, period, [this]()
+            {
+                return !running_;
+            }))
+    {
+        notify_monitor_();
+
+        if (!log_reports)
+        {
+            continue;
+        }
+
+        const SinkReport current = report();
+        const auto now = std::chrono::steady_clock::now();
+        const double seconds = std::chrono::duration<double>(now - last_time).count();
+
+        logInfo(DDSROUTER_SINK,
+                "Sink " << id() << ": "
+                        << (current.messages - last.messages) / seconds << " msgs/s, "
+                        << (current.bytes - last.bytes) / seconds / (1024 * 1024) << " MiB/s, latency (us)"
+                        << " min " << current.latency_min / 1000
+                        << " mean " << current.latency_mean / 1000
+                        << " p50 " << current.latency_p50 / 1000
+                        << " p99 " << current.latency_p99 / 1000
+                        << " max " << current.latency_max / 1000
+                        << ", lost " << current.lost - last.lost
+                        << ", out of order " << current.out_of_order - last.out_of_order << ".");
+
+        last = current;
+        last_time = now;
+    }
+
+    // Do not lose the messages received since the last period
+    notify_monitor_();
+}
+
+void SinkParticipant::notify_monitor_() noexcept
+{
+    std::lock_guard<std::mutex> lock(monitored_topics_mutex_);
+
+    for (auto& monitored_topic : monitored_topics_)
+    {
+        const SinkTopicReport current = monitored_topic.statistics->report();
+
+        // The topics monitor counts the messages one by one
+        for (uint64_t i = monitored_topic.notified.messages; i < current.messages; ++i)
+        {
+            monitor_msg_rx(monitored_topic.topic, id());
+        }
+
+        for (uint64_t i = monitored_topic.notified.lost; i < current.lost; ++i)
+        {
+            monitor_msg_lost(monitored_topic.topic, id());
+        }
+
+        monitored_topic.notified = current;
+    }
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
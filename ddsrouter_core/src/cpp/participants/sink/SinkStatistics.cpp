@@ -0,0 +1,130 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file SinkStatistics.cpp
+ *
+ */
+
+#include <ddsrouter_core/participants/sink/SinkStatistics.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+SinkTopicStatistics::SinkTopicStatistics()
+    : messages_(0)
+    , bytes_(0)
+    , lost_(0)
+    , out_of_order_(0)
+    , last_sequence_(0)
+{
+}
+
+void SinkTopicStatistics::add_message(
+        uint64_t size) noexcept
+{
+    messages_.fetch_add(1, std::memory_order_relaxed);
+    bytes_.fetch_add(size, std::memory_order_relaxed);
+}
+
+uint64_t SinkTopicStatistics::add_sequence(
+        uint64_t sequence) noexcept
+{
+    uint64_t last = last_sequence_.load(std::memory_order_relaxed);
+    while (sequence > last && !last_sequence_.compare_exchange_weak(last, sequence, std::memory_order_relaxed))
+    {
+    }
+
+    if (sequence <= last)
+    {
+        out_of_order_.fetch_add(1, std::memory_order_relaxed);
+        return 0;
+    }
+
+    const uint64_t lost = sequence - last - 1;
+    if (lost > 0)
+    {
+        lost_.fetch_add(lost, std::memory_order_relaxed);
+    }
+    return lost;
+}
+
+SinkTopicReport SinkTopicStatistics::report() const noexcept
+{
+    SinkTopicReport report;
+    report.messages = messages_.load(std::memory_order_relaxed);
+    report.bytes = bytes_.load(std::memory_order_relaxed);
+    report.lost = lost_.load(std::memory_order_relaxed);
+    report.out_of_order = out_of_order_.load(std::memory_order_relaxed);
+    return report;
+}
+
+SinkStatistics::SinkStatistics()
+{
+}
+
+void SinkStatistics::add_message(
+        uint64_t size) noexcept
+{
+    messages_.add();
+    bytes_.add(size);
+}
+
+void SinkStatistics::add_latency(
+        int64_t nanoseconds) noexcept
+{
+    latency_.add(nanoseconds);
+}
+
+std::shared_ptr<SinkTopicStatistics> SinkStatistics::topic(
+        const std::string& topic_name)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    auto& statistics = topics_[topic_name];
+    if (!statistics)
+    {
+        statistics = std::make_shared<SinkTopicStatistics>();
+    }
+    return statistics;
+}
+
+SinkReport SinkStatistics::report() const noexcept
+{
+    SinkReport report;
+    report.messages = messages_.value();
+    report.bytes = bytes_.value();
+    report.generated = latency_.count();
+    report.latency_min = latency_.min();
+    report.latency_mean = latency_.mean();
+    report.latency_p50 = latency_.percentile(0.5);
+    report.latency_p99 = latency_.percentile(0.99);
+    report.latency_max = latency_.max();
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const auto& it : topics_)
+    {
+        const SinkTopicReport topic_report = it.second->report();
+        report.lost += topic_report.lost;
+        report.out_of_order += topic_report.out_of_order;
+        report.topics[it.first] = topic_report;
+    }
+
+    return report;
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
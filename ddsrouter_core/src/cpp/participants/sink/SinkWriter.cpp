@@ -0,0 +1,72 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file SinkWriter.cpp
+ *
+ */
+
+#include <cpp_utils/Log.hpp>
+
+#include <ddsrouter_core/participants/decorator/routing_data.hpp>
+#include <ddsrouter_core/participants/generator/GeneratedPayload.hpp>
+#include <ddsrouter_core/participants/sink/SinkWriter.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+SinkWriter::SinkWriter(
+        const ddspipe::core::types::ParticipantId& participant_id,
+        const ddspipe::core::types::DdsTopic& topic,
+        const std::shared_ptr<SinkStatistics>& statistics,
+        bool check_sequence)
+    : ddspipe::participants::BaseWriter(participant_id)
+    , topic_(topic)
+    , statistics_(statistics)
+    , topic_statistics_(statistics->topic(topic.m_topic_name))
+    , check_sequence_(check_sequence)
+{
+}
+
+utils::ReturnCode SinkWriter::write_nts_(
+        ddspipe::core::IRoutingData& data) noexcept
+{
+    const auto* rtps_data = as_rtps_data(data);
+    if (!rtps_data)
+    {
+        logDevError(DDSROUTER_SINK, "Sink writer in topic " << topic_ << " received data of an unknown kind.");
+        return utils::ReturnCode::RETCODE_ERROR;
+    }
+
+    statistics_->add_message(rtps_data->payload.length);
+    topic_statistics_->add_message(rtps_data->payload.length);
+
+    GeneratedPayloadHeader header;
+    if (read_generated_payload_header(rtps_data->payload.data, rtps_data->payload.length, header))
+    {
+        statistics_->add_latency(generated_payload_now() - header.timestamp);
+
+        if (check_sequence_)
+        {
+            topic_statistics_->add_sequence(header.sequence);
+        }
+    }
+
+    return utils::ReturnCode::RETCODE_OK;
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,68 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file TracingParticipant.cpp
+ *
+ */
+
+#include <ddspipe_core/types/topic/dds/DdsTopic.hpp>
+
+#include <ddsrouter_core/participants/tracing/TracingParticipant.hpp>
+#include <ddsrouter_core/participants/tracing/TracingReader.hpp>
+#include <ddsrouter_core/participants/tracing/TracingWriter.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+TracingParticipant::TracingParticipant(
+        const std::shared_ptr<ddspipe::core::IParticipant>& participant,
+        const std::shared_ptr<PipelineTracer>& tracer)
+    : ParticipantDecorator(participant)
+    , tracer_(tracer)
+{
+}
+
+std::shared_ptr<ddspipe::core::IWriter> TracingParticipant::create_writer(
+        const ddspipe::core::ITopic& topic)
+{
+    std::shared_ptr<ddspipe::core::IWriter> writer = participant_->create_writer(topic);
+
+    const auto* dds_topic = dynamic_cast<const ddspipe::core::types::DdsTopic*>(&topic);
+    if (!dds_topic)
+    {
+        return writer;
+    }
+
+    return std::make_shared<TracingWriter>(writer, tracer_, tracer_->register_endpoint(id(), *dds_topic));
+}
+
+std::shared_ptr<ddspipe::core::IReader> TracingParticipant::create_reader(
+        const ddspipe::core::ITopic& topic)
+{
+    std::shared_ptr<ddspipe::core::IReader> reader = participant_->create_reader(topic);
+
+    const auto* dds_topic = dynamic_cast<const ddspipe::core::types::DdsTopic*>(&topic);
+    if (!dds_topic)
+    {
+        return reader;
+    }
+
+    return std::make_shared<TracingReader>(reader, tracer_, tracer_->register_endpoint(id(), *dds_topic));
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
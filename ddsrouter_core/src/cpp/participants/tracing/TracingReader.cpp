@@ -0,0 +1,96 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file TracingReader.cpp
+ *
+ */
+
+#include <ddsrouter_core/participants/tracing/TracingReader.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+TracingReader::TracingReader(
+        const std::shared_ptr<ddspipe::core::IReader>& reader,
+        const std::shared_ptr<PipelineTracer>& tracer,
+        const std::shared_ptr<TracedEndpoint>& endpoint)
+    : ReaderDecorator(reader)
+    , tracer_(tracer)
+    , endpoint_(endpoint)
+    , taking_(false)
+{
+}
+
+void TracingReader::set_on_data_available_callback(
+        std::function<void()> on_data_available_lambda) noexcept
+{
+    reader_->set_on_data_available_callback(
+        [this, on_data_available_lambda]()
+        {
+            if (!endpoint_->enabled.load(std::memory_order_relaxed))
+            {
+                on_data_available_lambda();
+                return;
+            }
+
+            // The DDS Pipe queues the slot of the reader in the thread pool within the callback
+            const int64_t notified = PipelineTracer::now();
+            tracer_->record(*endpoint_, TraceStage::notification, notified, notified);
+
+            on_data_available_lambda();
+
+            tracer_->record(*endpoint_, TraceStage::enqueue, notified, PipelineTracer::now());
+        });
+}
+
+utils::ReturnCode TracingReader::take(
+        std::unique_ptr<ddspipe::core::IRoutingData>& data) noexcept
+{
+    if (!endpoint_->enabled.load(std::memory_order_relaxed))
+    {
+        taking_.store(false, std::memory_order_relaxed);
+        return reader_->take(data);
+    }
+
+    const int64_t begin = PipelineTracer::now();
+
+    if (!taking_.exchange(true, std::memory_order_relaxed))
+    {
+        tracer_->record(*endpoint_, TraceStage::dequeue, begin, begin);
+    }
+
+    utils::ReturnCode ret = reader_->take(data);
+
+    if (ret == utils::ReturnCode::RETCODE_OK)
+    {
+        const uint32_t sample = endpoint_->samples.fetch_add(1, std::memory_order_relaxed) + 1;
+        tracer_->record(*endpoint_, TraceStage::payload_copy, begin, PipelineTracer::now(), endpoint_.get(), sample);
+
+        // The DDS Pipe writes the sample from this same thread
+        PipelineTracer::set_current_sample(endpoint_.get(), sample);
+    }
+    else
+    {
+        taking_.store(false, std::memory_order_relaxed);
+        PipelineTracer::set_current_sample(nullptr, 0);
+    }
+
+    return ret;
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
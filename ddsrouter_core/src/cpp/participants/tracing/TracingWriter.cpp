@@ -0,0 +1,61 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file TracingWriter.cpp
+ *
+ */
+
+#include <ddsrouter_core/participants/tracing/TracingWriter.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+TracingWriter::TracingWriter(
+        const std::shared_ptr<ddspipe::core::IWriter>& writer,
+        const std::shared_ptr<PipelineTracer>& tracer,
+        const std::shared_ptr<TracedEndpoint>& endpoint)
+    : WriterDecorator(writer)
+    , tracer_(tracer)
+    , endpoint_(endpoint)
+{
+}
+
+utils::ReturnCode TracingWriter::write(
+        ddspipe::core::IRoutingData& data) noexcept
+{
+    if (!endpoint_->enabled.load(std::memory_order_relaxed))
+    {
+        return writer_->write(data);
+    }
+
+    const int64_t begin = PipelineTracer::now();
+
+    utils::ReturnCode ret = writer_->write(data);
+
+    tracer_->record(
+        *endpoint_,
+        TraceStage::write,
+        begin,
+        PipelineTracer::now(),
+        PipelineTracer::current_source(),
+        PipelineTracer::current_sample());
+
+    return ret;
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,76 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ReadinessParticipant.cpp
+ *
+ */
+
+#include <chrono>
+
+#include <ddsrouter_core/participants/warmup/ReadinessParticipant.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+ReadinessParticipant::ReadinessParticipant(
+        const std::shared_ptr<ddspipe::core::IParticipant>& participant,
+        const std::shared_ptr<TopicReadinessTracker>& tracker)
+    : ParticipantDecorator(participant)
+    , tracker_(tracker)
+{
+}
+
+std::shared_ptr<ddspipe::core::IWriter> ReadinessParticipant::create_writer(
+        const ddspipe::core::ITopic& topic)
+{
+    const auto start = std::chrono::steady_clock::now();
+
+    try
+    {
+        auto writer = participant_->create_writer(topic);
+        tracker_->endpoint_created(topic.topic_name(), true, std::chrono::steady_clock::now() - start,
+                writer != nullptr);
+        return writer;
+    }
+    catch (...)
+    {
+        tracker_->endpoint_created(topic.topic_name(), true, std::chrono::steady_clock::now() - start, false);
+        throw;
+    }
+}
+
+std::shared_ptr<ddspipe::core::IReader> ReadinessParticipant::create_reader(
+        const ddspipe::core::ITopic& topic)
+{
+    const auto start = std::chrono::steady_clock::now();
+
+    try
+    {
+        auto reader = participant_->create_reader(topic);
+        tracker_->endpoint_created(topic.topic_name(), false, std::chrono::steady_clock::now() - start,
+                reader != nullptr);
+        return reader;
+    }
+    catch (...)
+    {
+        tracker_->endpoint_created(topic.topic_name(), false, std::chrono::steady_clock::now() - start, false);
+        throw;
+    }
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
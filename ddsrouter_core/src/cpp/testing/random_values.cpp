@@ -24,6 +24,12 @@
 #include <ddspipe_participants/configuration/SimpleParticipantConfiguration.hpp>
 #include <ddspipe_participants/configuration/XmlParticipantConfiguration.hpp>
 
+#include <ddsrouter_core/configuration/GeneratorParticipantConfiguration.hpp>
+#include <ddsrouter_core/configuration/InProcessParticipantConfiguration.hpp>
+#include <ddsrouter_core/configuration/IpcParticipantConfiguration.hpp>
+#include <ddsrouter_core/configuration/RecorderParticipantConfiguration.hpp>
+#include <ddsrouter_core/configuration/ReplayerParticipantConfiguration.hpp>
+#include <ddsrouter_core/configuration/SinkParticipantConfiguration.hpp>
 #include <ddsrouter_core/testing/random_values.hpp>
 #include <ddsrouter_core/types/ParticipantKind.hpp>
 
@@ -89,6 +95,57 @@ std::shared_ptr<ParticipantConfiguration> random_participant_configuration(
             return c;
         }
 
+        case ParticipantKind::ipc:
+        {
+            auto c = std::make_shared<IpcParticipantConfiguration>();
+            c->id = id;
+            c->channel = "channel_" + std::to_string(seed);
+            return c;
+        }
+
+        case ParticipantKind::inprocess:
+        {
+            auto c = std::make_shared<InProcessParticipantConfiguration>();
+            c->id = id;
+            c->channel = "channel_" + std::to_string(seed);
+            return c;
+        }
+
+        case ParticipantKind::recorder:
+        {
+            auto c = std::make_shared<RecorderParticipantConfiguration>();
+            c->id = id;
+            c->output_directory = "records_" + std::to_string(seed);
+            return c;
+        }
+
+        case ParticipantKind::replayer:
+        {
+            // Replay the working directory, that has no segments, so nothing is injected
+            auto c = std::make_shared<ReplayerParticipantConfiguration>();
+            c->id = id;
+            c->input_directory = ".";
+            return c;
+        }
+
+        case ParticipantKind::generator:
+        {
+            auto c = std::make_shared<GeneratorParticipantConfiguration>();
+            c->id = id;
+            GeneratedTopicConfiguration topic;
+            topic.topic_name = "generated_" + std::to_string(seed);
+            topic.rate = 10;
+            c->topics.push_back(topic);
+            return c;
+        }
+
+        case ParticipantKind::sink:
+        {
+            auto c = std::make_shared<SinkParticipantConfiguration>();
+            c->id = id;
+            return c;
+        }
+
         default:
             throw eprosima::utils::InconsistencyException("No valid kind");
     }
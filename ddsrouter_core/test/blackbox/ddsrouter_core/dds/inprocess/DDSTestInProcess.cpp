@@ -0,0 +1,175 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <atomic>
+#include <thread>
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <ddspipe_core/types/topic/filter/WildcardDdsFilterTopic.hpp>
+
+#include <ddspipe_participants/configuration/SimpleParticipantConfiguration.hpp>
+
+#include <ddsrouter_core/configuration/InProcessParticipantConfiguration.hpp>
+#include <ddsrouter_core/core/DdsRouter.hpp>
+#include <ddsrouter_core/participants/inprocess/InProcessChannel.hpp>
+
+#include <test_participants.hpp>
+
+using namespace eprosima;
+using namespace eprosima::ddspipe;
+using namespace eprosima::ddsrouter::core;
+
+namespace test {
+
+constexpr const uint32_t DEFAULT_SAMPLES_TO_RECEIVE = 5;
+constexpr const uint32_t DEFAULT_MILLISECONDS_PUBLISH_LOOP = 100;
+
+/**
+ * @brief Create a configuration for a DDS Router embedded in the test
+ *
+ * Create a configuration with 1 topic
+ * Create 1 simple participant in domain 0
+ * Create 1 in process participant in channel \c channel
+ *
+ * @return DdsRouterConfiguration
+ */
+DdsRouterConfiguration router_configuration(
+        const std::string& channel)
+{
+    DdsRouterConfiguration conf;
+
+    // One topic
+    core::types::WildcardDdsFilterTopic topic;
+    topic.topic_name.set_value(TOPIC_NAME);
+    conf.ddspipe_configuration.allowlist.insert(
+        utils::Heritable<core::types::WildcardDdsFilterTopic>::make_heritable(topic));
+
+    auto inprocess = std::make_shared<InProcessParticipantConfiguration>();
+    inprocess->id = core::types::ParticipantId("inprocess_participant");
+    inprocess->channel = channel;
+    conf.participants_configurations.insert({types::ParticipantKind::inprocess, inprocess});
+
+    auto simple = std::make_shared<participants::SimpleParticipantConfiguration>();
+    simple->id = core::types::ParticipantId("simple_participant");
+    simple->domain.domain_id = 0u;
+    conf.participants_configurations.insert({types::ParticipantKind::simple, simple});
+
+    return conf;
+}
+
+//! Topic of the HelloWorld samples as seen by the DDS Router.
+core::types::DdsTopic hello_world_topic()
+{
+    core::types::DdsTopic topic;
+    topic.m_topic_name = TOPIC_NAME;
+    topic.type_name = "HelloWorld";
+    return topic;
+}
+
+} /* namespace test */
+
+/**
+ * Test that samples published by the application through an in process channel reach a DDS Subscriber.
+ */
+TEST(DDSTestInProcess, end_to_end_inprocess_publish)
+{
+    std::atomic<uint32_t> samples_received(0);
+
+    HelloWorld msg;
+    msg.message("Testing DdsRouter Blackbox In Process Communication ...");
+
+    // Create DDS Subscriber in domain 0
+    TestSubscriber<HelloWorld> subscriber;
+    ASSERT_TRUE(subscriber.init(0, &msg, &samples_received));
+
+    // The application may get the channel before the router is created
+    auto channel = InProcessChannel::get("ddstest_inprocess_publish");
+    channel->announce_publication(test::hello_world_topic());
+
+    DdsRouter router(test::router_configuration("ddstest_inprocess_publish"));
+    router.start();
+
+    HelloWorldPubSubType type;
+    uint32_t samples_sent = 0;
+
+    while (samples_received.load() < test::DEFAULT_SAMPLES_TO_RECEIVE)
+    {
+        msg.index(++samples_sent);
+
+        // Serialize the sample directly in a payload of the router
+        auto data = channel->loan(type.getSerializedSizeProvider(&msg)());
+        ASSERT_NE(data, nullptr);
+        ASSERT_TRUE(type.serialize(&msg, &data->payload));
+
+        // The router may not have created the reader of the topic yet
+        channel->publish(test::hello_world_topic(), std::move(data));
+
+        eprosima::utils::sleep_for(test::DEFAULT_MILLISECONDS_PUBLISH_LOOP);
+    }
+
+    router.stop();
+}
+
+/**
+ * Test that samples published by a DDS Publisher reach the application through an in process channel.
+ */
+TEST(DDSTestInProcess, end_to_end_inprocess_subscribe)
+{
+    std::atomic<uint32_t> samples_received(0);
+
+    HelloWorld msg;
+    msg.message("Testing DdsRouter Blackbox In Process Communication ...");
+
+    auto channel = InProcessChannel::get("ddstest_inprocess_subscribe");
+    channel->subscribe(
+        test::hello_world_topic(),
+        [&](const core::types::DdsTopic&, const core::types::RtpsPayloadData& data)
+        {
+            HelloWorldPubSubType type;
+            HelloWorld received;
+            auto payload = const_cast<eprosima::fastrtps::rtps::SerializedPayload_t*>(&data.payload);
+            if (type.deserialize(payload, &received) && received.message() == msg.message())
+            {
+                samples_received++;
+            }
+        });
+
+    DdsRouter router(test::router_configuration("ddstest_inprocess_subscribe"));
+    router.start();
+
+    // Create DDS Publisher in domain 0
+    TestPublisher<HelloWorld> publisher;
+    ASSERT_TRUE(publisher.init(0));
+
+    uint32_t samples_sent = 0;
+    while (samples_received.load() < test::DEFAULT_SAMPLES_TO_RECEIVE)
+    {
+        msg.index(++samples_sent);
+        publisher.publish(msg);
+        eprosima::utils::sleep_for(test::DEFAULT_MILLISECONDS_PUBLISH_LOOP);
+    }
+
+    router.stop();
+    channel->unsubscribe(test::hello_world_topic());
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,292 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <new>
+#include <thread>
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <ddspipe_core/types/topic/filter/WildcardDdsFilterTopic.hpp>
+
+#include <ddsrouter_core/configuration/InProcessParticipantConfiguration.hpp>
+#include <ddsrouter_core/core/DdsRouter.hpp>
+#include <ddsrouter_core/participants/inprocess/InProcessChannel.hpp>
+
+using namespace eprosima;
+using namespace eprosima::ddspipe;
+using namespace eprosima::ddsrouter::core;
+
+#if defined(__GLIBC__)
+extern "C" {
+void* __libc_malloc(
+        std::size_t size);
+void* __libc_calloc(
+        std::size_t count,
+        std::size_t size);
+void* __libc_realloc(
+        void* memory,
+        std::size_t size);
+} // extern "C"
+#endif // defined(__GLIBC__)
+
+namespace test {
+
+constexpr const char* TOPIC_NAME = "allocations_topic";
+constexpr const char* INPUT_CHANNEL = "ddstest_allocations_input";
+constexpr const char* OUTPUT_CHANNEL = "ddstest_allocations_output";
+
+//! Samples routed before counting, so every endpoint, pool and queue of the DDS Router is created.
+constexpr const uint32_t WARM_UP_SAMPLES = 1000;
+
+//! Samples routed while counting the allocations.
+constexpr const uint32_t MEASURED_SAMPLES = 10000;
+
+//! Allocations allowed while measuring, whatever the samples routed, for containers that grow once after warm up.
+constexpr const uint64_t MAX_ALLOCATIONS = 16;
+
+constexpr const uint32_t SAMPLE_SIZE = 64;
+constexpr const uint32_t HISTORY_DEPTH = 100;
+
+//! Maximum time for a sample to be routed.
+constexpr const std::chrono::seconds ROUTING_TIMEOUT(5);
+
+//! Whether to count the allocations of every thread of the process.
+std::atomic<bool> counting_allocations(false);
+
+//! Allocations made while counting.
+std::atomic<uint64_t> allocations(0);
+
+void count_allocation() noexcept
+{
+    if (counting_allocations.load(std::memory_order_relaxed))
+    {
+        allocations.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+//! Allocate without counting, as the allocation is counted by the caller.
+void* raw_malloc(
+        std::size_t size) noexcept
+{
+#if defined(__GLIBC__)
+    return __libc_malloc(size);
+#else
+    return std::malloc(size);
+#endif // defined(__GLIBC__)
+}
+
+/**
+ * @brief Create a configuration for a DDS Router between two in process channels
+ *
+ * Create a configuration with 1 topic and preallocated histories
+ * Create 1 in process participant in channel \c INPUT_CHANNEL
+ * Create 1 in process participant in channel \c OUTPUT_CHANNEL
+ *
+ * @return DdsRouterConfiguration
+ */
+DdsRouterConfiguration router_configuration()
+{
+    DdsRouterConfiguration conf;
+
+    // One topic
+    core::types::WildcardDdsFilterTopic topic;
+    topic.topic_name.set_value(TOPIC_NAME);
+    conf.ddspipe_configuration.allowlist.insert(
+        utils::Heritable<core::types::WildcardDdsFilterTopic>::make_heritable(topic));
+
+    // Serve every payload from the slots reserved with the bridge
+    conf.advanced_options.preallocate_histories = true;
+    conf.advanced_options.max_sample_size = SAMPLE_SIZE;
+
+    auto input = std::make_shared<InProcessParticipantConfiguration>();
+    input->id = core::types::ParticipantId("input_participant");
+    input->channel = INPUT_CHANNEL;
+    conf.participants_configurations.insert({types::ParticipantKind::inprocess, input});
+
+    auto output = std::make_shared<InProcessParticipantConfiguration>();
+    output->id = core::types::ParticipantId("output_participant");
+    output->channel = OUTPUT_CHANNEL;
+    conf.participants_configurations.insert({types::ParticipantKind::inprocess, output});
+
+    return conf;
+}
+
+//! Reliable topic with a bounded history, as seen by the DDS Router.
+core::types::DdsTopic topic()
+{
+    core::types::DdsTopic topic;
+    topic.m_topic_name = TOPIC_NAME;
+    topic.type_name = "AllocationsType";
+    topic.topic_qos.reliability_qos = core::types::ReliabilityKind::RELIABLE;
+    topic.topic_qos.history_depth = HISTORY_DEPTH;
+    return topic;
+}
+
+/**
+ * @brief Publish a sample in the input channel and wait until it comes out of the output channel
+ *
+ * @return whether the sample has been routed before \c ROUTING_TIMEOUT
+ */
+bool route_sample(
+        InProcessChannel& input,
+        const core::types::DdsTopic& topic,
+        const std::atomic<uint32_t>& samples_received)
+{
+    static const uint8_t sample[SAMPLE_SIZE] = {};
+
+    const uint32_t expected = samples_received.load() + 1;
+    const auto timeout = std::chrono::steady_clock::now() + ROUTING_TIMEOUT;
+
+    // The router may not have created the reader of the topic yet
+    while (input.publish(topic, sample, SAMPLE_SIZE) != utils::ReturnCode::RETCODE_OK)
+    {
+        if (std::chrono::steady_clock::now() > timeout)
+        {
+            return false;
+        }
+        std::this_thread::yield();
+    }
+
+    while (samples_received.load() < expected)
+    {
+        if (std::chrono::steady_clock::now() > timeout)
+        {
+            return false;
+        }
+        std::this_thread::yield();
+    }
+
+    return true;
+}
+
+} /* namespace test */
+
+#if defined(__GLIBC__)
+extern "C" {
+
+void* malloc(
+        std::size_t size)
+{
+    test::count_allocation();
+    return __libc_malloc(size);
+}
+
+void* calloc(
+        std::size_t count,
+        std::size_t size)
+{
+    test::count_allocation();
+    return __libc_calloc(count, size);
+}
+
+void* realloc(
+        void* memory,
+        std::size_t size)
+{
+    test::count_allocation();
+    return __libc_realloc(memory, size);
+}
+
+} // extern "C"
+#endif // defined(__GLIBC__)
+
+void* operator new(
+        std::size_t size)
+{
+    test::count_allocation();
+
+    void* memory = test::raw_malloc(size == 0 ? 1 : size);
+    if (!memory)
+    {
+        throw std::bad_alloc();
+    }
+    return memory;
+}
+
+void operator delete(
+        void* memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete(
+        void* memory,
+        std::size_t /* size */) noexcept
+{
+    std::free(memory);
+}
+
+/**
+ * Test that once warmed up, the DDS Router routes samples between two in process channels without allocating memory
+ * for each of them.
+ */
+TEST(DDSTestInProcessAllocations, no_allocations_per_sample)
+{
+    std::atomic<uint32_t> samples_received(0);
+    const core::types::DdsTopic topic = test::topic();
+
+    auto input = InProcessChannel::get(test::INPUT_CHANNEL);
+    input->announce_publication(topic);
+
+    auto output = InProcessChannel::get(test::OUTPUT_CHANNEL);
+    output->subscribe(
+        topic,
+        [&](const core::types::DdsTopic&, const core::types::RtpsPayloadData&)
+        {
+            samples_received++;
+        });
+
+    DdsRouter router(test::router_configuration());
+    router.start();
+
+    for (uint32_t i = 0; i < test::WARM_UP_SAMPLES; ++i)
+    {
+        ASSERT_TRUE(test::route_sample(*input, topic, samples_received));
+    }
+
+    test::counting_allocations = true;
+
+    bool routed = true;
+    for (uint32_t i = 0; i < test::MEASURED_SAMPLES && routed; ++i)
+    {
+        routed = test::route_sample(*input, topic, samples_received);
+    }
+
+    test::counting_allocations = false;
+
+    ASSERT_TRUE(routed);
+
+    // A container of the DDS Pipe may still grow once (e.g. a new chunk of a queue), but routing a sample must not
+    // allocate anything by itself, so the allocations do not depend on the samples routed
+    ASSERT_LE(test::allocations.load(), test::MAX_ALLOCATIONS)
+        << test::allocations.load() << " allocations routing " << test::MEASURED_SAMPLES << " samples.";
+
+    ASSERT_EQ(router.payload_pool_statistics().heap, 0u);
+
+    router.stop();
+    output->unsubscribe(topic);
+    input->withdraw_publication(topic);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,172 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <atomic>
+#include <thread>
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <ddspipe_core/types/topic/filter/WildcardDdsFilterTopic.hpp>
+
+#include <ddspipe_participants/configuration/SimpleParticipantConfiguration.hpp>
+
+#include <ddsrouter_core/configuration/IpcParticipantConfiguration.hpp>
+#include <ddsrouter_core/core/DdsRouter.hpp>
+
+#include <test_participants.hpp>
+
+using namespace eprosima;
+using namespace eprosima::ddspipe;
+using namespace eprosima::ddsrouter::core;
+
+namespace test {
+
+constexpr const uint32_t DEFAULT_SAMPLES_TO_RECEIVE = 5;
+constexpr const uint32_t DEFAULT_MILLISECONDS_PUBLISH_LOOP = 100;
+constexpr const uint32_t DEFAULT_MESSAGE_SIZE = 1; // x50 bytes
+
+/**
+ * @brief Create a configuration for one of the DDS Routers
+ *
+ * Create a configuration with 1 topic
+ * Create 1 simple participant in domain \c domain
+ * Create 1 IPC participant in channel \c channel
+ *
+ * @return DdsRouterConfiguration
+ */
+DdsRouterConfiguration router_configuration(
+        const std::string& channel,
+        core::types::DomainIdType domain)
+{
+    DdsRouterConfiguration conf;
+
+    // One topic
+    core::types::WildcardDdsFilterTopic topic;
+    topic.topic_name.set_value(TOPIC_NAME);
+    conf.ddspipe_configuration.allowlist.insert(
+        utils::Heritable<core::types::WildcardDdsFilterTopic>::make_heritable(topic));
+
+    auto ipc = std::make_shared<IpcParticipantConfiguration>();
+    ipc->id = core::types::ParticipantId("ipc_participant_" + std::to_string(domain));
+    ipc->channel = channel;
+    conf.participants_configurations.insert({types::ParticipantKind::ipc, ipc});
+
+    auto simple = std::make_shared<participants::SimpleParticipantConfiguration>();
+    simple->id = core::types::ParticipantId("simple_participant_" + std::to_string(domain));
+    simple->domain.domain_id = domain;
+    conf.participants_configurations.insert({types::ParticipantKind::simple, simple});
+
+    return conf;
+}
+
+/**
+ * Test communication between two DDS Participants hosted in the same device, but which are at different DDS domains.
+ * This is accomplished by connecting two IPC Participants belonging to different DDS Router instances through a
+ * shared memory channel. These router instances communicate with the DDS Participants through Simple Participants
+ * deployed at those domains.
+ */
+void test_ipc_communication(
+        const std::string& channel,
+        uint32_t samples_to_receive = DEFAULT_SAMPLES_TO_RECEIVE,
+        uint32_t time_between_samples = DEFAULT_MILLISECONDS_PUBLISH_LOOP,
+        uint32_t msg_size = DEFAULT_MESSAGE_SIZE)
+{
+    uint32_t samples_sent = 0;
+    std::atomic<uint32_t> samples_received(0);
+
+    // Create a message with size specified by repeating the same string
+    HelloWorld msg;
+    std::string msg_str;
+
+    // Add this string as many times as the msg size requires
+    for (uint32_t i = 0; i < msg_size; i++)
+    {
+        msg_str += "Testing DdsRouter Blackbox Local Communication ...";
+    }
+    msg.message(msg_str);
+
+    // Create DDS Publisher in domain 0
+    TestPublisher<HelloWorld> publisher;
+    ASSERT_TRUE(publisher.init(0));
+
+    // Create DDS Subscriber in domain 1
+    TestSubscriber<HelloWorld> subscriber;
+    ASSERT_TRUE(subscriber.init(1, &msg, &samples_received));
+
+    // Create the DdsRouter at each side of the channel
+    DdsRouter router_0(router_configuration(channel, 0));
+    router_0.start();
+
+    DdsRouter router_1(router_configuration(channel, 1));
+    router_1.start();
+
+    // Start publishing
+    while (samples_received.load() < samples_to_receive)
+    {
+        msg.index(++samples_sent);
+        publisher.publish(msg);
+
+        // If time is 0 do not wait
+        if (time_between_samples > 0)
+        {
+            eprosima::utils::sleep_for(time_between_samples);
+        }
+    }
+
+    router_0.stop();
+    router_1.stop();
+}
+
+} /* namespace test */
+
+/**
+ * Test communication in HelloWorld topic between two DDS participants created in different domains,
+ * by using two routers connected through an IPC channel.
+ */
+TEST(DDSTestIpc, end_to_end_ipc_communication)
+{
+    test::test_ipc_communication("ddstest_ipc");
+}
+
+/**
+ * Test communication in HelloWorld topic with messages published as fast as possible, so the rings fill up.
+ */
+TEST(DDSTestIpc, end_to_end_ipc_communication_high_frequency)
+{
+    test::test_ipc_communication(
+        "ddstest_ipc_high_frequency",
+        1000,  // samples to receive
+        0);  // time between samples
+}
+
+/**
+ * Test communication in HelloWorld topic with messages bigger than a single UDP datagram.
+ */
+TEST(DDSTestIpc, end_to_end_ipc_communication_high_size)
+{
+    test::test_ipc_communication(
+        "ddstest_ipc_high_size",
+        test::DEFAULT_SAMPLES_TO_RECEIVE,
+        test::DEFAULT_MILLISECONDS_PUBLISH_LOOP,
+        50000);  // 2.5 MB message
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
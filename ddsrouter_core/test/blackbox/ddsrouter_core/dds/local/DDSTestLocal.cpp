@@ -23,6 +23,7 @@
 
 #include <ddspipe_core/types/topic/filter/WildcardDdsFilterTopic.hpp>
 
+#include <ddsrouter_core/configuration/RecorderParticipantConfiguration.hpp>
 #include <ddsrouter_core/core/DdsRouter.hpp>
 
 #include <test_participants.hpp>
@@ -350,6 +351,34 @@ TEST(DDSTestLocal, end_to_end_local_communication_high_throughput)
     #endif // if FASTRTPS_VERSION_MAJOR <= 2 && FASTRTPS_VERSION_MINOR < 13
 }
 
+/**
+ * Same test as end_to_end_local_communication_high_throughput, with a Recorder Participant writing every message
+ * to disk as well, so that both durations can be compared to measure the cost of recording in the forwarding.
+ */
+TEST(DDSTestLocal, end_to_end_local_communication_high_throughput_recorder)
+{
+    DdsRouterConfiguration configuration = test::dds_test_simple_configuration();
+
+    auto part = std::make_shared<RecorderParticipantConfiguration>();
+    part->id = core::types::ParticipantId("recorder");
+    part->output_directory = "end_to_end_local_communication_high_throughput_recorder";
+    configuration.participants_configurations.insert({types::ParticipantKind::recorder, part});
+
+    #if FASTRTPS_VERSION_MAJOR <= 2 && FASTRTPS_VERSION_MINOR < 13
+    test::test_local_communication<HelloWorld>(
+        configuration,
+        500,
+        1,
+        1000);     // 50K message size
+    #else
+    test::test_local_communication<HelloWorld, HelloWorldPubSubType>(
+        configuration,
+        500,
+        1,
+        1000);     // 50K message size
+    #endif // if FASTRTPS_VERSION_MAJOR <= 2 && FASTRTPS_VERSION_MINOR < 13
+}
+
 /**
  * Test transient_local communication in HelloWorld topic between two DDS participants created in different domains,
  * by using a router with two Simple Participants at each domain.
@@ -75,10 +75,33 @@ DdsRouterConfiguration dds_test_simple_configuration()
     return conf;
 }
 
+/**
+ * @brief Create a simple configuration for a DDS Router that limits the test topic rate per instance
+ *
+ * The rate is lower than the publication rate, so samples are kept and sent later, or replaced by newer ones.
+ *
+ * @return DdsRouterConfiguration
+ */
+DdsRouterConfiguration dds_test_per_instance_rate_limit_configuration()
+{
+    DdsRouterConfiguration conf = dds_test_simple_configuration();
+
+    RateLimitConfiguration rate_limit;
+    rate_limit.topic.topic_name.set_value(TOPIC_NAME);
+    rate_limit.max_msgs_per_second = 5;
+    rate_limit.burst_msgs = 1;
+    rate_limit.per_instance = true;
+    conf.advanced_options.rate_limits.push_back(rate_limit);
+
+    return conf;
+}
+
 /**
  * Test communication between two DDS Participants hosted in the same device, but which are at different DDS domains.
  * This is accomplished by using a DDS Router instance with a Simple Participant deployed at each domain.
  *
+ * The instance is disposed twice and unregistered once, and every instance state change must reach the subscriber.
+ *
  * The reliable option changes the test behavior to verify that the communication is reliable and all old data is sent
  * to Late Joiners.
  */
@@ -175,6 +198,27 @@ void test_local_communication_key_dispose(
 
     ASSERT_EQ(2u, subscriber.n_disposed());
 
+    samples_received.store(0);
+
+    // Keep publishing
+    while (samples_received.load() < samples_to_receive)
+    {
+        msg.index(++samples_sent);
+        ASSERT_TRUE(publisher.publish(msg)) << samples_sent;
+
+        // If time is 0 do not wait
+        if (time_between_samples > 0)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(time_between_samples));
+        }
+    }
+
+    // All samples received, now unregister key from publisher and check that subscriber has receive it
+    ASSERT_TRUE(publisher.unregister_key(msg) == ReturnCode_t::RETCODE_OK);
+    std::this_thread::sleep_for(std::chrono::milliseconds(DEFAULT_SUBSCRIBER_MESSAGE_RECEPTION));
+
+    ASSERT_EQ(1u, subscriber.n_unregistered());
+
     router.stop();
 }
 
@@ -189,6 +233,16 @@ TEST(DDSTestLocalDisposeKey, end_to_end_local_communication_key_dispose)
         test::dds_test_simple_configuration());
 }
 
+/**
+ * Test that dispose and unregister values from the publisher bypass a per instance rate limit, and are
+ * correctly received by the subscriber from the router.
+ */
+TEST(DDSTestLocalDisposeKey, end_to_end_local_communication_key_dispose_per_instance_rate_limit)
+{
+    test::test_local_communication_key_dispose(
+        test::dds_test_per_instance_rate_limit_configuration());
+}
+
 int main(
         int argc,
         char** argv)
@@ -0,0 +1,247 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <unistd.h>
+
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+
+#include <cpp_utils/exception/InitializationException.hpp>
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <ddspipe_core/types/topic/filter/WildcardDdsFilterTopic.hpp>
+
+#include <ddspipe_participants/configuration/SimpleParticipantConfiguration.hpp>
+
+#include <ddsrouter_core/configuration/RecorderParticipantConfiguration.hpp>
+#include <ddsrouter_core/configuration/ReplayerParticipantConfiguration.hpp>
+#include <ddsrouter_core/core/DdsRouter.hpp>
+#include <ddsrouter_core/participants/recorder/RecordFormat.hpp>
+#include <ddsrouter_core/participants/recorder/RecordSegmentReader.hpp>
+
+#include <test_participants.hpp>
+
+using namespace eprosima;
+using namespace eprosima::ddspipe;
+using namespace eprosima::ddsrouter::core;
+
+namespace test {
+
+constexpr const uint32_t DEFAULT_SAMPLES_TO_RECEIVE = 10;
+constexpr const uint32_t DEFAULT_MILLISECONDS_PUBLISH_LOOP = 100;
+
+//! Add a simple participant in \c domain to \c conf .
+void add_simple_participant(
+        DdsRouterConfiguration& conf,
+        const std::string& name,
+        uint32_t domain)
+{
+    auto simple = std::make_shared<participants::SimpleParticipantConfiguration>();
+    simple->id = core::types::ParticipantId(name);
+    simple->domain.domain_id = domain;
+    conf.participants_configurations.insert({types::ParticipantKind::simple, simple});
+}
+
+//! Configuration with 1 topic in its allowlist.
+DdsRouterConfiguration topic_configuration()
+{
+    DdsRouterConfiguration conf;
+
+    core::types::WildcardDdsFilterTopic topic;
+    topic.topic_name.set_value(TOPIC_NAME);
+    conf.ddspipe_configuration.allowlist.insert(
+        utils::Heritable<core::types::WildcardDdsFilterTopic>::make_heritable(topic));
+
+    return conf;
+}
+
+/**
+ * @brief Create a configuration for a DDS Router that records
+ *
+ * Create 2 simple participants in domains 0 and 1, so the test knows what has been forwarded
+ * Create 1 recorder participant writing in \c directory
+ */
+DdsRouterConfiguration record_configuration(
+        const std::string& directory)
+{
+    DdsRouterConfiguration conf = topic_configuration();
+
+    add_simple_participant(conf, "participant_0", 0u);
+    add_simple_participant(conf, "participant_1", 1u);
+
+    auto recorder = std::make_shared<RecorderParticipantConfiguration>();
+    recorder->id = core::types::ParticipantId("recorder");
+    recorder->output_directory = directory;
+    conf.participants_configurations.insert({types::ParticipantKind::recorder, recorder});
+
+    return conf;
+}
+
+/**
+ * @brief Create a configuration for a DDS Router that replays
+ *
+ * Create 1 replayer participant reading from \c directory at \c speed
+ * Create 1 simple participant in domain 2
+ */
+DdsRouterConfiguration replay_configuration(
+        const std::string& directory,
+        float speed)
+{
+    DdsRouterConfiguration conf = topic_configuration();
+
+    auto replayer = std::make_shared<ReplayerParticipantConfiguration>();
+    replayer->id = core::types::ParticipantId("replayer");
+    replayer->input_directory = directory;
+    replayer->speed = speed;
+    conf.participants_configurations.insert({types::ParticipantKind::replayer, replayer});
+
+    add_simple_participant(conf, "participant_2", 2u);
+
+    return conf;
+}
+
+//! Remove the segments left in \c directory by previous executions.
+void remove_recording(
+        const std::string& directory)
+{
+    try
+    {
+        for (const auto& segment : RecordSegmentReader::list_segments(directory))
+        {
+            unlink((segment + RECORD_SEGMENT_EXTENSION).c_str());
+            unlink((segment + RECORD_INDEX_EXTENSION).c_str());
+        }
+    }
+    catch (const utils::InitializationException&)
+    {
+        // The directory does not exist yet
+    }
+}
+
+/**
+ * @brief Record the samples published in domain 0 until \c samples_to_record reach domain 1.
+ */
+void record(
+        const std::string& directory,
+        const HelloWorld& msg_template,
+        uint32_t samples_to_record)
+{
+    remove_recording(directory);
+
+    std::atomic<uint32_t> samples_received(0);
+    HelloWorld msg(msg_template);
+
+    TestSubscriber<HelloWorld> subscriber;
+    ASSERT_TRUE(subscriber.init(1, &msg, &samples_received));
+
+    // The recording is flushed when the router is destroyed
+    DdsRouter router(record_configuration(directory));
+    router.start();
+
+    TestPublisher<HelloWorld> publisher;
+    ASSERT_TRUE(publisher.init(0));
+
+    uint32_t samples_sent = 0;
+    while (samples_received.load() < samples_to_record)
+    {
+        msg.index(++samples_sent);
+        publisher.publish(msg);
+        std::this_thread::sleep_for(std::chrono::milliseconds(DEFAULT_MILLISECONDS_PUBLISH_LOOP));
+    }
+
+    router.stop();
+}
+
+} /* namespace test */
+
+/**
+ * Test that the samples recorded by a DDS Router are received by a DDS Subscriber when replayed by another one
+ * as fast as possible.
+ */
+TEST(DDSTestReplayer, end_to_end_record_and_replay)
+{
+    const std::string directory = "ddstest_record_and_replay";
+
+    HelloWorld msg;
+    msg.message("Testing DdsRouter Blackbox Replayer ...");
+
+    test::record(directory, msg, test::DEFAULT_SAMPLES_TO_RECEIVE);
+
+    // Late joiner subscriber, so no replayed sample is lost while matching
+    std::atomic<uint32_t> samples_received(0);
+    TestSubscriber<HelloWorld> subscriber(false, true);
+    ASSERT_TRUE(subscriber.init(2, &msg, &samples_received));
+
+    DdsRouter router(test::replay_configuration(directory, 0));
+    router.start();
+
+    while (samples_received.load() < test::DEFAULT_SAMPLES_TO_RECEIVE)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(test::DEFAULT_MILLISECONDS_PUBLISH_LOOP));
+    }
+
+    router.stop();
+}
+
+/**
+ * Test that the replay keeps the time between the recorded samples divided by the speed.
+ */
+TEST(DDSTestReplayer, end_to_end_replay_speed)
+{
+    const std::string directory = "ddstest_replay_speed";
+    constexpr float SPEED = 2;
+
+    HelloWorld msg;
+    msg.message("Testing DdsRouter Blackbox Replayer ...");
+
+    test::record(directory, msg, test::DEFAULT_SAMPLES_TO_RECEIVE);
+
+    std::atomic<uint32_t> samples_received(0);
+    TestSubscriber<HelloWorld> subscriber(false, true);
+    ASSERT_TRUE(subscriber.init(2, &msg, &samples_received));
+
+    DdsRouter router(test::replay_configuration(directory, SPEED));
+    router.start();
+
+    while (samples_received.load() < 1)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    const auto first_sample = std::chrono::steady_clock::now();
+
+    while (samples_received.load() < test::DEFAULT_SAMPLES_TO_RECEIVE)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    // The samples were recorded at least DEFAULT_MILLISECONDS_PUBLISH_LOOP apart, with some margin for the matching
+    const auto elapsed = std::chrono::steady_clock::now() - first_sample;
+    ASSERT_GE(elapsed,
+            std::chrono::milliseconds(
+                (test::DEFAULT_SAMPLES_TO_RECEIVE - 2) * test::DEFAULT_MILLISECONDS_PUBLISH_LOOP / 2));
+
+    router.stop();
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
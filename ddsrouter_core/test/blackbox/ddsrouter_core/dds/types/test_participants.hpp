@@ -172,6 +172,10 @@ public:
     eprosima::fastrtps::types::ReturnCode_t dispose_key(
             MsgStruct msg);
 
+    //! Unregister instance
+    eprosima::fastrtps::types::ReturnCode_t unregister_key(
+            MsgStruct msg);
+
     void wait_discovery(
             uint32_t n_subscribers = 1)
     {
@@ -261,6 +265,14 @@ eprosima::fastrtps::types::ReturnCode_t TestPublisher<HelloWorldKeyed>::dispose_
     return writer_->dispose(&hello_, eprosima::fastdds::dds::HANDLE_NIL);
 }
 
+template <>
+eprosima::fastrtps::types::ReturnCode_t TestPublisher<HelloWorldKeyed>::unregister_key(
+        HelloWorldKeyed msg)
+{
+    hello_.id(msg.id());
+    return writer_->unregister_instance(&hello_, eprosima::fastdds::dds::HANDLE_NIL);
+}
+
 /**
  * Class used to group into a single working unit a Subscriber with a DataReader, its listener, and a TypeSupport member
  * corresponding to the HelloWorld datatype
@@ -384,6 +396,11 @@ public:
         return listener_.n_key_disposed;
     }
 
+    uint32_t n_unregistered() const
+    {
+        return listener_.n_key_unregistered;
+    }
+
 private:
 
     eprosima::fastdds::dds::DomainParticipant* participant_;
@@ -418,6 +435,7 @@ private:
             msg_should_receive = msg_should_receive_arg;
             samples_received = samples_received_arg;
             n_key_disposed = 0;
+            n_key_unregistered = 0;
         }
 
         void wait_discovery(
@@ -451,6 +469,10 @@ private:
                 {
                     n_key_disposed++;
                 }
+                else if (info.instance_state == eprosima::fastdds::dds::NOT_ALIVE_NO_WRITERS_INSTANCE_STATE)
+                {
+                    n_key_unregistered++;
+                }
             }
         }
 
@@ -474,6 +496,8 @@ private:
 
         std::atomic<std::uint32_t> n_key_disposed;
 
+        std::atomic<std::uint32_t> n_key_unregistered;
+
         //! Reference to the sample sent by the publisher
         MsgStruct* msg_should_receive;
 
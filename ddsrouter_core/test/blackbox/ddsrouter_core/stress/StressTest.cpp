@@ -0,0 +1,220 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <ddspipe_core/dynamic/ParticipantsDatabase.hpp>
+
+#include <ddsrouter_core/configuration/GeneratorParticipantConfiguration.hpp>
+#include <ddsrouter_core/configuration/SinkParticipantConfiguration.hpp>
+#include <ddsrouter_core/core/DdsRouter.hpp>
+#include <ddsrouter_core/participants/generator/GeneratorParticipant.hpp>
+#include <ddsrouter_core/participants/sink/SinkStatistics.hpp>
+
+using namespace eprosima;
+using namespace eprosima::ddspipe;
+using namespace eprosima::ddsrouter::core;
+
+namespace test {
+
+constexpr const char* GENERATOR_ID = "generator";
+constexpr const char* SINK_ID = "sink";
+
+constexpr const std::chrono::seconds MAX_WAIT_TIME(20);
+
+/**
+ * DDS Router that gives access to its Generator Participant.
+ */
+class StressRouter : public DdsRouter
+{
+public:
+
+    using DdsRouter::DdsRouter;
+
+    std::shared_ptr<GeneratorParticipant> generator() const
+    {
+        return std::dynamic_pointer_cast<GeneratorParticipant>(
+            participants_database_->get_participant(GENERATOR_ID));
+    }
+};
+
+//! Configuration with a Generator Participant generating \c topics and a Sink Participant.
+DdsRouterConfiguration stress_configuration(
+        const std::vector<GeneratedTopicConfiguration>& topics)
+{
+    DdsRouterConfiguration conf;
+
+    auto generator = std::make_shared<GeneratorParticipantConfiguration>();
+    generator->id = core::types::ParticipantId(GENERATOR_ID);
+    generator->topics = topics;
+    conf.participants_configurations.insert({types::ParticipantKind::generator, generator});
+
+    auto sink = std::make_shared<SinkParticipantConfiguration>();
+    sink->id = core::types::ParticipantId(SINK_ID);
+    sink->report_period = 0;
+    sink->check_sequence = true;
+    conf.participants_configurations.insert({types::ParticipantKind::sink, sink});
+
+    return conf;
+}
+
+//! Generated topic with a limited number of \c samples .
+GeneratedTopicConfiguration generated_topic(
+        const std::string& name,
+        uint64_t samples,
+        double rate = 0)
+{
+    GeneratedTopicConfiguration topic;
+    topic.topic_name = name;
+    topic.samples = samples;
+    topic.rate = rate;
+    return topic;
+}
+
+/**
+ * Run a DDS Router with \c configuration until the generator finishes and the sink has received \c expected
+ * messages, and return the report of the sink.
+ */
+SinkReport run(
+        const DdsRouterConfiguration& configuration,
+        uint64_t expected)
+{
+    StressRouter router(configuration);
+    router.start();
+
+    auto generator = router.generator();
+    EXPECT_TRUE(generator);
+
+    const auto deadline = std::chrono::steady_clock::now() + MAX_WAIT_TIME;
+    while ((!generator->finished() || router.sink_reports().at(SINK_ID).messages < expected) &&
+            std::chrono::steady_clock::now() < deadline)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    router.stop();
+
+    EXPECT_TRUE(generator->finished());
+    EXPECT_EQ(generator->generated(), expected);
+
+    SinkReport report = router.sink_reports().at(SINK_ID);
+
+    // Nothing is lost nor reordered inside a single process
+    EXPECT_EQ(report.lost, 0u);
+    EXPECT_EQ(report.out_of_order, 0u);
+
+    return report;
+}
+
+} /* namespace test */
+
+using namespace test;
+
+/**
+ * Generate a fixed number of samples as fast as possible and check every one of them arrives to the sink,
+ * with a valid latency.
+ */
+TEST(StressTest, generate_all_samples)
+{
+    constexpr uint64_t samples = 10000;
+
+    SinkReport report = run(stress_configuration({generated_topic("stress_topic", samples)}), samples);
+
+    ASSERT_EQ(report.messages, samples);
+    ASSERT_EQ(report.generated, samples);
+    ASSERT_EQ(report.bytes, samples * 64);
+    ASSERT_GE(report.latency_min, 0);
+    ASSERT_LE(report.latency_min, report.latency_p50);
+    ASSERT_LE(report.latency_p50, report.latency_p99);
+    ASSERT_LE(report.latency_p99, report.latency_max);
+}
+
+/**
+ * Generate at a fixed rate and check it takes as long as expected.
+ */
+TEST(StressTest, generate_at_rate)
+{
+    constexpr uint64_t samples = 50;
+    constexpr double rate = 100;
+
+    auto start = std::chrono::steady_clock::now();
+    SinkReport report = run(stress_configuration({generated_topic("stress_topic", samples, rate)}), samples);
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    ASSERT_EQ(report.messages, samples);
+
+    // 50 samples at 100 Hz take at least 490 ms (the first one is sent right away)
+    ASSERT_GE(elapsed, std::chrono::milliseconds(490));
+}
+
+/**
+ * Generate a keyed topic with random sizes in bursts and check every message arrives with a size in range.
+ */
+TEST(StressTest, generate_keys_sizes_and_bursts)
+{
+    constexpr uint64_t samples = 1000;
+
+    GeneratedTopicConfiguration topic = generated_topic("stress_keyed_topic", samples, 1000);
+    topic.size = 100;
+    topic.max_size = 1000;
+    topic.keys = 10;
+    topic.burst = 50;
+
+    SinkReport report = run(stress_configuration({topic}), samples);
+
+    ASSERT_EQ(report.messages, samples);
+    ASSERT_EQ(report.generated, samples);
+    ASSERT_GE(report.bytes, samples * 100);
+    ASSERT_LE(report.bytes, samples * 1000);
+}
+
+/**
+ * Generate several topics at once and check the sink receives all of them, and measures each topic apart.
+ */
+TEST(StressTest, generate_several_topics)
+{
+    constexpr uint64_t samples = 1000;
+
+    SinkReport report = run(
+        stress_configuration({
+                generated_topic("stress_topic_1", samples),
+                generated_topic("stress_topic_2", samples, 2000),
+                generated_topic("stress_topic_3", samples, 5000)}),
+        3 * samples);
+
+    ASSERT_EQ(report.messages, 3 * samples);
+    ASSERT_EQ(report.generated, 3 * samples);
+
+    ASSERT_EQ(report.topics.size(), 3u);
+    for (const auto& topic : report.topics)
+    {
+        ASSERT_EQ(topic.second.messages, samples);
+        ASSERT_EQ(topic.second.bytes, samples * 64);
+    }
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
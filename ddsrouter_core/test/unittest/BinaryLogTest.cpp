@@ -0,0 +1,271 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file BinaryLogTest.cpp
+ *
+ */
+
+#include <stdlib.h>
+
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <cpp_utils/exception/InitializationException.hpp>
+#include <cpp_utils/Log.hpp>
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <ddsrouter_core/logging/BinaryLog.hpp>
+
+using namespace eprosima;
+using namespace eprosima::ddsrouter::core;
+
+namespace test {
+
+//! Argument without a raw encoding, that is streamed.
+struct Endpoint
+{
+    std::string name;
+};
+
+std::ostream& operator <<(
+        std::ostream& os,
+        const Endpoint& endpoint)
+{
+    return os << "Endpoint{" << endpoint.name << "}";
+}
+
+//! Temporary directory for the files of a test.
+std::string temporary_directory()
+{
+    char path[] = "/tmp/ddsrouter_binary_log_test_XXXXXX";
+    return mkdtemp(path);
+}
+
+BinaryLogConfiguration configuration(
+        unsigned int buffer_size = 1024 * 1024,
+        unsigned int period = 10)
+{
+    BinaryLogConfiguration configuration;
+    configuration.enabled = true;
+    configuration.buffer_size = buffer_size;
+    configuration.period = period;
+    configuration.output_directory = temporary_directory();
+    return configuration;
+}
+
+//! Lines of the binary log in \c path decoded.
+std::vector<std::string> decode(
+        const std::string& path)
+{
+    std::ifstream file(path, std::ios::binary);
+    std::stringstream text;
+    const uint64_t entries = BinaryLog::decode(file, text);
+
+    std::vector<std::string> lines;
+    std::string line;
+    while (std::getline(text, line))
+    {
+        lines.push_back(line);
+    }
+
+    EXPECT_EQ(entries, lines.size());
+    return lines;
+}
+
+//! Whether \c line contains \c text .
+bool contains(
+        const std::string& line,
+        const std::string& text)
+{
+    return line.find(text) != std::string::npos;
+}
+
+} /* namespace test */
+
+/**
+ * Log entries with every kind of argument, and decode them back into text.
+ *
+ * CASES:
+ * - numbers, booleans, characters and strings
+ * - types streamed
+ * - missing arguments keep their placeholder
+ * - entries filtered by the verbosity are not recorded
+ */
+TEST(BinaryLogTest, decode)
+{
+    utils::Log::SetVerbosity(utils::Log::Kind::Warning);
+
+    std::string path;
+    {
+        BinaryLog binary_log(test::configuration());
+        path = binary_log.path();
+
+        const std::string topic = "rt/chatter";
+        logBinaryWarning(DDSROUTER_TEST, "Message of {} bytes dropped in topic {}.", 1024u, topic);
+        logBinaryError(DDSROUTER_TEST, "Values {} {} {} {} {}", -7, 2.5, true, 'x', "literal");
+        logBinaryWarning(DDSROUTER_TEST, "Reader {} removed.", test::Endpoint{"reader"});
+        logBinaryWarning(DDSROUTER_TEST, "Only {} of {} arguments.", 1);
+        logBinaryWarning(DDSROUTER_TEST, "No arguments.");
+        logBinaryInfo(DDSROUTER_TEST, "Filtered out by the verbosity.");
+
+        binary_log.flush();
+        ASSERT_EQ(binary_log.statistics().written, 5u);
+        ASSERT_EQ(binary_log.statistics().dropped, 0u);
+    }
+
+    const std::vector<std::string> lines = test::decode(path);
+    ASSERT_EQ(lines.size(), 5u);
+
+    ASSERT_TRUE(test::contains(lines[0],
+            "[DDSROUTER_TEST Warning] Message of 1024 bytes dropped in topic rt/chatter."));
+    ASSERT_TRUE(test::contains(lines[0], "(BinaryLogTest.cpp:"));
+    ASSERT_TRUE(test::contains(lines[1], "[DDSROUTER_TEST Error] Values -7 2.5 true x literal"));
+    ASSERT_TRUE(test::contains(lines[2], "Reader Endpoint{reader} removed."));
+    ASSERT_TRUE(test::contains(lines[3], "Only 1 of {} arguments."));
+    ASSERT_TRUE(test::contains(lines[4], "No arguments."));
+}
+
+/**
+ * Entries that do not fit in the buffer of their thread are dropped, and the rest are written in order.
+ */
+TEST(BinaryLogTest, full_buffer)
+{
+    utils::Log::SetVerbosity(utils::Log::Kind::Info);
+
+    constexpr unsigned int ENTRIES = 1000;
+
+    std::string path;
+    uint64_t written = 0;
+    {
+        // The log thread does not write the buffer before the test ends
+        BinaryLog binary_log(test::configuration(BinaryLogConfiguration::MIN_BUFFER_SIZE, 100000));
+        path = binary_log.path();
+
+        for (unsigned int i = 0; i < ENTRIES; ++i)
+        {
+            logBinaryInfo(DDSROUTER_TEST, "Entry {}", i);
+        }
+
+        binary_log.flush();
+
+        // The buffer has room again
+        logBinaryInfo(DDSROUTER_TEST, "Entry {}", ENTRIES);
+        binary_log.flush();
+
+        const BinaryLogStatistics statistics = binary_log.statistics();
+        ASSERT_GT(statistics.dropped, 0u);
+        ASSERT_EQ(statistics.written + statistics.dropped, ENTRIES + 1);
+        written = statistics.written;
+    }
+
+    const std::vector<std::string> lines = test::decode(path);
+    ASSERT_EQ(lines.size(), written);
+
+    for (std::size_t i = 0; i + 1 < lines.size(); ++i)
+    {
+        ASSERT_TRUE(test::contains(lines[i], "Entry " + std::to_string(i) + " "));
+    }
+    ASSERT_TRUE(test::contains(lines.back(), "Entry " + std::to_string(ENTRIES) + " "));
+}
+
+/**
+ * Several threads log at once while the log thread writes their buffers.
+ */
+TEST(BinaryLogTest, concurrent_threads)
+{
+    utils::Log::SetVerbosity(utils::Log::Kind::Info);
+
+    constexpr unsigned int THREADS = 4;
+    constexpr unsigned int ENTRIES = 20000;
+
+    std::string path;
+    {
+        BinaryLog binary_log(test::configuration(1024 * 1024, 1));
+        path = binary_log.path();
+
+        std::vector<std::thread> threads;
+        for (unsigned int thread = 0; thread < THREADS; ++thread)
+        {
+            threads.emplace_back([thread]()
+                    {
+                        for (unsigned int i = 0; i < ENTRIES; ++i)
+                        {
+                            logBinaryInfo(DDSROUTER_TEST, "Thread {} entry {}", thread, i);
+                        }
+                    });
+        }
+
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        binary_log.flush();
+        ASSERT_EQ(binary_log.statistics().threads, THREADS);
+        ASSERT_EQ(binary_log.statistics().written + binary_log.statistics().dropped, THREADS * ENTRIES);
+    }
+
+    // The entries of each thread are in order, without gaps unless dropped
+    std::vector<int64_t> last(THREADS, -1);
+    for (const std::string& line : test::decode(path))
+    {
+        const std::size_t position = line.find("Thread ");
+        ASSERT_NE(position, std::string::npos);
+
+        std::istringstream message(line.substr(position + 7));
+        unsigned int thread;
+        std::string entry;
+        int64_t i;
+        message >> thread >> entry >> i;
+
+        ASSERT_LT(thread, THREADS);
+        ASSERT_GT(i, last[thread]);
+        last[thread] = i;
+    }
+}
+
+/**
+ * There is at most one binary log in the process, and only binary logs can be decoded.
+ */
+TEST(BinaryLogTest, invalid)
+{
+    {
+        BinaryLog binary_log(test::configuration());
+        ASSERT_THROW(BinaryLog another(test::configuration()), utils::InitializationException);
+    }
+
+    // Once destroyed, there can be a new one
+    BinaryLog binary_log(test::configuration());
+
+    std::stringstream input("not a binary log");
+    std::stringstream output;
+    ASSERT_THROW(BinaryLog::decode(input, output), utils::InitializationException);
+
+    BinaryLogConfiguration invalid = test::configuration(BinaryLogConfiguration::MIN_BUFFER_SIZE - 1);
+    utils::Formatter error_msg;
+    ASSERT_FALSE(invalid.is_valid(error_msg));
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
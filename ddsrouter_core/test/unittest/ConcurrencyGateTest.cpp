@@ -0,0 +1,335 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ConcurrencyGateTest.cpp
+ *
+ */
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <ddspipe_core/interface/IReader.hpp>
+#include <ddspipe_core/interface/IRoutingData.hpp>
+#include <ddspipe_core/types/topic/dds/DdsTopic.hpp>
+
+#include <ddsrouter_core/efficiency/concurrency/ConcurrencyGate.hpp>
+#include <ddsrouter_core/participants/concurrency/GatedReader.hpp>
+
+using namespace eprosima;
+using namespace eprosima::ddsrouter::core;
+
+namespace test {
+
+//! Time that a thread stays in the gate.
+constexpr std::chrono::milliseconds WORK_TIME(50);
+
+//! Reader with \c samples messages to take, that notifies them when calling \c notify .
+class MockReader : public ddspipe::core::IReader
+{
+public:
+
+    void enable() noexcept override
+    {
+    }
+
+    void disable() noexcept override
+    {
+    }
+
+    void set_on_data_available_callback(
+            std::function<void()> on_data_available_lambda) noexcept override
+    {
+        callback = on_data_available_lambda;
+    }
+
+    void unset_on_data_available_callback() noexcept override
+    {
+        callback = nullptr;
+    }
+
+    utils::ReturnCode take(
+            std::unique_ptr<ddspipe::core::IRoutingData>& /* data */) noexcept override
+    {
+        if (samples == 0)
+        {
+            return utils::ReturnCode::RETCODE_NO_DATA;
+        }
+
+        --samples;
+        return utils::ReturnCode::RETCODE_OK;
+    }
+
+    ddspipe::core::types::Guid guid() const override
+    {
+        return ddspipe::core::types::Guid();
+    }
+
+    fastrtps::RecursiveTimedMutex& get_rtps_mutex() const override
+    {
+        return mutex;
+    }
+
+    uint64_t get_unread_count() const override
+    {
+        return samples;
+    }
+
+    ddspipe::core::types::DdsTopic topic() const override
+    {
+        return ddspipe::core::types::DdsTopic();
+    }
+
+    ddspipe::core::types::ParticipantId participant_id() const override
+    {
+        return "mock";
+    }
+
+    void notify(
+            uint64_t new_samples)
+    {
+        samples += new_samples;
+        callback();
+    }
+
+    std::atomic<uint64_t> samples{0};
+
+    std::function<void()> callback;
+
+    mutable fastrtps::RecursiveTimedMutex mutex;
+};
+
+} /* namespace test */
+
+using namespace test;
+
+/**
+ * Test that no more threads than the limit are in the gate at once.
+ */
+TEST(ConcurrencyGateTest, limit_blocks_threads)
+{
+    ConcurrencyGate gate(2, 8, 1000, 0);
+    std::atomic<uint32_t> inside{0};
+    std::atomic<uint32_t> max_inside{0};
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 6; ++i)
+    {
+        threads.emplace_back(
+            [&]()
+            {
+                gate.enter();
+                uint32_t current = ++inside;
+                uint32_t max = max_inside.load();
+                while (current > max && !max_inside.compare_exchange_weak(max, current))
+                {
+                }
+                std::this_thread::sleep_for(WORK_TIME);
+                --inside;
+                gate.exit();
+            });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    ASSERT_EQ(max_inside.load(), 2u);
+
+    ConcurrencyStatistics statistics = gate.statistics();
+    ASSERT_EQ(statistics.limit, 2u);
+    ASSERT_EQ(statistics.active, 0u);
+}
+
+/**
+ * Test that the limit grows with long waits up to the maximum, and only shrinks after several short ones.
+ */
+TEST(ConcurrencyGateTest, grows_and_shrinks_with_hysteresis)
+{
+    ConcurrencyGate gate(1, 4, 1000, 0);
+
+    // Long waits grow the limit by half, at least by one
+    gate.data_taken(5000);
+    ASSERT_EQ(gate.adjust(), 1);
+    gate.data_taken(5000);
+    ASSERT_EQ(gate.adjust(), 1);
+    gate.data_taken(5000);
+    ASSERT_EQ(gate.adjust(), 1);
+    ASSERT_EQ(gate.statistics().limit, 4u);
+
+    // Never over the maximum
+    gate.data_taken(5000);
+    ASSERT_EQ(gate.adjust(), 0);
+    ASSERT_EQ(gate.statistics().limit, 4u);
+
+    // More readers pending than threads allowed also grow the limit
+    ConcurrencyGate pending_gate(2, 8, 1000, 0);
+    for (int i = 0; i < 3; ++i)
+    {
+        pending_gate.data_pending();
+    }
+    ASSERT_EQ(pending_gate.adjust(), 1);
+    ASSERT_EQ(pending_gate.statistics().pending, 3u);
+
+    // Short waits only shrink the limit after SHRINK_PERIODS periods in a row
+    for (uint32_t period = 1; period < ConcurrencyGate::SHRINK_PERIODS; ++period)
+    {
+        gate.data_taken(100);
+        ASSERT_EQ(gate.adjust(), 0);
+    }
+    gate.data_taken(100);
+    ASSERT_EQ(gate.adjust(), -1);
+
+    // A wait between half the target and the target restarts the count
+    gate.data_taken(100);
+    ASSERT_EQ(gate.adjust(), 0);
+    gate.data_taken(800);
+    ASSERT_EQ(gate.adjust(), 0);
+    for (uint32_t period = 1; period < ConcurrencyGate::SHRINK_PERIODS; ++period)
+    {
+        ASSERT_EQ(gate.adjust(), 0);
+    }
+    ASSERT_EQ(gate.adjust(), -1);
+
+    // Never under the minimum
+    for (uint32_t period = 0; period < 10 * ConcurrencyGate::SHRINK_PERIODS; ++period)
+    {
+        gate.adjust();
+    }
+
+    ConcurrencyStatistics statistics = gate.statistics();
+    ASSERT_EQ(statistics.limit, 1u);
+    ASSERT_EQ(statistics.grown, 3u);
+    ASSERT_EQ(statistics.shrunk, 3u);
+}
+
+/**
+ * Test that a gated reader holds the gate while it has data, and reports the wait of the data notified.
+ */
+TEST(ConcurrencyGateTest, gated_reader)
+{
+    auto gate = std::make_shared<ConcurrencyGate>(1, 2, 1000, 0);
+    auto first_mock = std::make_shared<MockReader>();
+    auto second_mock = std::make_shared<MockReader>();
+    GatedReader first(first_mock, gate);
+    GatedReader second(second_mock, gate);
+
+    std::atomic<uint32_t> notifications{0};
+    first.set_on_data_available_callback([&]()
+            {
+                ++notifications;
+            });
+    second.set_on_data_available_callback([&]()
+            {
+                ++notifications;
+            });
+
+    // Only the first notification before taking the data counts as pending
+    first_mock->notify(2);
+    first_mock->notify(1);
+    ASSERT_EQ(notifications.load(), 2u);
+    ASSERT_EQ(gate->statistics().pending, 1u);
+
+    std::unique_ptr<ddspipe::core::IRoutingData> data;
+    ASSERT_EQ(first.take(data), utils::ReturnCode::RETCODE_OK);
+    ASSERT_EQ(gate->statistics().pending, 0u);
+    ASSERT_EQ(gate->statistics().active, 1u);
+
+    // Another thread can not take the data of the second reader until the first has no more data
+    second_mock->notify(1);
+    std::atomic<bool> taken{false};
+    std::thread other(
+        [&]()
+        {
+            std::unique_ptr<ddspipe::core::IRoutingData> other_data;
+            second.take(other_data);
+            taken = true;
+            second.take(other_data);
+        });
+
+    std::this_thread::sleep_for(WORK_TIME);
+    ASSERT_FALSE(taken.load());
+
+    ASSERT_EQ(first.take(data), utils::ReturnCode::RETCODE_OK);
+    ASSERT_EQ(first.take(data), utils::ReturnCode::RETCODE_OK);
+    ASSERT_EQ(first.take(data), utils::ReturnCode::RETCODE_NO_DATA);
+
+    other.join();
+    ASSERT_TRUE(taken.load());
+    ASSERT_EQ(gate->statistics().active, 0u);
+
+    // The wait of both readers is reported in the next adjustment
+    gate->adjust();
+    ASSERT_GT(gate->statistics().mean_wait_us, 0u);
+}
+
+/**
+ * Test that a gated reader leaves the gate when it is disabled or destroyed in the middle of a transmission.
+ */
+TEST(ConcurrencyGateTest, gated_reader_released)
+{
+    auto gate = std::make_shared<ConcurrencyGate>(1, 1, 1000, 0);
+    auto mock = std::make_shared<MockReader>();
+    std::unique_ptr<ddspipe::core::IRoutingData> data;
+
+    {
+        GatedReader reader(mock, gate);
+        reader.set_on_data_available_callback([]()
+                {
+                });
+
+        // Disabled with data left
+        mock->notify(3);
+        ASSERT_EQ(reader.take(data), utils::ReturnCode::RETCODE_OK);
+        ASSERT_EQ(gate->statistics().active, 1u);
+
+        reader.disable();
+        ASSERT_EQ(gate->statistics().active, 0u);
+
+        // Destroyed with data left
+        ASSERT_EQ(reader.take(data), utils::ReturnCode::RETCODE_OK);
+        ASSERT_EQ(gate->statistics().active, 1u);
+    }
+
+    ASSERT_EQ(gate->statistics().active, 0u);
+    ASSERT_EQ(gate->statistics().pending, 0u);
+
+    // Another reader can enter from another thread
+    GatedReader other(mock, gate);
+    std::thread thread(
+        [&]()
+        {
+            std::unique_ptr<ddspipe::core::IRoutingData> other_data;
+            ASSERT_EQ(other.take(other_data), utils::ReturnCode::RETCODE_OK);
+            ASSERT_EQ(other.take(other_data), utils::ReturnCode::RETCODE_NO_DATA);
+        });
+    thread.join();
+    ASSERT_EQ(gate->statistics().active, 0u);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,478 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ContentFilterTest.cpp
+ *
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <cpp_utils/exception/InitializationException.hpp>
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <ddspipe_core/types/topic/dds/DdsTopic.hpp>
+
+#include <ddsrouter_core/configuration/ContentFilterConfiguration.hpp>
+#include <ddsrouter_core/efficiency/filter/CdrPredicate.hpp>
+#include <ddsrouter_core/efficiency/filter/ContentFilter.hpp>
+#include <ddsrouter_core/efficiency/filter/ContentFilterEngine.hpp>
+
+using namespace eprosima;
+using namespace eprosima::ddsrouter::core;
+
+namespace test {
+
+constexpr unsigned int BENCHMARK_SAMPLES = 1000000;
+
+//! Encapsulation identifiers, little endian ones are odd.
+constexpr uint8_t CDR_BE = 0x00;
+constexpr uint8_t CDR_LE = 0x01;
+constexpr uint8_t PLAIN_CDR2_BE = 0x06;
+constexpr uint8_t PLAIN_CDR2_LE = 0x07;
+constexpr uint8_t DELIMITED_CDR2_BE = 0x08;
+constexpr uint8_t DELIMITED_CDR2_LE = 0x09;
+constexpr uint8_t PL_CDR_LE = 0x03;
+
+constexpr uint8_t ENCAPSULATIONS[] = {
+    CDR_BE, CDR_LE, PLAIN_CDR2_BE, PLAIN_CDR2_LE, DELIMITED_CDR2_BE, DELIMITED_CDR2_LE};
+
+//! Serializes a sample in CDR, as a DDS writer would.
+class SampleWriter
+{
+public:
+
+    SampleWriter(
+            uint8_t encapsulation)
+        : little_endian_(encapsulation & 0x01)
+        , max_alignment_(encapsulation >= PLAIN_CDR2_BE ? 4 : 8)
+        , delimited_(encapsulation >= DELIMITED_CDR2_BE)
+        , bytes_({0x00, encapsulation, 0x00, 0x00})
+    {
+        if (delimited_)
+        {
+            bytes_.resize(8);
+        }
+    }
+
+    template <typename T>
+    SampleWriter& add(
+            T value)
+    {
+        append_(&value, sizeof(T));
+        return *this;
+    }
+
+    SampleWriter& add(
+            const std::string& value)
+    {
+        add<uint32_t>(static_cast<uint32_t>(value.size() + 1));
+        bytes_.insert(bytes_.end(), value.begin(), value.end());
+        bytes_.push_back(0);
+        return *this;
+    }
+
+    //! Serialized sample, with its DHEADER if the encoding requires it.
+    std::vector<uint8_t> bytes() const
+    {
+        std::vector<uint8_t> bytes = bytes_;
+
+        if (delimited_)
+        {
+            SampleWriter dheader(little_endian_ ? CDR_LE : CDR_BE);
+            dheader.add<uint32_t>(static_cast<uint32_t>(bytes.size() - 8));
+            std::copy(dheader.bytes_.begin() + 4, dheader.bytes_.end(), bytes.begin() + 4);
+        }
+
+        return bytes;
+    }
+
+protected:
+
+    void append_(
+            const void* value,
+            std::size_t size)
+    {
+        const std::size_t alignment = std::min<std::size_t>(size, max_alignment_);
+        while ((bytes_.size() - 4) % alignment != 0)
+        {
+            bytes_.push_back(0);
+        }
+
+        const uint16_t probe = 1;
+        uint8_t host_little_endian;
+        std::memcpy(&host_little_endian, &probe, 1);
+
+        const uint8_t* data = static_cast<const uint8_t*>(value);
+        std::vector<uint8_t> serialized(data, data + size);
+        if (static_cast<bool>(host_little_endian) != little_endian_)
+        {
+            std::reverse(serialized.begin(), serialized.end());
+        }
+
+        bytes_.insert(bytes_.end(), serialized.begin(), serialized.end());
+    }
+
+    const bool little_endian_;
+    const std::size_t max_alignment_;
+    const bool delimited_;
+    std::vector<uint8_t> bytes_;
+};
+
+//! Layout of the robot status type of the tests.
+std::vector<CdrFieldConfiguration> robot_fields()
+{
+    return {
+        {"robot_id", "uint32"},
+        {"battery", "float64"},
+        {"state", "string"},
+        {"pose.x", "float64"},
+        {"tags", "sequence<uint16>"},
+        {"level", "int16"},
+        {"docked", "boolean"},
+    };
+}
+
+struct Robot
+{
+    uint32_t robot_id = 7;
+    double battery = 0.5;
+    std::string state = "MOVING";
+    double x = 2.5;
+    std::vector<uint16_t> tags{1, 2, 3};
+    int16_t level = -3;
+    bool docked = false;
+};
+
+std::vector<uint8_t> serialize(
+        const Robot& robot,
+        uint8_t encapsulation = CDR_LE)
+{
+    SampleWriter writer(encapsulation);
+    writer.add<uint32_t>(robot.robot_id)
+            .add<double>(robot.battery)
+            .add(robot.state)
+            .add<double>(robot.x)
+            .add<uint32_t>(static_cast<uint32_t>(robot.tags.size()));
+    for (uint16_t tag : robot.tags)
+    {
+        writer.add<uint16_t>(tag);
+    }
+    writer.add<int16_t>(robot.level)
+            .add<uint8_t>(robot.docked ? 1 : 0);
+    return writer.bytes();
+}
+
+CdrPredicateResult evaluate(
+        const std::string& expression,
+        const Robot& robot,
+        uint8_t encapsulation = CDR_LE,
+        const std::vector<std::string>& parameters = {})
+{
+    CdrPredicate predicate(expression, parameters, robot_fields());
+    const std::vector<uint8_t> sample = serialize(robot, encapsulation);
+    return predicate.evaluate(sample.data(), static_cast<uint32_t>(sample.size()));
+}
+
+bool matches(
+        const std::string& expression,
+        const Robot& robot = Robot(),
+        const std::vector<std::string>& parameters = {})
+{
+    return evaluate(expression, robot, CDR_LE, parameters) == CdrPredicateResult::match;
+}
+
+ddspipe::core::types::DdsTopic topic(
+        const std::string& name)
+{
+    ddspipe::core::types::DdsTopic topic;
+    topic.m_topic_name = name;
+    topic.type_name = "RobotStatus";
+    return topic;
+}
+
+ContentFilterConfiguration rule(
+        const std::string& topic_filter,
+        const std::string& expression,
+        const std::string& participant_id = "")
+{
+    ContentFilterConfiguration rule;
+    rule.topic.topic_name = topic_filter;
+    rule.participant_id = participant_id;
+    rule.expression = expression;
+    rule.fields = robot_fields();
+    return rule;
+}
+
+} /* namespace test */
+
+/**
+ * Test every field is found in every supported encapsulation, both before and after the fields of variable size.
+ *
+ * CASES:
+ * - CDR, PLAIN_CDR2 and DELIMITED_CDR2
+ * - little and big endian
+ */
+TEST(ContentFilterTest, encodings)
+{
+    const std::string expression =
+            "robot_id = 7 AND battery = 0.5 AND state = 'MOVING' AND pose.x = 2.5 AND level = -3 AND docked = FALSE";
+
+    for (uint8_t encapsulation : test::ENCAPSULATIONS)
+    {
+        ASSERT_EQ(test::evaluate(expression, test::Robot(), encapsulation), CdrPredicateResult::match)
+            << "encapsulation " << static_cast<int>(encapsulation);
+
+        test::Robot robot;
+        robot.level = 3;
+        ASSERT_EQ(test::evaluate(expression, robot, encapsulation), CdrPredicateResult::no_match)
+            << "encapsulation " << static_cast<int>(encapsulation);
+    }
+}
+
+/**
+ * Test the operators of the expressions.
+ *
+ * CASES:
+ * - comparisons of integers, floats, strings and booleans
+ * - AND, OR, NOT and parentheses
+ * - BETWEEN, IN and LIKE
+ * - parameters
+ */
+TEST(ContentFilterTest, operators)
+{
+    // Comparisons
+    ASSERT_TRUE(test::matches("robot_id <> 8"));
+    ASSERT_TRUE(test::matches("robot_id != 8"));
+    ASSERT_TRUE(test::matches("robot_id >= 7 AND robot_id <= 7"));
+    ASSERT_FALSE(test::matches("robot_id > 7"));
+    ASSERT_TRUE(test::matches("battery < 0.6"));
+    ASSERT_TRUE(test::matches("battery > 0"));
+    ASSERT_TRUE(test::matches("level < 0"));
+    ASSERT_TRUE(test::matches("level > -4"));
+    ASSERT_TRUE(test::matches("state > 'ALPHA'"));
+    ASSERT_TRUE(test::matches("docked = false"));
+
+    // Logical operators
+    ASSERT_TRUE(test::matches("robot_id = 1 OR state = 'MOVING'"));
+    ASSERT_FALSE(test::matches("robot_id = 1 OR state = 'IDLE'"));
+    ASSERT_TRUE(test::matches("NOT robot_id = 1"));
+    ASSERT_TRUE(test::matches("robot_id = 1 OR robot_id = 7 AND battery < 1"));
+    ASSERT_FALSE(test::matches("(robot_id = 1 OR robot_id = 7) AND battery > 1"));
+    ASSERT_TRUE(test::matches("not (robot_id = 1 or battery > 1)"));
+
+    // Ranges and lists
+    ASSERT_TRUE(test::matches("robot_id BETWEEN 5 AND 10"));
+    ASSERT_FALSE(test::matches("robot_id BETWEEN 8 AND 10"));
+    ASSERT_TRUE(test::matches("robot_id NOT BETWEEN 8 AND 10"));
+    ASSERT_TRUE(test::matches("robot_id IN (1, 3, 7)"));
+    ASSERT_FALSE(test::matches("robot_id IN (1, 3)"));
+    ASSERT_TRUE(test::matches("state IN ('IDLE', 'MOVING')"));
+
+    // Patterns
+    ASSERT_TRUE(test::matches("state LIKE 'MOV%'"));
+    ASSERT_TRUE(test::matches("state LIKE '_OVING'"));
+    ASSERT_FALSE(test::matches("state LIKE 'MOV'"));
+
+    // Parameters
+    ASSERT_TRUE(test::matches("robot_id = %0 AND state = %1", test::Robot(), {"7", "'MOVING'"}));
+    ASSERT_FALSE(test::matches("battery < %0", test::Robot(), {"0.2"}));
+
+    // Quotes in strings
+    test::Robot robot;
+    robot.state = "it's";
+    ASSERT_TRUE(test::matches("state = 'it''s'", robot));
+}
+
+/**
+ * Test the expressions that cannot be compiled.
+ *
+ * CASES:
+ * - empty expression
+ * - unknown field
+ * - missing parameter
+ * - values of different types
+ * - collections compared
+ * - malformed syntax
+ * - unsupported type of a field
+ */
+TEST(ContentFilterTest, invalid)
+{
+    const std::vector<std::string> expressions = {
+        "",
+        "speed > 1",
+        "robot_id = %1",
+        "robot_id = 'MOVING'",
+        "state = 1",
+        "docked = 1",
+        "tags = 1",
+        "robot_id = 1 AND",
+        "(robot_id = 1",
+        "robot_id = 1)",
+        "robot_id == 1",
+        "state LIKE 1",
+        "'MOVING' = 'MOVING'",
+    };
+
+    for (const auto& expression : expressions)
+    {
+        ASSERT_THROW(CdrPredicate(expression, {"7"}, test::robot_fields()), utils::InitializationException)
+            << expression;
+
+        ContentFilterConfiguration configuration = test::rule("*", expression);
+        configuration.parameters = {"7"};
+        utils::Formatter error_msg;
+        ASSERT_FALSE(configuration.is_valid(error_msg)) << expression;
+    }
+
+    ASSERT_THROW(CdrPredicate("robot_id = 1", {}, {{"robot_id", "uint128"}}), utils::InitializationException);
+    ASSERT_THROW(CdrPredicate("robot_id = 1", {}, {}), utils::InitializationException);
+    ASSERT_THROW(CdrPredicate("robot_id = 1", {}, {{"robot_id", "uint32"}, {"robot_id", "uint32"}}),
+            utils::InitializationException);
+
+    utils::Formatter error_msg;
+    ASSERT_TRUE(test::rule("*", "robot_id = 1").is_valid(error_msg));
+}
+
+/**
+ * Test the samples that cannot be evaluated are forwarded and counted.
+ *
+ * CASES:
+ * - sample shorter than the fields referenced
+ * - string longer than the sample
+ * - unsupported encapsulation
+ * - fields after the last one referenced are not checked
+ */
+TEST(ContentFilterTest, malformed)
+{
+    auto predicate = std::make_shared<const CdrPredicate>(
+        "level = -3", std::vector<std::string>(), test::robot_fields());
+    ContentFilter filter(predicate, "rt/robot_status");
+
+    std::vector<uint8_t> sample = test::serialize(test::Robot());
+    ASSERT_TRUE(filter.accept(sample.data(), static_cast<uint32_t>(sample.size())));
+
+    // Truncated right before the level
+    ASSERT_EQ(predicate->evaluate(sample.data(), 30), CdrPredicateResult::malformed);
+    ASSERT_TRUE(filter.accept(sample.data(), 30));
+
+    // Length of the string past the end of the sample
+    std::vector<uint8_t> corrupted = sample;
+    corrupted[23] = 0x7F;
+    ASSERT_EQ(predicate->evaluate(corrupted.data(), static_cast<uint32_t>(corrupted.size())),
+            CdrPredicateResult::malformed);
+
+    // Parameter list encapsulation
+    std::vector<uint8_t> parameter_list = sample;
+    parameter_list[1] = test::PL_CDR_LE;
+    ASSERT_TRUE(filter.accept(parameter_list.data(), static_cast<uint32_t>(parameter_list.size())));
+    ASSERT_EQ(predicate->evaluate(sample.data(), 2), CdrPredicateResult::malformed);
+
+    // The boolean after the level is never read
+    ASSERT_EQ(predicate->evaluate(sample.data(), static_cast<uint32_t>(sample.size() - 1)),
+            CdrPredicateResult::match);
+
+    test::Robot robot;
+    robot.level = 0;
+    sample = test::serialize(robot);
+    ASSERT_FALSE(filter.accept(sample.data(), static_cast<uint32_t>(sample.size())));
+
+    const ContentFilterStatistics statistics = filter.statistics();
+    ASSERT_EQ(statistics.topic, "rt/robot_status");
+    ASSERT_EQ(statistics.expression, "level = -3");
+    ASSERT_EQ(statistics.forwarded, 3u);
+    ASSERT_EQ(statistics.dropped, 1u);
+    ASSERT_EQ(statistics.malformed, 2u);
+}
+
+/**
+ * Test the engine hands the filters of each reader.
+ *
+ * CASES:
+ * - rules of other topics or participants do not apply
+ * - every rule that applies is returned
+ * - readers of the same topic share their filters
+ */
+TEST(ContentFilterTest, engine)
+{
+    ContentFilterEngine engine({
+        test::rule("rt/robot_*", "robot_id = 7"),
+        test::rule("rt/robot_status", "battery < 0.2", "P1"),
+    });
+
+    ASSERT_FALSE(engine.empty());
+    ASSERT_TRUE(engine.filters(test::topic("rt/chatter"), "P1").empty());
+
+    const auto p1_filters = engine.filters(test::topic("rt/robot_status"), "P1");
+    const auto p2_filters = engine.filters(test::topic("rt/robot_status"), "P2");
+    ASSERT_EQ(p1_filters.size(), 2u);
+    ASSERT_EQ(p2_filters.size(), 1u);
+    ASSERT_EQ(p1_filters[0], p2_filters[0]);
+
+    const std::vector<uint8_t> sample = test::serialize(test::Robot());
+    ASSERT_TRUE(p1_filters[0]->accept(sample.data(), static_cast<uint32_t>(sample.size())));
+    ASSERT_FALSE(p1_filters[1]->accept(sample.data(), static_cast<uint32_t>(sample.size())));
+
+    ASSERT_EQ(engine.statistics().size(), 2u);
+
+    ASSERT_THROW(ContentFilterEngine({test::rule("*", "speed > 1")}), utils::InitializationException);
+}
+
+/**
+ * Measure the time to drop a sample, evaluating a field after a string and a sequence.
+ *
+ * Times depend on the machine, so they are only reported.
+ */
+TEST(ContentFilterTest, benchmark)
+{
+    auto predicate = std::make_shared<const CdrPredicate>(
+        "robot_id IN (1, 2, 3) AND state LIKE 'FAULT%' OR level > %0", std::vector<std::string>({"100"}),
+        test::robot_fields());
+    ContentFilter filter(predicate, "rt/robot_status");
+
+    test::Robot robot;
+    robot.tags.resize(64);
+    const std::vector<uint8_t> sample = test::serialize(robot, test::PLAIN_CDR2_LE);
+
+    const auto start = std::chrono::steady_clock::now();
+
+    unsigned int forwarded = 0;
+    for (unsigned int i = 0; i < test::BENCHMARK_SAMPLES; ++i)
+    {
+        forwarded += filter.accept(sample.data(), static_cast<uint32_t>(sample.size()));
+    }
+
+    const double ns_per_sample = std::chrono::duration<double, std::nano>(
+        std::chrono::steady_clock::now() - start).count() / test::BENCHMARK_SAMPLES;
+
+    std::cout << "Content filter: " << ns_per_sample << " ns per sample dropped." << std::endl;
+    ::testing::Test::RecordProperty("ns_per_sample", std::to_string(ns_per_sample));
+
+    ASSERT_EQ(forwarded, 0u);
+    ASSERT_EQ(filter.statistics().dropped, test::BENCHMARK_SAMPLES);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,524 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file DiscoveryCoalescerTest.cpp
+ *
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <random>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <ddspipe_core/dynamic/DiscoveryDatabase.hpp>
+#include <ddspipe_core/types/dds/Endpoint.hpp>
+#include <ddspipe_core/types/dds/Guid.hpp>
+
+#include <ddsrouter_core/efficiency/discovery/DiscoveryCache.hpp>
+#include <ddsrouter_core/efficiency/discovery/DiscoveryCoalescer.hpp>
+
+using namespace eprosima;
+using namespace eprosima::ddsrouter::core;
+
+namespace test {
+
+//! Period long enough for every event of a test to fall in the same batch.
+constexpr utils::Duration_ms LONG_PERIOD = 60000;
+
+//! Period of the batches of the periodic test.
+constexpr utils::Duration_ms SHORT_PERIOD = 20;
+
+//! Period of the batches of the storm benchmark.
+constexpr utils::Duration_ms STORM_PERIOD = 100;
+
+//! Time that the DDS Pipe takes to process a single discovery change (e.g. creating or updating a bridge).
+constexpr std::chrono::microseconds PIPE_CHANGE_COST(10);
+
+//! Number of discovery events replayed by the storm benchmark.
+constexpr uint32_t STORM_EVENTS = 50000;
+
+//! Number of different endpoints discovered by the storm benchmark.
+constexpr uint32_t STORM_ENDPOINTS = 20000;
+
+//! Maximum time for the storm to reach the steady state.
+constexpr std::chrono::seconds STORM_TIMEOUT(30);
+
+//! File of the discovery cache of the tests.
+constexpr const char* CACHE_FILE = "DiscoveryCoalescerTest.cache";
+
+ddspipe::core::types::Endpoint endpoint(
+        uint32_t id)
+{
+    ddspipe::core::types::Endpoint endpoint;
+    endpoint.kind = ddspipe::core::types::EndpointKind::writer;
+    endpoint.active = true;
+    endpoint.guid.guidPrefix.value[0] = 1;
+    endpoint.guid.entityId.value[0] = static_cast<uint8_t>(id >> 24);
+    endpoint.guid.entityId.value[1] = static_cast<uint8_t>(id >> 16);
+    endpoint.guid.entityId.value[2] = static_cast<uint8_t>(id >> 8);
+    endpoint.guid.entityId.value[3] = static_cast<uint8_t>(id);
+    return endpoint;
+}
+
+//! Busy wait, as the DDS Pipe does not sleep while processing a change.
+void spin(
+        std::chrono::microseconds duration)
+{
+    const auto until = std::chrono::steady_clock::now() + duration;
+    while (std::chrono::steady_clock::now() < until)
+    {
+    }
+}
+
+//! Counts the changes that reach a database, taking \c cost to process each of them.
+struct DatabaseListener
+{
+    DatabaseListener(
+            ddspipe::core::DiscoveryDatabase& database,
+            std::chrono::microseconds cost = std::chrono::microseconds(0))
+    {
+        database.add_endpoint_discovered_callback([this, cost](ddspipe::core::types::Endpoint)
+                {
+                    spin(cost);
+                    ++added;
+                });
+        database.add_endpoint_updated_callback([this, cost](ddspipe::core::types::Endpoint)
+                {
+                    spin(cost);
+                    ++updated;
+                });
+        database.add_endpoint_erased_callback([this, cost](ddspipe::core::types::Endpoint)
+                {
+                    spin(cost);
+                    ++erased;
+                });
+    }
+
+    uint64_t changes() const
+    {
+        return added + updated + erased;
+    }
+
+    std::atomic<uint64_t> added{0};
+    std::atomic<uint64_t> updated{0};
+    std::atomic<uint64_t> erased{0};
+};
+
+/**
+ * Discovery events of a storm: endpoints discovered, rediscovered several times and flapping,
+ * in a reproducible random order.
+ */
+struct Storm
+{
+    Storm()
+    {
+        std::mt19937 generator(42);
+        std::uniform_int_distribution<uint32_t> distribution(0, STORM_ENDPOINTS - 1);
+
+        std::vector<bool> alive(STORM_ENDPOINTS, false);
+
+        // Every endpoint is discovered at least once, the rest of the events hit random endpoints
+        for (uint32_t i = 0; i < STORM_EVENTS; ++i)
+        {
+            const uint32_t id = i < STORM_ENDPOINTS ? i : distribution(generator);
+
+            // Some endpoints that are alive disappear, and may appear again later
+            const bool erase = alive[id] && distribution(generator) % 4 == 0;
+            events.push_back({id, !erase, alive[id]});
+            alive[id] = !erase;
+        }
+
+        for (uint32_t id = 0; id < STORM_ENDPOINTS; ++id)
+        {
+            if (alive[id])
+            {
+                ++final_endpoints;
+            }
+        }
+    }
+
+    //! Apply the storm to the database where the participants report.
+    void replay(
+            ddspipe::core::DiscoveryDatabase& database) const
+    {
+        for (const auto& event : events)
+        {
+            if (!event.alive)
+            {
+                database.erase_endpoint(endpoint(event.id));
+            }
+            else if (event.known)
+            {
+                database.update_endpoint(endpoint(event.id));
+            }
+            else
+            {
+                database.add_endpoint(endpoint(event.id));
+            }
+        }
+    }
+
+    struct Event
+    {
+        uint32_t id;
+        bool alive;
+        bool known;
+    };
+
+    std::vector<Event> events;
+
+    //! Endpoints alive once the storm is over.
+    uint64_t final_endpoints = 0;
+};
+
+//! Wait until \c condition holds or the storm timeout expires.
+template <typename Condition>
+bool wait_for(
+        Condition condition)
+{
+    const auto start = std::chrono::steady_clock::now();
+    while (!condition())
+    {
+        if (std::chrono::steady_clock::now() - start > STORM_TIMEOUT)
+        {
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return true;
+}
+
+//! Milliseconds since \c start .
+double elapsed_ms(
+        std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+} /* namespace test */
+
+/**
+ * Repeated discoveries of the same endpoint within a batch reach the target as a single add.
+ */
+TEST(DiscoveryCoalescerTest, coalesce_duplicates)
+{
+    auto source = std::make_shared<ddspipe::core::DiscoveryDatabase>();
+    auto target = std::make_shared<ddspipe::core::DiscoveryDatabase>();
+    test::DatabaseListener listener(*target);
+
+    auto coalescer = std::make_shared<DiscoveryCoalescer>(source, target, test::LONG_PERIOD);
+    coalescer->init();
+
+    source->add_endpoint(test::endpoint(1));
+    source->update_endpoint(test::endpoint(1));
+    source->update_endpoint(test::endpoint(1));
+    source->add_endpoint(test::endpoint(2));
+
+    ASSERT_FALSE(coalescer->idle());
+    ASSERT_EQ(listener.changes(), 0u);
+
+    coalescer->flush();
+
+    ASSERT_TRUE(coalescer->idle());
+    ASSERT_EQ(listener.added, 2u);
+    ASSERT_EQ(listener.updated, 0u);
+
+    // A later batch updates the endpoints already forwarded
+    source->update_endpoint(test::endpoint(1));
+    source->update_endpoint(test::endpoint(1));
+    coalescer->flush();
+
+    ASSERT_EQ(listener.added, 2u);
+    ASSERT_EQ(listener.updated, 1u);
+
+    const DiscoveryCoalescerStatistics statistics = coalescer->statistics();
+    ASSERT_EQ(statistics.received, 6u);
+    ASSERT_EQ(statistics.added, 2u);
+    ASSERT_EQ(statistics.updated, 1u);
+    ASSERT_EQ(statistics.coalesced, 3u);
+    ASSERT_EQ(statistics.batches, 2u);
+}
+
+/**
+ * An endpoint discovered and erased within a batch never reaches the target,
+ * while one erased in a later batch is erased from the target.
+ */
+TEST(DiscoveryCoalescerTest, flapping_endpoints)
+{
+    auto source = std::make_shared<ddspipe::core::DiscoveryDatabase>();
+    auto target = std::make_shared<ddspipe::core::DiscoveryDatabase>();
+    test::DatabaseListener listener(*target);
+
+    auto coalescer = std::make_shared<DiscoveryCoalescer>(source, target, test::LONG_PERIOD);
+    coalescer->init();
+
+    // Flapping endpoint
+    for (int i = 0; i < 10; ++i)
+    {
+        source->add_endpoint(test::endpoint(1));
+        source->erase_endpoint(test::endpoint(1));
+    }
+
+    // Endpoint that stays
+    source->add_endpoint(test::endpoint(2));
+    coalescer->flush();
+
+    ASSERT_EQ(listener.added, 1u);
+    ASSERT_EQ(listener.erased, 0u);
+    ASSERT_FALSE(target->endpoint_exists(test::endpoint(1).guid));
+    ASSERT_TRUE(target->endpoint_exists(test::endpoint(2).guid));
+
+    // Endpoint that leaves afterwards, flapping before leaving
+    source->erase_endpoint(test::endpoint(2));
+    source->add_endpoint(test::endpoint(2));
+    source->erase_endpoint(test::endpoint(2));
+    coalescer->flush();
+
+    ASSERT_EQ(listener.added, 1u);
+    ASSERT_EQ(listener.erased, 1u);
+    ASSERT_FALSE(target->endpoint_exists(test::endpoint(2).guid));
+    ASSERT_EQ(coalescer->statistics().coalesced, 22u);
+}
+
+/**
+ * The thread forwards the events once the batch period has elapsed, without calling \c flush .
+ */
+TEST(DiscoveryCoalescerTest, periodic_batches)
+{
+    auto source = std::make_shared<ddspipe::core::DiscoveryDatabase>();
+    auto target = std::make_shared<ddspipe::core::DiscoveryDatabase>();
+    test::DatabaseListener listener(*target);
+
+    auto coalescer = std::make_shared<DiscoveryCoalescer>(source, target, test::SHORT_PERIOD);
+    coalescer->init();
+
+    source->add_endpoint(test::endpoint(1));
+    source->update_endpoint(test::endpoint(1));
+
+    ASSERT_TRUE(test::wait_for([&]()
+            {
+                return coalescer->idle();
+            }));
+    ASSERT_EQ(listener.added, 1u);
+    ASSERT_EQ(listener.updated, 0u);
+}
+
+/**
+ * Endpoints saved in a discovery cache are loaded with the same guid, topic, QoS and discoverer.
+ */
+TEST(DiscoveryCoalescerTest, cache_round_trip)
+{
+    std::vector<ddspipe::core::types::Endpoint> endpoints;
+    for (uint32_t id = 0; id < 3; ++id)
+    {
+        auto cached = test::endpoint(id);
+        cached.kind = id % 2 ? ddspipe::core::types::EndpointKind::reader : ddspipe::core::types::EndpointKind::writer;
+        cached.topic.m_topic_name = "topic_" + std::to_string(id);
+        cached.topic.type_name = "type_" + std::to_string(id);
+        cached.topic.topic_qos.reliability_qos = ddspipe::core::types::ReliabilityKind::RELIABLE;
+        cached.topic.topic_qos.durability_qos = ddspipe::core::types::DurabilityKind::TRANSIENT_LOCAL;
+        cached.topic.topic_qos.keyed = id == 0;
+        cached.topic.topic_qos.history_depth = 10 + id;
+        cached.discoverer_participant_id = "participant_" + std::to_string(id);
+        endpoints.push_back(cached);
+    }
+
+    DiscoveryCache cache(test::CACHE_FILE);
+    ASSERT_TRUE(cache.save(endpoints));
+
+    const auto loaded = cache.load();
+    std::remove(test::CACHE_FILE);
+
+    ASSERT_EQ(loaded.size(), endpoints.size());
+    for (std::size_t i = 0; i < endpoints.size(); ++i)
+    {
+        ASSERT_EQ(loaded[i].guid, endpoints[i].guid);
+        ASSERT_EQ(loaded[i].kind, endpoints[i].kind);
+        ASSERT_TRUE(loaded[i].active);
+        ASSERT_EQ(loaded[i].topic.m_topic_name, endpoints[i].topic.m_topic_name);
+        ASSERT_EQ(loaded[i].topic.type_name, endpoints[i].topic.type_name);
+        ASSERT_EQ(loaded[i].topic.topic_qos.reliability_qos.get_value(),
+                ddspipe::core::types::ReliabilityKind::RELIABLE);
+        ASSERT_EQ(loaded[i].topic.topic_qos.durability_qos.get_value(),
+                ddspipe::core::types::DurabilityKind::TRANSIENT_LOCAL);
+        ASSERT_EQ(loaded[i].topic.topic_qos.keyed.get_value(), endpoints[i].topic.topic_qos.keyed.get_value());
+        ASSERT_EQ(loaded[i].topic.topic_qos.history_depth.get_value(), 10 + i);
+        ASSERT_EQ(loaded[i].discoverer_participant_id, endpoints[i].discoverer_participant_id);
+    }
+}
+
+/**
+ * A missing or corrupted discovery cache loads no endpoint.
+ */
+TEST(DiscoveryCoalescerTest, cache_missing_or_corrupted)
+{
+    DiscoveryCache cache(test::CACHE_FILE);
+    std::remove(test::CACHE_FILE);
+
+    ASSERT_TRUE(cache.load().empty());
+
+    // Not a cache
+    {
+        std::ofstream file(test::CACHE_FILE, std::ios::binary);
+        file << "this is not a discovery cache";
+    }
+    ASSERT_TRUE(cache.load().empty());
+
+    // Truncated cache
+    ASSERT_TRUE(cache.save({test::endpoint(1), test::endpoint(2)}));
+    {
+        std::ifstream input(test::CACHE_FILE, std::ios::binary);
+        std::string content{std::istreambuf_iterator<char>(input), std::istreambuf_iterator<char>()};
+        input.close();
+
+        std::ofstream output(test::CACHE_FILE, std::ios::binary | std::ios::trunc);
+        output << content.substr(0, content.size() - 4);
+    }
+    ASSERT_TRUE(cache.load().empty());
+
+    std::remove(test::CACHE_FILE);
+}
+
+/**
+ * Preloaded endpoints reach the target right away. Those discovered again stay, and the rest expire.
+ */
+TEST(DiscoveryCoalescerTest, preload_and_expire)
+{
+    auto source = std::make_shared<ddspipe::core::DiscoveryDatabase>();
+    auto target = std::make_shared<ddspipe::core::DiscoveryDatabase>();
+    test::DatabaseListener listener(*target);
+
+    auto coalescer = std::make_shared<DiscoveryCoalescer>(source, target, 0);
+    coalescer->init();
+
+    coalescer->preload({test::endpoint(1), test::endpoint(2)}, 200);
+
+    ASSERT_EQ(listener.added, 2u);
+    ASSERT_EQ(coalescer->endpoints().size(), 2u);
+
+    // Endpoint 1 is discovered again, so it is updated instead of added twice
+    source->add_endpoint(test::endpoint(1));
+    ASSERT_TRUE(test::wait_for([&]()
+            {
+                return coalescer->idle() && listener.updated == 1;
+            }));
+    ASSERT_EQ(listener.added, 2u);
+
+    // Endpoint 2 is never discovered again
+    ASSERT_TRUE(test::wait_for([&]()
+            {
+                return coalescer->statistics().expired == 1;
+            }));
+
+    ASSERT_EQ(listener.erased, 1u);
+    ASSERT_TRUE(target->endpoint_exists(test::endpoint(1).guid));
+    ASSERT_FALSE(target->endpoint_exists(test::endpoint(2).guid));
+
+    const auto endpoints = coalescer->endpoints();
+    ASSERT_EQ(endpoints.size(), 1u);
+    ASSERT_EQ(endpoints[0].guid, test::endpoint(1).guid);
+    ASSERT_EQ(coalescer->statistics().preloaded, 2u);
+}
+
+/**
+ * Replay a storm of 50k discovery events and measure the time until the DDS Pipe database reaches its
+ * steady state, with and without batching.
+ *
+ * The time without batching is that of forwarding every event to the target database right away, that is what
+ * the DDS Pipe would have to process. Both databases are given the same cost per change, standing for the work
+ * of the DDS Pipe.
+ */
+TEST(DiscoveryCoalescerTest, storm_50k_endpoints)
+{
+    const test::Storm storm;
+
+    // Direct forwarding
+    double direct_ms;
+    uint64_t direct_changes;
+    {
+        auto target = std::make_shared<ddspipe::core::DiscoveryDatabase>();
+        test::DatabaseListener listener(*target, test::PIPE_CHANGE_COST);
+
+        const auto start = std::chrono::steady_clock::now();
+        storm.replay(*target);
+        direct_ms = test::elapsed_ms(start);
+        direct_changes = listener.changes();
+    }
+
+    // Batched forwarding
+    double batched_ms;
+    uint64_t batched_changes;
+    {
+        auto source = std::make_shared<ddspipe::core::DiscoveryDatabase>();
+        auto target = std::make_shared<ddspipe::core::DiscoveryDatabase>();
+        test::DatabaseListener listener(*target, test::PIPE_CHANGE_COST);
+
+        auto coalescer = std::make_shared<DiscoveryCoalescer>(source, target, test::STORM_PERIOD);
+        coalescer->init();
+
+        const auto start = std::chrono::steady_clock::now();
+        storm.replay(*source);
+
+        // Steady state: every event forwarded and the target holding exactly the endpoints alive
+        while (!coalescer->idle() && std::chrono::steady_clock::now() - start < test::STORM_TIMEOUT)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        batched_ms = test::elapsed_ms(start);
+        batched_changes = listener.changes();
+
+        ASSERT_TRUE(coalescer->idle());
+        ASSERT_EQ(listener.added - listener.erased, storm.final_endpoints);
+
+        const DiscoveryCoalescerStatistics statistics = coalescer->statistics();
+        ASSERT_EQ(statistics.received, test::STORM_EVENTS);
+        ASSERT_EQ(statistics.coalesced + batched_changes, test::STORM_EVENTS);
+
+        std::cout
+            << "Storm of " << test::STORM_EVENTS << " discovery events over " << test::STORM_ENDPOINTS
+            << " endpoints (" << storm.final_endpoints << " alive at the end)" << std::endl
+            << "  direct:  " << direct_changes << " changes, steady state in " << direct_ms << " ms" << std::endl
+            << "  batched: " << batched_changes << " changes in " << statistics.batches
+            << " batches, steady state in " << batched_ms << " ms" << std::endl;
+    }
+
+    // The DDS Pipe sees fewer changes, never more
+    ASSERT_EQ(direct_changes, test::STORM_EVENTS);
+    ASSERT_LT(batched_changes, direct_changes);
+
+    ::testing::Test::RecordProperty("direct_ms", std::to_string(direct_ms));
+    ::testing::Test::RecordProperty("batched_ms", std::to_string(batched_ms));
+    ::testing::Test::RecordProperty("batched_changes", std::to_string(batched_changes));
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
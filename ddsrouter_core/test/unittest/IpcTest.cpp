@@ -0,0 +1,284 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file IpcTest.cpp
+ *
+ */
+
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include <cpp_utils/exception/InitializationException.hpp>
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <ddsrouter_core/participants/ipc/IpcChannel.hpp>
+#include <ddsrouter_core/participants/ipc/SpscRing.hpp>
+
+using namespace eprosima;
+using namespace eprosima::ddsrouter::core;
+
+namespace test {
+
+constexpr uint64_t RING_SIZE = 1024;
+
+constexpr uint32_t TEST_RECORD = 7;
+
+//! Ring over memory owned by the test.
+struct TestRing
+{
+    TestRing()
+        : data(RING_SIZE)
+        , ring(&control, data.data(), RING_SIZE)
+    {
+        control.head = 0;
+        control.tail = 0;
+    }
+
+    SpscRingControl control;
+    std::vector<uint8_t> data;
+    SpscRing ring;
+};
+
+bool push(
+        SpscRing& ring,
+        uint32_t value,
+        uint64_t size)
+{
+    uint8_t* buffer = ring.try_reserve(size);
+    if (!buffer)
+    {
+        return false;
+    }
+
+    std::memset(buffer, 0, size);
+    std::memcpy(buffer, &value, sizeof(value));
+    ring.commit(TEST_RECORD);
+    return true;
+}
+
+bool pop(
+        SpscRing& ring,
+        uint32_t& value,
+        uint64_t& size)
+{
+    uint32_t type;
+    const uint8_t* record = ring.try_peek(type, size);
+    if (!record)
+    {
+        return false;
+    }
+
+    EXPECT_EQ(type, TEST_RECORD);
+    std::memcpy(&value, record, sizeof(value));
+    ring.release();
+    return true;
+}
+
+} /* namespace test */
+
+/**
+ * Records are read in the same order and with the same size they are written.
+ */
+TEST(IpcTest, ring_fifo)
+{
+    test::TestRing test_ring;
+
+    for (uint32_t i = 0; i < 10; ++i)
+    {
+        ASSERT_TRUE(test::push(test_ring.ring, i, 4 + i));
+    }
+
+    for (uint32_t i = 0; i < 10; ++i)
+    {
+        uint32_t value;
+        uint64_t size;
+        ASSERT_TRUE(test::pop(test_ring.ring, value, size));
+        ASSERT_EQ(value, i);
+        ASSERT_EQ(size, 4u + i);
+    }
+
+    uint32_t value;
+    uint64_t size;
+    ASSERT_FALSE(test::pop(test_ring.ring, value, size));
+}
+
+/**
+ * A full ring rejects records until the consumer frees space, and records too big are always rejected.
+ */
+TEST(IpcTest, ring_full)
+{
+    test::TestRing test_ring;
+
+    // Each record of 120 bytes takes 128 in the ring
+    for (uint32_t i = 0; i < test::RING_SIZE / 128; ++i)
+    {
+        ASSERT_TRUE(test::push(test_ring.ring, i, 120));
+    }
+    ASSERT_FALSE(test::push(test_ring.ring, 0, 120));
+
+    uint32_t value;
+    uint64_t size;
+    ASSERT_TRUE(test::pop(test_ring.ring, value, size));
+    ASSERT_TRUE(test::push(test_ring.ring, 0, 120));
+
+    ASSERT_EQ(test_ring.ring.try_reserve(test_ring.ring.max_record_size() + 1), nullptr);
+}
+
+/**
+ * Records that do not fit before the end of the ring are written at the beginning, and the padding is skipped.
+ */
+TEST(IpcTest, ring_wrap_around)
+{
+    test::TestRing test_ring;
+
+    uint32_t expected = 0;
+    uint32_t next = 0;
+
+    // Sizes not multiple of the ring size force padding records in every lap
+    for (unsigned int lap = 0; lap < 1000; ++lap)
+    {
+        while (test::push(test_ring.ring, next, 100 + next % 200))
+        {
+            ++next;
+        }
+
+        uint32_t value;
+        uint64_t size;
+        while (test::pop(test_ring.ring, value, size))
+        {
+            ASSERT_EQ(value, expected);
+            ASSERT_EQ(size, 100u + expected % 200);
+            ++expected;
+        }
+    }
+
+    ASSERT_EQ(expected, next);
+}
+
+/**
+ * A producer and a consumer thread exchange records without losing or reordering any of them.
+ */
+TEST(IpcTest, ring_concurrent)
+{
+    test::TestRing test_ring;
+    constexpr uint32_t N_RECORDS = 100000;
+
+    std::thread producer([&]()
+            {
+                for (uint32_t i = 0; i < N_RECORDS; ++i)
+                {
+                    while (!test::push(test_ring.ring, i, 8 + i % 64))
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+
+    for (uint32_t i = 0; i < N_RECORDS; ++i)
+    {
+        uint32_t value;
+        uint64_t size;
+        while (!test::pop(test_ring.ring, value, size))
+        {
+            std::this_thread::yield();
+        }
+        ASSERT_EQ(value, i);
+    }
+
+    producer.join();
+}
+
+/**
+ * Two channels opened with the same name are the two sides of the same channel, and a third one is rejected.
+ */
+TEST(IpcTest, channel_sides)
+{
+    IpcChannel first("ipc_test_sides", 64 * 1024, std::chrono::milliseconds(10));
+    ASSERT_FALSE(first.peer_attached());
+
+    {
+        IpcChannel second("ipc_test_sides", 64 * 1024, std::chrono::milliseconds(10));
+        ASSERT_NE(first.side(), second.side());
+        ASSERT_TRUE(first.peer_attached());
+        ASSERT_TRUE(second.peer_attached());
+        ASSERT_EQ(first.peer_epoch(), second.epoch());
+
+        ASSERT_THROW(
+            IpcChannel("ipc_test_sides", 64 * 1024, std::chrono::milliseconds(10)),
+            utils::InitializationException);
+
+        // Channels of a different ring size can not share the segment
+        ASSERT_THROW(
+            IpcChannel("ipc_test_sides", 128 * 1024, std::chrono::milliseconds(10)),
+            utils::InitializationException);
+    }
+
+    ASSERT_FALSE(first.peer_attached());
+
+    // The free side is claimed again with a new epoch
+    const uint32_t old_epoch = first.peer_epoch();
+    IpcChannel third("ipc_test_sides", 64 * 1024, std::chrono::milliseconds(10));
+    ASSERT_TRUE(first.peer_attached());
+    ASSERT_NE(first.peer_epoch(), old_epoch);
+}
+
+/**
+ * Records sent by each side are received by the other one.
+ */
+TEST(IpcTest, channel_send_receive)
+{
+    IpcChannel first("ipc_test_send_receive", 64 * 1024, std::chrono::milliseconds(10));
+    IpcChannel second("ipc_test_send_receive", 64 * 1024, std::chrono::milliseconds(10));
+
+    const char message[] = "hello";
+    ASSERT_TRUE(first.send(test::TEST_RECORD, sizeof(message),
+            [&](uint8_t* buffer)
+            {
+                std::memcpy(buffer, message, sizeof(message));
+            }));
+
+    uint32_t type;
+    uint64_t size;
+    const uint8_t* record = second.try_receive(type, size);
+    ASSERT_NE(record, nullptr);
+    ASSERT_EQ(type, test::TEST_RECORD);
+    ASSERT_EQ(size, sizeof(message));
+    ASSERT_EQ(std::memcmp(record, message, sizeof(message)), 0);
+    second.release_received();
+
+    ASSERT_EQ(second.try_receive(type, size), nullptr);
+    ASSERT_EQ(first.try_receive(type, size), nullptr);
+
+    // The ring of a side is full when the peer does not consume it
+    uint64_t sent = 0;
+    while (second.send(test::TEST_RECORD, 1024, [](uint8_t*)
+            {
+            }))
+    {
+        ++sent;
+    }
+    ASSERT_GT(sent, 0u);
+    ASSERT_LT(sent, 64u);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
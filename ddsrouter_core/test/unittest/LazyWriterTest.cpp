@@ -0,0 +1,359 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file LazyWriterTest.cpp
+ *
+ */
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <ddspipe_core/dynamic/DiscoveryDatabase.hpp>
+#include <ddspipe_core/interface/IParticipant.hpp>
+#include <ddspipe_core/interface/IWriter.hpp>
+#include <ddspipe_core/types/data/RtpsPayloadData.hpp>
+
+#include <ddsrouter_core/efficiency/lazy/LazyWriterEngine.hpp>
+#include <ddsrouter_core/participants/lazy/LazyParticipant.hpp>
+#include <ddsrouter_core/participants/lazy/LazyWriter.hpp>
+
+using namespace eprosima;
+using namespace eprosima::ddsrouter::core;
+
+namespace test {
+
+//! Writer that counts what is done with it.
+class MockWriter : public ddspipe::core::IWriter
+{
+public:
+
+    MockWriter(
+            std::atomic<uint64_t>& total_written)
+        : total_written(total_written)
+    {
+    }
+
+    void enable() noexcept override
+    {
+        enabled = true;
+    }
+
+    void disable() noexcept override
+    {
+        enabled = false;
+    }
+
+    utils::ReturnCode write(
+            ddspipe::core::IRoutingData& /* data */) noexcept override
+    {
+        ++written;
+        ++total_written;
+        return utils::ReturnCode::RETCODE_OK;
+    }
+
+    std::atomic<bool> enabled{false};
+    std::atomic<uint64_t> written{0};
+
+    //! Messages written by every writer of the participant.
+    std::atomic<uint64_t>& total_written;
+};
+
+//! Participant that creates \c MockWriter and counts them.
+class MockParticipant : public ddspipe::core::IParticipant
+{
+public:
+
+    ddspipe::core::types::ParticipantId id() const noexcept override
+    {
+        return "mock";
+    }
+
+    bool is_repeater() const noexcept override
+    {
+        return false;
+    }
+
+    bool is_rtps_kind() const noexcept override
+    {
+        return false;
+    }
+
+    ddspipe::core::types::TopicQoS topic_qos() const noexcept override
+    {
+        return ddspipe::core::types::TopicQoS();
+    }
+
+    std::shared_ptr<ddspipe::core::IWriter> create_writer(
+            const ddspipe::core::ITopic& /* topic */) override
+    {
+        ++created;
+        last_writer = std::make_shared<MockWriter>(total_written);
+        return last_writer;
+    }
+
+    std::shared_ptr<ddspipe::core::IReader> create_reader(
+            const ddspipe::core::ITopic& /* topic */) override
+    {
+        return nullptr;
+    }
+
+    std::atomic<uint64_t> created{0};
+    std::atomic<uint64_t> total_written{0};
+    std::shared_ptr<MockWriter> last_writer;
+};
+
+ddspipe::core::types::DdsTopic topic(
+        const std::string& name)
+{
+    ddspipe::core::types::DdsTopic topic;
+    topic.m_topic_name = name;
+    topic.type_name = "type";
+    return topic;
+}
+
+ddspipe::core::types::Endpoint reader(
+        uint8_t id,
+        const std::string& topic_name,
+        const ddspipe::core::types::ParticipantId& participant_id = "mock")
+{
+    ddspipe::core::types::Endpoint endpoint;
+    endpoint.kind = ddspipe::core::types::EndpointKind::reader;
+    endpoint.guid.entityId.value[3] = id;
+    endpoint.topic = topic(topic_name);
+    endpoint.active = true;
+    endpoint.discoverer_participant_id = participant_id;
+    return endpoint;
+}
+
+} /* namespace test */
+
+using namespace test;
+
+/**
+ * Check that the inner writer is only created with the first message, and keeps the enabled state of the lazy
+ * writer.
+ */
+TEST(LazyWriterTest, create_on_first_write)
+{
+    auto participant = std::make_shared<MockParticipant>();
+    auto engine = std::make_shared<LazyWriterEngine>(0);
+    LazyParticipant lazy_participant(participant, engine);
+
+    std::shared_ptr<ddspipe::core::IWriter> writer = lazy_participant.create_writer(topic("topic"));
+    writer->enable();
+
+    ASSERT_EQ(participant->created, 0u);
+    ASSERT_EQ(engine->statistics().writers, 1u);
+    ASSERT_EQ(engine->statistics().active, 0u);
+
+    ddspipe::core::types::RtpsPayloadData data;
+    ASSERT_EQ(writer->write(data), utils::ReturnCode::RETCODE_OK);
+    ASSERT_EQ(writer->write(data), utils::ReturnCode::RETCODE_OK);
+
+    ASSERT_EQ(participant->created, 1u);
+    ASSERT_TRUE(participant->last_writer->enabled);
+    ASSERT_EQ(participant->last_writer->written, 2u);
+
+    writer->disable();
+    ASSERT_FALSE(participant->last_writer->enabled);
+
+    const LazyWriterStatistics statistics = engine->statistics();
+    ASSERT_EQ(statistics.writers, 1u);
+    ASSERT_EQ(statistics.active, 1u);
+    ASSERT_EQ(statistics.created, 1u);
+    ASSERT_EQ(statistics.reaped, 0u);
+
+    // Writers destroyed by the DDS Pipe are not counted anymore
+    writer.reset();
+    ASSERT_EQ(engine->statistics().writers, 0u);
+    ASSERT_EQ(engine->statistics().active, 0u);
+}
+
+/**
+ * Check that a writer is only destroyed after being idle for longer than the TTL, and created again with the next
+ * message.
+ */
+TEST(LazyWriterTest, reap_idle_writer)
+{
+    constexpr int64_t MILLISECOND = 1000000;
+
+    auto participant = std::make_shared<MockParticipant>();
+    auto counters = std::make_shared<LazyWriterCounters>();
+    LazyWriter writer(participant, topic("topic"), counters);
+    writer.enable();
+
+    // Nothing to reap before the first message
+    ASSERT_FALSE(writer.reap_if_idle(LazyWriter::now() + 1000 * MILLISECOND, 10 * MILLISECOND));
+
+    ddspipe::core::types::RtpsPayloadData data;
+    writer.write(data);
+    ASSERT_TRUE(writer.created());
+
+    // Not idle yet
+    ASSERT_FALSE(writer.reap_if_idle(LazyWriter::now(), 1000 * MILLISECOND));
+    ASSERT_TRUE(writer.created());
+
+    // Idle
+    ASSERT_TRUE(writer.reap_if_idle(LazyWriter::now() + 1000 * MILLISECOND, 10 * MILLISECOND));
+    ASSERT_FALSE(writer.created());
+    ASSERT_FALSE(participant->last_writer->enabled);
+    ASSERT_EQ(counters->active, 0u);
+    ASSERT_EQ(counters->reaped, 1u);
+
+    // Created again, enabled
+    writer.write(data);
+    ASSERT_TRUE(writer.created());
+    ASSERT_EQ(participant->created, 2u);
+    ASSERT_TRUE(participant->last_writer->enabled);
+    ASSERT_EQ(counters->created, 2u);
+    ASSERT_EQ(counters->active, 1u);
+}
+
+/**
+ * Check that the reaper of the engine destroys the idle writers only, while others keep writing.
+ */
+TEST(LazyWriterTest, engine_reaper)
+{
+    auto participant = std::make_shared<MockParticipant>();
+    auto engine = std::make_shared<LazyWriterEngine>(50);
+
+    auto busy_writer = engine->create_writer(participant, topic("busy"));
+    auto idle_writer = engine->create_writer(participant, topic("idle"));
+
+    ddspipe::core::types::RtpsPayloadData data;
+    busy_writer->write(data);
+    idle_writer->write(data);
+
+    // Keep writing in one of them for several TTLs
+    const auto end = std::chrono::steady_clock::now() + std::chrono::milliseconds(300);
+    while (std::chrono::steady_clock::now() < end)
+    {
+        busy_writer->write(data);
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+
+    const LazyWriterStatistics statistics = engine->statistics();
+    ASSERT_EQ(statistics.writers, 2u);
+    ASSERT_EQ(statistics.active, 1u);
+    ASSERT_EQ(statistics.created, 2u);
+    ASSERT_EQ(statistics.reaped, 1u);
+    ASSERT_TRUE(std::static_pointer_cast<LazyWriter>(busy_writer)->created());
+    ASSERT_FALSE(std::static_pointer_cast<LazyWriter>(idle_writer)->created());
+}
+
+/**
+ * Check that writers are only reaped when their participant has not discovered readers in their topic, so
+ * subscribers of topics publishing less often than the TTL do not lose messages.
+ *
+ * CASES:
+ * - reader of the participant in the topic keeps the writer
+ * - readers of other participants or topics do not
+ * - writer reaped once its readers are deactivated or removed
+ */
+TEST(LazyWriterTest, writers_with_readers_not_reaped)
+{
+    auto participant = std::make_shared<MockParticipant>();
+    auto engine = std::make_shared<LazyWriterEngine>(0);
+    auto discovery_database = std::make_shared<ddspipe::core::DiscoveryDatabase>();
+    engine->track_readers(discovery_database);
+
+    auto writer = engine->create_writer(participant, topic("topic"));
+    ddspipe::core::types::RtpsPayloadData data;
+
+    discovery_database->add_endpoint(reader(1, "topic"));
+    discovery_database->add_endpoint(reader(2, "topic"));
+    discovery_database->add_endpoint(reader(3, "other_topic"));
+    discovery_database->add_endpoint(reader(4, "topic", "other_participant"));
+    ASSERT_TRUE(engine->has_readers("mock", "topic"));
+
+    // Idle for longer than the TTL, since the TTL is 0
+    writer->write(data);
+    ASSERT_EQ(engine->reap_idle_writers(), 0u);
+    ASSERT_TRUE(std::static_pointer_cast<LazyWriter>(writer)->created());
+
+    ddspipe::core::types::Endpoint inactive = reader(1, "topic");
+    inactive.active = false;
+    discovery_database->update_endpoint(inactive);
+    ASSERT_EQ(engine->reap_idle_writers(), 0u);
+
+    discovery_database->erase_endpoint(reader(2, "topic"));
+    ASSERT_FALSE(engine->has_readers("mock", "topic"));
+    ASSERT_EQ(engine->reap_idle_writers(), 1u);
+    ASSERT_FALSE(std::static_pointer_cast<LazyWriter>(writer)->created());
+}
+
+/**
+ * Check that concurrent writes to a writer being reaped never lose a message.
+ */
+TEST(LazyWriterTest, concurrent_write_and_reap)
+{
+    constexpr uint32_t THREADS = 4;
+    constexpr uint32_t MESSAGES = 10000;
+
+    auto participant = std::make_shared<MockParticipant>();
+    auto counters = std::make_shared<LazyWriterCounters>();
+    auto writer = std::make_shared<LazyWriter>(participant, topic("topic"), counters);
+    writer->enable();
+
+    std::atomic<bool> running{true};
+
+    std::thread reaper([&]()
+            {
+                while (running)
+                {
+                    // TTL 0 reaps the writer as soon as it is not writing
+                    writer->reap_if_idle(LazyWriter::now(), 0);
+                }
+            });
+
+    std::vector<std::thread> threads;
+    for (uint32_t i = 0; i < THREADS; ++i)
+    {
+        threads.emplace_back([&]()
+                {
+                    ddspipe::core::types::RtpsPayloadData data;
+                    for (uint32_t j = 0; j < MESSAGES; ++j)
+                    {
+                        writer->write(data);
+                    }
+                });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    running = false;
+    reaper.join();
+
+    // Inner writers are replaced while writing, but every message reaches one of them
+    ASSERT_EQ(participant->total_written, THREADS * MESSAGES);
+    ASSERT_EQ(counters->created - counters->reaped, counters->active.load());
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,275 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file LogThrottleTest.cpp
+ *
+ */
+
+#include <stdlib.h>
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <cpp_utils/exception/InitializationException.hpp>
+#include <cpp_utils/Log.hpp>
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <ddsrouter_core/logging/BinaryLog.hpp>
+#include <ddsrouter_core/logging/LogThrottle.hpp>
+
+using namespace eprosima;
+using namespace eprosima::ddsrouter::core;
+
+namespace test {
+
+constexpr unsigned int STORM_THREADS = 4;
+constexpr unsigned int STORM_ENTRIES = 50000;
+constexpr unsigned int STORM_MAX_PER_SECOND = 10;
+
+LogThrottleConfiguration rule(
+        const std::string& category,
+        unsigned int max_per_second)
+{
+    LogThrottleConfiguration rule;
+    rule.category = category;
+    rule.max_per_second = max_per_second;
+    return rule;
+}
+
+//! Temporary directory for the files of a test.
+std::string temporary_directory()
+{
+    char path[] = "/tmp/ddsrouter_log_throttle_test_XXXXXX";
+    return mkdtemp(path);
+}
+
+//! Warnings of the same site logged by several threads at once, as in an error storm.
+double storm_ns_per_entry()
+{
+    const auto start = std::chrono::steady_clock::now();
+
+    std::vector<std::thread> threads;
+    for (unsigned int thread = 0; thread < STORM_THREADS; ++thread)
+    {
+        threads.emplace_back([thread]()
+                {
+                    for (unsigned int i = 0; i < STORM_ENTRIES; ++i)
+                    {
+                        logBinaryWarning(DDSROUTER_TEST_STORM, "Failed to send message {} of thread {}.", i, thread);
+                    }
+                });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    utils::Log::Flush();
+
+    const double elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    return elapsed / (STORM_THREADS * STORM_ENTRIES);
+}
+
+} /* namespace test */
+
+/**
+ * Each site logs up to the limit of the first rule matching its category, and the rest are suppressed and reported.
+ *
+ * CASES:
+ * - sites of a category matching a rule are limited
+ * - each site has its own limit
+ * - only the first matching rule applies
+ * - sites of categories matching no rule are not limited
+ */
+TEST(LogThrottleTest, limit_per_site)
+{
+    utils::Log::SetVerbosity(utils::Log::Kind::Warning);
+
+    BinaryLogConfiguration configuration;
+    configuration.enabled = true;
+    configuration.output_directory = test::temporary_directory();
+    BinaryLog binary_log(configuration);
+
+    // The entries of the test are logged within the first window of each site
+    LogThrottle throttle({test::rule("DDSROUTER_TEST_LIMITED*", 10), test::rule("DDSROUTER_TEST_LIMITED", 1)});
+
+    for (unsigned int i = 0; i < 100; ++i)
+    {
+        logBinaryWarning(DDSROUTER_TEST_LIMITED, "First site {}", i);
+        logBinaryWarning(DDSROUTER_TEST_LIMITED, "Second site {}", i);
+        logBinaryWarning(DDSROUTER_TEST, "Unlimited site {}", i);
+    }
+
+    binary_log.flush();
+    ASSERT_EQ(binary_log.statistics().written, 10u + 10u + 100u);
+    ASSERT_EQ(throttle.statistics().suppressed, 90u + 90u);
+
+    // A report per site with entries suppressed
+    throttle.report();
+    ASSERT_EQ(throttle.statistics().reports, 2u);
+
+    // Nothing suppressed since
+    throttle.report();
+    ASSERT_EQ(throttle.statistics().reports, 2u);
+}
+
+/**
+ * Each window lets the limit of entries through again.
+ */
+TEST(LogThrottleTest, windows)
+{
+    utils::Log::SetVerbosity(utils::Log::Kind::Warning);
+
+    constexpr unsigned int WINDOW = 50;
+
+    // 10 entries per window
+    LogThrottle throttle({test::rule("DDSROUTER_*", 200)}, WINDOW);
+
+    LogSite site{"DDSROUTER_TEST", BinaryLogKind::warning, "Entry", __FILE__, __LINE__};
+
+    for (unsigned int window = 0; window < 3; ++window)
+    {
+        unsigned int accepted = 0;
+        for (unsigned int i = 0; i < 100; ++i)
+        {
+            accepted += LogThrottle::accepts(site) ? 1 : 0;
+        }
+
+        // A window may start in the middle of the entries
+        ASSERT_GE(accepted, 10u);
+        ASSERT_LE(accepted, 20u);
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(WINDOW + 10));
+    }
+
+    // Reported by the report thread at the end of each window
+    ASSERT_GE(throttle.statistics().reports, 2u);
+}
+
+/**
+ * There is at most one log throttle in the process, and rules must let entries through.
+ */
+TEST(LogThrottleTest, invalid)
+{
+    {
+        LogThrottle throttle({test::rule("*", 10)});
+        ASSERT_THROW(LogThrottle another({test::rule("*", 10)}), utils::InitializationException);
+    }
+
+    // Once destroyed, sites are not limited, and there can be a new one
+    LogSite site{"DDSROUTER_TEST", BinaryLogKind::warning, "Entry", __FILE__, __LINE__};
+    for (unsigned int i = 0; i < 100; ++i)
+    {
+        ASSERT_TRUE(LogThrottle::accepts(site));
+    }
+    LogThrottle throttle({test::rule("*", 10)});
+
+    utils::Formatter error_msg;
+    ASSERT_FALSE(test::rule("DDSROUTER_*", 0).is_valid(error_msg));
+    ASSERT_FALSE(test::rule("", 10).is_valid(error_msg));
+    ASSERT_TRUE(test::rule("DDSROUTER_*", 10).is_valid(error_msg));
+}
+
+/**
+ * Log throttles destroyed while other threads check their entries, which must not use a throttle destroyed.
+ */
+TEST(LogThrottleTest, destroyed_while_logging)
+{
+    LogSite site{"DDSROUTER_TEST", BinaryLogKind::warning, "Entry", __FILE__, __LINE__};
+    std::atomic<bool> stop{false};
+
+    std::vector<std::thread> threads;
+    for (unsigned int thread = 0; thread < test::STORM_THREADS; ++thread)
+    {
+        threads.emplace_back([&site, &stop]()
+                {
+                    while (!stop)
+                    {
+                        LogThrottle::accepts(site);
+                    }
+                });
+    }
+
+    for (unsigned int i = 0; i < 100; ++i)
+    {
+        LogThrottle throttle({test::rule("DDSROUTER_*", 1)});
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+    }
+
+    stop = true;
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    // Without a log throttle, every entry is logged
+    ASSERT_TRUE(LogThrottle::accepts(site));
+}
+
+/**
+ * Storm of warnings of a hot path, formatted and queued in the log without a binary log.
+ *
+ * With the log throttle, the entries logged are bounded by its limit, whatever the entries of the storm.
+ */
+TEST(LogThrottleTest, error_storm)
+{
+    utils::Log::SetVerbosity(utils::Log::Kind::Warning);
+
+    // Measure the cost of the entries, not of printing them
+    utils::Log::ClearConsumers();
+
+    const double unthrottled_ns = test::storm_ns_per_entry();
+
+    double throttled_ns;
+    LogThrottleStatistics statistics;
+    {
+        const auto start = std::chrono::steady_clock::now();
+
+        LogThrottle throttle({test::rule("DDSROUTER_*", test::STORM_MAX_PER_SECOND)});
+        throttled_ns = test::storm_ns_per_entry();
+        statistics = throttle.statistics();
+
+        const uint64_t logged = test::STORM_THREADS * test::STORM_ENTRIES - statistics.suppressed;
+        const auto seconds = std::chrono::duration_cast<std::chrono::seconds>(
+            std::chrono::steady_clock::now() - start).count();
+
+        std::cout
+            << "Storm of " << test::STORM_THREADS * test::STORM_ENTRIES << " warnings from "
+            << test::STORM_THREADS << " threads" << std::endl
+            << "  unthrottled: " << unthrottled_ns << " ns per entry" << std::endl
+            << "  throttled:   " << throttled_ns << " ns per entry, " << logged << " logged and "
+            << statistics.suppressed << " suppressed" << std::endl;
+
+        // Up to the limit in each window, plus the entries counted before a window is reset
+        ASSERT_LE(logged, test::STORM_MAX_PER_SECOND * (seconds + 1) + test::STORM_THREADS);
+    }
+
+    ::testing::Test::RecordProperty("unthrottled_ns", std::to_string(unthrottled_ns));
+    ::testing::Test::RecordProperty("throttled_ns", std::to_string(throttled_ns));
+    ::testing::Test::RecordProperty("suppressed", std::to_string(statistics.suppressed));
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
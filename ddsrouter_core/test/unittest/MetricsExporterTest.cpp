@@ -0,0 +1,226 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file MetricsExporterTest.cpp
+ *
+ */
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <string>
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <ddsrouter_core/monitoring/MetricsExporter.hpp>
+
+using namespace eprosima;
+using namespace eprosima::ddsrouter::core;
+
+namespace test {
+
+//! Metrics of a router with a slot, a rate limit, a sink and the payload pool.
+RouterMetrics metrics()
+{
+    RouterMetrics metrics;
+
+    SlotStatistics slot;
+    slot.participant_id = "P1";
+    slot.topic = "rt/\"chatter\"";
+    slot.messages = 10;
+    slot.bytes = 1000;
+    slot.enqueued = 4;
+    slot.executed = 3;
+    slot.queue_latency_us = 1500;
+    slot.task_time_us = 123456789;
+    slot.max_queue_depth = 7;
+    metrics.slots.push_back(slot);
+
+    RateLimitStatistics limit{};
+    limit.scope = types::RateLimitScope::topic;
+    limit.key = "rt/chatter";
+    limit.accepted_msgs = 8;
+    limit.dropped_msgs = 2;
+    metrics.rate_limits.push_back(limit);
+
+    SinkReport sink;
+    sink.generated = 2;
+    sink.latency_p50 = 1000000;
+    sink.latency_p99 = 2000000;
+    sink.latency_mean = 1500000;
+    sink.topics["rt/chatter"].messages = 2;
+    metrics.sinks["sink"] = sink;
+
+    metrics.payload_pool.slots = 16;
+    metrics.payload_pool.free_slots = 12;
+    metrics.payload_pool.pooled = 100;
+    metrics.payload_pool.heap = 1;
+
+    return metrics;
+}
+
+//! Send \c request to the server in \c port of localhost and return the whole response.
+std::string http_request(
+        uint16_t port,
+        const std::string& request)
+{
+    const int fd = socket(AF_INET, SOCK_STREAM, 0);
+
+    sockaddr_in address{};
+    address.sin_family = AF_INET;
+    address.sin_port = htons(port);
+    inet_pton(AF_INET, "127.0.0.1", &address.sin_addr);
+
+    if (connect(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0)
+    {
+        close(fd);
+        return "";
+    }
+
+    send(fd, request.data(), request.size(), 0);
+
+    std::string response;
+    char buffer[4096];
+    ssize_t received;
+    while ((received = recv(fd, buffer, sizeof(buffer), 0)) > 0)
+    {
+        response.append(buffer, static_cast<std::size_t>(received));
+    }
+
+    close(fd);
+    return response;
+}
+
+std::string get(
+        uint16_t port,
+        const std::string& path)
+{
+    return http_request(port, "GET " + path + " HTTP/1.1\r\nHost: localhost\r\n\r\n");
+}
+
+} /* namespace test */
+
+using namespace test;
+
+/**
+ * Test that the metrics are serialized in OpenMetrics format, with their label values escaped.
+ */
+TEST(MetricsExporterTest, serialize)
+{
+    const std::string text = MetricsExporter::serialize(metrics());
+
+    ASSERT_NE(text.find("# TYPE ddsrouter_topic_messages counter\n"), std::string::npos);
+    ASSERT_NE(text.find("ddsrouter_topic_messages_total{participant=\"P1\",topic=\"rt/\\\"chatter\\\"\"} 10\n"),
+            std::string::npos);
+    ASSERT_NE(text.find("ddsrouter_thread_pool_queue_latency_seconds_count{participant=\"P1\""), std::string::npos);
+    ASSERT_NE(text.find("ddsrouter_rate_limit_messages_total{scope=\"topic\",key=\"rt/chatter\",result=\"dropped\"} 2\n"),
+            std::string::npos);
+    ASSERT_NE(text.find("ddsrouter_sink_latency_seconds{participant=\"sink\",quantile=\"0.99\"} 0.002\n"),
+            std::string::npos);
+    ASSERT_NE(text.find("ddsrouter_payload_pool_slots{state=\"used\"} 4\n"), std::string::npos);
+
+    // Sums keep every microsecond, not just 6 significant digits
+    ASSERT_NE(text.find("ddsrouter_thread_pool_task_seconds_sum{participant=\"P1\""), std::string::npos);
+    ASSERT_NE(text.find("} 123.456789\n"), std::string::npos);
+
+    // Features not configured are not serialized
+    ASSERT_EQ(text.find("ddsrouter_forwarding_threads"), std::string::npos);
+
+    // Every exposition ends with EOF
+    ASSERT_EQ(text.substr(text.size() - 6), "# EOF\n");
+
+    // Slots and rate limits with the same labels are written once, added up
+    RouterMetrics repeated = metrics();
+    repeated.slots.push_back(repeated.slots.front());
+    repeated.rate_limits.push_back(repeated.rate_limits.front());
+    const std::string merged = MetricsExporter::serialize(repeated);
+
+    const std::string messages = "ddsrouter_topic_messages_total{participant=\"P1\",topic=\"rt/\\\"chatter\\\"\"} ";
+    ASSERT_NE(merged.find(messages + "20\n"), std::string::npos);
+    ASSERT_EQ(merged.find(messages, merged.find(messages) + 1), std::string::npos);
+    ASSERT_NE(merged.find("ddsrouter_thread_pool_max_queue_depth{participant=\"P1\",topic=\"rt/\\\"chatter\\\"\"} 7\n"),
+            std::string::npos);
+    ASSERT_NE(merged.find(
+                "ddsrouter_rate_limit_messages_total{scope=\"topic\",key=\"rt/chatter\",result=\"dropped\"} 4\n"),
+            std::string::npos);
+
+    // An empty router still has a valid exposition
+    ASSERT_EQ(MetricsExporter::serialize(RouterMetrics()), "# EOF\n");
+}
+
+/**
+ * Test that the metrics are served in localhost, and that other paths and methods are rejected.
+ */
+TEST(MetricsExporterTest, http_endpoint)
+{
+    MetricsExporterConfiguration configuration;
+    configuration.enabled = true;
+    configuration.port = 0;
+
+    MetricsExporter exporter(configuration, []()
+            {
+                return metrics();
+            });
+    ASSERT_NE(exporter.port(), 0u);
+
+    const std::string response = get(exporter.port(), "/metrics");
+    ASSERT_EQ(response.find("HTTP/1.1 200 OK\r\n"), 0u);
+    ASSERT_NE(response.find(std::string("Content-Type: ") + MetricsHttpServer::CONTENT_TYPE), std::string::npos);
+    ASSERT_NE(response.find("ddsrouter_topic_bytes_total"), std::string::npos);
+    ASSERT_EQ(response.substr(response.find("\r\n\r\n") + 4), *exporter.snapshot());
+
+    ASSERT_EQ(get(exporter.port(), "/").find("HTTP/1.1 404"), 0u);
+    ASSERT_EQ(http_request(exporter.port(), "POST /metrics HTTP/1.1\r\n\r\n").find("HTTP/1.1 405"), 0u);
+    ASSERT_EQ(http_request(exporter.port(), "garbage\r\n\r\n").find("HTTP/1.1 400"), 0u);
+}
+
+/**
+ * Test that scrapes send the last snapshot, without gathering the metrics again.
+ */
+TEST(MetricsExporterTest, scrapes_use_snapshot)
+{
+    MetricsExporterConfiguration configuration;
+    configuration.enabled = true;
+    configuration.port = 0;
+    configuration.period = 1000000;
+
+    std::atomic<uint32_t> gathered{0};
+    MetricsExporter exporter(configuration, [&gathered]()
+            {
+                ++gathered;
+                return metrics();
+            });
+
+    for (int i = 0; i < 20; ++i)
+    {
+        ASSERT_EQ(get(exporter.port(), "/metrics").find("HTTP/1.1 200 OK\r\n"), 0u);
+    }
+    ASSERT_EQ(gathered.load(), 1u);
+
+    exporter.refresh();
+    ASSERT_EQ(gathered.load(), 2u);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -17,6 +17,7 @@
  *
  */
 
+#include <cpp_utils/exception/InitializationException.hpp>
 #include <cpp_utils/testing/gtest_aux.hpp>
 #include <gtest/gtest.h>
 
@@ -39,7 +40,19 @@
 
 #include <ddspipe_participants/testing/random_values.hpp>
 
+#include <ddsrouter_core/configuration/GeneratorParticipantConfiguration.hpp>
+#include <ddsrouter_core/configuration/InProcessParticipantConfiguration.hpp>
+#include <ddsrouter_core/configuration/IpcParticipantConfiguration.hpp>
+#include <ddsrouter_core/configuration/RecorderParticipantConfiguration.hpp>
+#include <ddsrouter_core/configuration/ReplayerParticipantConfiguration.hpp>
+#include <ddsrouter_core/configuration/SinkParticipantConfiguration.hpp>
 #include <ddsrouter_core/core/ParticipantFactory.hpp>
+#include <ddsrouter_core/participants/generator/GeneratorParticipant.hpp>
+#include <ddsrouter_core/participants/inprocess/InProcessParticipant.hpp>
+#include <ddsrouter_core/participants/ipc/IpcParticipant.hpp>
+#include <ddsrouter_core/participants/recorder/RecorderParticipant.hpp>
+#include <ddsrouter_core/participants/replayer/ReplayerParticipant.hpp>
+#include <ddsrouter_core/participants/sink/SinkParticipant.hpp>
 
 using namespace eprosima;
 using namespace eprosima::ddsrouter::core;
@@ -104,6 +117,79 @@ public:
     using ddspipe::participants::dds::XmlParticipant::configuration_;  // Make protected member accessible
 };
 
+/**
+ * This class is a subclass of ddsrouter::core::IpcParticipant.
+ * It provides public access to the protected members 'configuration_' and 'channel_' from its base class
+ * ddsrouter::core::IpcParticipant.
+ */
+class IpcTestClass : public ddsrouter::core::IpcParticipant
+{
+public:
+
+    using ddsrouter::core::IpcParticipant::configuration_;  // Make protected member accessible
+    using ddsrouter::core::IpcParticipant::channel_;  // Make protected member accessible
+};
+
+/**
+ * This class is a subclass of ddsrouter::core::InProcessParticipant.
+ * It provides public access to the protected member 'configuration_' from its base class
+ * ddsrouter::core::InProcessParticipant.
+ */
+class InProcessTestClass : public ddsrouter::core::InProcessParticipant
+{
+public:
+
+    using ddsrouter::core::InProcessParticipant::configuration_;  // Make protected member accessible
+};
+
+/**
+ * This class is a subclass of ddsrouter::core::RecorderParticipant.
+ * It provides public access to the protected member 'configuration_' from its base class
+ * ddsrouter::core::RecorderParticipant.
+ */
+class RecorderTestClass : public ddsrouter::core::RecorderParticipant
+{
+public:
+
+    using ddsrouter::core::RecorderParticipant::configuration_;  // Make protected member accessible
+};
+
+/**
+ * This class is a subclass of ddsrouter::core::ReplayerParticipant.
+ * It provides public access to the protected member 'configuration_' from its base class
+ * ddsrouter::core::ReplayerParticipant.
+ */
+class ReplayerTestClass : public ddsrouter::core::ReplayerParticipant
+{
+public:
+
+    using ddsrouter::core::ReplayerParticipant::configuration_;  // Make protected member accessible
+};
+
+/**
+ * This class is a subclass of ddsrouter::core::GeneratorParticipant.
+ * It provides public access to the protected member 'configuration_' from its base class
+ * ddsrouter::core::GeneratorParticipant.
+ */
+class GeneratorTestClass : public ddsrouter::core::GeneratorParticipant
+{
+public:
+
+    using ddsrouter::core::GeneratorParticipant::configuration_;  // Make protected member accessible
+};
+
+/**
+ * This class is a subclass of ddsrouter::core::SinkParticipant.
+ * It provides public access to the protected member 'configuration_' from its base class
+ * ddsrouter::core::SinkParticipant.
+ */
+class SinkTestClass : public ddsrouter::core::SinkParticipant
+{
+public:
+
+    using ddsrouter::core::SinkParticipant::configuration_;  // Make protected member accessible
+};
+
 /**
  * This test case is for the ParticipantFactory class, specifically testing the creation
  * of an EchoParticipant. The test checks whether the created EchoParticipant has the
@@ -243,6 +329,248 @@ TEST(ParticipantFactoryTest, create_xml_participant)
     }
 }
 
+/**
+ * This test case is for the ParticipantFactory class, specifically testing the creation
+ * of an IpcParticipant. The test checks whether the created IpcParticipant has the
+ * expected configuration values and has opened its channel, or that it is rejected where IPC is not supported.
+ */
+TEST(ParticipantFactoryTest, create_ipc_participant)
+{
+    {
+        ParticipantFactory participant_factory;
+
+        auto configuration = std::make_shared<IpcParticipantConfiguration>();
+        configuration->channel = "participant_factory_test";
+        std::shared_ptr<ddspipe::core::PayloadPool> payload_pool(new ddspipe::core::FastPayloadPool());
+        std::shared_ptr<ddspipe::core::DiscoveryDatabase> discovery_database(new ddspipe::core::DiscoveryDatabase());
+
+#if defined(__linux__)
+        std::shared_ptr<eprosima::ddspipe::core::IParticipant> i_participant = participant_factory.create_participant(
+            types::ParticipantKind::ipc, configuration, payload_pool, discovery_database);
+
+        std::shared_ptr<IpcTestClass> ipc_participant =
+                std::static_pointer_cast<IpcTestClass>(i_participant);
+
+        ASSERT_TRUE(ipc_participant) << "Failed to create IPC Participant";
+
+        ASSERT_EQ(ipc_participant->configuration_->app_id, "DDS_ROUTER");
+        ASSERT_EQ(ipc_participant->configuration_->app_metadata, "");
+        ASSERT_TRUE(ipc_participant->channel_);
+        ASSERT_FALSE(ipc_participant->channel_->peer_attached());
+#else
+        // IPC channels are only supported in Linux
+        ASSERT_THROW(
+            participant_factory.create_participant(
+                types::ParticipantKind::ipc, configuration, payload_pool, discovery_database),
+            utils::InitializationException);
+#endif // defined(__linux__)
+    }
+}
+
+/**
+ * This test case is for the ParticipantFactory class, specifically testing the creation
+ * of an InProcessParticipant. The test checks whether the created InProcessParticipant has the
+ * expected configuration values and has attached to its channel.
+ */
+TEST(ParticipantFactoryTest, create_inprocess_participant)
+{
+    {
+        ParticipantFactory participant_factory;
+
+        auto configuration = std::make_shared<InProcessParticipantConfiguration>();
+        configuration->channel = "participant_factory_test";
+        std::shared_ptr<ddspipe::core::PayloadPool> payload_pool(new ddspipe::core::FastPayloadPool());
+        std::shared_ptr<ddspipe::core::DiscoveryDatabase> discovery_database(new ddspipe::core::DiscoveryDatabase());
+
+        auto channel = InProcessChannel::get("participant_factory_test");
+        ASSERT_FALSE(channel->attached());
+
+        std::shared_ptr<eprosima::ddspipe::core::IParticipant> i_participant = participant_factory.create_participant(
+            types::ParticipantKind::inprocess, configuration, payload_pool, discovery_database);
+
+        std::shared_ptr<InProcessTestClass> inprocess_participant =
+                std::static_pointer_cast<InProcessTestClass>(i_participant);
+
+        ASSERT_TRUE(inprocess_participant) << "Failed to create In Process Participant";
+
+        ASSERT_EQ(inprocess_participant->configuration_->app_id, "DDS_ROUTER");
+        ASSERT_EQ(inprocess_participant->configuration_->app_metadata, "");
+        ASSERT_TRUE(channel->attached());
+
+        // A second participant in the same channel is rejected
+        ASSERT_THROW(
+            participant_factory.create_participant(
+                types::ParticipantKind::inprocess, configuration, payload_pool, discovery_database),
+            utils::InitializationException);
+
+        i_participant.reset();
+        inprocess_participant.reset();
+        ASSERT_FALSE(channel->attached());
+    }
+}
+
+/**
+ * This test case is for the ParticipantFactory class, specifically testing the creation
+ * of a RecorderParticipant. The test checks whether the created RecorderParticipant has the
+ * expected configuration values and that it starts its first segment, or that it is rejected where recording is not
+ * supported.
+ */
+TEST(ParticipantFactoryTest, create_recorder_participant)
+{
+    {
+        ParticipantFactory participant_factory;
+
+        auto configuration = std::make_shared<RecorderParticipantConfiguration>();
+        configuration->output_directory = "participant_factory_test_records";
+        std::shared_ptr<ddspipe::core::PayloadPool> payload_pool(new ddspipe::core::FastPayloadPool());
+        std::shared_ptr<ddspipe::core::DiscoveryDatabase> discovery_database(new ddspipe::core::DiscoveryDatabase());
+
+#if defined(__linux__)
+        std::shared_ptr<eprosima::ddspipe::core::IParticipant> i_participant = participant_factory.create_participant(
+            types::ParticipantKind::recorder, configuration, payload_pool, discovery_database);
+
+        std::shared_ptr<RecorderTestClass> recorder_participant =
+                std::static_pointer_cast<RecorderTestClass>(i_participant);
+
+        ASSERT_TRUE(recorder_participant) << "Failed to create Recorder Participant";
+
+        ASSERT_EQ(recorder_participant->configuration_->app_id, "DDS_ROUTER");
+        ASSERT_EQ(recorder_participant->configuration_->app_metadata, "");
+        ASSERT_EQ(recorder_participant->configuration_->output_directory, "participant_factory_test_records");
+        ASSERT_FALSE(recorder_participant->is_repeater());
+        ASSERT_FALSE(recorder_participant->is_rtps_kind());
+#else
+        // Recording is only supported in Linux
+        ASSERT_THROW(
+            participant_factory.create_participant(
+                types::ParticipantKind::recorder, configuration, payload_pool, discovery_database),
+            utils::InitializationException);
+#endif // defined(__linux__)
+    }
+}
+
+/**
+ * This test case is for the ParticipantFactory class, specifically testing the creation
+ * of a ReplayerParticipant. The test checks whether the created ReplayerParticipant has the
+ * expected configuration values, and that a non existing input directory is rejected, or that it is rejected where
+ * replaying is not supported.
+ */
+TEST(ParticipantFactoryTest, create_replayer_participant)
+{
+    {
+        ParticipantFactory participant_factory;
+
+        auto configuration = std::make_shared<ReplayerParticipantConfiguration>();
+        configuration->input_directory = ".";
+        configuration->speed = 0;
+        std::shared_ptr<ddspipe::core::PayloadPool> payload_pool(new ddspipe::core::FastPayloadPool());
+        std::shared_ptr<ddspipe::core::DiscoveryDatabase> discovery_database(new ddspipe::core::DiscoveryDatabase());
+
+#if defined(__linux__)
+        std::shared_ptr<eprosima::ddspipe::core::IParticipant> i_participant = participant_factory.create_participant(
+            types::ParticipantKind::replayer, configuration, payload_pool, discovery_database);
+
+        std::shared_ptr<ReplayerTestClass> replayer_participant =
+                std::static_pointer_cast<ReplayerTestClass>(i_participant);
+
+        ASSERT_TRUE(replayer_participant) << "Failed to create Replayer Participant";
+
+        ASSERT_EQ(replayer_participant->configuration_->app_id, "DDS_ROUTER");
+        ASSERT_EQ(replayer_participant->configuration_->app_metadata, "");
+        ASSERT_EQ(replayer_participant->configuration_->speed, 0);
+        ASSERT_FALSE(replayer_participant->is_repeater());
+        ASSERT_FALSE(replayer_participant->is_rtps_kind());
+
+        // The working directory has no segments, so there is nothing to replay
+        ASSERT_TRUE(replayer_participant->finished());
+        ASSERT_EQ(replayer_participant->replayed(), 0u);
+#else
+        // Replaying is only supported in Linux
+        ASSERT_THROW(
+            participant_factory.create_participant(
+                types::ParticipantKind::replayer, configuration, payload_pool, discovery_database),
+            utils::InitializationException);
+#endif // defined(__linux__)
+
+        // A directory that does not exist is rejected
+        configuration->input_directory = "participant_factory_test_non_existing_records";
+        ASSERT_THROW(
+            participant_factory.create_participant(
+                types::ParticipantKind::replayer, configuration, payload_pool, discovery_database),
+            utils::InitializationException);
+    }
+}
+
+/**
+ * This test case is for the ParticipantFactory class, specifically testing the creation
+ * of a GeneratorParticipant. The test checks whether the created GeneratorParticipant has the
+ * expected configuration values.
+ */
+TEST(ParticipantFactoryTest, create_generator_participant)
+{
+    {
+        ParticipantFactory participant_factory;
+
+        GeneratedTopicConfiguration topic;
+        topic.topic_name = "participant_factory_test_topic";
+        topic.rate = 10;
+        topic.keys = 4;
+
+        auto configuration = std::make_shared<GeneratorParticipantConfiguration>();
+        configuration->topics.push_back(topic);
+        std::shared_ptr<ddspipe::core::PayloadPool> payload_pool(new ddspipe::core::FastPayloadPool());
+        std::shared_ptr<ddspipe::core::DiscoveryDatabase> discovery_database(new ddspipe::core::DiscoveryDatabase());
+
+        std::shared_ptr<eprosima::ddspipe::core::IParticipant> i_participant = participant_factory.create_participant(
+            types::ParticipantKind::generator, configuration, payload_pool, discovery_database);
+
+        std::shared_ptr<GeneratorTestClass> generator_participant =
+                std::static_pointer_cast<GeneratorTestClass>(i_participant);
+
+        ASSERT_TRUE(generator_participant) << "Failed to create Generator Participant";
+
+        ASSERT_EQ(generator_participant->configuration_->app_id, "DDS_ROUTER");
+        ASSERT_EQ(generator_participant->configuration_->app_metadata, "");
+        ASSERT_EQ(generator_participant->configuration_->topics.size(), 1u);
+        ASSERT_EQ(generator_participant->configuration_->topics[0].topic_name, "participant_factory_test_topic");
+        ASSERT_FALSE(generator_participant->is_repeater());
+        ASSERT_FALSE(generator_participant->is_rtps_kind());
+        ASSERT_FALSE(generator_participant->finished());
+    }
+}
+
+/**
+ * This test case is for the ParticipantFactory class, specifically testing the creation
+ * of a SinkParticipant. The test checks whether the created SinkParticipant has the
+ * expected configuration values and starts with no measures.
+ */
+TEST(ParticipantFactoryTest, create_sink_participant)
+{
+    {
+        ParticipantFactory participant_factory;
+
+        auto configuration = std::make_shared<SinkParticipantConfiguration>();
+        configuration->report_period = 0;
+        std::shared_ptr<ddspipe::core::PayloadPool> payload_pool(new ddspipe::core::FastPayloadPool());
+        std::shared_ptr<ddspipe::core::DiscoveryDatabase> discovery_database(new ddspipe::core::DiscoveryDatabase());
+
+        std::shared_ptr<eprosima::ddspipe::core::IParticipant> i_participant = participant_factory.create_participant(
+            types::ParticipantKind::sink, configuration, payload_pool, discovery_database);
+
+        std::shared_ptr<SinkTestClass> sink_participant =
+                std::static_pointer_cast<SinkTestClass>(i_participant);
+
+        ASSERT_TRUE(sink_participant) << "Failed to create Sink Participant";
+
+        ASSERT_EQ(sink_participant->configuration_->app_id, "DDS_ROUTER");
+        ASSERT_EQ(sink_participant->configuration_->app_metadata, "");
+        ASSERT_EQ(sink_participant->configuration_->report_period, 0u);
+        ASSERT_FALSE(sink_participant->is_repeater());
+        ASSERT_FALSE(sink_participant->is_rtps_kind());
+        ASSERT_EQ(sink_participant->report().messages, 0u);
+    }
+}
+
 int main(
         int argc,
         char** argv)
@@ -0,0 +1,458 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file PayloadPoolTest.cpp
+ *
+ */
+
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <new>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <ddspipe_core/interface/IParticipant.hpp>
+#include <ddspipe_core/interface/IReader.hpp>
+#include <ddspipe_core/interface/IWriter.hpp>
+#include <ddspipe_core/interface/IRoutingData.hpp>
+#include <ddspipe_core/types/data/RtpsPayloadData.hpp>
+#include <ddspipe_core/types/topic/dds/DdsTopic.hpp>
+
+#include <ddsrouter_core/efficiency/payload/PooledRtpsPayloadData.hpp>
+#include <ddsrouter_core/efficiency/payload/PreallocatedPayloadPool.hpp>
+#include <ddsrouter_core/participants/preallocation/PreallocatingParticipant.hpp>
+
+using namespace eprosima;
+using namespace eprosima::ddsrouter::core;
+
+namespace test {
+
+//! Whether to count the allocations of this process.
+std::atomic<bool> counting_allocations{false};
+
+//! Allocations made while counting.
+std::atomic<uint64_t> allocations{0};
+
+//! Size of the slots of the pools tested.
+constexpr uint32_t SLOT_SIZE = 256;
+
+class MockWriter : public ddspipe::core::IWriter
+{
+public:
+
+    void enable() noexcept override
+    {
+    }
+
+    void disable() noexcept override
+    {
+    }
+
+    utils::ReturnCode write(
+            ddspipe::core::IRoutingData& /* data */) noexcept override
+    {
+        return utils::ReturnCode::RETCODE_OK;
+    }
+};
+
+class MockReader : public ddspipe::core::IReader
+{
+public:
+
+    void enable() noexcept override
+    {
+    }
+
+    void disable() noexcept override
+    {
+    }
+
+    void set_on_data_available_callback(
+            std::function<void()> /* on_data_available_lambda */) noexcept override
+    {
+    }
+
+    void unset_on_data_available_callback() noexcept override
+    {
+    }
+
+    utils::ReturnCode take(
+            std::unique_ptr<ddspipe::core::IRoutingData>& /* data */) noexcept override
+    {
+        return utils::ReturnCode::RETCODE_NO_DATA;
+    }
+
+    ddspipe::core::types::Guid guid() const override
+    {
+        return ddspipe::core::types::Guid();
+    }
+
+    fastrtps::RecursiveTimedMutex& get_rtps_mutex() const override
+    {
+        return mutex_;
+    }
+
+    uint64_t get_unread_count() const override
+    {
+        return 0;
+    }
+
+    ddspipe::core::types::DdsTopic topic() const override
+    {
+        return ddspipe::core::types::DdsTopic();
+    }
+
+    ddspipe::core::types::ParticipantId participant_id() const override
+    {
+        return "mock";
+    }
+
+protected:
+
+    mutable fastrtps::RecursiveTimedMutex mutex_;
+};
+
+class MockParticipant : public ddspipe::core::IParticipant
+{
+public:
+
+    ddspipe::core::types::ParticipantId id() const noexcept override
+    {
+        return "mock";
+    }
+
+    bool is_repeater() const noexcept override
+    {
+        return false;
+    }
+
+    bool is_rtps_kind() const noexcept override
+    {
+        return false;
+    }
+
+    ddspipe::core::types::TopicQoS topic_qos() const noexcept override
+    {
+        return ddspipe::core::types::TopicQoS();
+    }
+
+    std::shared_ptr<ddspipe::core::IWriter> create_writer(
+            const ddspipe::core::ITopic& /* topic */) override
+    {
+        return std::make_shared<MockWriter>();
+    }
+
+    std::shared_ptr<ddspipe::core::IReader> create_reader(
+            const ddspipe::core::ITopic& /* topic */) override
+    {
+        return std::make_shared<MockReader>();
+    }
+};
+
+ddspipe::core::types::DdsTopic topic(
+        ddspipe::core::types::ReliabilityKind reliability,
+        ddspipe::core::types::DurabilityKind durability,
+        unsigned int history_depth,
+        const std::string& topic_name = "topic")
+{
+    ddspipe::core::types::DdsTopic topic;
+    topic.m_topic_name = topic_name;
+    topic.type_name = "type";
+    topic.topic_qos.reliability_qos = reliability;
+    topic.topic_qos.durability_qos = durability;
+    topic.topic_qos.history_depth = history_depth;
+    return topic;
+}
+
+} /* namespace test */
+
+void* operator new(
+        std::size_t size)
+{
+    if (test::counting_allocations.load(std::memory_order_relaxed))
+    {
+        ++test::allocations;
+    }
+
+    void* memory = std::malloc(size == 0 ? 1 : size);
+    if (!memory)
+    {
+        throw std::bad_alloc();
+    }
+    return memory;
+}
+
+void operator delete(
+        void* memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete(
+        void* memory,
+        std::size_t /* size */) noexcept
+{
+    std::free(memory);
+}
+
+using namespace test;
+
+/**
+ * Check that payloads that fit in a free slot are taken from it, and the rest are allocated in the heap.
+ */
+TEST(PayloadPoolTest, pooled_and_heap_payloads)
+{
+    PreallocatedPayloadPool pool(SLOT_SIZE);
+    pool.reserve(2);
+
+    ddspipe::core::types::Payload first;
+    ddspipe::core::types::Payload second;
+    ddspipe::core::types::Payload third;
+    ddspipe::core::types::Payload big;
+
+    ASSERT_TRUE(pool.get_payload(SLOT_SIZE, first));
+    ASSERT_TRUE(pool.get_payload(10, second));
+    ASSERT_TRUE(pool.get_payload(10, third));
+    ASSERT_TRUE(pool.get_payload(SLOT_SIZE + 1, big));
+
+    PayloadPoolStatistics statistics = pool.statistics();
+    ASSERT_EQ(statistics.slots, 2u);
+    ASSERT_EQ(statistics.free_slots, 0u);
+    ASSERT_EQ(statistics.pooled, 2u);
+    ASSERT_EQ(statistics.heap, 2u);
+
+    ASSERT_TRUE(pool.release_payload(first));
+    ASSERT_TRUE(pool.release_payload(second));
+    ASSERT_TRUE(pool.release_payload(third));
+    ASSERT_TRUE(pool.release_payload(big));
+    ASSERT_EQ(first.data, nullptr);
+
+    ASSERT_EQ(pool.statistics().free_slots, 2u);
+}
+
+/**
+ * Check that a payload of the pool is shared until every holder releases it, and one of another pool is copied.
+ */
+TEST(PayloadPoolTest, shared_references)
+{
+    PreallocatedPayloadPool pool(SLOT_SIZE);
+    PreallocatedPayloadPool other_pool(SLOT_SIZE);
+    pool.reserve(1);
+    other_pool.reserve(1);
+
+    ddspipe::core::types::Payload source;
+    ASSERT_TRUE(pool.get_payload(4, source));
+    source.length = 4;
+    std::memcpy(source.data, "data", 4);
+
+    fastrtps::rtps::IPayloadPool* owner = &pool;
+    ddspipe::core::types::Payload shared;
+    ASSERT_TRUE(pool.get_payload(source, owner, shared));
+    ASSERT_EQ(shared.data, source.data);
+
+    ddspipe::core::types::Payload copied;
+    ASSERT_TRUE(other_pool.get_payload(source, owner, copied));
+    ASSERT_NE(copied.data, source.data);
+    ASSERT_EQ(std::string(reinterpret_cast<char*>(copied.data), copied.length), "data");
+
+    // The slot is free once both holders release it
+    pool.release_payload(source);
+    ASSERT_EQ(pool.statistics().free_slots, 0u);
+    pool.release_payload(shared);
+    ASSERT_EQ(pool.statistics().free_slots, 1u);
+
+    other_pool.release_payload(copied);
+    ASSERT_EQ(other_pool.statistics().free_slots, 1u);
+}
+
+/**
+ * Check that only the readers and writers of topics that keep a bounded history reserve slots.
+ */
+TEST(PayloadPoolTest, preallocating_participant)
+{
+    using ddspipe::core::types::DurabilityKind;
+    using ddspipe::core::types::ReliabilityKind;
+
+    auto pool = std::make_shared<PreallocatedPayloadPool>(SLOT_SIZE);
+    PreallocatingParticipant participant(std::make_shared<MockParticipant>(), pool);
+
+    participant.create_writer(topic(ReliabilityKind::RELIABLE, DurabilityKind::VOLATILE, 10));
+    participant.create_reader(topic(ReliabilityKind::BEST_EFFORT, DurabilityKind::TRANSIENT_LOCAL, 5));
+    ASSERT_EQ(pool->statistics().slots, 15u);
+
+    // Best effort volatile topics and unlimited histories reserve nothing
+    participant.create_writer(topic(ReliabilityKind::BEST_EFFORT, DurabilityKind::VOLATILE, 10));
+    participant.create_writer(topic(ReliabilityKind::RELIABLE, DurabilityKind::TRANSIENT_LOCAL, 0));
+    ASSERT_EQ(pool->statistics().slots, 15u);
+
+    // Endpoints created again in the same topics reserve nothing, so the pool does not grow
+    for (int i = 0; i < 10; ++i)
+    {
+        participant.create_writer(topic(ReliabilityKind::RELIABLE, DurabilityKind::VOLATILE, 10));
+        participant.create_reader(topic(ReliabilityKind::BEST_EFFORT, DurabilityKind::TRANSIENT_LOCAL, 5));
+    }
+    ASSERT_EQ(pool->statistics().slots, 15u);
+
+    // Other topics do
+    participant.create_writer(topic(ReliabilityKind::RELIABLE, DurabilityKind::VOLATILE, 10, "other_topic"));
+    ASSERT_EQ(pool->statistics().slots, 25u);
+}
+
+/**
+ * Check that once the histories are reserved, filling and emptying them does not allocate any memory.
+ */
+TEST(PayloadPoolTest, no_allocations_in_steady_state)
+{
+    constexpr unsigned int HISTORY_DEPTH = 100;
+    constexpr int ROUNDS = 1000;
+
+    auto pool = std::make_shared<PreallocatedPayloadPool>(SLOT_SIZE);
+    PreallocatingParticipant participant(std::make_shared<MockParticipant>(), pool);
+    participant.create_writer(
+        topic(ddspipe::core::types::ReliabilityKind::RELIABLE, ddspipe::core::types::DurabilityKind::VOLATILE,
+        HISTORY_DEPTH));
+
+    std::vector<ddspipe::core::types::Payload> history(HISTORY_DEPTH);
+    std::vector<ddspipe::core::types::Payload> shared(HISTORY_DEPTH);
+    fastrtps::rtps::IPayloadPool* owner = pool.get();
+
+    counting_allocations = true;
+
+    for (int round = 0; round < ROUNDS; ++round)
+    {
+        for (unsigned int i = 0; i < HISTORY_DEPTH; ++i)
+        {
+            pool->get_payload(SLOT_SIZE, history[i]);
+            pool->get_payload(history[i], owner, shared[i]);
+        }
+
+        for (unsigned int i = 0; i < HISTORY_DEPTH; ++i)
+        {
+            pool->release_payload(history[i]);
+            pool->release_payload(shared[i]);
+        }
+    }
+
+    counting_allocations = false;
+
+    ASSERT_EQ(allocations, 0u);
+
+    const PayloadPoolStatistics statistics = pool->statistics();
+    ASSERT_EQ(statistics.pooled, static_cast<uint64_t>(HISTORY_DEPTH) * ROUNDS);
+    ASSERT_EQ(statistics.heap, 0u);
+    ASSERT_EQ(statistics.free_slots, HISTORY_DEPTH);
+}
+
+/**
+ * Check that threads taking and returning slots at the same time never share a slot nor lose one.
+ */
+TEST(PayloadPoolTest, concurrent_slots)
+{
+    constexpr unsigned int THREADS = 8;
+    constexpr unsigned int SLOTS = 4;
+    constexpr int ROUNDS = 10000;
+
+    auto pool = std::make_shared<PreallocatedPayloadPool>(SLOT_SIZE);
+    pool->reserve(SLOTS);
+
+    std::atomic<bool> shared_slot(false);
+    std::vector<std::thread> threads;
+
+    for (unsigned int t = 0; t < THREADS; ++t)
+    {
+        threads.emplace_back([&pool, &shared_slot, t]()
+                {
+                    for (int round = 0; round < ROUNDS; ++round)
+                    {
+                        ddspipe::core::types::Payload payload;
+                        pool->get_payload(SLOT_SIZE, payload);
+
+                        // Every thread writes its own mark, so a slot held by two threads is noticed
+                        std::memset(payload.data, static_cast<int>(t), SLOT_SIZE);
+                        for (unsigned int i = 0; i < SLOT_SIZE; ++i)
+                        {
+                            if (payload.data[i] != static_cast<uint8_t>(t))
+                            {
+                                shared_slot = true;
+                            }
+                        }
+
+                        pool->release_payload(payload);
+                    }
+                });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    ASSERT_FALSE(shared_slot);
+
+    const PayloadPoolStatistics statistics = pool->statistics();
+    ASSERT_EQ(statistics.pooled + statistics.heap, static_cast<uint64_t>(THREADS) * ROUNDS);
+    ASSERT_GT(statistics.pooled, 0u);
+    ASSERT_EQ(statistics.free_slots, SLOTS);
+}
+
+/**
+ * Check that the data of the messages is recycled when destroyed through the interface of the DDS Pipe, and that
+ * creating it again does not allocate.
+ */
+TEST(PayloadPoolTest, pooled_routing_data)
+{
+    constexpr int MESSAGES = 1000;
+
+    auto pool = std::make_shared<PreallocatedPayloadPool>(SLOT_SIZE);
+    pool->reserve(1);
+
+    // Fill the free list with one object
+    std::unique_ptr<ddspipe::core::IRoutingData>(new PooledRtpsPayloadData());
+    const uint64_t cached = PooledRtpsPayloadData::cached();
+    ASSERT_GE(cached, 1u);
+
+    counting_allocations = true;
+
+    for (int i = 0; i < MESSAGES; ++i)
+    {
+        std::unique_ptr<ddspipe::core::types::RtpsPayloadData> data = std::make_unique<PooledRtpsPayloadData>();
+        ASSERT_TRUE(pool->get_payload(SLOT_SIZE, data->payload));
+        data->payload_owner = pool.get();
+
+        // Destroyed as the DDS Pipe does, which returns its payload to the pool too
+        std::unique_ptr<ddspipe::core::IRoutingData> routing_data(std::move(data));
+    }
+
+    counting_allocations = false;
+
+    ASSERT_EQ(allocations, 0u);
+    ASSERT_EQ(PooledRtpsPayloadData::cached(), cached);
+    ASSERT_EQ(pool->statistics().free_slots, 1u);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
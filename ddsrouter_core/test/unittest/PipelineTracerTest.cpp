@@ -0,0 +1,267 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file PipelineTracerTest.cpp
+ *
+ */
+
+#include <atomic>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <ddsrouter_core/monitoring/PipelineTracer.hpp>
+
+using namespace eprosima;
+using namespace eprosima::ddsrouter::core;
+
+namespace test {
+
+ddspipe::core::types::DdsTopic topic(
+        const std::string& name)
+{
+    ddspipe::core::types::DdsTopic topic;
+    topic.m_topic_name = name;
+    topic.type_name = "type";
+    return topic;
+}
+
+ddspipe::core::types::WildcardDdsFilterTopic filter(
+        const std::string& name)
+{
+    ddspipe::core::types::WildcardDdsFilterTopic filter;
+    filter.topic_name = name;
+    return filter;
+}
+
+//! Configuration that traces the topics matching \c topic_filter .
+TracingConfiguration configuration(
+        const std::string& topic_filter,
+        unsigned int buffer_size = 1024)
+{
+    TracingConfiguration configuration;
+    configuration.enabled = true;
+    configuration.topics.push_back(filter(topic_filter));
+    configuration.buffer_size = buffer_size;
+    return configuration;
+}
+
+std::string dump(
+        const PipelineTracer& tracer)
+{
+    std::ostringstream output;
+    tracer.dump(output);
+    return output.str();
+}
+
+std::size_t count(
+        const std::string& text,
+        const std::string& pattern)
+{
+    std::size_t occurrences = 0;
+    for (std::size_t position = text.find(pattern); position != std::string::npos;
+            position = text.find(pattern, position + pattern.size()))
+    {
+        ++occurrences;
+    }
+    return occurrences;
+}
+
+} /* namespace test */
+
+/**
+ * Record every stage of a sample forwarded by a thread and dump them.
+ *
+ * CASES:
+ * - stages with a duration are complete events, and the rest are instant events
+ * - writes refer to the reader and number of their sample
+ * - each thread has a track of its own
+ */
+TEST(PipelineTracerTest, chrome_trace)
+{
+    PipelineTracer tracer(test::configuration("rt/chatter"));
+
+    auto reader = tracer.register_endpoint("Sub \"1\"", test::topic("rt/chatter"));
+    auto writer = tracer.register_endpoint("Pub", test::topic("rt/chatter"));
+    ASSERT_TRUE(reader->enabled);
+    ASSERT_TRUE(writer->enabled);
+
+    // Reception thread
+    std::thread reception([&]()
+            {
+                tracer.record(*reader, TraceStage::notification, 1000, 1000);
+                tracer.record(*reader, TraceStage::enqueue, 1000, 3500);
+            });
+    reception.join();
+
+    // Thread of the pool
+    tracer.record(*reader, TraceStage::dequeue, 10000, 10000);
+    tracer.record(*reader, TraceStage::payload_copy, 10000, 12250, reader.get(), 1);
+    tracer.record(*writer, TraceStage::write, 12500, 20000, reader.get(), 1);
+
+    const TraceStatistics statistics = tracer.statistics();
+    ASSERT_EQ(statistics.threads, 2u);
+    ASSERT_EQ(statistics.recorded, 5u);
+    ASSERT_EQ(statistics.overwritten, 0u);
+
+    const std::string trace = test::dump(tracer);
+
+    ASSERT_EQ(trace.find("{\"displayTimeUnit\":\"ns\",\"traceEvents\":["), 0u);
+    ASSERT_EQ(test::count(trace, "\"name\":\"thread_name\""), 2u);
+    ASSERT_EQ(test::count(trace, "\"ph\":\"X\""), 3u);
+    ASSERT_EQ(test::count(trace, "\"ph\":\"i\""), 2u);
+
+    ASSERT_NE(trace.find("{\"name\":\"notification\",\"cat\":\"ddsrouter\",\"ph\":\"i\",\"s\":\"t\",\"ts\":1.000"),
+            std::string::npos);
+    ASSERT_NE(trace.find("{\"name\":\"enqueue\",\"cat\":\"ddsrouter\",\"ph\":\"X\",\"ts\":1.000,\"dur\":2.500"),
+            std::string::npos);
+    ASSERT_NE(trace.find("\"name\":\"payload copy\""), std::string::npos);
+
+    // Participant names are escaped
+    ASSERT_NE(trace.find(
+                "{\"name\":\"write\",\"cat\":\"ddsrouter\",\"ph\":\"X\",\"ts\":12.500,\"dur\":7.500,"
+                "\"pid\":1,\"tid\":2,"
+                "\"args\":{\"participant\":\"Pub\",\"topic\":\"rt/chatter\",\"source\":\"Sub \\\"1\\\"\","
+                "\"sample\":1}}"),
+            std::string::npos);
+
+    ASSERT_EQ(trace.substr(trace.size() - 4), "\n]}\n");
+}
+
+/**
+ * Change the topics traced.
+ *
+ * CASES:
+ * - only the endpoints of the topics matching are traced
+ * - endpoints registered after a reload follow the topics reloaded
+ */
+TEST(PipelineTracerTest, reload)
+{
+    PipelineTracer tracer(test::configuration("rt/camera/*"));
+
+    auto camera = tracer.register_endpoint("P1", test::topic("rt/camera/front"));
+    auto chatter = tracer.register_endpoint("P1", test::topic("rt/chatter"));
+    ASSERT_TRUE(camera->enabled);
+    ASSERT_FALSE(chatter->enabled);
+
+    tracer.reload({test::filter("rt/chatter")});
+    ASSERT_FALSE(camera->enabled);
+    ASSERT_TRUE(chatter->enabled);
+
+    auto camera_writer = tracer.register_endpoint("P2", test::topic("rt/camera/rear"));
+    ASSERT_FALSE(camera_writer->enabled);
+
+    tracer.reload({});
+    ASSERT_FALSE(camera->enabled);
+    ASSERT_FALSE(chatter->enabled);
+}
+
+/**
+ * Record more events than fit in the buffer of the thread.
+ *
+ * CASES:
+ * - only the newest events are dumped
+ */
+TEST(PipelineTracerTest, ring_buffer)
+{
+    constexpr unsigned int BUFFER_SIZE = 8;
+    constexpr uint32_t SAMPLES = 20;
+
+    PipelineTracer tracer(test::configuration("*", BUFFER_SIZE));
+    auto reader = tracer.register_endpoint("P1", test::topic("rt/chatter"));
+
+    for (uint32_t sample = 1; sample <= SAMPLES; ++sample)
+    {
+        tracer.record(*reader, TraceStage::payload_copy, sample * 1000, sample * 1000 + 500, reader.get(), sample);
+    }
+
+    const TraceStatistics statistics = tracer.statistics();
+    ASSERT_EQ(statistics.recorded, SAMPLES);
+    ASSERT_EQ(statistics.overwritten, SAMPLES - BUFFER_SIZE);
+
+    const std::string trace = test::dump(tracer);
+    ASSERT_EQ(test::count(trace, "\"name\":\"payload copy\""), BUFFER_SIZE);
+
+    for (uint32_t sample = 1; sample <= SAMPLES; ++sample)
+    {
+        const bool dumped = trace.find("\"sample\":" + std::to_string(sample) + "}") != std::string::npos;
+        ASSERT_EQ(dumped, sample > SAMPLES - BUFFER_SIZE);
+    }
+}
+
+/**
+ * Dump while a thread keeps recording.
+ *
+ * CASES:
+ * - events being overwritten while they are copied are discarded, so every event dumped is whole
+ */
+TEST(PipelineTracerTest, concurrent_dump)
+{
+    PipelineTracer tracer(test::configuration("*", 16));
+    auto reader = tracer.register_endpoint("P1", test::topic("rt/chatter"));
+
+    // Each event starts at the microsecond of its sample and lasts as many nanoseconds as its sample modulo 999, plus 1
+    std::atomic<bool> stop(false);
+    std::thread recorder([&]()
+            {
+                uint32_t sample = 0;
+                while (!stop)
+                {
+                    ++sample;
+                    tracer.record(*reader, TraceStage::payload_copy, int64_t(sample) * 1000,
+                    int64_t(sample) * 1000 + sample % 999 + 1, reader.get(), sample);
+                }
+            });
+
+    while (tracer.statistics().recorded < 1000)
+    {
+        std::this_thread::yield();
+    }
+
+    for (int i = 0; i < 200; ++i)
+    {
+        const std::string trace = test::dump(tracer);
+
+        for (std::size_t position = trace.find("\"ts\":"); position != std::string::npos;
+                position = trace.find("\"ts\":", position + 1))
+        {
+            const uint64_t ts = std::stoull(trace.substr(position + 5));
+            const std::size_t dur_position = trace.find("\"dur\":0.", position);
+            const std::size_t sample_position = trace.find("\"sample\":", position);
+            ASSERT_NE(dur_position, std::string::npos);
+            ASSERT_NE(sample_position, std::string::npos);
+
+            const uint64_t dur = std::stoull(trace.substr(dur_position + 8));
+            const uint64_t sample = std::stoull(trace.substr(sample_position + 9));
+            ASSERT_EQ(ts, sample);
+            ASSERT_EQ(dur, sample % 999 + 1);
+        }
+    }
+
+    stop = true;
+    recorder.join();
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,488 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ProjectionTest.cpp
+ *
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <cpp_utils/exception/InitializationException.hpp>
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <ddspipe_core/efficiency/payload/FastPayloadPool.hpp>
+#include <ddspipe_core/types/topic/dds/DdsTopic.hpp>
+
+#include <ddsrouter_core/configuration/ProjectionConfiguration.hpp>
+#include <ddsrouter_core/efficiency/cdr/CdrProjection.hpp>
+#include <ddsrouter_core/efficiency/projection/ProjectionEngine.hpp>
+#include <ddsrouter_core/efficiency/projection/TopicProjection.hpp>
+
+using namespace eprosima;
+using namespace eprosima::ddsrouter::core;
+
+namespace test {
+
+constexpr unsigned int BENCHMARK_SAMPLES = 1000000;
+
+//! Encapsulation identifiers, little endian ones are odd.
+constexpr uint8_t CDR_BE = 0x00;
+constexpr uint8_t CDR_LE = 0x01;
+constexpr uint8_t PLAIN_CDR2_BE = 0x06;
+constexpr uint8_t PLAIN_CDR2_LE = 0x07;
+constexpr uint8_t DELIMITED_CDR2_BE = 0x08;
+constexpr uint8_t DELIMITED_CDR2_LE = 0x09;
+constexpr uint8_t PL_CDR_LE = 0x03;
+
+constexpr uint8_t ENCAPSULATIONS[] = {
+    CDR_BE, CDR_LE, PLAIN_CDR2_BE, PLAIN_CDR2_LE, DELIMITED_CDR2_BE, DELIMITED_CDR2_LE};
+
+//! Serializes a sample in CDR, as a DDS writer would.
+class SampleWriter
+{
+public:
+
+    SampleWriter(
+            uint8_t encapsulation)
+        : little_endian_(encapsulation & 0x01)
+        , max_alignment_(encapsulation >= PLAIN_CDR2_BE ? 4 : 8)
+        , delimited_(encapsulation >= DELIMITED_CDR2_BE)
+        , bytes_({0x00, encapsulation, 0x00, 0x00})
+    {
+        if (delimited_)
+        {
+            bytes_.resize(8);
+        }
+    }
+
+    template <typename T>
+    SampleWriter& add(
+            T value)
+    {
+        append_(&value, sizeof(T));
+        return *this;
+    }
+
+    SampleWriter& add(
+            const std::string& value)
+    {
+        add<uint32_t>(static_cast<uint32_t>(value.size() + 1));
+        bytes_.insert(bytes_.end(), value.begin(), value.end());
+        bytes_.push_back(0);
+        return *this;
+    }
+
+    template <typename T>
+    SampleWriter& add(
+            const std::vector<T>& values)
+    {
+        add<uint32_t>(static_cast<uint32_t>(values.size()));
+        for (const T& value : values)
+        {
+            add<T>(value);
+        }
+        return *this;
+    }
+
+    //! Serialized sample with its DHEADER if the encoding requires it, padded to a multiple of 4.
+    std::vector<uint8_t> bytes() const
+    {
+        std::vector<uint8_t> bytes = bytes_;
+
+        if (delimited_)
+        {
+            SampleWriter dheader(little_endian_ ? CDR_LE : CDR_BE);
+            dheader.add<uint32_t>(static_cast<uint32_t>(bytes.size() - 8));
+            std::copy(dheader.bytes_.begin() + 4, dheader.bytes_.end(), bytes.begin() + 4);
+        }
+
+        const uint8_t padding = static_cast<uint8_t>((4 - bytes.size() % 4) % 4);
+        bytes.resize(bytes.size() + padding, 0);
+        bytes[3] = padding;
+
+        return bytes;
+    }
+
+protected:
+
+    void append_(
+            const void* value,
+            std::size_t size)
+    {
+        const std::size_t alignment = std::min<std::size_t>(size, max_alignment_);
+        while ((bytes_.size() - 4) % alignment != 0)
+        {
+            bytes_.push_back(0);
+        }
+
+        const uint16_t probe = 1;
+        uint8_t host_little_endian;
+        std::memcpy(&host_little_endian, &probe, 1);
+
+        const uint8_t* data = static_cast<const uint8_t*>(value);
+        std::vector<uint8_t> serialized(data, data + size);
+        if (static_cast<bool>(host_little_endian) != little_endian_)
+        {
+            std::reverse(serialized.begin(), serialized.end());
+        }
+
+        bytes_.insert(bytes_.end(), serialized.begin(), serialized.end());
+    }
+
+    const bool little_endian_;
+    const std::size_t max_alignment_;
+    const bool delimited_;
+    std::vector<uint8_t> bytes_;
+};
+
+//! Layout of the camera frame type of the tests.
+std::vector<CdrFieldConfiguration> camera_fields()
+{
+    return {
+        {"camera_id", "uint32"},
+        {"exposure", "float64"},
+        {"stamp", "uint64"},
+        {"frame_id", "string"},
+        {"image", "sequence<uint8>"},
+        {"histogram", "sequence<float64>"},
+        {"gain", "float32"},
+        {"level", "int16"},
+    };
+}
+
+struct Camera
+{
+    uint32_t camera_id = 7;
+    double exposure = 0.01;
+    uint64_t stamp = 123456789;
+    std::string frame_id = "front";
+    std::vector<uint8_t> image{1, 2, 3, 4, 5};
+    std::vector<double> histogram{0.25, 0.5, 0.25};
+    float gain = 1.5f;
+    int16_t level = -3;
+};
+
+//! Serialize the fields of \c camera not in \c stripped .
+std::vector<uint8_t> serialize(
+        const Camera& camera,
+        uint8_t encapsulation = CDR_LE,
+        const std::vector<std::string>& stripped = {})
+{
+    auto kept = [&](const std::string& name)
+            {
+                return std::find(stripped.begin(), stripped.end(), name) == stripped.end();
+            };
+
+    SampleWriter writer(encapsulation);
+    if (kept("camera_id"))
+    {
+        writer.add<uint32_t>(camera.camera_id);
+    }
+    if (kept("exposure"))
+    {
+        writer.add<double>(camera.exposure);
+    }
+    if (kept("stamp"))
+    {
+        writer.add<uint64_t>(camera.stamp);
+    }
+    if (kept("frame_id"))
+    {
+        writer.add(camera.frame_id);
+    }
+    if (kept("image"))
+    {
+        writer.add(camera.image);
+    }
+    if (kept("histogram"))
+    {
+        writer.add(camera.histogram);
+    }
+    if (kept("gain"))
+    {
+        writer.add<float>(camera.gain);
+    }
+    if (kept("level"))
+    {
+        writer.add<int16_t>(camera.level);
+    }
+    return writer.bytes();
+}
+
+//! Projection of \c sample , empty if it is not projected.
+std::vector<uint8_t> project(
+        const CdrProjection& projection,
+        const std::vector<uint8_t>& sample)
+{
+    std::vector<uint8_t> output(sample.size() + CdrProjection::MAX_PADDING, 0xFF);
+    const uint32_t size = projection.project(sample.data(), static_cast<uint32_t>(sample.size()), output.data());
+    output.resize(size);
+    return output;
+}
+
+//! Check the projection of \c camera stripping \c stripped is the serialization of the fields kept.
+void check_projection(
+        const Camera& camera,
+        const std::vector<std::string>& stripped)
+{
+    const CdrProjection projection(camera_fields(), stripped);
+
+    for (uint8_t encapsulation : ENCAPSULATIONS)
+    {
+        ASSERT_EQ(project(projection, serialize(camera, encapsulation)), serialize(camera, encapsulation, stripped))
+            << "encapsulation " << static_cast<int>(encapsulation);
+    }
+}
+
+ddspipe::core::types::DdsTopic topic(
+        const std::string& name)
+{
+    ddspipe::core::types::DdsTopic topic;
+    topic.m_topic_name = name;
+    topic.type_name = "CameraFrame";
+    return topic;
+}
+
+ProjectionConfiguration rule(
+        const std::string& topic_filter,
+        const std::vector<std::string>& stripped,
+        const std::string& participant_id = "")
+{
+    ProjectionConfiguration rule;
+    rule.topic.topic_name = topic_filter;
+    rule.participant_id = participant_id;
+    rule.strip = stripped;
+    rule.fields = camera_fields();
+    return rule;
+}
+
+} /* namespace test */
+
+/**
+ * Test the fields of a fixed size are stripped in every supported encapsulation.
+ *
+ * CASES:
+ * - CDR, PLAIN_CDR2 and DELIMITED_CDR2
+ * - little and big endian
+ * - first field, fields in the middle realigned and last field
+ */
+TEST(ProjectionTest, fixed_fields)
+{
+    test::check_projection(test::Camera(), {"camera_id"});
+    test::check_projection(test::Camera(), {"exposure"});
+    test::check_projection(test::Camera(), {"camera_id", "stamp"});
+    test::check_projection(test::Camera(), {"gain"});
+    test::check_projection(test::Camera(), {"level"});
+}
+
+/**
+ * Test the fields of a variable size are stripped, and the fields after them realigned.
+ *
+ * CASES:
+ * - strings and sequences of every length modulo 8, so the sequence of float64 after them moves in XCDR1
+ * - empty sequences
+ * - fields of a fixed and a variable size stripped together
+ */
+TEST(ProjectionTest, variable_fields)
+{
+    test::Camera camera;
+    for (std::size_t length = 0; length < 8; ++length)
+    {
+        camera.frame_id = std::string(length, 'f');
+        camera.image.resize(length, 0xAB);
+
+        test::check_projection(camera, {"frame_id"});
+        test::check_projection(camera, {"image"});
+        test::check_projection(camera, {"exposure", "image"});
+        test::check_projection(camera, {"histogram"});
+    }
+
+    camera.histogram.clear();
+    test::check_projection(camera, {"image"});
+    test::check_projection(camera, {"frame_id", "gain"});
+}
+
+/**
+ * Test the samples that do not follow the layout are not projected.
+ *
+ * CASES:
+ * - sample truncated
+ * - encapsulation not supported
+ * - sample with bytes after the last field of the layout
+ */
+TEST(ProjectionTest, malformed)
+{
+    const CdrProjection projection(test::camera_fields(), {"image"});
+
+    std::vector<uint8_t> sample = test::serialize(test::Camera());
+    sample.resize(sample.size() - 8);
+    ASSERT_TRUE(test::project(projection, sample).empty());
+
+    sample = test::serialize(test::Camera());
+    sample[1] = test::PL_CDR_LE;
+    ASSERT_TRUE(test::project(projection, sample).empty());
+
+    sample = test::serialize(test::Camera());
+    sample.insert(sample.end(), 8, 0);
+    ASSERT_TRUE(test::project(projection, sample).empty());
+}
+
+/**
+ * Test the rules that are not valid are rejected.
+ *
+ * CASES:
+ * - no field stripped
+ * - field stripped not in the layout
+ * - every field stripped
+ * - layout not valid
+ */
+TEST(ProjectionTest, invalid)
+{
+    ASSERT_THROW(CdrProjection(test::camera_fields(), {}), utils::InitializationException);
+    ASSERT_THROW(CdrProjection(test::camera_fields(), {"thumbnail"}), utils::InitializationException);
+    ASSERT_THROW(CdrProjection({{"stamp", "uint64"}}, {"stamp"}), utils::InitializationException);
+    ASSERT_THROW(CdrProjection({{"stamp", "uint64"}, {"pose", "Pose"}}, {"stamp"}), utils::InitializationException);
+
+    utils::Formatter error_msg;
+    ASSERT_FALSE(test::rule("*", {"thumbnail"}).is_valid(error_msg));
+    ASSERT_TRUE(test::rule("*", {"image"}).is_valid(error_msg));
+}
+
+/**
+ * Test the samples of a topic are projected into payloads of a pool, and counted.
+ *
+ * CASES:
+ * - sample projected
+ * - sample that does not follow the layout is dropped
+ */
+TEST(ProjectionTest, topic_projection)
+{
+    TopicProjection projection(
+        std::make_shared<const CdrProjection>(test::camera_fields(), std::vector<std::string>({"image"})),
+        "rt/camera", "CameraFrame_projected");
+    ddspipe::core::FastPayloadPool pool;
+
+    test::Camera camera;
+    camera.image.resize(1024);
+    std::vector<uint8_t> sample = test::serialize(camera, test::PLAIN_CDR2_LE);
+
+    ddspipe::core::types::Payload source;
+    source.data = sample.data();
+    source.length = static_cast<uint32_t>(sample.size());
+
+    ddspipe::core::types::Payload target;
+    ASSERT_TRUE(projection.project(source, pool, target));
+    ASSERT_EQ(std::vector<uint8_t>(target.data, target.data + target.length),
+            test::serialize(camera, test::PLAIN_CDR2_LE, {"image"}));
+    pool.release_payload(target);
+
+    sample.resize(16);
+    source.length = static_cast<uint32_t>(sample.size());
+    ASSERT_FALSE(projection.project(source, pool, target));
+
+    const ProjectionStatistics statistics = projection.statistics();
+    ASSERT_EQ(statistics.topic, "rt/camera");
+    ASSERT_EQ(statistics.type_name, "CameraFrame_projected");
+    ASSERT_EQ(statistics.projected, 1u);
+    ASSERT_EQ(statistics.dropped, 1u);
+    ASSERT_EQ(statistics.original_bytes, test::serialize(camera, test::PLAIN_CDR2_LE).size());
+    ASSERT_EQ(statistics.projected_bytes, test::serialize(camera, test::PLAIN_CDR2_LE, {"image"}).size());
+}
+
+/**
+ * Test the engine hands the projection of each rule to the writers it applies to.
+ *
+ * CASES:
+ * - topic and participant matching, with the derived type named after the original one
+ * - derived type configured
+ * - topic or participant not matching
+ * - first rule applies if several match
+ * - same projection for every writer of a topic
+ */
+TEST(ProjectionTest, engine)
+{
+    ProjectionConfiguration named = test::rule("rt/lidar", {"histogram"});
+    named.type_name = "LidarSummary";
+
+    ProjectionEngine engine({test::rule("rt/camera_*", {"image"}, "wan"), named, test::rule("*", {"gain"})});
+    ASSERT_FALSE(engine.empty());
+
+    auto projection = engine.projection(test::topic("rt/camera_front"), "wan");
+    ASSERT_NE(projection, nullptr);
+    ASSERT_EQ(projection->type_name(), "CameraFrame_projected");
+    ASSERT_EQ(engine.projection(test::topic("rt/camera_front"), "wan"), projection);
+
+    ASSERT_EQ(engine.projection(test::topic("rt/lidar"), "local")->type_name(), "LidarSummary");
+
+    // Only the catch-all rule applies to other participants
+    auto other = engine.projection(test::topic("rt/camera_front"), "local");
+    ASSERT_NE(other, nullptr);
+    ASSERT_NE(other, projection);
+
+    ProjectionEngine scoped({test::rule("rt/camera_*", {"image"}, "wan")});
+    ASSERT_EQ(scoped.projection(test::topic("rt/camera_front"), "local"), nullptr);
+    ASSERT_EQ(scoped.projection(test::topic("rt/lidar"), "wan"), nullptr);
+
+    ASSERT_EQ(engine.statistics().size(), 3u);
+    ASSERT_THROW(ProjectionEngine({test::rule("*", {"thumbnail"})}), utils::InitializationException);
+}
+
+/**
+ * Measure the time to strip the image of a camera frame, in the encapsulation that requires realigning the
+ * fields after it.
+ */
+TEST(ProjectionTest, benchmark)
+{
+    const CdrProjection projection(test::camera_fields(), {"image"});
+
+    test::Camera camera;
+    camera.image.resize(4093);
+    camera.histogram.resize(16);
+    const std::vector<uint8_t> sample = test::serialize(camera, test::CDR_LE);
+    std::vector<uint8_t> output(sample.size() + CdrProjection::MAX_PADDING);
+
+    const auto start = std::chrono::steady_clock::now();
+
+    uint64_t projected_bytes = 0;
+    for (unsigned int i = 0; i < test::BENCHMARK_SAMPLES; ++i)
+    {
+        projected_bytes += projection.project(sample.data(), static_cast<uint32_t>(sample.size()), output.data());
+    }
+
+    const double ns_per_sample = std::chrono::duration<double, std::nano>(
+        std::chrono::steady_clock::now() - start).count() / test::BENCHMARK_SAMPLES;
+
+    const std::size_t expected = test::serialize(camera, test::CDR_LE, {"image"}).size();
+    std::cout << "Projection: " << ns_per_sample << " ns per sample, " << sample.size() << " bytes reduced to "
+              << expected << "." << std::endl;
+    ::testing::Test::RecordProperty("ns_per_sample", std::to_string(ns_per_sample));
+
+    ASSERT_EQ(projected_bytes, expected * test::BENCHMARK_SAMPLES);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,607 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file RateLimitTest.cpp
+ *
+ */
+
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <ddspipe_core/interface/IParticipant.hpp>
+#include <ddspipe_core/interface/IReader.hpp>
+#include <ddspipe_core/interface/IRoutingData.hpp>
+#include <ddspipe_core/interface/IWriter.hpp>
+#include <ddspipe_core/types/data/RtpsPayloadData.hpp>
+#include <ddspipe_core/types/topic/dds/DdsTopic.hpp>
+
+#include <ddsrouter_core/configuration/RateLimitConfiguration.hpp>
+#include <ddsrouter_core/efficiency/rate_limit/InstanceSampleTable.hpp>
+#include <ddsrouter_core/efficiency/rate_limit/RateLimitEngine.hpp>
+#include <ddsrouter_core/efficiency/rate_limit/RateLimiter.hpp>
+#include <ddsrouter_core/efficiency/rate_limit/TokenBucket.hpp>
+#include <ddsrouter_core/participants/rate_limit/RateLimitedParticipant.hpp>
+
+using namespace eprosima;
+using namespace eprosima::ddsrouter::core;
+
+namespace test {
+
+constexpr int64_t SECOND = 1000000000;
+
+InstanceSampleTable::Key instance(
+        uint8_t id)
+{
+    InstanceSampleTable::Key key;
+    key.value[0] = id;
+    key.value[15] = id;
+    return key;
+}
+
+std::unique_ptr<ddspipe::core::IRoutingData> sample(
+        uint8_t id)
+{
+    auto data = std::make_unique<ddspipe::core::types::RtpsPayloadData>();
+    data->instanceHandle = instance(id);
+    return data;
+}
+
+//! Writer that counts the messages written.
+class MockWriter : public ddspipe::core::IWriter
+{
+public:
+
+    void enable() noexcept override
+    {
+    }
+
+    void disable() noexcept override
+    {
+    }
+
+    utils::ReturnCode write(
+            ddspipe::core::IRoutingData& /* data */) noexcept override
+    {
+        ++written;
+        return utils::ReturnCode::RETCODE_OK;
+    }
+
+    unsigned int written = 0;
+};
+
+//! Reader that returns the messages pushed to it.
+class MockReader : public ddspipe::core::IReader
+{
+public:
+
+    MockReader(
+            const ddspipe::core::types::ParticipantId& participant_id)
+        : participant_id_(participant_id)
+    {
+    }
+
+    void enable() noexcept override
+    {
+    }
+
+    void disable() noexcept override
+    {
+    }
+
+    void set_on_data_available_callback(
+            std::function<void()> /* on_data_available_lambda */) noexcept override
+    {
+    }
+
+    void unset_on_data_available_callback() noexcept override
+    {
+    }
+
+    utils::ReturnCode take(
+            std::unique_ptr<ddspipe::core::IRoutingData>& data) noexcept override
+    {
+        if (pending.empty())
+        {
+            return utils::ReturnCode::RETCODE_NO_DATA;
+        }
+
+        data = std::move(pending.front());
+        pending.pop_front();
+        return utils::ReturnCode::RETCODE_OK;
+    }
+
+    ddspipe::core::types::Guid guid() const override
+    {
+        return ddspipe::core::types::Guid();
+    }
+
+    fastrtps::RecursiveTimedMutex& get_rtps_mutex() const override
+    {
+        return mutex_;
+    }
+
+    uint64_t get_unread_count() const override
+    {
+        return pending.size();
+    }
+
+    ddspipe::core::types::DdsTopic topic() const override
+    {
+        return ddspipe::core::types::DdsTopic();
+    }
+
+    ddspipe::core::types::ParticipantId participant_id() const override
+    {
+        return participant_id_;
+    }
+
+    std::deque<std::unique_ptr<ddspipe::core::IRoutingData>> pending;
+
+protected:
+
+    const ddspipe::core::types::ParticipantId participant_id_;
+
+    mutable fastrtps::RecursiveTimedMutex mutex_;
+};
+
+//! Participant that creates mock endpoints, keeping them to feed and inspect them.
+class MockParticipant : public ddspipe::core::IParticipant
+{
+public:
+
+    MockParticipant(
+            const ddspipe::core::types::ParticipantId& id)
+        : id_(id)
+    {
+    }
+
+    ddspipe::core::types::ParticipantId id() const noexcept override
+    {
+        return id_;
+    }
+
+    bool is_repeater() const noexcept override
+    {
+        return false;
+    }
+
+    bool is_rtps_kind() const noexcept override
+    {
+        return false;
+    }
+
+    ddspipe::core::types::TopicQoS topic_qos() const noexcept override
+    {
+        return ddspipe::core::types::TopicQoS();
+    }
+
+    std::shared_ptr<ddspipe::core::IWriter> create_writer(
+            const ddspipe::core::ITopic& /* topic */) override
+    {
+        writer = std::make_shared<MockWriter>();
+        return writer;
+    }
+
+    std::shared_ptr<ddspipe::core::IReader> create_reader(
+            const ddspipe::core::ITopic& /* topic */) override
+    {
+        reader = std::make_shared<MockReader>(id_);
+        return reader;
+    }
+
+    std::shared_ptr<MockWriter> writer;
+    std::shared_ptr<MockReader> reader;
+
+protected:
+
+    const ddspipe::core::types::ParticipantId id_;
+};
+
+//! Take a message from \c reader and write it to \c writer in this thread, as the DDS Pipe does.
+bool forward(
+        ddspipe::core::IReader& reader,
+        ddspipe::core::IWriter& writer)
+{
+    std::unique_ptr<ddspipe::core::IRoutingData> data;
+    if (reader.take(data) != utils::ReturnCode::RETCODE_OK)
+    {
+        return false;
+    }
+
+    writer.write(*data);
+    return true;
+}
+
+} /* namespace test */
+
+/**
+ * Test that a bucket accepts up to its burst at once, and refills at its rate.
+ */
+TEST(RateLimitTest, token_bucket_burst_and_refill)
+{
+    // 10 tokens per second, burst of 5
+    TokenBucket bucket(10, 5);
+    int64_t now = test::SECOND;
+
+    for (int i = 0; i < 5; ++i)
+    {
+        ASSERT_TRUE(bucket.try_consume(1, now));
+    }
+    ASSERT_FALSE(bucket.try_consume(1, now));
+
+    // After 100ms a single token has been refilled
+    now += test::SECOND / 10;
+    ASSERT_TRUE(bucket.try_consume(1, now));
+    ASSERT_FALSE(bucket.try_consume(1, now));
+
+    // After a long time the bucket is full again, but never over its burst
+    now += 100 * test::SECOND;
+    for (int i = 0; i < 5; ++i)
+    {
+        ASSERT_TRUE(bucket.try_consume(1, now));
+    }
+    ASSERT_FALSE(bucket.try_consume(1, now));
+}
+
+/**
+ * Test that a refund gives back the tokens consumed.
+ */
+TEST(RateLimitTest, token_bucket_refund)
+{
+    TokenBucket bucket(10, 2);
+    int64_t now = test::SECOND;
+
+    ASSERT_TRUE(bucket.try_consume(2, now));
+    ASSERT_FALSE(bucket.try_consume(1, now));
+
+    bucket.refund(1);
+    ASSERT_TRUE(bucket.try_consume(1, now));
+}
+
+/**
+ * Test that requests bigger than the burst do not starve, but are only accepted with the bucket full.
+ */
+TEST(RateLimitTest, token_bucket_oversized_request)
+{
+    TokenBucket bucket(100, 10);
+    int64_t now = test::SECOND;
+
+    ASSERT_TRUE(bucket.try_consume(50, now));
+    ASSERT_FALSE(bucket.try_consume(1, now));
+
+    // Once the debt is paid the bucket accepts again
+    now += test::SECOND / 2;
+    ASSERT_TRUE(bucket.try_consume(1, now));
+}
+
+/**
+ * Test that an unlimited bucket accepts everything.
+ */
+TEST(RateLimitTest, token_bucket_unlimited)
+{
+    TokenBucket bucket(0);
+    ASSERT_TRUE(bucket.unlimited());
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        ASSERT_TRUE(bucket.try_consume(1000000, test::SECOND));
+    }
+}
+
+/**
+ * Test that several threads never consume more tokens than available.
+ */
+TEST(RateLimitTest, token_bucket_concurrent)
+{
+    constexpr unsigned int N_THREADS = 8;
+    constexpr unsigned int N_REQUESTS = 10000;
+    constexpr unsigned int BURST = 1000;
+
+    // Very slow rate, so no token is refilled during the test
+    TokenBucket bucket(0.001, BURST);
+    const int64_t now = test::SECOND;
+
+    std::atomic<unsigned int> accepted(0);
+    std::vector<std::thread> threads;
+
+    for (unsigned int i = 0; i < N_THREADS; ++i)
+    {
+        threads.emplace_back([&]()
+                {
+                    for (unsigned int j = 0; j < N_REQUESTS; ++j)
+                    {
+                        if (bucket.try_consume(1, now))
+                        {
+                            accepted++;
+                        }
+                    }
+                });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    ASSERT_EQ(accepted.load(), BURST);
+}
+
+/**
+ * Test that a limiter checks both messages and bytes, and counts accepted and dropped data.
+ */
+TEST(RateLimitTest, rate_limiter_statistics)
+{
+    RateLimitConfiguration configuration;
+    configuration.max_msgs_per_second = 10;
+    configuration.burst_msgs = 3;
+    configuration.max_bytes_per_second = 100;
+    configuration.burst_bytes = 250;
+
+    RateLimiter limiter(configuration, "rt/chatter");
+    const int64_t now = test::SECOND;
+
+    // Limited by bytes
+    ASSERT_TRUE(limiter.accept(200, now));
+    ASSERT_FALSE(limiter.accept(100, now));
+
+    // Limited by messages (the message token of the rejected sample has been given back)
+    ASSERT_TRUE(limiter.accept(10, now));
+    ASSERT_TRUE(limiter.accept(10, now));
+    ASSERT_FALSE(limiter.accept(1, now));
+
+    RateLimitStatistics statistics = limiter.statistics();
+    ASSERT_EQ(statistics.key, "rt/chatter");
+    ASSERT_EQ(statistics.scope, types::RateLimitScope::topic);
+    ASSERT_EQ(statistics.accepted_msgs, 3u);
+    ASSERT_EQ(statistics.accepted_bytes, 220u);
+    ASSERT_EQ(statistics.dropped_msgs, 2u);
+    ASSERT_EQ(statistics.dropped_bytes, 101u);
+}
+
+/**
+ * Test that a rejected try_accept is not counted as dropped.
+ */
+TEST(RateLimitTest, rate_limiter_try_accept)
+{
+    RateLimitConfiguration configuration;
+    configuration.max_msgs_per_second = 1;
+    configuration.burst_msgs = 1;
+
+    RateLimiter limiter(configuration, "rt/chatter");
+    const int64_t now = test::SECOND;
+
+    ASSERT_TRUE(limiter.try_accept(10, now));
+    ASSERT_FALSE(limiter.try_accept(10, now));
+    ASSERT_EQ(limiter.statistics().dropped_msgs, 0u);
+
+    limiter.drop(10);
+    ASSERT_EQ(limiter.statistics().accepted_msgs, 1u);
+    ASSERT_EQ(limiter.statistics().dropped_msgs, 1u);
+    ASSERT_EQ(limiter.statistics().dropped_bytes, 10u);
+}
+
+/**
+ * Test that the instance table keeps only the latest sample of each instance.
+ */
+TEST(RateLimitTest, instance_table_latest_sample)
+{
+    InstanceSampleTable table;
+
+    ASSERT_EQ(table.store(test::instance(1), test::sample(1)), nullptr);
+    ASSERT_EQ(table.pending(), 1u);
+
+    auto latest = test::sample(1);
+    auto* latest_ptr = latest.get();
+    ASSERT_NE(table.store(test::instance(1), std::move(latest)), nullptr);
+    ASSERT_EQ(table.pending(), 1u);
+    ASSERT_EQ(table.instances(), 1u);
+
+    ASSERT_EQ(table.front(), latest_ptr);
+    ASSERT_EQ(table.pop().get(), latest_ptr);
+    ASSERT_EQ(table.pending(), 0u);
+    ASSERT_EQ(table.front(), nullptr);
+
+    // The instance is still known after its sample is sent
+    ASSERT_EQ(table.instances(), 1u);
+}
+
+/**
+ * Test that pending instances are visited in round-robin order, even if some of them are updated faster.
+ */
+TEST(RateLimitTest, instance_table_round_robin)
+{
+    InstanceSampleTable table(2);
+
+    // Instance 0 is updated much faster than the rest
+    for (uint8_t i = 1; i <= 100; ++i)
+    {
+        table.store(test::instance(0), test::sample(0));
+        table.store(test::instance(i), test::sample(i));
+    }
+
+    ASSERT_EQ(table.pending(), 101u);
+    ASSERT_EQ(table.instances(), 101u);
+
+    // Every instance is sent once, in the order they got their first pending sample
+    for (uint8_t i = 0; i <= 100; ++i)
+    {
+        auto data = table.pop();
+        ASSERT_NE(data, nullptr);
+
+        auto* rtps_data = dynamic_cast<ddspipe::core::types::RtpsPayloadData*>(data.get());
+        ASSERT_EQ(rtps_data->instanceHandle, test::instance(i));
+    }
+
+    ASSERT_EQ(table.pop(), nullptr);
+}
+
+/**
+ * Test that erasing instances returns their pending sample and keeps the rest reachable.
+ */
+TEST(RateLimitTest, instance_table_erase)
+{
+    InstanceSampleTable table(4);
+
+    for (uint8_t i = 0; i < 50; ++i)
+    {
+        table.store(test::instance(i), test::sample(i));
+    }
+
+    // Erase the even instances
+    for (uint8_t i = 0; i < 50; i += 2)
+    {
+        ASSERT_NE(table.erase(test::instance(i)), nullptr);
+    }
+    ASSERT_EQ(table.erase(test::instance(0)), nullptr);
+
+    ASSERT_EQ(table.pending(), 25u);
+    ASSERT_EQ(table.instances(), 25u);
+
+    // Only the odd instances are left, in order
+    for (uint8_t i = 1; i < 50; i += 2)
+    {
+        auto data = table.pop();
+        ASSERT_NE(data, nullptr);
+
+        auto* rtps_data = dynamic_cast<ddspipe::core::types::RtpsPayloadData*>(data.get());
+        ASSERT_EQ(rtps_data->instanceHandle, test::instance(i));
+    }
+
+    ASSERT_EQ(table.pop(), nullptr);
+}
+
+/**
+ * Test the messages of a participant that is not the source of a route are not charged to it, when a thread
+ * forwards the messages of both.
+ *
+ * CASES:
+ * - message of the route source accepted, consuming the only token of the route
+ * - message of another participant accepted, though the thread forwarded a route message last
+ * - message of the route source dropped, as the route has no tokens left
+ */
+TEST(RateLimitTest, route_source_per_message)
+{
+    RateLimitConfiguration rule;
+    rule.scope = types::RateLimitScope::route;
+    rule.topic.topic_name = "*";
+    rule.source_participant_id = "source";
+    rule.destination_participant_id = "destination";
+    rule.max_msgs_per_second = 1;
+    rule.burst_msgs = 1;
+
+    auto engine = std::make_shared<RateLimitEngine>(std::vector<RateLimitConfiguration>({rule}));
+
+    auto source = std::make_shared<test::MockParticipant>("source");
+    auto other = std::make_shared<test::MockParticipant>("other");
+    auto destination = std::make_shared<test::MockParticipant>("destination");
+
+    RateLimitedParticipant limited_source(source, engine);
+    RateLimitedParticipant limited_other(other, engine);
+    RateLimitedParticipant limited_destination(destination, engine);
+
+    ddspipe::core::types::DdsTopic topic;
+    topic.m_topic_name = "topic";
+    topic.type_name = "type";
+
+    auto source_reader = limited_source.create_reader(topic);
+    auto other_reader = limited_other.create_reader(topic);
+    auto writer = limited_destination.create_writer(topic);
+
+    source->reader->pending.push_back(test::sample(1));
+    other->reader->pending.push_back(test::sample(2));
+    source->reader->pending.push_back(test::sample(3));
+
+    ASSERT_TRUE(test::forward(*source_reader, *writer));
+    ASSERT_EQ(destination->writer->written, 1u);
+
+    ASSERT_TRUE(test::forward(*other_reader, *writer));
+    ASSERT_EQ(destination->writer->written, 2u);
+
+    // Nothing taken, so the next message of the thread does not inherit the source either
+    ASSERT_FALSE(test::forward(*other_reader, *writer));
+
+    ASSERT_TRUE(test::forward(*source_reader, *writer));
+    ASSERT_EQ(destination->writer->written, 2u);
+
+    const std::vector<RateLimitStatistics> statistics = engine->statistics();
+    ASSERT_EQ(statistics.size(), 1u);
+    ASSERT_EQ(statistics[0].key, "source->destination");
+    ASSERT_EQ(statistics[0].accepted_msgs, 1u);
+    ASSERT_EQ(statistics[0].dropped_msgs, 1u);
+}
+
+/**
+ * Test the validity of the rate limit configurations.
+ */
+TEST(RateLimitTest, rate_limit_configuration_is_valid)
+{
+    utils::Formatter error_msg;
+
+    // No limit
+    {
+        RateLimitConfiguration configuration;
+        ASSERT_FALSE(configuration.is_valid(error_msg));
+    }
+
+    // Negative limit
+    {
+        RateLimitConfiguration configuration;
+        configuration.max_msgs_per_second = -1;
+        ASSERT_FALSE(configuration.is_valid(error_msg));
+    }
+
+    // Participant scope without participant
+    {
+        RateLimitConfiguration configuration;
+        configuration.scope = types::RateLimitScope::participant;
+        configuration.max_msgs_per_second = 10;
+        ASSERT_FALSE(configuration.is_valid(error_msg));
+
+        configuration.participant_id = "P1";
+        ASSERT_TRUE(configuration.is_valid(error_msg));
+    }
+
+    // Route scope without destination
+    {
+        RateLimitConfiguration configuration;
+        configuration.scope = types::RateLimitScope::route;
+        configuration.max_bytes_per_second = 10;
+        configuration.source_participant_id = "P1";
+        ASSERT_FALSE(configuration.is_valid(error_msg));
+
+        configuration.destination_participant_id = "P2";
+        ASSERT_TRUE(configuration.is_valid(error_msg));
+
+        // Only topic limits can be applied per instance
+        configuration.per_instance = true;
+        ASSERT_FALSE(configuration.is_valid(error_msg));
+    }
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
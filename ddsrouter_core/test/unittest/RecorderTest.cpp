@@ -0,0 +1,490 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file RecorderTest.cpp
+ *
+ */
+
+#include <dirent.h>
+#include <stdlib.h>
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <cpp_utils/exception/InitializationException.hpp>
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <ddspipe_core/efficiency/payload/FastPayloadPool.hpp>
+#include <ddspipe_core/types/data/RtpsPayloadData.hpp>
+
+#include <ddsrouter_core/configuration/RecorderParticipantConfiguration.hpp>
+#include <ddsrouter_core/participants/recorder/RecordFormat.hpp>
+#include <ddsrouter_core/participants/recorder/RecordSegment.hpp>
+#include <ddsrouter_core/participants/recorder/RecordSegmentReader.hpp>
+#include <ddsrouter_core/participants/recorder/SegmentRecorder.hpp>
+
+using namespace eprosima;
+using namespace eprosima::ddsrouter::core;
+
+namespace test {
+
+constexpr uint64_t SEGMENT_SIZE = 1024 * 1024;
+
+//! Record read back from a segment file.
+struct ReadRecord
+{
+    uint64_t offset;
+    RecordType type;
+    std::vector<uint8_t> body;
+};
+
+//! Temporary directory for the files of a test.
+std::string temporary_directory()
+{
+    char path[] = "/tmp/ddsrouter_recorder_test_XXXXXX";
+    return mkdtemp(path);
+}
+
+std::vector<uint8_t> read_file(
+        const std::string& path)
+{
+    std::ifstream file(path, std::ios::binary);
+    return std::vector<uint8_t>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+//! Paths without extension of the segments in \c directory , in order.
+std::vector<std::string> list_segments(
+        const std::string& directory)
+{
+    std::vector<std::string> segments;
+    const std::string extension = RECORD_SEGMENT_EXTENSION;
+
+    DIR* dir = opendir(directory.c_str());
+    while (dirent* entry = readdir(dir))
+    {
+        const std::string name = entry->d_name;
+        if (name.size() > extension.size() &&
+                name.compare(name.size() - extension.size(), extension.size(), extension) == 0)
+        {
+            segments.push_back(directory + "/" + name.substr(0, name.size() - extension.size()));
+        }
+    }
+    closedir(dir);
+
+    std::sort(segments.begin(), segments.end());
+    return segments;
+}
+
+//! Read every record of a segment, checking its header.
+std::vector<ReadRecord> read_segment(
+        const std::string& path)
+{
+    const std::vector<uint8_t> file = read_file(path + RECORD_SEGMENT_EXTENSION);
+
+    EXPECT_GE(file.size(), sizeof(RecordFileHeader));
+    EXPECT_EQ(std::memcmp(file.data(), RECORD_SEGMENT_MAGIC, sizeof(RECORD_SEGMENT_MAGIC)), 0);
+
+    std::vector<ReadRecord> records;
+    uint64_t offset = sizeof(RecordFileHeader);
+
+    while (offset + sizeof(RecordHeader) <= file.size())
+    {
+        RecordHeader header;
+        std::memcpy(&header, file.data() + offset, sizeof(header));
+
+        if (header.type == RECORD_END)
+        {
+            break;
+        }
+
+        const uint8_t* body = file.data() + offset + sizeof(header);
+        records.push_back({offset, static_cast<RecordType>(header.type), std::vector<uint8_t>(body, body + header.size)});
+        offset += record_aligned_size(header.size);
+    }
+
+    return records;
+}
+
+//! Read every entry of the index of a segment, checking its header.
+std::vector<RecordIndexEntry> read_index(
+        const std::string& path)
+{
+    const std::vector<uint8_t> file = read_file(path + RECORD_INDEX_EXTENSION);
+
+    EXPECT_GE(file.size(), sizeof(RecordFileHeader));
+    EXPECT_EQ(std::memcmp(file.data(), RECORD_INDEX_MAGIC, sizeof(RECORD_INDEX_MAGIC)), 0);
+    EXPECT_EQ((file.size() - sizeof(RecordFileHeader)) % sizeof(RecordIndexEntry), 0u);
+
+    std::vector<RecordIndexEntry> entries((file.size() - sizeof(RecordFileHeader)) / sizeof(RecordIndexEntry));
+    std::memcpy(entries.data(), file.data() + sizeof(RecordFileHeader), entries.size() * sizeof(RecordIndexEntry));
+    return entries;
+}
+
+//! Append a record whose body is \c size times \c value .
+bool append(
+        RecordSegment& segment,
+        uint8_t value,
+        uint32_t size)
+{
+    uint64_t offset;
+    uint8_t* buffer = segment.reserve(size, offset);
+    if (!buffer)
+    {
+        return false;
+    }
+
+    std::memset(buffer, value, size);
+    segment.commit(RECORD_DATA, size);
+
+    RecordIndexEntry entry{};
+    entry.timestamp = value;
+    entry.size = size;
+    entry.offset = offset;
+    segment.add_index(entry);
+
+    return true;
+}
+
+//! Message with a payload of \c size bytes set to \c value , taken from \c pool .
+std::unique_ptr<ddspipe::core::types::RtpsPayloadData> make_data(
+        const std::shared_ptr<ddspipe::core::PayloadPool>& pool,
+        uint8_t value,
+        uint32_t size)
+{
+    auto data = std::make_unique<ddspipe::core::types::RtpsPayloadData>();
+    pool->get_payload(size, data->payload);
+    std::memset(data->payload.data, value, size);
+    data->payload.length = size;
+    data->payload_owner = pool.get();
+    return data;
+}
+
+ddspipe::core::types::DdsTopic make_topic(
+        const std::string& name)
+{
+    ddspipe::core::types::DdsTopic topic;
+    topic.m_topic_name = name;
+    topic.type_name = "type_" + name;
+    return topic;
+}
+
+} /* namespace test */
+
+using namespace test;
+
+/**
+ * Append records to a segment and read them back, both from the segment and from its index.
+ */
+TEST(RecorderTest, segment_append_and_read)
+{
+    const std::string path = temporary_directory() + "/segment";
+
+    {
+        RecordSegment segment(path, SEGMENT_SIZE);
+        for (uint8_t i = 1; i <= 10; ++i)
+        {
+            ASSERT_TRUE(append(segment, i, i * 3));
+        }
+
+        ASSERT_TRUE(segment.sync());
+
+        // Records appended after a synchronization are written when closing
+        ASSERT_TRUE(append(segment, 11, 33));
+    }
+
+    const auto records = read_segment(path);
+    const auto index = read_index(path);
+
+    ASSERT_EQ(records.size(), 11u);
+    ASSERT_EQ(index.size(), 11u);
+
+    for (size_t i = 0; i < records.size(); ++i)
+    {
+        const uint8_t value = static_cast<uint8_t>(i + 1);
+
+        ASSERT_EQ(records[i].type, RECORD_DATA);
+        ASSERT_EQ(records[i].body, std::vector<uint8_t>(value * 3, value));
+        ASSERT_EQ(records[i].offset % RECORD_ALIGNMENT, 0u);
+
+        ASSERT_EQ(index[i].timestamp, value);
+        ASSERT_EQ(index[i].offset, records[i].offset);
+        ASSERT_EQ(index[i].size, records[i].body.size());
+    }
+
+    // The segment file is shrunk to the data written when closed
+    ASSERT_LT(read_file(path + RECORD_SEGMENT_EXTENSION).size(), SEGMENT_SIZE);
+}
+
+/**
+ * A segment rejects records that do not fit in the space left.
+ */
+TEST(RecorderTest, segment_full)
+{
+    const std::string path = temporary_directory() + "/segment";
+
+    RecordSegment segment(path, SEGMENT_SIZE);
+
+    const uint32_t max_size = static_cast<uint32_t>(RecordSegment::max_record_size(SEGMENT_SIZE));
+    uint64_t offset;
+    ASSERT_EQ(segment.reserve(max_size + 1, offset), nullptr);
+
+    ASSERT_TRUE(append(segment, 1, max_size / 2));
+    ASSERT_FALSE(append(segment, 2, max_size / 2 + RECORD_ALIGNMENT * 2));
+    ASSERT_TRUE(append(segment, 3, 16));
+
+    segment.close();
+
+    // Nothing can be appended once closed
+    ASSERT_FALSE(append(segment, 4, 16));
+    ASSERT_EQ(read_segment(path).size(), 2u);
+}
+
+/**
+ * Record more messages than fit in a segment, and check every segment can be read on its own.
+ */
+TEST(RecorderTest, recorder_segments)
+{
+    constexpr uint32_t MESSAGES = 200;
+    constexpr uint32_t MESSAGE_SIZE = 20 * 1024;
+
+    const std::string directory = temporary_directory();
+    std::shared_ptr<ddspipe::core::PayloadPool> pool(new ddspipe::core::FastPayloadPool());
+
+    auto configuration = std::make_shared<RecorderParticipantConfiguration>();
+    configuration->id = "recorder";
+    configuration->output_directory = directory + "/records";
+    configuration->segment_size = SEGMENT_SIZE;
+    configuration->fsync_period = 10;
+
+    {
+        SegmentRecorder recorder(configuration, pool);
+        recorder.start();
+
+        const uint32_t topic_a = recorder.register_topic(make_topic("a"));
+        const uint32_t topic_b = recorder.register_topic(make_topic("b"));
+
+        for (uint32_t i = 0; i < MESSAGES; ++i)
+        {
+            auto data = make_data(pool, static_cast<uint8_t>(i), MESSAGE_SIZE);
+            ASSERT_TRUE(recorder.record(i % 2 ? topic_b : topic_a, *data));
+        }
+
+        recorder.flush();
+
+        ASSERT_EQ(recorder.recorded(), MESSAGES);
+        ASSERT_EQ(recorder.dropped(), 0u);
+    }
+
+    const auto segments = list_segments(directory + "/records");
+    ASSERT_GT(segments.size(), 1u);
+
+    uint32_t messages = 0;
+    int64_t last_timestamp = 0;
+
+    for (const auto& segment : segments)
+    {
+        const auto records = read_segment(segment);
+        const auto index = read_index(segment);
+
+        std::vector<bool> declared(2, false);
+        size_t index_position = 0;
+
+        for (const auto& record : records)
+        {
+            if (record.type == RECORD_TOPIC)
+            {
+                RecordTopic topic;
+                std::memcpy(&topic, record.body.data(), sizeof(topic));
+                const std::string name(record.body.begin() + sizeof(topic),
+                        record.body.begin() + sizeof(topic) + topic.name_size);
+                ASSERT_EQ(name, topic.topic_id ? "b" : "a");
+                declared[topic.topic_id] = true;
+                continue;
+            }
+
+            ASSERT_EQ(record.type, RECORD_DATA);
+
+            RecordData data;
+            std::memcpy(&data, record.body.data(), sizeof(data));
+
+            // Topics are declared in every segment before their first message
+            ASSERT_TRUE(declared[data.topic_id]);
+            ASSERT_EQ(data.topic_id, messages % 2);
+            ASSERT_EQ(data.payload_size, MESSAGE_SIZE);
+            ASSERT_EQ(record.body[sizeof(data)], static_cast<uint8_t>(messages));
+            ASSERT_GE(data.reception_timestamp, last_timestamp);
+            last_timestamp = data.reception_timestamp;
+
+            ASSERT_LT(index_position, index.size());
+            ASSERT_EQ(index[index_position].offset, record.offset);
+            ASSERT_EQ(index[index_position].topic_id, data.topic_id);
+            ASSERT_EQ(index[index_position].timestamp, data.reception_timestamp);
+            ++index_position;
+
+            ++messages;
+        }
+
+        ASSERT_EQ(index_position, index.size());
+    }
+
+    ASSERT_EQ(messages, MESSAGES);
+}
+
+/**
+ * Read a recording with a prefetch window smaller than the segments, as the Replayer Participant does.
+ */
+TEST(RecorderTest, segment_reader)
+{
+    constexpr uint32_t MESSAGES = 100;
+    constexpr uint32_t MESSAGE_SIZE = 30 * 1024;
+    constexpr uint64_t PREFETCH_SIZE = 64 * 1024;
+
+    const std::string directory = temporary_directory();
+    std::shared_ptr<ddspipe::core::PayloadPool> pool(new ddspipe::core::FastPayloadPool());
+
+    auto configuration = std::make_shared<RecorderParticipantConfiguration>();
+    configuration->id = "recorder";
+    configuration->output_directory = directory;
+    configuration->segment_size = SEGMENT_SIZE;
+
+    {
+        SegmentRecorder recorder(configuration, pool);
+        recorder.start();
+
+        const uint32_t topic = recorder.register_topic(make_topic("a"));
+
+        for (uint32_t i = 0; i < MESSAGES; ++i)
+        {
+            auto data = make_data(pool, static_cast<uint8_t>(i), MESSAGE_SIZE);
+            ASSERT_TRUE(recorder.record(topic, *data));
+        }
+
+        recorder.flush();
+    }
+
+    const auto segments = RecordSegmentReader::list_segments(directory);
+    ASSERT_EQ(segments, list_segments(directory));
+    ASSERT_GT(segments.size(), 1u);
+
+    uint32_t messages = 0;
+
+    for (const auto& path : segments)
+    {
+        RecordSegmentReader segment(path, PREFETCH_SIZE);
+
+        RecordType type;
+        const uint8_t* body;
+        uint32_t size;
+        bool declared = false;
+
+        while (segment.next(type, body, size))
+        {
+            if (type == RECORD_TOPIC)
+            {
+                declared = true;
+                continue;
+            }
+
+            ASSERT_EQ(type, RECORD_DATA);
+            ASSERT_TRUE(declared);
+
+            RecordData data;
+            ASSERT_GE(size, sizeof(data));
+            std::memcpy(&data, body, sizeof(data));
+            ASSERT_EQ(data.payload_size, MESSAGE_SIZE);
+            ASSERT_EQ(size, sizeof(data) + MESSAGE_SIZE);
+
+            // Every byte of the payload is the index of the message
+            const uint8_t* payload = body + sizeof(data);
+            ASSERT_EQ(payload[0], static_cast<uint8_t>(messages));
+            ASSERT_EQ(payload[MESSAGE_SIZE - 1], static_cast<uint8_t>(messages));
+
+            ++messages;
+        }
+    }
+
+    ASSERT_EQ(messages, MESSAGES);
+
+    // A directory that does not exist cannot be replayed
+    ASSERT_THROW(RecordSegmentReader::list_segments(directory + "/missing"), utils::InitializationException);
+}
+
+/**
+ * Messages are dropped instead of blocking when the queue reaches its maximum size.
+ */
+TEST(RecorderTest, recorder_queue_limit)
+{
+    std::shared_ptr<ddspipe::core::PayloadPool> pool(new ddspipe::core::FastPayloadPool());
+
+    auto configuration = std::make_shared<RecorderParticipantConfiguration>();
+    configuration->id = "recorder";
+    configuration->output_directory = temporary_directory();
+    configuration->max_pending_size = 1000;
+
+    // Not started, so nothing leaves the queue
+    SegmentRecorder recorder(configuration, pool);
+    const uint32_t topic = recorder.register_topic(make_topic("a"));
+
+    auto data = make_data(pool, 1, 600);
+    ASSERT_TRUE(recorder.record(topic, *data));
+    ASSERT_FALSE(recorder.record(topic, *data));
+
+    // A message bigger than a segment is never recorded
+    auto big_data = make_data(pool, 1, configuration->segment_size);
+    ASSERT_FALSE(recorder.record(topic, *big_data));
+
+    ASSERT_EQ(recorder.dropped(), 2u);
+}
+
+/**
+ * Check the validation of the recorder configuration.
+ */
+TEST(RecorderTest, configuration_is_valid)
+{
+    RecorderParticipantConfiguration configuration;
+    configuration.id = "recorder";
+
+    utils::Formatter error_msg;
+    ASSERT_TRUE(configuration.is_valid(error_msg));
+
+    configuration.output_directory = "";
+    ASSERT_FALSE(configuration.is_valid(error_msg));
+    configuration.output_directory = ".";
+
+    configuration.segment_size = 1024;
+    ASSERT_FALSE(configuration.is_valid(error_msg));
+    configuration.segment_size = SEGMENT_SIZE;
+
+    configuration.fsync_period = 0;
+    ASSERT_FALSE(configuration.is_valid(error_msg));
+    configuration.fsync_period = 1000;
+
+    configuration.max_pending_size = 0;
+    ASSERT_FALSE(configuration.is_valid(error_msg));
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
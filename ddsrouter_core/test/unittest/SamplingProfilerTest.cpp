@@ -0,0 +1,210 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file SamplingProfilerTest.cpp
+ *
+ */
+
+#include <signal.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <thread>
+
+#include <cpp_utils/exception/InitializationException.hpp>
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <ddsrouter_core/monitoring/SamplingProfiler.hpp>
+
+using namespace eprosima;
+using namespace eprosima::ddsrouter::core;
+
+namespace test {
+
+//! Configuration of short sessions sampling often, written in the working directory.
+ProfilerConfiguration configuration()
+{
+    ProfilerConfiguration configuration;
+    configuration.enabled = true;
+    configuration.duration = 300;
+    configuration.frequency = 1000;
+    configuration.output_directory = ".";
+    return configuration;
+}
+
+//! Keep the CPU busy in a thread tagged with \c tag until \c stop .
+void burn(
+        const char* tag,
+        const std::atomic<bool>& stop)
+{
+    SamplingProfiler::tag_thread(tag);
+
+    volatile uint64_t value = 0;
+    while (!stop)
+    {
+        value = value + 1;
+    }
+
+    SamplingProfiler::untag_thread();
+}
+
+//! Times that \c count_signal has handled a signal.
+std::atomic<int> signals_counted{0};
+
+void count_signal(
+        int /* signal */)
+{
+    ++signals_counted;
+}
+
+} /* namespace test */
+
+using namespace test;
+
+/**
+ * Test that a session writes the folded stacks of the threads running, with the tags of the threads as root frames.
+ */
+TEST(SamplingProfilerTest, folded_stacks)
+{
+    const std::string tag = SamplingProfiler::tag("participant;1", "topic");
+    ASSERT_EQ(tag, "participant participant:1;topic topic");
+
+    SamplingProfiler profiler(configuration());
+
+    std::atomic<bool> stop{false};
+    std::thread worker(burn, tag.c_str(), std::cref(stop));
+
+    const std::string path = profiler.profile();
+
+    stop = true;
+    worker.join();
+
+    ASSERT_FALSE(path.empty());
+
+    const ProfilerStatistics statistics = profiler.statistics();
+    ASSERT_EQ(statistics.sessions, 1u);
+    ASSERT_GT(statistics.samples, 0u);
+    ASSERT_EQ(statistics.last_profile, path);
+
+    // Every line is a stack and its samples, and the busy thread has its tag as root frames
+    std::ifstream file(path);
+    std::string line;
+    uint64_t samples = 0;
+    uint64_t tagged = 0;
+    while (std::getline(file, line))
+    {
+        const std::size_t separator = line.rfind(' ');
+        ASSERT_NE(separator, std::string::npos);
+
+        const uint64_t count = std::stoull(line.substr(separator + 1));
+        samples += count;
+        if (line.find(tag + ";") == 0)
+        {
+            tagged += count;
+        }
+    }
+    ASSERT_EQ(samples, statistics.samples);
+    ASSERT_GT(tagged, 0u);
+
+    std::remove(path.c_str());
+}
+
+/**
+ * Test that a frequency of one sample per second, whose period does not fit in the microseconds of the timer, samples.
+ */
+TEST(SamplingProfilerTest, one_sample_per_second)
+{
+    ProfilerConfiguration slow_configuration = configuration();
+    slow_configuration.frequency = 1;
+    slow_configuration.duration = 2500;
+    SamplingProfiler profiler(slow_configuration);
+
+    std::atomic<bool> stop{false};
+    std::thread worker(burn, "worker", std::cref(stop));
+
+    const std::string path = profiler.profile();
+
+    stop = true;
+    worker.join();
+
+    ASSERT_FALSE(path.empty());
+    ASSERT_GT(profiler.statistics().samples, 0u);
+
+    std::remove(path.c_str());
+}
+
+/**
+ * Test that a signal starts a session in the background, and that only one profiler may exist.
+ */
+TEST(SamplingProfilerTest, trigger_on_signal)
+{
+    SamplingProfiler profiler(configuration());
+    ASSERT_THROW(SamplingProfiler another(configuration()), utils::InitializationException);
+
+    profiler.trigger_on_signal(SIGUSR2);
+
+    std::atomic<bool> stop{false};
+    std::thread worker(burn, "worker", std::cref(stop));
+
+    raise(SIGUSR2);
+
+    const auto start = std::chrono::steady_clock::now();
+    while (profiler.statistics().sessions == 0 && std::chrono::steady_clock::now() - start < std::chrono::seconds(10))
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    stop = true;
+    worker.join();
+
+    ASSERT_EQ(profiler.statistics().sessions, 1u);
+
+    std::remove(profiler.statistics().last_profile.c_str());
+}
+
+/**
+ * Test that the handler of a signal before the profiler handles it is restored when the profiler is destroyed.
+ */
+TEST(SamplingProfilerTest, signal_handler_restored)
+{
+    struct sigaction action{};
+    struct sigaction previous{};
+    action.sa_handler = count_signal;
+    sigemptyset(&action.sa_mask);
+    ASSERT_EQ(sigaction(SIGUSR2, &action, &previous), 0);
+
+    {
+        SamplingProfiler profiler(configuration());
+        profiler.trigger_on_signal(SIGUSR2);
+    }
+
+    // Without the previous handler restored, the default action would terminate the process
+    raise(SIGUSR2);
+    ASSERT_EQ(signals_counted.load(), 1);
+
+    sigaction(SIGUSR2, &previous, nullptr);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,163 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ThreadConfigurationTest.cpp
+ *
+ */
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif // defined(__linux__)
+
+#include <string>
+#include <thread>
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <ddsrouter_core/configuration/ThreadConfiguration.hpp>
+#include <ddsrouter_core/core/ScopedThreadConfiguration.hpp>
+
+using namespace eprosima;
+using namespace eprosima::ddsrouter::core;
+
+#if defined(__linux__)
+
+namespace test {
+
+//! Settings of a thread, as seen from the thread itself.
+struct ThreadSettings
+{
+    std::string name;
+    cpu_set_t affinity;
+    int policy;
+};
+
+ThreadSettings current_settings()
+{
+    ThreadSettings settings;
+    char name[16] = {};
+    sched_param parameters{};
+
+    pthread_getname_np(pthread_self(), name, sizeof(name));
+    pthread_getaffinity_np(pthread_self(), sizeof(settings.affinity), &settings.affinity);
+    pthread_getschedparam(pthread_self(), &settings.policy, &parameters);
+
+    settings.name = name;
+    return settings;
+}
+
+//! Settings of a thread created by the calling thread.
+ThreadSettings new_thread_settings()
+{
+    ThreadSettings settings;
+    std::thread thread([&settings]()
+            {
+                settings = current_settings();
+            });
+    thread.join();
+    return settings;
+}
+
+} /* namespace test */
+
+/**
+ * Check that the threads created in the scope get its name, affinity and policy, and that the creator gets its
+ * previous settings back when the scope ends.
+ */
+TEST(ThreadConfigurationTest, threads_created_in_scope)
+{
+    const test::ThreadSettings previous = test::current_settings();
+
+    ThreadConfiguration configuration;
+    configuration.name = "ddsr-test";
+    configuration.affinity = {0};
+    configuration.policy = types::ThreadPolicy::batch;
+
+    {
+        ScopedThreadConfiguration scope(configuration);
+
+        const test::ThreadSettings created = test::new_thread_settings();
+        ASSERT_EQ(created.name, "ddsr-test");
+        ASSERT_EQ(CPU_COUNT(&created.affinity), 1);
+        ASSERT_TRUE(CPU_ISSET(0, &created.affinity));
+        ASSERT_EQ(created.policy, SCHED_BATCH);
+    }
+
+    const test::ThreadSettings restored = test::current_settings();
+    ASSERT_EQ(restored.name, previous.name);
+    ASSERT_TRUE(CPU_EQUAL(&restored.affinity, &previous.affinity));
+    ASSERT_EQ(restored.policy, previous.policy);
+
+    // Threads created after the scope are not configured
+    ASSERT_EQ(test::new_thread_settings().name, previous.name);
+}
+
+/**
+ * Check that an unset configuration leaves the threads as they are.
+ */
+TEST(ThreadConfigurationTest, unset_configuration)
+{
+    const test::ThreadSettings previous = test::current_settings();
+
+    ScopedThreadConfiguration scope{ThreadConfiguration()};
+
+    const test::ThreadSettings created = test::new_thread_settings();
+    ASSERT_EQ(created.name, previous.name);
+    ASSERT_TRUE(CPU_EQUAL(&created.affinity, &previous.affinity));
+    ASSERT_EQ(created.policy, previous.policy);
+}
+
+#endif // defined(__linux__)
+
+/**
+ * Check the limits of the names, affinities and priorities.
+ */
+TEST(ThreadConfigurationTest, invalid_configurations)
+{
+    utils::Formatter error_msg;
+
+    ThreadConfiguration configuration;
+    ASSERT_TRUE(configuration.is_valid(error_msg));
+    ASSERT_FALSE(configuration.is_set());
+
+    configuration.name = "sixteen_chars_xx";
+    ASSERT_FALSE(configuration.is_valid(error_msg));
+    configuration.name = "fifteen_chars_x";
+    ASSERT_TRUE(configuration.is_valid(error_msg));
+    ASSERT_TRUE(configuration.is_set());
+
+    configuration.affinity = {0, 1024};
+    ASSERT_FALSE(configuration.is_valid(error_msg));
+    configuration.affinity = {0, 1023};
+    ASSERT_TRUE(configuration.is_valid(error_msg));
+
+    // Real time policies require a priority, and the others do not accept it
+    configuration.policy = types::ThreadPolicy::fifo;
+    ASSERT_FALSE(configuration.is_valid(error_msg));
+    configuration.priority = 99;
+    ASSERT_TRUE(configuration.is_valid(error_msg));
+    configuration.policy = types::ThreadPolicy::batch;
+    ASSERT_FALSE(configuration.is_valid(error_msg));
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
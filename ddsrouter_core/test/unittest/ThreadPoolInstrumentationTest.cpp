@@ -0,0 +1,291 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ThreadPoolInstrumentationTest.cpp
+ *
+ */
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <ddspipe_core/interface/IReader.hpp>
+#include <ddspipe_core/interface/IRoutingData.hpp>
+#include <ddspipe_core/types/topic/dds/DdsTopic.hpp>
+
+#include <ddsrouter_core/efficiency/instrumentation/ThreadPoolInstrumentation.hpp>
+#include <ddsrouter_core/monitoring/producers/ThreadPoolMonitorProducer.hpp>
+#include <ddsrouter_core/participants/instrumentation/InstrumentedReader.hpp>
+
+using namespace eprosima;
+using namespace eprosima::ddsrouter::core;
+
+namespace test {
+
+//! Time that data waits before being taken.
+constexpr std::chrono::milliseconds QUEUE_TIME(20);
+
+//! Reader with \c samples messages to take, that notifies them when calling \c notify .
+class MockReader : public ddspipe::core::IReader
+{
+public:
+
+    void enable() noexcept override
+    {
+    }
+
+    void disable() noexcept override
+    {
+    }
+
+    void set_on_data_available_callback(
+            std::function<void()> on_data_available_lambda) noexcept override
+    {
+        callback = on_data_available_lambda;
+    }
+
+    void unset_on_data_available_callback() noexcept override
+    {
+        callback = nullptr;
+    }
+
+    utils::ReturnCode take(
+            std::unique_ptr<ddspipe::core::IRoutingData>& /* data */) noexcept override
+    {
+        if (samples == 0)
+        {
+            return utils::ReturnCode::RETCODE_NO_DATA;
+        }
+
+        --samples;
+        return utils::ReturnCode::RETCODE_OK;
+    }
+
+    ddspipe::core::types::Guid guid() const override
+    {
+        return ddspipe::core::types::Guid();
+    }
+
+    fastrtps::RecursiveTimedMutex& get_rtps_mutex() const override
+    {
+        return mutex;
+    }
+
+    uint64_t get_unread_count() const override
+    {
+        return samples;
+    }
+
+    ddspipe::core::types::DdsTopic topic() const override
+    {
+        return ddspipe::core::types::DdsTopic();
+    }
+
+    ddspipe::core::types::ParticipantId participant_id() const override
+    {
+        return "mock";
+    }
+
+    void notify(
+            uint64_t new_samples)
+    {
+        samples += new_samples;
+        callback();
+    }
+
+    std::atomic<uint64_t> samples{0};
+
+    std::function<void()> callback;
+
+    mutable fastrtps::RecursiveTimedMutex mutex;
+};
+
+} /* namespace test */
+
+using namespace test;
+
+/**
+ * Test that an instrumented reader counts its transmissions, their queue latency and their time.
+ */
+TEST(ThreadPoolInstrumentationTest, instrumented_reader)
+{
+    ThreadPoolInstrumentation instrumentation;
+    auto mock = std::make_shared<MockReader>();
+    InstrumentedReader reader(mock, instrumentation.register_slot("participant", "topic"));
+    reader.set_on_data_available_callback([]()
+            {
+            });
+
+    // Two notifications queue the slot twice, but the thread takes every message in a single transmission
+    mock->notify(2);
+    mock->notify(3);
+    std::this_thread::sleep_for(QUEUE_TIME);
+
+    std::unique_ptr<ddspipe::core::IRoutingData> data;
+    while (reader.take(data) == utils::ReturnCode::RETCODE_OK)
+    {
+    }
+
+    std::vector<SlotStatistics> statistics = instrumentation.statistics();
+    ASSERT_EQ(statistics.size(), 1u);
+    ASSERT_EQ(statistics[0].participant_id, "participant");
+    ASSERT_EQ(statistics[0].topic, "topic");
+    ASSERT_EQ(statistics[0].enqueued, 2u);
+    ASSERT_EQ(statistics[0].executed, 1u);
+    ASSERT_EQ(statistics[0].messages, 5u);
+    ASSERT_EQ(statistics[0].max_queue_depth, 5u);
+    ASSERT_GE(statistics[0].queue_latency_us, 20000u);
+    ASSERT_EQ(statistics[0].max_queue_latency_us, statistics[0].queue_latency_us);
+    const uint64_t max_queue_latency_us = statistics[0].max_queue_latency_us;
+
+    // A second transmission without data waiting, whose latency may round down to 0 microseconds
+    mock->notify(1);
+    while (reader.take(data) == utils::ReturnCode::RETCODE_OK)
+    {
+    }
+
+    statistics = instrumentation.statistics();
+    ASSERT_EQ(statistics[0].enqueued, 3u);
+    ASSERT_EQ(statistics[0].executed, 2u);
+    ASSERT_EQ(statistics[0].max_queue_latency_us, max_queue_latency_us);
+    ASSERT_GE(statistics[0].queue_latency_us, max_queue_latency_us);
+}
+
+/**
+ * Test that the counters of several slots updated from several threads add up.
+ */
+TEST(ThreadPoolInstrumentationTest, concurrent_slots)
+{
+    constexpr uint64_t TRANSMISSIONS = 10000;
+
+    ThreadPoolInstrumentation instrumentation;
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; ++i)
+    {
+        auto counters = instrumentation.register_slot("participant", "topic_" + std::to_string(i));
+        threads.emplace_back(
+            [counters]()
+            {
+                for (uint64_t transmission = 1; transmission <= TRANSMISSIONS; ++transmission)
+                {
+                    counters->record_enqueue(transmission);
+                    counters->record_start(1);
+                    counters->record_end(2);
+                }
+            });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    std::vector<SlotStatistics> statistics = instrumentation.statistics();
+    ASSERT_EQ(statistics.size(), 4u);
+    for (const auto& slot : statistics)
+    {
+        ASSERT_EQ(slot.enqueued, TRANSMISSIONS);
+        ASSERT_EQ(slot.executed, TRANSMISSIONS);
+        ASSERT_EQ(slot.max_queue_depth, TRANSMISSIONS);
+        ASSERT_EQ(slot.queue_latency_us, TRANSMISSIONS);
+        ASSERT_EQ(slot.task_time_us, 2 * TRANSMISSIONS);
+        ASSERT_EQ(slot.max_task_time_us, 2u);
+    }
+}
+
+/**
+ * Test that a reader created again for the same participant and topic keeps counting in the same slot.
+ */
+TEST(ThreadPoolInstrumentationTest, slot_reused)
+{
+    ThreadPoolInstrumentation instrumentation;
+
+    auto counters = instrumentation.register_slot("participant", "topic");
+    counters->record_enqueue(1);
+
+    // Recreating the reader many times does not grow the registry
+    for (int i = 0; i < 100; ++i)
+    {
+        ASSERT_EQ(instrumentation.register_slot("participant", "topic"), counters);
+    }
+    instrumentation.register_slot("participant", "topic")->record_enqueue(1);
+
+    // Another topic or participant gets a slot of its own
+    ASSERT_NE(instrumentation.register_slot("participant", "other_topic"), counters);
+    ASSERT_NE(instrumentation.register_slot("other_participant", "topic"), counters);
+
+    std::vector<SlotStatistics> statistics = instrumentation.statistics();
+    ASSERT_EQ(statistics.size(), 3u);
+    ASSERT_EQ(statistics[0].participant_id, "participant");
+    ASSERT_EQ(statistics[0].topic, "topic");
+    ASSERT_EQ(statistics[0].enqueued, 2u);
+    ASSERT_EQ(statistics[1].topic, "other_topic");
+    ASSERT_EQ(statistics[2].participant_id, "other_participant");
+}
+
+/**
+ * Test that the monitor producer produces the counters of each period.
+ */
+TEST(ThreadPoolInstrumentationTest, monitor_producer)
+{
+    auto instrumentation = std::make_shared<ThreadPoolInstrumentation>();
+    auto counters = instrumentation->register_slot("participant", "topic");
+    ThreadPoolMonitorProducer producer(instrumentation, 0);
+
+    counters->record_enqueue(1);
+    counters->record_start(10);
+    counters->record_end(100);
+    producer.produce_and_consume();
+
+    std::vector<SlotStatistics> data = producer.data();
+    ASSERT_EQ(data.size(), 1u);
+    ASSERT_EQ(data[0].executed, 1u);
+    ASSERT_EQ(data[0].task_time_us, 100u);
+
+    counters->record_enqueue(1);
+    counters->record_start(10);
+    counters->record_end(50);
+    counters->record_enqueue(1);
+    counters->record_start(10);
+    counters->record_end(50);
+    producer.produce_and_consume();
+
+    data = producer.data();
+    ASSERT_EQ(data[0].enqueued, 2u);
+    ASSERT_EQ(data[0].executed, 2u);
+    ASSERT_EQ(data[0].queue_latency_us, 20u);
+    ASSERT_EQ(data[0].task_time_us, 100u);
+    ASSERT_EQ(data[0].max_task_time_us, 100u);
+
+    // Periods without transmissions produce no counters
+    producer.produce_and_consume();
+    ASSERT_EQ(producer.data()[0].executed, 0u);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
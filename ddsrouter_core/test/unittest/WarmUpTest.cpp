@@ -0,0 +1,291 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file WarmUpTest.cpp
+ *
+ */
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <ddspipe_core/interface/IParticipant.hpp>
+#include <ddspipe_core/interface/IReader.hpp>
+#include <ddspipe_core/interface/IRoutingData.hpp>
+#include <ddspipe_core/interface/IWriter.hpp>
+
+#include <ddsrouter_core/efficiency/lazy/LazyWriterEngine.hpp>
+#include <ddsrouter_core/efficiency/warmup/TopicReadinessTracker.hpp>
+#include <ddsrouter_core/participants/lazy/LazyParticipant.hpp>
+#include <ddsrouter_core/participants/warmup/ReadinessParticipant.hpp>
+
+using namespace eprosima;
+using namespace eprosima::ddsrouter::core;
+
+namespace test {
+
+//! Topic whose endpoints can not be created.
+constexpr const char* FAILING_TOPIC = "failing";
+
+//! Time that the creation of an endpoint takes.
+constexpr std::chrono::milliseconds CREATION_TIME(5);
+
+class MockWriter : public ddspipe::core::IWriter
+{
+public:
+
+    void enable() noexcept override
+    {
+    }
+
+    void disable() noexcept override
+    {
+    }
+
+    utils::ReturnCode write(
+            ddspipe::core::IRoutingData& /* data */) noexcept override
+    {
+        return utils::ReturnCode::RETCODE_OK;
+    }
+};
+
+class MockReader : public ddspipe::core::IReader
+{
+public:
+
+    void enable() noexcept override
+    {
+    }
+
+    void disable() noexcept override
+    {
+    }
+
+    void set_on_data_available_callback(
+            std::function<void()> /* on_data_available_lambda */) noexcept override
+    {
+    }
+
+    void unset_on_data_available_callback() noexcept override
+    {
+    }
+
+    utils::ReturnCode take(
+            std::unique_ptr<ddspipe::core::IRoutingData>& /* data */) noexcept override
+    {
+        return utils::ReturnCode::RETCODE_NO_DATA;
+    }
+
+    ddspipe::core::types::Guid guid() const override
+    {
+        return ddspipe::core::types::Guid();
+    }
+
+    fastrtps::RecursiveTimedMutex& get_rtps_mutex() const override
+    {
+        return mutex_;
+    }
+
+    uint64_t get_unread_count() const override
+    {
+        return 0;
+    }
+
+    ddspipe::core::types::DdsTopic topic() const override
+    {
+        return ddspipe::core::types::DdsTopic();
+    }
+
+    ddspipe::core::types::ParticipantId participant_id() const override
+    {
+        return "mock";
+    }
+
+protected:
+
+    mutable fastrtps::RecursiveTimedMutex mutex_;
+};
+
+//! Participant whose endpoints take \c CREATION_TIME to be created, and fail in \c FAILING_TOPIC .
+class MockParticipant : public ddspipe::core::IParticipant
+{
+public:
+
+    ddspipe::core::types::ParticipantId id() const noexcept override
+    {
+        return "mock";
+    }
+
+    bool is_repeater() const noexcept override
+    {
+        return false;
+    }
+
+    bool is_rtps_kind() const noexcept override
+    {
+        return false;
+    }
+
+    ddspipe::core::types::TopicQoS topic_qos() const noexcept override
+    {
+        return ddspipe::core::types::TopicQoS();
+    }
+
+    std::shared_ptr<ddspipe::core::IWriter> create_writer(
+            const ddspipe::core::ITopic& topic) override
+    {
+        std::this_thread::sleep_for(CREATION_TIME);
+
+        if (topic.topic_name() == FAILING_TOPIC)
+        {
+            throw std::runtime_error("failing topic");
+        }
+
+        ++writers;
+        return std::make_shared<MockWriter>();
+    }
+
+    std::shared_ptr<ddspipe::core::IReader> create_reader(
+            const ddspipe::core::ITopic& /* topic */) override
+    {
+        std::this_thread::sleep_for(CREATION_TIME);
+
+        ++readers;
+        return std::make_shared<MockReader>();
+    }
+
+    std::atomic<uint64_t> writers{0};
+    std::atomic<uint64_t> readers{0};
+};
+
+ddspipe::core::types::DdsTopic topic(
+        const std::string& name)
+{
+    ddspipe::core::types::DdsTopic topic;
+    topic.m_topic_name = name;
+    topic.type_name = "type";
+    return topic;
+}
+
+} /* namespace test */
+
+using namespace test;
+
+/**
+ * Check that warming up creates the lazy writers of the given topics only, and counts the ones that fail.
+ */
+TEST(WarmUpTest, warm_up_lazy_writers)
+{
+    auto participant = std::make_shared<MockParticipant>();
+    auto engine = std::make_shared<LazyWriterEngine>(0);
+    LazyParticipant lazy_participant(participant, engine);
+
+    std::vector<std::shared_ptr<ddspipe::core::IWriter>> writers;
+    for (int i = 0; i < 6; ++i)
+    {
+        writers.push_back(lazy_participant.create_writer(topic("builtin")));
+    }
+    writers.push_back(lazy_participant.create_writer(topic("discovered")));
+    writers.push_back(lazy_participant.create_writer(topic(FAILING_TOPIC)));
+
+    ASSERT_EQ(participant->writers, 0u);
+
+    ASSERT_EQ(engine->warm_up({"builtin", FAILING_TOPIC}), 1u);
+    ASSERT_EQ(participant->writers, 6u);
+    ASSERT_EQ(engine->statistics().active, 6u);
+
+    // Writers already created are not created again
+    ASSERT_EQ(engine->warm_up({"builtin"}), 0u);
+    ASSERT_EQ(participant->writers, 6u);
+}
+
+/**
+ * Check the readiness of topics with every endpoint created, with endpoints that failed, and without endpoints.
+ */
+TEST(WarmUpTest, topic_readiness)
+{
+    auto participant = std::make_shared<MockParticipant>();
+    auto tracker = std::make_shared<TopicReadinessTracker>();
+    ReadinessParticipant readiness_participant(participant, tracker);
+
+    readiness_participant.create_reader(topic("ready"));
+    readiness_participant.create_writer(topic("ready"));
+    readiness_participant.create_reader(topic(FAILING_TOPIC));
+    ASSERT_THROW(readiness_participant.create_writer(topic(FAILING_TOPIC)), std::runtime_error);
+
+    const auto readiness = tracker->readiness({"ready", FAILING_TOPIC, "unknown"});
+    ASSERT_EQ(readiness.size(), 3u);
+
+    // Sorted by name
+    const TopicReadiness& failing = readiness[0];
+    const TopicReadiness& ready = readiness[1];
+    const TopicReadiness& unknown = readiness[2];
+
+    ASSERT_EQ(ready.topic, "ready");
+    ASSERT_TRUE(ready.ready);
+    ASSERT_EQ(ready.readers, 1u);
+    ASSERT_EQ(ready.writers, 1u);
+    ASSERT_GE(ready.creation_ms, 2 * CREATION_TIME.count());
+    ASSERT_GE(ready.ready_ms, ready.creation_ms);
+
+    ASSERT_EQ(failing.topic, FAILING_TOPIC);
+    ASSERT_FALSE(failing.ready);
+    ASSERT_EQ(failing.readers, 1u);
+    ASSERT_EQ(failing.failed, 1u);
+
+    ASSERT_EQ(unknown.topic, "unknown");
+    ASSERT_FALSE(unknown.ready);
+}
+
+/**
+ * Check that lazy writers only count as created once they are warmed up, when the readiness decorator is the
+ * innermost one as in the DDS Router.
+ */
+TEST(WarmUpTest, readiness_of_lazy_writers)
+{
+    auto participant = std::make_shared<MockParticipant>();
+    auto tracker = std::make_shared<TopicReadinessTracker>();
+    auto engine = std::make_shared<LazyWriterEngine>(0);
+    LazyParticipant lazy_participant(std::make_shared<ReadinessParticipant>(participant, tracker), engine);
+
+    auto reader = lazy_participant.create_reader(topic("builtin"));
+    auto writer = lazy_participant.create_writer(topic("builtin"));
+
+    ASSERT_EQ(tracker->readiness({"builtin"})[0].writers, 0u);
+
+    engine->warm_up({"builtin"});
+
+    const TopicReadiness readiness = tracker->readiness({"builtin"})[0];
+    ASSERT_TRUE(readiness.ready);
+    ASSERT_EQ(readiness.readers, 1u);
+    ASSERT_EQ(readiness.writers, 1u);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
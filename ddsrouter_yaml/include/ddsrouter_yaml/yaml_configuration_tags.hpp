@@ -0,0 +1,164 @@
+// Copyright 2024 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file yaml_configuration_tags.hpp
+ *
+ * Tags of the DDS Router specific configuration. Tags shared with other DDS Pipe applications are in
+ * <ddspipe_yaml/yaml_configuration_tags.hpp> .
+ */
+
+#pragma once
+
+namespace eprosima {
+namespace ddsrouter {
+namespace yaml {
+
+// Threads related tags
+constexpr const char* THREADS_NUMBER_TAG("number");                        //! Number of threads of the pool
+constexpr const char* THREADS_MIN_TAG("min-threads");                      //! Minimum threads forwarding at once
+constexpr const char* THREADS_MAX_TAG("max-threads");                      //! Maximum threads forwarding at once
+constexpr const char* THREADS_TARGET_LATENCY_TAG("target-queue-latency");  //! Target wait of data for a thread (us)
+constexpr const char* THREADS_FORWARDING_TAG("forwarding");                //! Threads of the pool
+constexpr const char* THREADS_PARTICIPANTS_TAG("participants");            //! Threads of the participants
+constexpr const char* THREADS_HOUSEKEEPING_TAG("housekeeping");            //! Threads of internal tasks
+constexpr const char* THREAD_NAME_TAG("name");                             //! Name of the threads
+constexpr const char* THREAD_AFFINITY_TAG("affinity");                     //! CPUs where the threads run
+constexpr const char* THREAD_POLICY_TAG("policy");                         //! Scheduling policy of the threads
+constexpr const char* THREAD_PRIORITY_TAG("priority");                     //! Priority in real time policies
+
+// Binary log related tags
+constexpr const char* BINARY_LOG_TAG("binary");                            //! Binary log of the hot paths
+constexpr const char* BINARY_LOG_ENABLE_TAG("enable");                     //! Enable the binary log
+constexpr const char* BINARY_LOG_BUFFER_SIZE_TAG("buffer-size");           //! Bytes of the buffer of each thread
+constexpr const char* BINARY_LOG_PERIOD_TAG("period");                     //! Period in ms to write the entries
+constexpr const char* BINARY_LOG_OUTPUT_DIRECTORY_TAG("output-directory"); //! Directory of the binary log written
+
+// Log throttle related tags
+constexpr const char* LOG_THROTTLE_TAG("throttle");                        //! List of log throttle rules
+constexpr const char* LOG_THROTTLE_CATEGORY_TAG("category");               //! Categories limited by the rule
+constexpr const char* LOG_THROTTLE_MAX_PER_SECOND_TAG("max-per-second");   //! Entries per second of each call site
+
+// Thread pool monitor related tags
+constexpr const char* THREAD_POOL_MONITOR_TAG("thread-pool");              //! Monitor of the thread pool
+constexpr const char* THREAD_POOL_MONITOR_ENABLE_TAG("enable");            //! Enable the thread pool monitor
+constexpr const char* THREAD_POOL_MONITOR_PERIOD_TAG("period");            //! Period in ms of the thread pool monitor
+
+// Metrics exporter related tags
+constexpr const char* METRICS_EXPORTER_TAG("prometheus");                  //! HTTP endpoint of the metrics
+constexpr const char* METRICS_EXPORTER_ENABLE_TAG("enable");               //! Enable the metrics exporter
+constexpr const char* METRICS_EXPORTER_ADDRESS_TAG("address");             //! IPv4 address where the metrics are served
+constexpr const char* METRICS_EXPORTER_PORT_TAG("port");                   //! TCP port where the metrics are served
+constexpr const char* METRICS_EXPORTER_PERIOD_TAG("period");               //! Period in ms of the metrics snapshots
+
+// Profiler related tags
+constexpr const char* PROFILER_TAG("profiler");                            //! Sampling profiler started on demand
+constexpr const char* PROFILER_ENABLE_TAG("enable");                       //! Enable the profiling sessions
+constexpr const char* PROFILER_DURATION_TAG("duration");                   //! Duration in ms of each profiling session
+constexpr const char* PROFILER_FREQUENCY_TAG("frequency");                 //! Samples per second of CPU time
+constexpr const char* PROFILER_OUTPUT_DIRECTORY_TAG("output-directory");   //! Directory of the profiles written
+
+// Tracing related tags
+constexpr const char* TRACING_TAG("tracing");                              //! Tracing of the stages of the samples
+constexpr const char* TRACING_ENABLE_TAG("enable");                        //! Enable the tracing of readers and writers
+constexpr const char* TRACING_TOPICS_TAG("topics");                        //! Topics traced
+constexpr const char* TRACING_BUFFER_SIZE_TAG("buffer-size");              //! Events kept by each thread
+constexpr const char* TRACING_OUTPUT_DIRECTORY_TAG("output-directory");    //! Directory of the traces written
+
+// Content filters related tags
+constexpr const char* CONTENT_FILTERS_TAG("content-filters");              //! List of content filter rules
+constexpr const char* CONTENT_FILTER_TOPIC_TAG("topic");                   //! Topic filter of the rule
+constexpr const char* CONTENT_FILTER_PARTICIPANT_TAG("participant");       //! Participant whose samples are filtered
+constexpr const char* CONTENT_FILTER_EXPRESSION_TAG("expression");         //! Filter expression
+constexpr const char* CONTENT_FILTER_PARAMETERS_TAG("parameters");         //! Values of the parameters of the expression
+constexpr const char* CONTENT_FILTER_FIELDS_TAG("fields");                 //! Layout of the type filtered
+
+// Projections related tags
+constexpr const char* PROJECTIONS_TAG("projections");                      //! List of projection rules
+constexpr const char* PROJECTION_TOPIC_TAG("topic");                       //! Topic filter of the rule
+constexpr const char* PROJECTION_PARTICIPANT_TAG("participant");           //! Participant whose writers project
+constexpr const char* PROJECTION_STRIP_TAG("strip");                       //! Fields removed from the samples
+constexpr const char* PROJECTION_FIELDS_TAG("fields");                     //! Layout of the type projected
+constexpr const char* PROJECTION_TYPE_TAG("derived-type");                 //! Name of the derived type
+
+// CDR layout related tags
+constexpr const char* CDR_FIELD_NAME_TAG("name");                          //! Name of a field of the type
+constexpr const char* CDR_FIELD_TYPE_TAG("type");                          //! Type of a field of the type
+
+// Rate limits related tags
+constexpr const char* RATE_LIMITS_TAG("rate-limits");      //! List of rate limit rules
+constexpr const char* RATE_LIMIT_SCOPE_TAG("scope");       //! Entity shaped by the rule: topic, participant or route
+constexpr const char* RATE_LIMIT_TOPIC_TAG("topic");       //! Topic filter of the rule
+constexpr const char* RATE_LIMIT_PARTICIPANT_TAG("participant");   //! Participant shaped by a participant rule
+constexpr const char* RATE_LIMIT_SOURCE_TAG("src");        //! Source participant of a route rule
+constexpr const char* RATE_LIMIT_DESTINATION_TAG("dst");   //! Destination participant of a route rule
+constexpr const char* RATE_LIMIT_MAX_MSGS_TAG("max-msgs-per-second");      //! Maximum messages per second
+constexpr const char* RATE_LIMIT_MAX_BYTES_TAG("max-bytes-per-second");    //! Maximum bytes per second
+constexpr const char* RATE_LIMIT_BURST_MSGS_TAG("burst-msgs");             //! Maximum messages in a burst
+constexpr const char* RATE_LIMIT_BURST_BYTES_TAG("burst-bytes");           //! Maximum bytes in a burst
+constexpr const char* RATE_LIMIT_PER_INSTANCE_TAG("per-instance");         //! Share the limit between instances
+
+// Lazy writers related tags
+constexpr const char* LAZY_WRITERS_TAG("lazy-writers");                    //! Create writers with the first message
+constexpr const char* WRITERS_IDLE_TTL_TAG("writers-idle-ttl");            //! Time in ms to destroy idle writers
+
+// Discovery related tags
+constexpr const char* DISCOVERY_BATCH_PERIOD_TAG("discovery-batch-period"); //! Time in ms to gather discovery events
+constexpr const char* DISCOVERY_CACHE_TAG("discovery-cache");              //! File to persist the endpoints discovered
+constexpr const char* DISCOVERY_CACHE_TTL_TAG("discovery-cache-ttl");      //! Time in ms to discover cached endpoints
+
+// Warm up related tags
+constexpr const char* WARM_UP_TAG("warm-up");                              //! Create builtin topic endpoints on start
+
+// Preallocated histories related tags
+constexpr const char* PREALLOCATE_HISTORIES_TAG("preallocate-histories");  //! Reserve history payloads on creation
+constexpr const char* MAX_SAMPLE_SIZE_TAG("max-sample-size");              //! Size in bytes of the payloads reserved
+
+// IPC participant related tags
+constexpr const char* IPC_CHANNEL_TAG("channel");                          //! Name of the shared memory channel
+constexpr const char* IPC_RING_SIZE_TAG("ring-size");                      //! Size in bytes of each ring
+constexpr const char* IPC_MAX_BLOCKING_TIME_TAG("max-blocking-time");      //! Maximum wait in ms for a full ring
+
+// In process participant related tags
+constexpr const char* INPROCESS_CHANNEL_TAG("channel");                    //! Name of the application channel
+
+// Recorder participant related tags
+constexpr const char* RECORDER_OUTPUT_DIRECTORY_TAG("output-directory");   //! Directory of the segment files
+constexpr const char* RECORDER_SEGMENT_SIZE_TAG("segment-size");           //! Maximum size in bytes of a segment
+constexpr const char* RECORDER_FSYNC_PERIOD_TAG("fsync-period");           //! Period in ms of the flushes to disk
+constexpr const char* RECORDER_MAX_PENDING_SIZE_TAG("max-pending-size");   //! Maximum bytes waiting to be written
+
+// Replayer participant related tags
+constexpr const char* REPLAYER_INPUT_DIRECTORY_TAG("input-directory");     //! Directory of the segment files
+constexpr const char* REPLAYER_SPEED_TAG("speed");                         //! Speed relative to the original timing
+constexpr const char* REPLAYER_PREFETCH_SIZE_TAG("prefetch-size");         //! Bytes read ahead of the replay
+
+// Generator participant related tags
+constexpr const char* GENERATOR_TOPICS_TAG("topics");                      //! List of generated topics
+constexpr const char* GENERATOR_TOPIC_NAME_TAG("name");                    //! Name of a generated topic
+constexpr const char* GENERATOR_TOPIC_TYPE_TAG("type");                    //! Type of a generated topic
+constexpr const char* GENERATOR_RATE_TAG("rate");                          //! Messages per second
+constexpr const char* GENERATOR_SIZE_TAG("size");                          //! Size in bytes of the messages
+constexpr const char* GENERATOR_MAX_SIZE_TAG("max-size");                  //! Maximum size in bytes of the messages
+constexpr const char* GENERATOR_KEYS_TAG("keys");                          //! Number of instances
+constexpr const char* GENERATOR_BURST_TAG("burst");                        //! Messages generated at once
+constexpr const char* GENERATOR_SAMPLES_TAG("samples");                    //! Total messages to generate
+
+// Sink participant related tags
+constexpr const char* SINK_REPORT_PERIOD_TAG("report-period");             //! Period in ms of the reports
+constexpr const char* SINK_CHECK_SEQUENCE_TAG("check-sequence");           //! Check continuity of generated messages
+
+} /* namespace yaml */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -12,6 +12,8 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <limits>
+
 #include <ddspipe_participants/configuration/DiscoveryServerParticipantConfiguration.hpp>
 #include <ddspipe_participants/configuration/EchoParticipantConfiguration.hpp>
 #include <ddspipe_participants/configuration/InitialPeersParticipantConfiguration.hpp>
@@ -26,13 +28,527 @@
 
 #include <ddspipe_core/configuration/DdsPipeConfiguration.hpp>
 #include <ddspipe_core/configuration/MonitorConfiguration.hpp>
+#include <ddsrouter_core/configuration/BinaryLogConfiguration.hpp>
+#include <ddsrouter_core/configuration/CdrFieldConfiguration.hpp>
+#include <ddsrouter_core/configuration/ContentFilterConfiguration.hpp>
+#include <ddsrouter_core/configuration/ProjectionConfiguration.hpp>
 #include <ddsrouter_core/configuration/DdsRouterConfiguration.hpp>
+#include <ddsrouter_core/configuration/GeneratedTopicConfiguration.hpp>
+#include <ddsrouter_core/configuration/GeneratorParticipantConfiguration.hpp>
+#include <ddsrouter_core/configuration/InProcessParticipantConfiguration.hpp>
+#include <ddsrouter_core/configuration/IpcParticipantConfiguration.hpp>
+#include <ddsrouter_core/configuration/LogThrottleConfiguration.hpp>
+#include <ddsrouter_core/configuration/MetricsExporterConfiguration.hpp>
+#include <ddsrouter_core/configuration/ProfilerConfiguration.hpp>
+#include <ddsrouter_core/configuration/RecorderParticipantConfiguration.hpp>
+#include <ddsrouter_core/configuration/ReplayerParticipantConfiguration.hpp>
+#include <ddsrouter_core/configuration/SinkParticipantConfiguration.hpp>
+#include <ddsrouter_core/configuration/TracingConfiguration.hpp>
+
+#include <ddsrouter_yaml/yaml_configuration_tags.hpp>
+#include <ddsrouter_yaml/YamlReaderConfiguration.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace yaml {
+
+template <>
+void YamlReader::fill(
+        ddsrouter::core::RateLimitConfiguration& object,
+        const Yaml& yml,
+        const YamlReaderVersion version)
+{
+    /////
+    // Get optional scope. If not present, deduce it from the participants given
+    if (YamlReader::is_tag_present(yml, ddsrouter::yaml::RATE_LIMIT_SCOPE_TAG))
+    {
+        const std::string scope = YamlReader::get<std::string>(yml, ddsrouter::yaml::RATE_LIMIT_SCOPE_TAG, version);
+
+        if (!ddsrouter::core::types::string_to_enumeration(scope, object.scope))
+        {
+            throw eprosima::utils::ConfigurationException(
+                      utils::Formatter() << "The rate limit scope " << scope << " is not valid.");
+        }
+    }
+    else if (YamlReader::is_tag_present(yml, ddsrouter::yaml::RATE_LIMIT_PARTICIPANT_TAG))
+    {
+        object.scope = ddsrouter::core::types::RateLimitScope::participant;
+    }
+    else if (YamlReader::is_tag_present(yml, ddsrouter::yaml::RATE_LIMIT_SOURCE_TAG) ||
+            YamlReader::is_tag_present(yml, ddsrouter::yaml::RATE_LIMIT_DESTINATION_TAG))
+    {
+        object.scope = ddsrouter::core::types::RateLimitScope::route;
+    }
+
+    /////
+    // Get optional topic filter
+    if (YamlReader::is_tag_present(yml, ddsrouter::yaml::RATE_LIMIT_TOPIC_TAG))
+    {
+        object.topic = YamlReader::get<core::types::WildcardDdsFilterTopic>(yml, ddsrouter::yaml::RATE_LIMIT_TOPIC_TAG,
+                        version);
+    }
+
+    /////
+    // Get optional participants
+    if (YamlReader::is_tag_present(yml, ddsrouter::yaml::RATE_LIMIT_PARTICIPANT_TAG))
+    {
+        object.participant_id = YamlReader::get<std::string>(yml, ddsrouter::yaml::RATE_LIMIT_PARTICIPANT_TAG,
+                        version);
+    }
+
+    if (YamlReader::is_tag_present(yml, ddsrouter::yaml::RATE_LIMIT_SOURCE_TAG))
+    {
+        object.source_participant_id = YamlReader::get<std::string>(yml, ddsrouter::yaml::RATE_LIMIT_SOURCE_TAG,
+                        version);
+    }
+
+    if (YamlReader::is_tag_present(yml, ddsrouter::yaml::RATE_LIMIT_DESTINATION_TAG))
+    {
+        object.destination_participant_id = YamlReader::get<std::string>(yml,
+                        ddsrouter::yaml::RATE_LIMIT_DESTINATION_TAG, version);
+    }
+
+    /////
+    // Get optional limits
+    if (YamlReader::is_tag_present(yml, ddsrouter::yaml::RATE_LIMIT_MAX_MSGS_TAG))
+    {
+        object.max_msgs_per_second = YamlReader::get<float>(yml, ddsrouter::yaml::RATE_LIMIT_MAX_MSGS_TAG, version);
+    }
+
+    if (YamlReader::is_tag_present(yml, ddsrouter::yaml::RATE_LIMIT_MAX_BYTES_TAG))
+    {
+        object.max_bytes_per_second = YamlReader::get<float>(yml, ddsrouter::yaml::RATE_LIMIT_MAX_BYTES_TAG,
+                        version);
+    }
+
+    if (YamlReader::is_tag_present(yml, ddsrouter::yaml::RATE_LIMIT_BURST_MSGS_TAG))
+    {
+        object.burst_msgs = YamlReader::get<unsigned int>(yml, ddsrouter::yaml::RATE_LIMIT_BURST_MSGS_TAG, version);
+    }
+
+    if (YamlReader::is_tag_present(yml, ddsrouter::yaml::RATE_LIMIT_BURST_BYTES_TAG))
+    {
+        object.burst_bytes = YamlReader::get<unsigned int>(yml, ddsrouter::yaml::RATE_LIMIT_BURST_BYTES_TAG,
+                        version);
+    }
+
+    /////
+    // Get optional per instance tag
+    if (YamlReader::is_tag_present(yml, ddsrouter::yaml::RATE_LIMIT_PER_INSTANCE_TAG))
+    {
+        object.per_instance = YamlReader::get<bool>(yml, ddsrouter::yaml::RATE_LIMIT_PER_INSTANCE_TAG, version);
+    }
+}
+
+template <>
+ddsrouter::core::RateLimitConfiguration YamlReader::get<ddsrouter::core::RateLimitConfiguration>(
+        const Yaml& yml,
+        const YamlReaderVersion version)
+{
+    ddsrouter::core::RateLimitConfiguration object;
+    fill<ddsrouter::core::RateLimitConfiguration>(object, yml, version);
+    return object;
+}
+
+template <>
+void YamlReader::fill(
+        ddsrouter::core::CdrFieldConfiguration& object,
+        const Yaml& yml,
+        const YamlReaderVersion version)
+{
+    /////
+    // Get required name
+    object.name = YamlReader::get<std::string>(yml, ddsrouter::yaml::CDR_FIELD_NAME_TAG, version);
+
+    /////
+    // Get required type
+    object.type = YamlReader::get<std::string>(yml, ddsrouter::yaml::CDR_FIELD_TYPE_TAG, version);
+}
+
+template <>
+ddsrouter::core::CdrFieldConfiguration YamlReader::get<ddsrouter::core::CdrFieldConfiguration>(
+        const Yaml& yml,
+        const YamlReaderVersion version)
+{
+    ddsrouter::core::CdrFieldConfiguration object;
+    fill<ddsrouter::core::CdrFieldConfiguration>(object, yml, version);
+    return object;
+}
+
+template <>
+void YamlReader::fill(
+        ddsrouter::core::ContentFilterConfiguration& object,
+        const Yaml& yml,
+        const YamlReaderVersion version)
+{
+    /////
+    // Get optional topic filter
+    if (YamlReader::is_tag_present(yml, ddsrouter::yaml::CONTENT_FILTER_TOPIC_TAG))
+    {
+        object.topic = YamlReader::get<core::types::WildcardDdsFilterTopic>(yml,
+                        ddsrouter::yaml::CONTENT_FILTER_TOPIC_TAG, version);
+    }
+
+    /////
+    // Get optional participant
+    if (YamlReader::is_tag_present(yml, ddsrouter::yaml::CONTENT_FILTER_PARTICIPANT_TAG))
+    {
+        object.participant_id = YamlReader::get<std::string>(yml, ddsrouter::yaml::CONTENT_FILTER_PARTICIPANT_TAG,
+                        version);
+    }
+
+    /////
+    // Get required expression
+    object.expression = YamlReader::get<std::string>(yml, ddsrouter::yaml::CONTENT_FILTER_EXPRESSION_TAG, version);
+
+    /////
+    // Get optional parameters
+    if (YamlReader::is_tag_present(yml, ddsrouter::yaml::CONTENT_FILTER_PARAMETERS_TAG))
+    {
+        const auto& parameters = YamlReader::get_list<std::string>(yml,
+                        ddsrouter::yaml::CONTENT_FILTER_PARAMETERS_TAG, version);
+        object.parameters = std::vector<std::string>(parameters.begin(), parameters.end());
+    }
+
+    /////
+    // Get required fields
+    const auto& fields = YamlReader::get_list<ddsrouter::core::CdrFieldConfiguration>(yml,
+                    ddsrouter::yaml::CONTENT_FILTER_FIELDS_TAG, version);
+    object.fields = std::vector<ddsrouter::core::CdrFieldConfiguration>(fields.begin(), fields.end());
+}
+
+template <>
+ddsrouter::core::ContentFilterConfiguration YamlReader::get<ddsrouter::core::ContentFilterConfiguration>(
+        const Yaml& yml,
+        const YamlReaderVersion version)
+{
+    ddsrouter::core::ContentFilterConfiguration object;
+    fill<ddsrouter::core::ContentFilterConfiguration>(object, yml, version);
+    return object;
+}
+
+template <>
+void YamlReader::fill(
+        ddsrouter::core::ProjectionConfiguration& object,
+        const Yaml& yml,
+        const YamlReaderVersion version)
+{
+    /////
+    // Get optional topic filter
+    if (YamlReader::is_tag_present(yml, ddsrouter::yaml::PROJECTION_TOPIC_TAG))
+    {
+        object.topic = YamlReader::get<core::types::WildcardDdsFilterTopic>(yml,
+                        ddsrouter::yaml::PROJECTION_TOPIC_TAG, version);
+    }
+
+    /////
+    // Get optional participant
+    if (YamlReader::is_tag_present(yml, ddsrouter::yaml::PROJECTION_PARTICIPANT_TAG))
+    {
+        object.participant_id = YamlReader::get<std::string>(yml, ddsrouter::yaml::PROJECTION_PARTICIPANT_TAG,
+                        version);
+    }
+
+    /////
+    // Get required fields stripped
+    const auto& strip = YamlReader::get_list<std::string>(yml, ddsrouter::yaml::PROJECTION_STRIP_TAG, version);
+    object.strip = std::vector<std::string>(strip.begin(), strip.end());
+
+    /////
+    // Get required fields
+    const auto& fields = YamlReader::get_list<ddsrouter::core::CdrFieldConfiguration>(yml,
+                    ddsrouter::yaml::PROJECTION_FIELDS_TAG, version);
+    object.fields = std::vector<ddsrouter::core::CdrFieldConfiguration>(fields.begin(), fields.end());
+
+    /////
+    // Get optional derived type name
+    if (YamlReader::is_tag_present(yml, ddsrouter::yaml::PROJECTION_TYPE_TAG))
+    {
+        object.type_name = YamlReader::get<std::string>(yml, ddsrouter::yaml::PROJECTION_TYPE_TAG, version);
+    }
+}
+
+template <>
+ddsrouter::core::ProjectionConfiguration YamlReader::get<ddsrouter::core::ProjectionConfiguration>(
+        const Yaml& yml,
+        const YamlReaderVersion version)
+{
+    ddsrouter::core::ProjectionConfiguration object;
+    fill<ddsrouter::core::ProjectionConfiguration>(object, yml, version);
+    return object;
+}
+
+template <>
+void YamlReader::fill(
+        ddsrouter::core::ThreadConfiguration& object,
+        const Yaml& yml,
+        const YamlReaderVersion version)
+{
+    /////
+    // Get optional name
+    if (YamlReader::is_tag_present(yml, ddsrouter::yaml::THREAD_NAME_TAG))
+    {
+        object.name = YamlReader::get<std::string>(yml, ddsrouter::yaml::THREAD_NAME_TAG, version);
+    }
+
+    /////
+    // Get optional affinity
+    if (YamlReader::is_tag_present(yml, ddsrouter::yaml::THREAD_AFFINITY_TAG))
+    {
+        const auto& cpus = YamlReader::get_list<unsigned int>(yml, ddsrouter::yaml::THREAD_AFFINITY_TAG, version);
+        object.affinity = std::set<uint32_t>(cpus.begin(), cpus.end());
+    }
+
+    /////
+    // Get optional scheduling policy
+    if (YamlReader::is_tag_present(yml, ddsrouter::yaml::THREAD_POLICY_TAG))
+    {
+        const std::string policy = YamlReader::get<std::string>(yml, ddsrouter::yaml::THREAD_POLICY_TAG, version);
+
+        if (!ddsrouter::core::types::string_to_enumeration(policy, object.policy))
+        {
+            throw eprosima::utils::ConfigurationException(
+                      utils::Formatter() << "The thread policy " << policy << " is not valid.");
+        }
+    }
+
+    /////
+    // Get optional priority
+    if (YamlReader::is_tag_present(yml, ddsrouter::yaml::THREAD_PRIORITY_TAG))
+    {
+        object.priority = YamlReader::get<int>(yml, ddsrouter::yaml::THREAD_PRIORITY_TAG, version);
+    }
+}
+
+template <>
+ddsrouter::core::ThreadConfiguration YamlReader::get<ddsrouter::core::ThreadConfiguration>(
+        const Yaml& yml,
+        const YamlReaderVersion version)
+{
+    ddsrouter::core::ThreadConfiguration object;
+    fill<ddsrouter::core::ThreadConfiguration>(object, yml, version);
+    return object;
+}
+
+template <>
+void YamlReader::fill(
+        ddsrouter::core::MetricsExporterConfiguration& object,
+        const Yaml& yml,
+        const YamlReaderVersion version)
+{
+    /////
+    // Get optional enable
+    if (YamlReader::is_tag_present(yml, ddsrouter::yaml::METRICS_EXPORTER_ENABLE_TAG))
+    {
+        object.enabled = YamlReader::get<bool>(yml, ddsrouter::yaml::METRICS_EXPORTER_ENABLE_TAG, version);
+    }
+
+    /////
+    // Get optional address
+    if (YamlReader::is_tag_present(yml, ddsrouter::yaml::METRICS_EXPORTER_ADDRESS_TAG))
+    {
+        object.address = YamlReader::get<std::string>(yml, ddsrouter::yaml::METRICS_EXPORTER_ADDRESS_TAG, version);
+    }
+
+    /////
+    // Get optional port
+    if (YamlReader::is_tag_present(yml, ddsrouter::yaml::METRICS_EXPORTER_PORT_TAG))
+    {
+        const unsigned int port = YamlReader::get<unsigned int>(yml, ddsrouter::yaml::METRICS_EXPORTER_PORT_TAG,
+                        version);
+
+        if (port > std::numeric_limits<uint16_t>::max())
+        {
+            throw eprosima::utils::ConfigurationException(
+                      utils::Formatter() << "The metrics exporter port " << port << " is not valid.");
+        }
+
+        object.port = static_cast<uint16_t>(port);
+    }
+
+    /////
+    // Get optional period
+    if (YamlReader::is_tag_present(yml, ddsrouter::yaml::METRICS_EXPORTER_PERIOD_TAG))
+    {
+        object.period = YamlReader::get<unsigned int>(yml, ddsrouter::yaml::METRICS_EXPORTER_PERIOD_TAG, version);
+    }
+}
+
+template <>
+ddsrouter::core::MetricsExporterConfiguration YamlReader::get<ddsrouter::core::MetricsExporterConfiguration>(
+        const Yaml& yml,
+        const YamlReaderVersion version)
+{
+    ddsrouter::core::MetricsExporterConfiguration object;
+    fill<ddsrouter::core::MetricsExporterConfiguration>(object, yml, version);
+    return object;
+}
+
+template <>
+void YamlReader::fill(
+        ddsrouter::core::ProfilerConfiguration& object,
+        const Yaml& yml,
+        const YamlReaderVersion version)
+{
+    /////
+    // Get optional enable
+    if (YamlReader::is_tag_present(yml, ddsrouter::yaml::PROFILER_ENABLE_TAG))
+    {
+        object.enabled = YamlReader::get<bool>(yml, ddsrouter::yaml::PROFILER_ENABLE_TAG, version);
+    }
+
+    /////
+    // Get optional duration
+    if (YamlReader::is_tag_present(yml, ddsrouter::yaml::PROFILER_DURATION_TAG))
+    {
+        object.duration = YamlReader::get<unsigned int>(yml, ddsrouter::yaml::PROFILER_DURATION_TAG, version);
+    }
+
+    /////
+    // Get optional frequency
+    if (YamlReader::is_tag_present(yml, ddsrouter::yaml::PROFILER_FREQUENCY_TAG))
+    {
+        object.frequency = YamlReader::get<unsigned int>(yml, ddsrouter::yaml::PROFILER_FREQUENCY_TAG, version);
+    }
+
+    /////
+    // Get optional output directory
+    if (YamlReader::is_tag_present(yml, ddsrouter::yaml::PROFILER_OUTPUT_DIRECTORY_TAG))
+    {
+        object.output_directory = YamlReader::get<std::string>(yml, ddsrouter::yaml::PROFILER_OUTPUT_DIRECTORY_TAG,
+                        version);
+    }
+}
+
+template <>
+ddsrouter::core::ProfilerConfiguration YamlReader::get<ddsrouter::core::ProfilerConfiguration>(
+        const Yaml& yml,
+        const YamlReaderVersion version)
+{
+    ddsrouter::core::ProfilerConfiguration object;
+    fill<ddsrouter::core::ProfilerConfiguration>(object, yml, version);
+    return object;
+}
+
+template <>
+void YamlReader::fill(
+        ddsrouter::core::TracingConfiguration& object,
+        const Yaml& yml,
+        const YamlReaderVersion version)
+{
+    /////
+    // Get optional enable
+    if (YamlReader::is_tag_present(yml, ddsrouter::yaml::TRACING_ENABLE_TAG))
+    {
+        object.enabled = YamlReader::get<bool>(yml, ddsrouter::yaml::TRACING_ENABLE_TAG, version);
+    }
+
+    /////
+    // Get optional topics
+    if (YamlReader::is_tag_present(yml, ddsrouter::yaml::TRACING_TOPICS_TAG))
+    {
+        const auto& topics = YamlReader::get_list<core::types::WildcardDdsFilterTopic>(yml,
+                        ddsrouter::yaml::TRACING_TOPICS_TAG, version);
+        object.topics = std::vector<core::types::WildcardDdsFilterTopic>(topics.begin(), topics.end());
+    }
+
+    /////
+    // Get optional buffer size
+    if (YamlReader::is_tag_present(yml, ddsrouter::yaml::TRACING_BUFFER_SIZE_TAG))
+    {
+        object.buffer_size = YamlReader::get<unsigned int>(yml, ddsrouter::yaml::TRACING_BUFFER_SIZE_TAG, version);
+    }
+
+    /////
+    // Get optional output directory
+    if (YamlReader::is_tag_present(yml, ddsrouter::yaml::TRACING_OUTPUT_DIRECTORY_TAG))
+    {
+        object.output_directory = YamlReader::get<std::string>(yml, ddsrouter::yaml::TRACING_OUTPUT_DIRECTORY_TAG,
+                        version);
+    }
+}
+
+template <>
+ddsrouter::core::TracingConfiguration YamlReader::get<ddsrouter::core::TracingConfiguration>(
+        const Yaml& yml,
+        const YamlReaderVersion version)
+{
+    ddsrouter::core::TracingConfiguration object;
+    fill<ddsrouter::core::TracingConfiguration>(object, yml, version);
+    return object;
+}
+
+template <>
+void YamlReader::fill(
+        ddsrouter::core::BinaryLogConfiguration& object,
+        const Yaml& yml,
+        const YamlReaderVersion version)
+{
+    /////
+    // Get optional enable
+    if (YamlReader::is_tag_present(yml, ddsrouter::yaml::BINARY_LOG_ENABLE_TAG))
+    {
+        object.enabled = YamlReader::get<bool>(yml, ddsrouter::yaml::BINARY_LOG_ENABLE_TAG, version);
+    }
+
+    /////
+    // Get optional buffer size
+    if (YamlReader::is_tag_present(yml, ddsrouter::yaml::BINARY_LOG_BUFFER_SIZE_TAG))
+    {
+        object.buffer_size = YamlReader::get<unsigned int>(yml, ddsrouter::yaml::BINARY_LOG_BUFFER_SIZE_TAG, version);
+    }
+
+    /////
+    // Get optional period
+    if (YamlReader::is_tag_present(yml, ddsrouter::yaml::BINARY_LOG_PERIOD_TAG))
+    {
+        object.period = YamlReader::get<unsigned int>(yml, ddsrouter::yaml::BINARY_LOG_PERIOD_TAG, version);
+    }
+
+    /////
+    // Get optional output directory
+    if (YamlReader::is_tag_present(yml, ddsrouter::yaml::BINARY_LOG_OUTPUT_DIRECTORY_TAG))
+    {
+        object.output_directory = YamlReader::get<std::string>(yml, ddsrouter::yaml::BINARY_LOG_OUTPUT_DIRECTORY_TAG,
+                        version);
+    }
+}
+
+template <>
+ddsrouter::core::BinaryLogConfiguration YamlReader::get<ddsrouter::core::BinaryLogConfiguration>(
+        const Yaml& yml,
+        const YamlReaderVersion version)
+{
+    ddsrouter::core::BinaryLogConfiguration object;
+    fill<ddsrouter::core::BinaryLogConfiguration>(object, yml, version);
+    return object;
+}
+
+template <>
+void YamlReader::fill(
+        ddsrouter::core::LogThrottleConfiguration& object,
+        const Yaml& yml,
+        const YamlReaderVersion version)
+{
+    /////
+    // Get mandatory category
+    object.category = YamlReader::get<std::string>(yml, ddsrouter::yaml::LOG_THROTTLE_CATEGORY_TAG, version);
 
-#include <ddsrouter_yaml/YamlReaderConfiguration.hpp>
+    /////
+    // Get mandatory entries per second
+    object.max_per_second = YamlReader::get<unsigned int>(yml, ddsrouter::yaml::LOG_THROTTLE_MAX_PER_SECOND_TAG,
+                    version);
+}
 
-namespace eprosima {
-namespace ddspipe {
-namespace yaml {
+template <>
+ddsrouter::core::LogThrottleConfiguration YamlReader::get<ddsrouter::core::LogThrottleConfiguration>(
+        const Yaml& yml,
+        const YamlReaderVersion version)
+{
+    ddsrouter::core::LogThrottleConfiguration object;
+    fill<ddsrouter::core::LogThrottleConfiguration>(object, yml, version);
+    return object;
+}
 
 template <>
 void YamlReader::fill(
@@ -41,10 +557,60 @@ void YamlReader::fill(
         const YamlReaderVersion version)
 {
     /////
-    // Get optional number of threads
+    // Get optional threads. Either the number of threads of the pool, or the configuration of each class of threads
     if (YamlReader::is_tag_present(yml, NUMBER_THREADS_TAG))
     {
-        object.number_of_threads = YamlReader::get<unsigned int>(yml, NUMBER_THREADS_TAG, version);
+        const Yaml threads_yml = get_value_in_tag(yml, NUMBER_THREADS_TAG);
+
+        if (threads_yml.IsScalar())
+        {
+            object.number_of_threads = YamlReader::get<unsigned int>(yml, NUMBER_THREADS_TAG, version);
+        }
+        else
+        {
+            if (YamlReader::is_tag_present(threads_yml, ddsrouter::yaml::THREADS_NUMBER_TAG))
+            {
+                object.number_of_threads = YamlReader::get<unsigned int>(threads_yml,
+                                ddsrouter::yaml::THREADS_NUMBER_TAG, version);
+            }
+
+            // Adapt the threads forwarding data at once to the load
+            if (YamlReader::is_tag_present(threads_yml, ddsrouter::yaml::THREADS_MIN_TAG))
+            {
+                object.min_threads = YamlReader::get<unsigned int>(threads_yml,
+                                ddsrouter::yaml::THREADS_MIN_TAG, version);
+            }
+
+            if (YamlReader::is_tag_present(threads_yml, ddsrouter::yaml::THREADS_MAX_TAG))
+            {
+                object.max_threads = YamlReader::get<unsigned int>(threads_yml,
+                                ddsrouter::yaml::THREADS_MAX_TAG, version);
+            }
+
+            if (YamlReader::is_tag_present(threads_yml, ddsrouter::yaml::THREADS_TARGET_LATENCY_TAG))
+            {
+                object.target_queue_latency = YamlReader::get<unsigned int>(threads_yml,
+                                ddsrouter::yaml::THREADS_TARGET_LATENCY_TAG, version);
+            }
+
+            if (YamlReader::is_tag_present(threads_yml, ddsrouter::yaml::THREADS_FORWARDING_TAG))
+            {
+                object.forwarding_threads = YamlReader::get<ddsrouter::core::ThreadConfiguration>(threads_yml,
+                                ddsrouter::yaml::THREADS_FORWARDING_TAG, version);
+            }
+
+            if (YamlReader::is_tag_present(threads_yml, ddsrouter::yaml::THREADS_PARTICIPANTS_TAG))
+            {
+                object.participant_threads = YamlReader::get<ddsrouter::core::ThreadConfiguration>(threads_yml,
+                                ddsrouter::yaml::THREADS_PARTICIPANTS_TAG, version);
+            }
+
+            if (YamlReader::is_tag_present(threads_yml, ddsrouter::yaml::THREADS_HOUSEKEEPING_TAG))
+            {
+                object.housekeeping_threads = YamlReader::get<ddsrouter::core::ThreadConfiguration>(threads_yml,
+                                ddsrouter::yaml::THREADS_HOUSEKEEPING_TAG, version);
+            }
+        }
     }
 
     /////
@@ -85,6 +651,22 @@ void YamlReader::fill(
     {
         object.log_configuration = YamlReader::get<ddspipe::core::DdsPipeLogConfiguration>(yml, LOG_CONFIGURATION_TAG,
                         version);
+
+        // The binary log and the log throttle belong to the DDS Router, so the DDS Pipe does not read them
+        const Yaml log_yml = get_value_in_tag(yml, LOG_CONFIGURATION_TAG);
+        if (YamlReader::is_tag_present(log_yml, ddsrouter::yaml::BINARY_LOG_TAG))
+        {
+            object.binary_log = YamlReader::get<ddsrouter::core::BinaryLogConfiguration>(log_yml,
+                            ddsrouter::yaml::BINARY_LOG_TAG, version);
+        }
+
+        if (YamlReader::is_tag_present(log_yml, ddsrouter::yaml::LOG_THROTTLE_TAG))
+        {
+            const auto& log_throttles = YamlReader::get_list<ddsrouter::core::LogThrottleConfiguration>(log_yml,
+                            ddsrouter::yaml::LOG_THROTTLE_TAG, version);
+            object.log_throttles = std::vector<ddsrouter::core::LogThrottleConfiguration>(log_throttles.begin(),
+                            log_throttles.end());
+        }
     }
 
     /////
@@ -92,7 +674,390 @@ void YamlReader::fill(
     if (YamlReader::is_tag_present(yml, MONITOR_TAG))
     {
         object.monitor_configuration = YamlReader::get<core::MonitorConfiguration>(yml, MONITOR_TAG, version);
+
+        // The thread pool monitor, the metrics exporter, the profiler and the tracing belong to the DDS Router, so the
+        // DDS Pipe does not read them
+        const Yaml monitor_yml = get_value_in_tag(yml, MONITOR_TAG);
+        if (YamlReader::is_tag_present(monitor_yml, ddsrouter::yaml::THREAD_POOL_MONITOR_TAG))
+        {
+            const Yaml thread_pool_yml = get_value_in_tag(monitor_yml, ddsrouter::yaml::THREAD_POOL_MONITOR_TAG);
+
+            if (YamlReader::is_tag_present(thread_pool_yml, ddsrouter::yaml::THREAD_POOL_MONITOR_ENABLE_TAG))
+            {
+                object.thread_pool_monitor = YamlReader::get<bool>(thread_pool_yml,
+                                ddsrouter::yaml::THREAD_POOL_MONITOR_ENABLE_TAG, version);
+            }
+
+            if (YamlReader::is_tag_present(thread_pool_yml, ddsrouter::yaml::THREAD_POOL_MONITOR_PERIOD_TAG))
+            {
+                object.thread_pool_monitor_period = YamlReader::get<unsigned int>(thread_pool_yml,
+                                ddsrouter::yaml::THREAD_POOL_MONITOR_PERIOD_TAG, version);
+            }
+        }
+
+        if (YamlReader::is_tag_present(monitor_yml, ddsrouter::yaml::METRICS_EXPORTER_TAG))
+        {
+            object.metrics_exporter = YamlReader::get<ddsrouter::core::MetricsExporterConfiguration>(monitor_yml,
+                            ddsrouter::yaml::METRICS_EXPORTER_TAG, version);
+        }
+
+        if (YamlReader::is_tag_present(monitor_yml, ddsrouter::yaml::PROFILER_TAG))
+        {
+            object.profiler = YamlReader::get<ddsrouter::core::ProfilerConfiguration>(monitor_yml,
+                            ddsrouter::yaml::PROFILER_TAG, version);
+        }
+
+        if (YamlReader::is_tag_present(monitor_yml, ddsrouter::yaml::TRACING_TAG))
+        {
+            object.tracing = YamlReader::get<ddsrouter::core::TracingConfiguration>(monitor_yml,
+                            ddsrouter::yaml::TRACING_TAG, version);
+        }
+    }
+
+    /////
+    // Get optional content filters
+    if (YamlReader::is_tag_present(yml, ddsrouter::yaml::CONTENT_FILTERS_TAG))
+    {
+        const auto& content_filters = YamlReader::get_list<ddsrouter::core::ContentFilterConfiguration>(yml,
+                        ddsrouter::yaml::CONTENT_FILTERS_TAG, version);
+        object.content_filters = std::vector<ddsrouter::core::ContentFilterConfiguration>(content_filters.begin(),
+                        content_filters.end());
+    }
+
+    /////
+    // Get optional projections
+    if (YamlReader::is_tag_present(yml, ddsrouter::yaml::PROJECTIONS_TAG))
+    {
+        const auto& projections = YamlReader::get_list<ddsrouter::core::ProjectionConfiguration>(yml,
+                        ddsrouter::yaml::PROJECTIONS_TAG, version);
+        object.projections = std::vector<ddsrouter::core::ProjectionConfiguration>(projections.begin(),
+                        projections.end());
+    }
+
+    /////
+    // Get optional rate limits
+    if (YamlReader::is_tag_present(yml, ddsrouter::yaml::RATE_LIMITS_TAG))
+    {
+        const auto& rate_limits = YamlReader::get_list<ddsrouter::core::RateLimitConfiguration>(yml,
+                        ddsrouter::yaml::RATE_LIMITS_TAG, version);
+        object.rate_limits = std::vector<ddsrouter::core::RateLimitConfiguration>(rate_limits.begin(),
+                        rate_limits.end());
+    }
+
+    /////
+    // Get optional lazy writers
+    if (YamlReader::is_tag_present(yml, ddsrouter::yaml::LAZY_WRITERS_TAG))
+    {
+        object.lazy_writers = YamlReader::get<bool>(yml, ddsrouter::yaml::LAZY_WRITERS_TAG, version);
+    }
+
+    /////
+    // Get optional writers idle TTL
+    if (YamlReader::is_tag_present(yml, ddsrouter::yaml::WRITERS_IDLE_TTL_TAG))
+    {
+        object.writers_idle_ttl = YamlReader::get<unsigned int>(yml, ddsrouter::yaml::WRITERS_IDLE_TTL_TAG, version);
+    }
+
+    /////
+    // Get optional discovery batch period
+    if (YamlReader::is_tag_present(yml, ddsrouter::yaml::DISCOVERY_BATCH_PERIOD_TAG))
+    {
+        object.discovery_batch_period = YamlReader::get<unsigned int>(yml,
+                        ddsrouter::yaml::DISCOVERY_BATCH_PERIOD_TAG, version);
+    }
+
+    /////
+    // Get optional discovery cache
+    if (YamlReader::is_tag_present(yml, ddsrouter::yaml::DISCOVERY_CACHE_TAG))
+    {
+        object.discovery_cache = YamlReader::get<std::string>(yml, ddsrouter::yaml::DISCOVERY_CACHE_TAG, version);
+    }
+
+    /////
+    // Get optional discovery cache TTL
+    if (YamlReader::is_tag_present(yml, ddsrouter::yaml::DISCOVERY_CACHE_TTL_TAG))
+    {
+        object.discovery_cache_ttl = YamlReader::get<unsigned int>(yml,
+                        ddsrouter::yaml::DISCOVERY_CACHE_TTL_TAG, version);
+    }
+
+    /////
+    // Get optional warm up
+    if (YamlReader::is_tag_present(yml, ddsrouter::yaml::WARM_UP_TAG))
+    {
+        object.warm_up = YamlReader::get<bool>(yml, ddsrouter::yaml::WARM_UP_TAG, version);
+    }
+
+    /////
+    // Get optional preallocated histories
+    if (YamlReader::is_tag_present(yml, ddsrouter::yaml::PREALLOCATE_HISTORIES_TAG))
+    {
+        object.preallocate_histories = YamlReader::get<bool>(yml, ddsrouter::yaml::PREALLOCATE_HISTORIES_TAG, version);
+    }
+
+    /////
+    // Get optional maximum sample size
+    if (YamlReader::is_tag_present(yml, ddsrouter::yaml::MAX_SAMPLE_SIZE_TAG))
+    {
+        object.max_sample_size = YamlReader::get<unsigned int>(yml, ddsrouter::yaml::MAX_SAMPLE_SIZE_TAG, version);
+    }
+}
+
+template <>
+void YamlReader::fill(
+        ddsrouter::core::IpcParticipantConfiguration& object,
+        const Yaml& yml,
+        const YamlReaderVersion version)
+{
+    // Parent class fill
+    fill<participants::ParticipantConfiguration>(object, yml, version);
+
+    // Channel required
+    object.channel = YamlReader::get<std::string>(yml, ddsrouter::yaml::IPC_CHANNEL_TAG, version);
+
+    // Optional ring size
+    if (YamlReader::is_tag_present(yml, ddsrouter::yaml::IPC_RING_SIZE_TAG))
+    {
+        object.ring_size = YamlReader::get<unsigned int>(yml, ddsrouter::yaml::IPC_RING_SIZE_TAG, version);
+    }
+
+    // Optional maximum blocking time
+    if (YamlReader::is_tag_present(yml, ddsrouter::yaml::IPC_MAX_BLOCKING_TIME_TAG))
+    {
+        object.max_blocking_time = YamlReader::get<unsigned int>(yml, ddsrouter::yaml::IPC_MAX_BLOCKING_TIME_TAG,
+                        version);
+    }
+}
+
+template <>
+ddsrouter::core::IpcParticipantConfiguration YamlReader::get<ddsrouter::core::IpcParticipantConfiguration>(
+        const Yaml& yml,
+        const YamlReaderVersion version)
+{
+    ddsrouter::core::IpcParticipantConfiguration object;
+    fill<ddsrouter::core::IpcParticipantConfiguration>(object, yml, version);
+    return object;
+}
+
+template <>
+void YamlReader::fill(
+        ddsrouter::core::InProcessParticipantConfiguration& object,
+        const Yaml& yml,
+        const YamlReaderVersion version)
+{
+    // Parent class fill
+    fill<participants::ParticipantConfiguration>(object, yml, version);
+
+    // Channel required
+    object.channel = YamlReader::get<std::string>(yml, ddsrouter::yaml::INPROCESS_CHANNEL_TAG, version);
+}
+
+template <>
+ddsrouter::core::InProcessParticipantConfiguration YamlReader::get<ddsrouter::core::InProcessParticipantConfiguration>(
+        const Yaml& yml,
+        const YamlReaderVersion version)
+{
+    ddsrouter::core::InProcessParticipantConfiguration object;
+    fill<ddsrouter::core::InProcessParticipantConfiguration>(object, yml, version);
+    return object;
+}
+
+template <>
+void YamlReader::fill(
+        ddsrouter::core::RecorderParticipantConfiguration& object,
+        const Yaml& yml,
+        const YamlReaderVersion version)
+{
+    // Parent class fill
+    fill<participants::ParticipantConfiguration>(object, yml, version);
+
+    // Optional output directory
+    if (YamlReader::is_tag_present(yml, ddsrouter::yaml::RECORDER_OUTPUT_DIRECTORY_TAG))
+    {
+        object.output_directory = YamlReader::get<std::string>(yml, ddsrouter::yaml::RECORDER_OUTPUT_DIRECTORY_TAG,
+                        version);
+    }
+
+    // Optional segment size
+    if (YamlReader::is_tag_present(yml, ddsrouter::yaml::RECORDER_SEGMENT_SIZE_TAG))
+    {
+        object.segment_size = YamlReader::get<unsigned int>(yml, ddsrouter::yaml::RECORDER_SEGMENT_SIZE_TAG, version);
+    }
+
+    // Optional fsync period
+    if (YamlReader::is_tag_present(yml, ddsrouter::yaml::RECORDER_FSYNC_PERIOD_TAG))
+    {
+        object.fsync_period = YamlReader::get<unsigned int>(yml, ddsrouter::yaml::RECORDER_FSYNC_PERIOD_TAG, version);
+    }
+
+    // Optional maximum pending size
+    if (YamlReader::is_tag_present(yml, ddsrouter::yaml::RECORDER_MAX_PENDING_SIZE_TAG))
+    {
+        object.max_pending_size = YamlReader::get<unsigned int>(yml, ddsrouter::yaml::RECORDER_MAX_PENDING_SIZE_TAG,
+                        version);
+    }
+}
+
+template <>
+ddsrouter::core::RecorderParticipantConfiguration YamlReader::get<ddsrouter::core::RecorderParticipantConfiguration>(
+        const Yaml& yml,
+        const YamlReaderVersion version)
+{
+    ddsrouter::core::RecorderParticipantConfiguration object;
+    fill<ddsrouter::core::RecorderParticipantConfiguration>(object, yml, version);
+    return object;
+}
+
+template <>
+void YamlReader::fill(
+        ddsrouter::core::ReplayerParticipantConfiguration& object,
+        const Yaml& yml,
+        const YamlReaderVersion version)
+{
+    // Parent class fill
+    fill<participants::ParticipantConfiguration>(object, yml, version);
+
+    // Input directory required
+    object.input_directory = YamlReader::get<std::string>(yml, ddsrouter::yaml::REPLAYER_INPUT_DIRECTORY_TAG, version);
+
+    // Optional speed
+    if (YamlReader::is_tag_present(yml, ddsrouter::yaml::REPLAYER_SPEED_TAG))
+    {
+        object.speed = YamlReader::get<float>(yml, ddsrouter::yaml::REPLAYER_SPEED_TAG, version);
+    }
+
+    // Optional prefetch size
+    if (YamlReader::is_tag_present(yml, ddsrouter::yaml::REPLAYER_PREFETCH_SIZE_TAG))
+    {
+        object.prefetch_size = YamlReader::get<unsigned int>(yml, ddsrouter::yaml::REPLAYER_PREFETCH_SIZE_TAG, version);
+    }
+}
+
+template <>
+ddsrouter::core::ReplayerParticipantConfiguration YamlReader::get<ddsrouter::core::ReplayerParticipantConfiguration>(
+        const Yaml& yml,
+        const YamlReaderVersion version)
+{
+    ddsrouter::core::ReplayerParticipantConfiguration object;
+    fill<ddsrouter::core::ReplayerParticipantConfiguration>(object, yml, version);
+    return object;
+}
+
+template <>
+void YamlReader::fill(
+        ddsrouter::core::GeneratedTopicConfiguration& object,
+        const Yaml& yml,
+        const YamlReaderVersion version)
+{
+    // Topic name required
+    object.topic_name = YamlReader::get<std::string>(yml, ddsrouter::yaml::GENERATOR_TOPIC_NAME_TAG, version);
+
+    // Optional type name
+    if (YamlReader::is_tag_present(yml, ddsrouter::yaml::GENERATOR_TOPIC_TYPE_TAG))
+    {
+        object.type_name = YamlReader::get<std::string>(yml, ddsrouter::yaml::GENERATOR_TOPIC_TYPE_TAG, version);
+    }
+
+    // Optional rate
+    if (YamlReader::is_tag_present(yml, ddsrouter::yaml::GENERATOR_RATE_TAG))
+    {
+        object.rate = YamlReader::get<float>(yml, ddsrouter::yaml::GENERATOR_RATE_TAG, version);
+    }
+
+    // Optional sizes
+    if (YamlReader::is_tag_present(yml, ddsrouter::yaml::GENERATOR_SIZE_TAG))
+    {
+        object.size = YamlReader::get<unsigned int>(yml, ddsrouter::yaml::GENERATOR_SIZE_TAG, version);
+    }
+
+    if (YamlReader::is_tag_present(yml, ddsrouter::yaml::GENERATOR_MAX_SIZE_TAG))
+    {
+        object.max_size = YamlReader::get<unsigned int>(yml, ddsrouter::yaml::GENERATOR_MAX_SIZE_TAG, version);
+    }
+
+    // Optional number of keys
+    if (YamlReader::is_tag_present(yml, ddsrouter::yaml::GENERATOR_KEYS_TAG))
+    {
+        object.keys = YamlReader::get<unsigned int>(yml, ddsrouter::yaml::GENERATOR_KEYS_TAG, version);
+    }
+
+    // Optional burst
+    if (YamlReader::is_tag_present(yml, ddsrouter::yaml::GENERATOR_BURST_TAG))
+    {
+        object.burst = YamlReader::get<unsigned int>(yml, ddsrouter::yaml::GENERATOR_BURST_TAG, version);
+    }
+
+    // Optional number of samples
+    if (YamlReader::is_tag_present(yml, ddsrouter::yaml::GENERATOR_SAMPLES_TAG))
+    {
+        object.samples = YamlReader::get<unsigned int>(yml, ddsrouter::yaml::GENERATOR_SAMPLES_TAG, version);
+    }
+}
+
+template <>
+ddsrouter::core::GeneratedTopicConfiguration YamlReader::get<ddsrouter::core::GeneratedTopicConfiguration>(
+        const Yaml& yml,
+        const YamlReaderVersion version)
+{
+    ddsrouter::core::GeneratedTopicConfiguration object;
+    fill<ddsrouter::core::GeneratedTopicConfiguration>(object, yml, version);
+    return object;
+}
+
+template <>
+void YamlReader::fill(
+        ddsrouter::core::GeneratorParticipantConfiguration& object,
+        const Yaml& yml,
+        const YamlReaderVersion version)
+{
+    // Parent class fill
+    fill<participants::ParticipantConfiguration>(object, yml, version);
+
+    // Topics required
+    object.topics = YamlReader::get_list<ddsrouter::core::GeneratedTopicConfiguration>(yml,
+                    ddsrouter::yaml::GENERATOR_TOPICS_TAG, version);
+}
+
+template <>
+ddsrouter::core::GeneratorParticipantConfiguration YamlReader::get<ddsrouter::core::GeneratorParticipantConfiguration>(
+        const Yaml& yml,
+        const YamlReaderVersion version)
+{
+    ddsrouter::core::GeneratorParticipantConfiguration object;
+    fill<ddsrouter::core::GeneratorParticipantConfiguration>(object, yml, version);
+    return object;
+}
+
+template <>
+void YamlReader::fill(
+        ddsrouter::core::SinkParticipantConfiguration& object,
+        const Yaml& yml,
+        const YamlReaderVersion version)
+{
+    // Parent class fill
+    fill<participants::ParticipantConfiguration>(object, yml, version);
+
+    // Optional report period
+    if (YamlReader::is_tag_present(yml, ddsrouter::yaml::SINK_REPORT_PERIOD_TAG))
+    {
+        object.report_period = YamlReader::get<unsigned int>(yml, ddsrouter::yaml::SINK_REPORT_PERIOD_TAG, version);
     }
+
+    // Optional check sequence
+    if (YamlReader::is_tag_present(yml, ddsrouter::yaml::SINK_CHECK_SEQUENCE_TAG))
+    {
+        object.check_sequence = YamlReader::get<bool>(yml, ddsrouter::yaml::SINK_CHECK_SEQUENCE_TAG, version);
+    }
+}
+
+template <>
+ddsrouter::core::SinkParticipantConfiguration YamlReader::get<ddsrouter::core::SinkParticipantConfiguration>(
+        const Yaml& yml,
+        const YamlReaderVersion version)
+{
+    ddsrouter::core::SinkParticipantConfiguration object;
+    fill<ddsrouter::core::SinkParticipantConfiguration>(object, yml, version);
+    return object;
 }
 
 template <>
@@ -140,6 +1105,30 @@ YamlReader::get<std::shared_ptr<participants::ParticipantConfiguration>>(
             return std::make_shared<participants::XmlParticipantConfiguration>(
                 YamlReader::get<participants::XmlParticipantConfiguration>(yml, version));
 
+        case ddsrouter::core::types::ParticipantKind::ipc:
+            return std::make_shared<ddsrouter::core::IpcParticipantConfiguration>(
+                YamlReader::get<ddsrouter::core::IpcParticipantConfiguration>(yml, version));
+
+        case ddsrouter::core::types::ParticipantKind::inprocess:
+            return std::make_shared<ddsrouter::core::InProcessParticipantConfiguration>(
+                YamlReader::get<ddsrouter::core::InProcessParticipantConfiguration>(yml, version));
+
+        case ddsrouter::core::types::ParticipantKind::recorder:
+            return std::make_shared<ddsrouter::core::RecorderParticipantConfiguration>(
+                YamlReader::get<ddsrouter::core::RecorderParticipantConfiguration>(yml, version));
+
+        case ddsrouter::core::types::ParticipantKind::replayer:
+            return std::make_shared<ddsrouter::core::ReplayerParticipantConfiguration>(
+                YamlReader::get<ddsrouter::core::ReplayerParticipantConfiguration>(yml, version));
+
+        case ddsrouter::core::types::ParticipantKind::generator:
+            return std::make_shared<ddsrouter::core::GeneratorParticipantConfiguration>(
+                YamlReader::get<ddsrouter::core::GeneratorParticipantConfiguration>(yml, version));
+
+        case ddsrouter::core::types::ParticipantKind::sink:
+            return std::make_shared<ddsrouter::core::SinkParticipantConfiguration>(
+                YamlReader::get<ddsrouter::core::SinkParticipantConfiguration>(yml, version));
+
         default:
             // Non recheable code
             throw eprosima::utils::ConfigurationException(
@@ -20,6 +20,13 @@
 #include <ddspipe_yaml/yaml_configuration_tags.hpp>
 #include <ddspipe_yaml/testing/generate_yaml.hpp>
 
+#include <ddsrouter_core/configuration/InProcessParticipantConfiguration.hpp>
+#include <ddsrouter_core/configuration/IpcParticipantConfiguration.hpp>
+#include <ddsrouter_core/configuration/GeneratorParticipantConfiguration.hpp>
+#include <ddsrouter_core/configuration/RecorderParticipantConfiguration.hpp>
+#include <ddsrouter_core/configuration/ReplayerParticipantConfiguration.hpp>
+#include <ddsrouter_core/configuration/SinkParticipantConfiguration.hpp>
+
 #include <ddsrouter_yaml/YamlReaderConfiguration.hpp>
 
 using namespace eprosima;
@@ -544,6 +551,1706 @@ TEST(YamlReaderConfigurationTest, downsampling)
     }
 }
 
+/**
+ * Test load of rate limits in the configuration
+ *
+ * CASES:
+ * - topic rate limit with topic filter and bursts
+ * - topic rate limit per instance
+ * - participant rate limit with scope deduced
+ * - route rate limit with explicit scope
+ */
+TEST(YamlReaderConfigurationTest, rate_limits)
+{
+    const char* yml_configuration =
+            R"(
+        version: v4.0
+        participants:
+          - name: "P1"
+            kind: "echo"
+          - name: "P2"
+            kind: "echo"
+        specs:
+          rate-limits:
+            - topic:
+                name: "rt/*"
+              max-msgs-per-second: 100
+              burst-msgs: 10
+            - max-msgs-per-second: 10
+              per-instance: true
+            - participant: "P1"
+              max-bytes-per-second: 1000000
+            - scope: "route"
+              src: "P1"
+              dst: "P2"
+              max-msgs-per-second: 50
+              max-bytes-per-second: 5000
+              burst-bytes: 500
+        )";
+    Yaml yml = YAML::Load(yml_configuration);
+
+    // Load configuration
+    ddsrouter::core::DdsRouterConfiguration configuration_result =
+            ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml);
+
+    const auto& rate_limits = configuration_result.advanced_options.rate_limits;
+    ASSERT_EQ(rate_limits.size(), 4u);
+
+    // Topic rate limit
+    ASSERT_EQ(rate_limits[0].scope, ddsrouter::core::types::RateLimitScope::topic);
+    ASSERT_EQ(rate_limits[0].topic.topic_name.get_value(), "rt/*");
+    ASSERT_EQ(rate_limits[0].max_msgs_per_second, 100);
+    ASSERT_EQ(rate_limits[0].max_bytes_per_second, 0);
+    ASSERT_EQ(rate_limits[0].burst_msgs, 10u);
+    ASSERT_FALSE(rate_limits[0].per_instance);
+
+    // Topic rate limit per instance
+    ASSERT_EQ(rate_limits[1].scope, ddsrouter::core::types::RateLimitScope::topic);
+    ASSERT_EQ(rate_limits[1].max_msgs_per_second, 10);
+    ASSERT_TRUE(rate_limits[1].per_instance);
+
+    // Participant rate limit
+    ASSERT_EQ(rate_limits[2].scope, ddsrouter::core::types::RateLimitScope::participant);
+    ASSERT_EQ(rate_limits[2].participant_id, "P1");
+    ASSERT_EQ(rate_limits[2].max_bytes_per_second, 1000000);
+
+    // Route rate limit
+    ASSERT_EQ(rate_limits[3].scope, ddsrouter::core::types::RateLimitScope::route);
+    ASSERT_EQ(rate_limits[3].source_participant_id, "P1");
+    ASSERT_EQ(rate_limits[3].destination_participant_id, "P2");
+    ASSERT_EQ(rate_limits[3].max_msgs_per_second, 50);
+    ASSERT_EQ(rate_limits[3].max_bytes_per_second, 5000);
+    ASSERT_EQ(rate_limits[3].burst_bytes, 500u);
+
+    // The whole configuration is valid
+    utils::Formatter error_msg;
+    ASSERT_TRUE(configuration_result.is_valid(error_msg));
+}
+
+/**
+ * Test that rate limits referencing unknown participants are not valid
+ */
+TEST(YamlReaderConfigurationTest, rate_limits_unknown_participant)
+{
+    const char* yml_configuration =
+            R"(
+        version: v4.0
+        participants:
+          - name: "P1"
+            kind: "echo"
+        specs:
+          rate-limits:
+            - participant: "P3"
+              max-msgs-per-second: 10
+        )";
+    Yaml yml = YAML::Load(yml_configuration);
+
+    ddsrouter::core::DdsRouterConfiguration configuration_result =
+            ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml);
+
+    utils::Formatter error_msg;
+    ASSERT_FALSE(configuration_result.is_valid(error_msg));
+}
+
+/**
+ * Test load the lazy writers specs, and that an idle TTL without lazy writers is not valid
+ */
+TEST(YamlReaderConfigurationTest, lazy_writers)
+{
+    {
+        const char* yml_configuration =
+                R"(
+            version: v4.0
+            participants:
+              - name: "P1"
+                kind: "echo"
+              - name: "P2"
+                kind: "echo"
+            specs:
+              lazy-writers: true
+              writers-idle-ttl: 30000
+            )";
+        Yaml yml = YAML::Load(yml_configuration);
+
+        ddsrouter::core::DdsRouterConfiguration configuration_result =
+                ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml);
+
+        ASSERT_TRUE(configuration_result.advanced_options.lazy_writers);
+        ASSERT_EQ(configuration_result.advanced_options.writers_idle_ttl, 30000u);
+
+        utils::Formatter error_msg;
+        ASSERT_TRUE(configuration_result.is_valid(error_msg));
+    }
+
+    {
+        const char* yml_configuration =
+                R"(
+            version: v4.0
+            participants:
+              - name: "P1"
+                kind: "echo"
+            specs:
+              writers-idle-ttl: 30000
+            )";
+        Yaml yml = YAML::Load(yml_configuration);
+
+        ddsrouter::core::DdsRouterConfiguration configuration_result =
+                ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml);
+
+        ASSERT_FALSE(configuration_result.advanced_options.lazy_writers);
+
+        utils::Formatter error_msg;
+        ASSERT_FALSE(configuration_result.is_valid(error_msg));
+    }
+}
+
+/**
+ * Test load the discovery batch period, and that batching is disabled by default
+ */
+TEST(YamlReaderConfigurationTest, discovery_batch_period)
+{
+    {
+        const char* yml_configuration =
+                R"(
+            version: v4.0
+            participants:
+              - name: "P1"
+                kind: "echo"
+            specs:
+              discovery-batch-period: 50
+            )";
+        Yaml yml = YAML::Load(yml_configuration);
+
+        ddsrouter::core::DdsRouterConfiguration configuration_result =
+                ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml);
+
+        ASSERT_EQ(configuration_result.advanced_options.discovery_batch_period, 50u);
+
+        utils::Formatter error_msg;
+        ASSERT_TRUE(configuration_result.is_valid(error_msg));
+    }
+
+    {
+        const char* yml_configuration =
+                R"(
+            version: v4.0
+            participants:
+              - name: "P1"
+                kind: "echo"
+            )";
+        Yaml yml = YAML::Load(yml_configuration);
+
+        ddsrouter::core::DdsRouterConfiguration configuration_result =
+                ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml);
+
+        ASSERT_EQ(configuration_result.advanced_options.discovery_batch_period, 0u);
+    }
+}
+
+/**
+ * Test load the discovery cache, and that its endpoints must have time to be discovered again
+ */
+TEST(YamlReaderConfigurationTest, discovery_cache)
+{
+    {
+        const char* yml_configuration =
+                R"(
+            version: v4.0
+            participants:
+              - name: "P1"
+                kind: "echo"
+            specs:
+              discovery-cache: "/var/lib/ddsrouter/discovery.cache"
+              discovery-cache-ttl: 60000
+            )";
+        Yaml yml = YAML::Load(yml_configuration);
+
+        ddsrouter::core::DdsRouterConfiguration configuration_result =
+                ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml);
+
+        ASSERT_EQ(configuration_result.advanced_options.discovery_cache, "/var/lib/ddsrouter/discovery.cache");
+        ASSERT_EQ(configuration_result.advanced_options.discovery_cache_ttl, 60000u);
+
+        utils::Formatter error_msg;
+        ASSERT_TRUE(configuration_result.is_valid(error_msg));
+    }
+
+    {
+        const char* yml_configuration =
+                R"(
+            version: v4.0
+            participants:
+              - name: "P1"
+                kind: "echo"
+            specs:
+              discovery-cache: "discovery.cache"
+              discovery-cache-ttl: 0
+            )";
+        Yaml yml = YAML::Load(yml_configuration);
+
+        ddsrouter::core::DdsRouterConfiguration configuration_result =
+                ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml);
+
+        utils::Formatter error_msg;
+        ASSERT_FALSE(configuration_result.is_valid(error_msg));
+    }
+}
+
+/**
+ * Test load the warm up of the builtin topics, disabled by default
+ */
+TEST(YamlReaderConfigurationTest, warm_up)
+{
+    const char* yml_configuration =
+            R"(
+        version: v4.0
+        participants:
+          - name: "P1"
+            kind: "echo"
+        specs:
+          warm-up: true
+        )";
+    Yaml yml = YAML::Load(yml_configuration);
+
+    ddsrouter::core::DdsRouterConfiguration configuration_result =
+            ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml);
+
+    ASSERT_TRUE(configuration_result.advanced_options.warm_up);
+    ASSERT_FALSE(ddsrouter::core::SpecsConfiguration().warm_up);
+
+    utils::Formatter error_msg;
+    ASSERT_TRUE(configuration_result.is_valid(error_msg));
+}
+
+/**
+ * Test load the preallocated histories, and that they require a maximum sample size
+ */
+TEST(YamlReaderConfigurationTest, preallocated_histories)
+{
+    {
+        const char* yml_configuration =
+                R"(
+            version: v4.0
+            participants:
+              - name: "P1"
+                kind: "echo"
+            specs:
+              preallocate-histories: true
+              max-sample-size: 4096
+            )";
+        Yaml yml = YAML::Load(yml_configuration);
+
+        ddsrouter::core::DdsRouterConfiguration configuration_result =
+                ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml);
+
+        ASSERT_TRUE(configuration_result.advanced_options.preallocate_histories);
+        ASSERT_EQ(configuration_result.advanced_options.max_sample_size, 4096u);
+
+        utils::Formatter error_msg;
+        ASSERT_TRUE(configuration_result.is_valid(error_msg));
+    }
+
+    {
+        const char* yml_configuration =
+                R"(
+            version: v4.0
+            participants:
+              - name: "P1"
+                kind: "echo"
+            specs:
+              preallocate-histories: true
+            )";
+        Yaml yml = YAML::Load(yml_configuration);
+
+        ddsrouter::core::DdsRouterConfiguration configuration_result =
+                ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml);
+
+        utils::Formatter error_msg;
+        ASSERT_FALSE(configuration_result.is_valid(error_msg));
+    }
+}
+
+/**
+ * Test load the configuration of each class of threads
+ *
+ * CASES:
+ * - every class configured along with the number of threads
+ * - invalid scheduling policy
+ * - priority out of range
+ */
+TEST(YamlReaderConfigurationTest, thread_configuration)
+{
+    {
+        const char* yml_configuration =
+                R"(
+            version: v4.0
+            participants:
+              - name: "P1"
+                kind: "echo"
+            specs:
+              threads:
+                number: 4
+                forwarding:
+                  name: "ddsr-fwd"
+                  affinity: [2, 3]
+                  policy: "fifo"
+                  priority: 10
+                participants:
+                  affinity: [1]
+                housekeeping:
+                  name: "ddsr-hk"
+                  affinity: [0]
+                  policy: "idle"
+            )";
+        Yaml yml = YAML::Load(yml_configuration);
+
+        ddsrouter::core::DdsRouterConfiguration configuration_result =
+                ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml);
+
+        const auto& specs = configuration_result.advanced_options;
+        ASSERT_EQ(specs.number_of_threads, 4u);
+
+        ASSERT_EQ(specs.forwarding_threads.name, "ddsr-fwd");
+        ASSERT_EQ(specs.forwarding_threads.affinity, std::set<uint32_t>({2, 3}));
+        ASSERT_EQ(specs.forwarding_threads.policy, ddsrouter::core::types::ThreadPolicy::fifo);
+        ASSERT_EQ(specs.forwarding_threads.priority, 10);
+
+        ASSERT_TRUE(specs.participant_threads.name.empty());
+        ASSERT_EQ(specs.participant_threads.affinity, std::set<uint32_t>({1}));
+        ASSERT_EQ(specs.participant_threads.policy, ddsrouter::core::types::ThreadPolicy::inherited);
+
+        ASSERT_EQ(specs.housekeeping_threads.name, "ddsr-hk");
+        ASSERT_EQ(specs.housekeeping_threads.policy, ddsrouter::core::types::ThreadPolicy::idle);
+
+        utils::Formatter error_msg;
+        ASSERT_TRUE(configuration_result.is_valid(error_msg));
+    }
+
+    {
+        const char* yml_configuration =
+                R"(
+            version: v4.0
+            participants:
+              - name: "P1"
+                kind: "echo"
+            specs:
+              threads:
+                forwarding:
+                  policy: "deadline"
+            )";
+        Yaml yml = YAML::Load(yml_configuration);
+
+        ASSERT_THROW(
+            ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml),
+            utils::ConfigurationException);
+    }
+
+    {
+        const char* yml_configuration =
+                R"(
+            version: v4.0
+            participants:
+              - name: "P1"
+                kind: "echo"
+            specs:
+              threads:
+                forwarding:
+                  policy: "round_robin"
+                  priority: 100
+            )";
+        Yaml yml = YAML::Load(yml_configuration);
+
+        ddsrouter::core::DdsRouterConfiguration configuration_result =
+                ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml);
+
+        utils::Formatter error_msg;
+        ASSERT_FALSE(configuration_result.is_valid(error_msg));
+    }
+}
+
+/**
+ * Test load the adaptive number of forwarding threads
+ *
+ * CASES:
+ * - minimum, maximum and target queue latency
+ * - minimum threads over the maximum
+ */
+TEST(YamlReaderConfigurationTest, adaptive_threads)
+{
+    {
+        const char* yml_configuration =
+                R"(
+            version: v4.0
+            participants:
+              - name: "P1"
+                kind: "echo"
+            specs:
+              threads:
+                min-threads: 2
+                max-threads: 16
+                target-queue-latency: 500
+            )";
+        Yaml yml = YAML::Load(yml_configuration);
+
+        ddsrouter::core::DdsRouterConfiguration configuration_result =
+                ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml);
+
+        const auto& specs = configuration_result.advanced_options;
+        ASSERT_EQ(specs.min_threads, 2u);
+        ASSERT_EQ(specs.max_threads, 16u);
+        ASSERT_EQ(specs.target_queue_latency, 500u);
+
+        utils::Formatter error_msg;
+        ASSERT_TRUE(configuration_result.is_valid(error_msg));
+    }
+
+    {
+        const char* yml_configuration =
+                R"(
+            version: v4.0
+            participants:
+              - name: "P1"
+                kind: "echo"
+            specs:
+              threads:
+                min-threads: 8
+                max-threads: 4
+            )";
+        Yaml yml = YAML::Load(yml_configuration);
+
+        ddsrouter::core::DdsRouterConfiguration configuration_result =
+                ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml);
+
+        utils::Formatter error_msg;
+        ASSERT_FALSE(configuration_result.is_valid(error_msg));
+    }
+}
+
+/**
+ * Test load the thread pool monitor
+ *
+ * CASES:
+ * - enabled with a period
+ * - enabled with a period of 0
+ */
+TEST(YamlReaderConfigurationTest, thread_pool_monitor)
+{
+    {
+        const char* yml_configuration =
+                R"(
+            version: v4.0
+            participants:
+              - name: "P1"
+                kind: "echo"
+            specs:
+              monitor:
+                thread-pool:
+                  enable: true
+                  period: 500
+            )";
+        Yaml yml = YAML::Load(yml_configuration);
+
+        ddsrouter::core::DdsRouterConfiguration configuration_result =
+                ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml);
+
+        ASSERT_TRUE(configuration_result.advanced_options.thread_pool_monitor);
+        ASSERT_EQ(configuration_result.advanced_options.thread_pool_monitor_period, 500u);
+
+        utils::Formatter error_msg;
+        ASSERT_TRUE(configuration_result.is_valid(error_msg));
+    }
+
+    {
+        const char* yml_configuration =
+                R"(
+            version: v4.0
+            participants:
+              - name: "P1"
+                kind: "echo"
+            specs:
+              monitor:
+                thread-pool:
+                  enable: true
+                  period: 0
+            )";
+        Yaml yml = YAML::Load(yml_configuration);
+
+        ddsrouter::core::DdsRouterConfiguration configuration_result =
+                ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml);
+
+        utils::Formatter error_msg;
+        ASSERT_FALSE(configuration_result.is_valid(error_msg));
+    }
+}
+
+/**
+ * Test load the metrics exporter
+ *
+ * CASES:
+ * - enabled with every tag
+ * - invalid address
+ * - port out of range
+ */
+TEST(YamlReaderConfigurationTest, metrics_exporter)
+{
+    {
+        const char* yml_configuration =
+                R"(
+            version: v4.0
+            participants:
+              - name: "P1"
+                kind: "echo"
+            specs:
+              monitor:
+                prometheus:
+                  enable: true
+                  address: "0.0.0.0"
+                  port: 9100
+                  period: 2000
+            )";
+        Yaml yml = YAML::Load(yml_configuration);
+
+        ddsrouter::core::DdsRouterConfiguration configuration_result =
+                ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml);
+
+        const auto& metrics_exporter = configuration_result.advanced_options.metrics_exporter;
+        ASSERT_TRUE(metrics_exporter.enabled);
+        ASSERT_EQ(metrics_exporter.address, "0.0.0.0");
+        ASSERT_EQ(metrics_exporter.port, 9100u);
+        ASSERT_EQ(metrics_exporter.period, 2000u);
+
+        // The metrics exporter is only supported in Linux
+        utils::Formatter error_msg;
+#if defined(__linux__)
+        ASSERT_TRUE(configuration_result.is_valid(error_msg));
+#else
+        ASSERT_FALSE(configuration_result.is_valid(error_msg));
+#endif // defined(__linux__)
+    }
+
+    {
+        const char* yml_configuration =
+                R"(
+            version: v4.0
+            participants:
+              - name: "P1"
+                kind: "echo"
+            specs:
+              monitor:
+                prometheus:
+                  enable: true
+                  address: "localhost:80"
+            )";
+        Yaml yml = YAML::Load(yml_configuration);
+
+        ddsrouter::core::DdsRouterConfiguration configuration_result =
+                ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml);
+
+        utils::Formatter error_msg;
+        ASSERT_FALSE(configuration_result.is_valid(error_msg));
+    }
+
+    {
+        const char* yml_configuration =
+                R"(
+            version: v4.0
+            participants:
+              - name: "P1"
+                kind: "echo"
+            specs:
+              monitor:
+                prometheus:
+                  enable: true
+                  port: 70000
+            )";
+        Yaml yml = YAML::Load(yml_configuration);
+
+        ASSERT_THROW(
+            ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml),
+            utils::ConfigurationException);
+    }
+}
+
+/**
+ * Test load the profiler
+ *
+ * CASES:
+ * - enabled with every tag
+ * - default values
+ * - frequency out of range
+ */
+TEST(YamlReaderConfigurationTest, profiler)
+{
+    {
+        const char* yml_configuration =
+                R"(
+            version: v4.0
+            participants:
+              - name: "P1"
+                kind: "echo"
+            specs:
+              monitor:
+                profiler:
+                  enable: true
+                  duration: 5000
+                  frequency: 199
+                  output-directory: "/tmp"
+            )";
+        Yaml yml = YAML::Load(yml_configuration);
+
+        ddsrouter::core::DdsRouterConfiguration configuration_result =
+                ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml);
+
+        const auto& profiler = configuration_result.advanced_options.profiler;
+        ASSERT_TRUE(profiler.enabled);
+        ASSERT_EQ(profiler.duration, 5000u);
+        ASSERT_EQ(profiler.frequency, 199u);
+        ASSERT_EQ(profiler.output_directory, "/tmp");
+
+        utils::Formatter error_msg;
+        ASSERT_TRUE(configuration_result.is_valid(error_msg));
+    }
+
+    {
+        const char* yml_configuration =
+                R"(
+            version: v4.0
+            participants:
+              - name: "P1"
+                kind: "echo"
+            specs:
+              monitor:
+                profiler:
+                  enable: true
+            )";
+        Yaml yml = YAML::Load(yml_configuration);
+
+        ddsrouter::core::DdsRouterConfiguration configuration_result =
+                ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml);
+
+        const auto& profiler = configuration_result.advanced_options.profiler;
+        ASSERT_TRUE(profiler.enabled);
+        ASSERT_EQ(profiler.duration, 10000u);
+        ASSERT_EQ(profiler.frequency, 99u);
+        ASSERT_EQ(profiler.output_directory, ".");
+    }
+
+    {
+        const char* yml_configuration =
+                R"(
+            version: v4.0
+            participants:
+              - name: "P1"
+                kind: "echo"
+            specs:
+              monitor:
+                profiler:
+                  enable: true
+                  frequency: 5000
+            )";
+        Yaml yml = YAML::Load(yml_configuration);
+
+        ddsrouter::core::DdsRouterConfiguration configuration_result =
+                ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml);
+
+        utils::Formatter error_msg;
+        ASSERT_FALSE(configuration_result.is_valid(error_msg));
+    }
+}
+
+/**
+ * Test load the tracing
+ *
+ * CASES:
+ * - enabled with every tag
+ * - default values
+ * - buffer size of 0
+ */
+TEST(YamlReaderConfigurationTest, tracing)
+{
+    {
+        const char* yml_configuration =
+                R"(
+            version: v4.0
+            participants:
+              - name: "P1"
+                kind: "echo"
+            specs:
+              monitor:
+                tracing:
+                  enable: true
+                  topics:
+                    - name: "rt/chatter"
+                    - name: "rt/camera/*"
+                  buffer-size: 1024
+                  output-directory: "/tmp"
+            )";
+        Yaml yml = YAML::Load(yml_configuration);
+
+        ddsrouter::core::DdsRouterConfiguration configuration_result =
+                ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml);
+
+        const auto& tracing = configuration_result.advanced_options.tracing;
+        ASSERT_TRUE(tracing.enabled);
+        ASSERT_EQ(tracing.topics.size(), 2u);
+        ASSERT_EQ(tracing.topics[0].topic_name, "rt/chatter");
+        ASSERT_EQ(tracing.topics[1].topic_name, "rt/camera/*");
+        ASSERT_EQ(tracing.buffer_size, 1024u);
+        ASSERT_EQ(tracing.output_directory, "/tmp");
+
+        utils::Formatter error_msg;
+        ASSERT_TRUE(configuration_result.is_valid(error_msg));
+    }
+
+    {
+        const char* yml_configuration =
+                R"(
+            version: v4.0
+            participants:
+              - name: "P1"
+                kind: "echo"
+            specs:
+              monitor:
+                tracing:
+                  enable: true
+            )";
+        Yaml yml = YAML::Load(yml_configuration);
+
+        ddsrouter::core::DdsRouterConfiguration configuration_result =
+                ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml);
+
+        const auto& tracing = configuration_result.advanced_options.tracing;
+        ASSERT_TRUE(tracing.enabled);
+        ASSERT_TRUE(tracing.topics.empty());
+        ASSERT_EQ(tracing.buffer_size, 65536u);
+        ASSERT_EQ(tracing.output_directory, ".");
+    }
+
+    {
+        const char* yml_configuration =
+                R"(
+            version: v4.0
+            participants:
+              - name: "P1"
+                kind: "echo"
+            specs:
+              monitor:
+                tracing:
+                  enable: true
+                  buffer-size: 0
+            )";
+        Yaml yml = YAML::Load(yml_configuration);
+
+        ddsrouter::core::DdsRouterConfiguration configuration_result =
+                ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml);
+
+        utils::Formatter error_msg;
+        ASSERT_FALSE(configuration_result.is_valid(error_msg));
+    }
+}
+
+/**
+ * Test load the binary log
+ *
+ * CASES:
+ * - enabled with every tag
+ * - default values
+ * - buffer size too small for an entry
+ */
+TEST(YamlReaderConfigurationTest, binary_log)
+{
+    {
+        const char* yml_configuration =
+                R"(
+            version: v4.0
+            participants:
+              - name: "P1"
+                kind: "echo"
+            specs:
+              logging:
+                verbosity: info
+                binary:
+                  enable: true
+                  buffer-size: 65536
+                  period: 50
+                  output-directory: "/tmp"
+            )";
+        Yaml yml = YAML::Load(yml_configuration);
+
+        ddsrouter::core::DdsRouterConfiguration configuration_result =
+                ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml);
+
+        const auto& binary_log = configuration_result.advanced_options.binary_log;
+        ASSERT_TRUE(binary_log.enabled);
+        ASSERT_EQ(binary_log.buffer_size, 65536u);
+        ASSERT_EQ(binary_log.period, 50u);
+        ASSERT_EQ(binary_log.output_directory, "/tmp");
+
+        utils::Formatter error_msg;
+        ASSERT_TRUE(configuration_result.is_valid(error_msg));
+    }
+
+    {
+        const char* yml_configuration =
+                R"(
+            version: v4.0
+            participants:
+              - name: "P1"
+                kind: "echo"
+            specs:
+              logging:
+                binary:
+                  enable: true
+            )";
+        Yaml yml = YAML::Load(yml_configuration);
+
+        ddsrouter::core::DdsRouterConfiguration configuration_result =
+                ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml);
+
+        const auto& binary_log = configuration_result.advanced_options.binary_log;
+        ASSERT_TRUE(binary_log.enabled);
+        ASSERT_EQ(binary_log.buffer_size, 1048576u);
+        ASSERT_EQ(binary_log.period, 100u);
+        ASSERT_EQ(binary_log.output_directory, ".");
+    }
+
+    {
+        const char* yml_configuration =
+                R"(
+            version: v4.0
+            participants:
+              - name: "P1"
+                kind: "echo"
+            specs:
+              logging:
+                binary:
+                  enable: true
+                  buffer-size: 1024
+            )";
+        Yaml yml = YAML::Load(yml_configuration);
+
+        ddsrouter::core::DdsRouterConfiguration configuration_result =
+                ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml);
+
+        utils::Formatter error_msg;
+        ASSERT_FALSE(configuration_result.is_valid(error_msg));
+    }
+}
+
+/**
+ * Test load the log throttle rules
+ *
+ * CASES:
+ * - several rules, in order
+ * - no rules by default
+ * - rule without entries per second
+ * - rule that suppresses every entry
+ */
+TEST(YamlReaderConfigurationTest, log_throttle)
+{
+    {
+        const char* yml_configuration =
+                R"(
+            version: v4.0
+            participants:
+              - name: "P1"
+                kind: "echo"
+            specs:
+              logging:
+                verbosity: warning
+                throttle:
+                  - category: "DDSROUTER_IPC"
+                    max-per-second: 5
+                  - category: "DDSROUTER_*"
+                    max-per-second: 20
+            )";
+        Yaml yml = YAML::Load(yml_configuration);
+
+        ddsrouter::core::DdsRouterConfiguration configuration_result =
+                ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml);
+
+        const auto& log_throttles = configuration_result.advanced_options.log_throttles;
+        ASSERT_EQ(log_throttles.size(), 2u);
+        ASSERT_EQ(log_throttles[0].category, "DDSROUTER_IPC");
+        ASSERT_EQ(log_throttles[0].max_per_second, 5u);
+        ASSERT_EQ(log_throttles[1].category, "DDSROUTER_*");
+        ASSERT_EQ(log_throttles[1].max_per_second, 20u);
+
+        utils::Formatter error_msg;
+        ASSERT_TRUE(configuration_result.is_valid(error_msg));
+    }
+
+    {
+        const char* yml_configuration =
+                R"(
+            version: v4.0
+            participants:
+              - name: "P1"
+                kind: "echo"
+            specs:
+              logging:
+                verbosity: warning
+            )";
+        Yaml yml = YAML::Load(yml_configuration);
+
+        ddsrouter::core::DdsRouterConfiguration configuration_result =
+                ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml);
+
+        ASSERT_TRUE(configuration_result.advanced_options.log_throttles.empty());
+    }
+
+    {
+        const char* yml_configuration =
+                R"(
+            version: v4.0
+            participants:
+              - name: "P1"
+                kind: "echo"
+            specs:
+              logging:
+                throttle:
+                  - category: "DDSROUTER_IPC"
+            )";
+        Yaml yml = YAML::Load(yml_configuration);
+
+        ASSERT_THROW(ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml),
+                utils::ConfigurationException);
+    }
+
+    {
+        const char* yml_configuration =
+                R"(
+            version: v4.0
+            participants:
+              - name: "P1"
+                kind: "echo"
+            specs:
+              logging:
+                throttle:
+                  - category: "DDSROUTER_IPC"
+                    max-per-second: 0
+            )";
+        Yaml yml = YAML::Load(yml_configuration);
+
+        ddsrouter::core::DdsRouterConfiguration configuration_result =
+                ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml);
+
+        utils::Formatter error_msg;
+        ASSERT_FALSE(configuration_result.is_valid(error_msg));
+    }
+}
+
+/**
+ * Test load the content filter rules
+ *
+ * CASES:
+ * - rule with topic, participant, parameters and fields
+ * - no rules by default
+ * - rule without expression
+ * - rule whose expression references an unknown field
+ * - rule that references an unknown participant
+ */
+TEST(YamlReaderConfigurationTest, content_filter)
+{
+    {
+        const char* yml_configuration =
+                R"(
+            version: v4.0
+            participants:
+              - name: "P1"
+                kind: "echo"
+            specs:
+              content-filters:
+                - topic:
+                    name: "rt/robot_*"
+                  participant: "P1"
+                  expression: "robot_id IN (1, 2) AND battery < %0"
+                  parameters: [0.2]
+                  fields:
+                    - name: robot_id
+                      type: uint32
+                    - name: battery
+                      type: float64
+            )";
+        Yaml yml = YAML::Load(yml_configuration);
+
+        ddsrouter::core::DdsRouterConfiguration configuration_result =
+                ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml);
+
+        const auto& content_filters = configuration_result.advanced_options.content_filters;
+        ASSERT_EQ(content_filters.size(), 1u);
+        ASSERT_EQ(content_filters[0].topic.topic_name.get_value(), "rt/robot_*");
+        ASSERT_EQ(content_filters[0].participant_id, "P1");
+        ASSERT_EQ(content_filters[0].expression, "robot_id IN (1, 2) AND battery < %0");
+        ASSERT_EQ(content_filters[0].parameters, std::vector<std::string>({"0.2"}));
+        ASSERT_EQ(content_filters[0].fields.size(), 2u);
+        ASSERT_EQ(content_filters[0].fields[1].name, "battery");
+        ASSERT_EQ(content_filters[0].fields[1].type, "float64");
+
+        utils::Formatter error_msg;
+        ASSERT_TRUE(configuration_result.is_valid(error_msg));
+    }
+
+    {
+        const char* yml_configuration =
+                R"(
+            version: v4.0
+            participants:
+              - name: "P1"
+                kind: "echo"
+            )";
+        Yaml yml = YAML::Load(yml_configuration);
+
+        ddsrouter::core::DdsRouterConfiguration configuration_result =
+                ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml);
+
+        ASSERT_TRUE(configuration_result.advanced_options.content_filters.empty());
+    }
+
+    {
+        const char* yml_configuration =
+                R"(
+            version: v4.0
+            participants:
+              - name: "P1"
+                kind: "echo"
+            specs:
+              content-filters:
+                - fields:
+                    - name: robot_id
+                      type: uint32
+            )";
+        Yaml yml = YAML::Load(yml_configuration);
+
+        ASSERT_THROW(ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml),
+                utils::ConfigurationException);
+    }
+
+    {
+        const char* yml_configuration =
+                R"(
+            version: v4.0
+            participants:
+              - name: "P1"
+                kind: "echo"
+            specs:
+              content-filters:
+                - expression: "state = 'FAULT'"
+                  fields:
+                    - name: robot_id
+                      type: uint32
+            )";
+        Yaml yml = YAML::Load(yml_configuration);
+
+        ddsrouter::core::DdsRouterConfiguration configuration_result =
+                ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml);
+
+        utils::Formatter error_msg;
+        ASSERT_FALSE(configuration_result.is_valid(error_msg));
+    }
+
+    {
+        const char* yml_configuration =
+                R"(
+            version: v4.0
+            participants:
+              - name: "P1"
+                kind: "echo"
+            specs:
+              content-filters:
+                - participant: "P2"
+                  expression: "robot_id = 1"
+                  fields:
+                    - name: robot_id
+                      type: uint32
+            )";
+        Yaml yml = YAML::Load(yml_configuration);
+
+        ddsrouter::core::DdsRouterConfiguration configuration_result =
+                ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml);
+
+        utils::Formatter error_msg;
+        ASSERT_FALSE(configuration_result.is_valid(error_msg));
+    }
+}
+
+/**
+ * Test load the projection rules
+ *
+ * CASES:
+ * - rule with topic, participant, fields stripped, fields and derived type
+ * - no rules by default
+ * - rule without fields stripped
+ * - rule that strips an unknown field
+ * - rule that references an unknown participant
+ */
+TEST(YamlReaderConfigurationTest, projection)
+{
+    {
+        const char* yml_configuration =
+                R"(
+            version: v4.0
+            participants:
+              - name: "P1"
+                kind: "echo"
+            specs:
+              projections:
+                - topic:
+                    name: "rt/camera_*"
+                  participant: "P1"
+                  strip: [image]
+                  fields:
+                    - name: stamp
+                      type: uint64
+                    - name: image
+                      type: sequence<uint8>
+                  derived-type: "CameraSummary"
+            )";
+        Yaml yml = YAML::Load(yml_configuration);
+
+        ddsrouter::core::DdsRouterConfiguration configuration_result =
+                ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml);
+
+        const auto& projections = configuration_result.advanced_options.projections;
+        ASSERT_EQ(projections.size(), 1u);
+        ASSERT_EQ(projections[0].topic.topic_name.get_value(), "rt/camera_*");
+        ASSERT_EQ(projections[0].participant_id, "P1");
+        ASSERT_EQ(projections[0].strip, std::vector<std::string>({"image"}));
+        ASSERT_EQ(projections[0].fields.size(), 2u);
+        ASSERT_EQ(projections[0].fields[1].name, "image");
+        ASSERT_EQ(projections[0].fields[1].type, "sequence<uint8>");
+        ASSERT_EQ(projections[0].type_name, "CameraSummary");
+
+        utils::Formatter error_msg;
+        ASSERT_TRUE(configuration_result.is_valid(error_msg));
+    }
+
+    {
+        const char* yml_configuration =
+                R"(
+            version: v4.0
+            participants:
+              - name: "P1"
+                kind: "echo"
+            )";
+        Yaml yml = YAML::Load(yml_configuration);
+
+        ddsrouter::core::DdsRouterConfiguration configuration_result =
+                ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml);
+
+        ASSERT_TRUE(configuration_result.advanced_options.projections.empty());
+    }
+
+    {
+        const char* yml_configuration =
+                R"(
+            version: v4.0
+            participants:
+              - name: "P1"
+                kind: "echo"
+            specs:
+              projections:
+                - fields:
+                    - name: stamp
+                      type: uint64
+            )";
+        Yaml yml = YAML::Load(yml_configuration);
+
+        ASSERT_THROW(ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml),
+                utils::ConfigurationException);
+    }
+
+    {
+        const char* yml_configuration =
+                R"(
+            version: v4.0
+            participants:
+              - name: "P1"
+                kind: "echo"
+            specs:
+              projections:
+                - strip: [thumbnail]
+                  fields:
+                    - name: stamp
+                      type: uint64
+                    - name: image
+                      type: sequence<uint8>
+            )";
+        Yaml yml = YAML::Load(yml_configuration);
+
+        ddsrouter::core::DdsRouterConfiguration configuration_result =
+                ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml);
+
+        utils::Formatter error_msg;
+        ASSERT_FALSE(configuration_result.is_valid(error_msg));
+    }
+
+    {
+        const char* yml_configuration =
+                R"(
+            version: v4.0
+            participants:
+              - name: "P1"
+                kind: "echo"
+            specs:
+              projections:
+                - participant: "P2"
+                  strip: [image]
+                  fields:
+                    - name: stamp
+                      type: uint64
+                    - name: image
+                      type: sequence<uint8>
+            )";
+        Yaml yml = YAML::Load(yml_configuration);
+
+        ddsrouter::core::DdsRouterConfiguration configuration_result =
+                ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml);
+
+        utils::Formatter error_msg;
+        ASSERT_FALSE(configuration_result.is_valid(error_msg));
+    }
+}
+
+/**
+ * Test load an IPC participant with and without its optional tags
+ */
+TEST(YamlReaderConfigurationTest, ipc_participant)
+{
+    const char* yml_configuration =
+            R"(
+        version: v4.0
+        participants:
+          - name: "P1"
+            kind: "ipc"
+            channel: "robot"
+          - name: "P2"
+            kind: "ipc"
+            channel: "robot_2"
+            ring-size: 1048576
+            max-blocking-time: 10
+        )";
+    Yaml yml = YAML::Load(yml_configuration);
+
+    ddsrouter::core::DdsRouterConfiguration configuration_result =
+            ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml);
+
+    ASSERT_EQ(configuration_result.participants_configurations.size(), 2u);
+
+    for (const auto& participant : configuration_result.participants_configurations)
+    {
+        ASSERT_EQ(participant.first, ddsrouter::core::types::ParticipantKind::ipc);
+
+        auto ipc_configuration =
+                std::dynamic_pointer_cast<ddsrouter::core::IpcParticipantConfiguration>(participant.second);
+        ASSERT_NE(ipc_configuration, nullptr);
+
+        if (ipc_configuration->id == "P1")
+        {
+            ASSERT_EQ(ipc_configuration->channel, "robot");
+            ASSERT_EQ(ipc_configuration->ring_size, ddsrouter::core::IpcParticipantConfiguration().ring_size);
+        }
+        else
+        {
+            ASSERT_EQ(ipc_configuration->channel, "robot_2");
+            ASSERT_EQ(ipc_configuration->ring_size, 1048576u);
+            ASSERT_EQ(ipc_configuration->max_blocking_time, 10u);
+        }
+    }
+
+    // IPC participants are only supported in Linux
+    utils::Formatter error_msg;
+#if defined(__linux__)
+    ASSERT_TRUE(configuration_result.is_valid(error_msg));
+#else
+    ASSERT_FALSE(configuration_result.is_valid(error_msg));
+#endif // defined(__linux__)
+}
+
+/**
+ * Test that IPC participants with a ring size that is not a power of two are not valid
+ */
+TEST(YamlReaderConfigurationTest, ipc_participant_invalid_ring_size)
+{
+    const char* yml_configuration =
+            R"(
+        version: v4.0
+        participants:
+          - name: "P1"
+            kind: "ipc"
+            channel: "robot"
+            ring-size: 1000000
+        )";
+    Yaml yml = YAML::Load(yml_configuration);
+
+    ddsrouter::core::DdsRouterConfiguration configuration_result =
+            ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml);
+
+    utils::Formatter error_msg;
+    ASSERT_FALSE(configuration_result.is_valid(error_msg));
+}
+
+/**
+ * Test load an in process participant, whose channel is required
+ */
+TEST(YamlReaderConfigurationTest, inprocess_participant)
+{
+    // Valid participant
+    {
+        const char* yml_configuration =
+                R"(
+            version: v4.0
+            participants:
+              - name: "P1"
+                kind: "inprocess"
+                channel: "gateway"
+            )";
+        Yaml yml = YAML::Load(yml_configuration);
+
+        ddsrouter::core::DdsRouterConfiguration configuration_result =
+                ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml);
+
+        ASSERT_EQ(configuration_result.participants_configurations.size(), 1u);
+
+        const auto& participant = *configuration_result.participants_configurations.begin();
+        ASSERT_EQ(participant.first, ddsrouter::core::types::ParticipantKind::inprocess);
+
+        auto inprocess_configuration =
+                std::dynamic_pointer_cast<ddsrouter::core::InProcessParticipantConfiguration>(participant.second);
+        ASSERT_NE(inprocess_configuration, nullptr);
+        ASSERT_EQ(inprocess_configuration->channel, "gateway");
+    }
+
+    // Missing channel
+    {
+        const char* yml_configuration =
+                R"(
+            version: v4.0
+            participants:
+              - name: "P1"
+                kind: "inprocess"
+            )";
+        Yaml yml = YAML::Load(yml_configuration);
+
+        ASSERT_THROW(
+            ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml),
+            utils::ConfigurationException);
+    }
+}
+
+/**
+ * Test load a recorder participant, with default and with explicit options
+ */
+TEST(YamlReaderConfigurationTest, recorder_participant)
+{
+    // Default options
+    {
+        const char* yml_configuration =
+                R"(
+            version: v4.0
+            participants:
+              - name: "P1"
+                kind: "recorder"
+            )";
+        Yaml yml = YAML::Load(yml_configuration);
+
+        ddsrouter::core::DdsRouterConfiguration configuration_result =
+                ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml);
+
+        const auto& participant = *configuration_result.participants_configurations.begin();
+        ASSERT_EQ(participant.first, ddsrouter::core::types::ParticipantKind::recorder);
+
+        auto recorder_configuration =
+                std::dynamic_pointer_cast<ddsrouter::core::RecorderParticipantConfiguration>(participant.second);
+        ASSERT_NE(recorder_configuration, nullptr);
+
+        ddsrouter::core::RecorderParticipantConfiguration default_configuration;
+        ASSERT_EQ(recorder_configuration->output_directory, default_configuration.output_directory);
+        ASSERT_EQ(recorder_configuration->segment_size, default_configuration.segment_size);
+        ASSERT_EQ(recorder_configuration->fsync_period, default_configuration.fsync_period);
+        ASSERT_EQ(recorder_configuration->max_pending_size, default_configuration.max_pending_size);
+    }
+
+    // Explicit options
+    {
+        const char* yml_configuration =
+                R"(
+            version: v4.0
+            participants:
+              - name: "P1"
+                kind: "recorder"
+                output-directory: "/var/log/ddsrouter"
+                segment-size: 16777216
+                fsync-period: 200
+                max-pending-size: 4194304
+            )";
+        Yaml yml = YAML::Load(yml_configuration);
+
+        ddsrouter::core::DdsRouterConfiguration configuration_result =
+                ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml);
+
+        auto recorder_configuration =
+                std::dynamic_pointer_cast<ddsrouter::core::RecorderParticipantConfiguration>(
+            configuration_result.participants_configurations.begin()->second);
+        ASSERT_NE(recorder_configuration, nullptr);
+        ASSERT_EQ(recorder_configuration->output_directory, "/var/log/ddsrouter");
+        ASSERT_EQ(recorder_configuration->segment_size, 16777216u);
+        ASSERT_EQ(recorder_configuration->fsync_period, 200u);
+        ASSERT_EQ(recorder_configuration->max_pending_size, 4194304u);
+
+        // Recorder participants are only supported in Linux
+        utils::Formatter error_msg;
+#if defined(__linux__)
+        ASSERT_TRUE(configuration_result.is_valid(error_msg));
+#else
+        ASSERT_FALSE(configuration_result.is_valid(error_msg));
+#endif // defined(__linux__)
+    }
+
+    // Segment too small
+    {
+        const char* yml_configuration =
+                R"(
+            version: v4.0
+            participants:
+              - name: "P1"
+                kind: "recorder"
+                segment-size: 4096
+            )";
+        Yaml yml = YAML::Load(yml_configuration);
+
+        ddsrouter::core::DdsRouterConfiguration configuration_result =
+                ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml);
+
+        utils::Formatter error_msg;
+        ASSERT_FALSE(configuration_result.is_valid(error_msg));
+    }
+}
+
+/**
+ * Test load a replayer participant, with explicit options and without the required input directory
+ */
+TEST(YamlReaderConfigurationTest, replayer_participant)
+{
+    // Explicit options
+    {
+        const char* yml_configuration =
+                R"(
+            version: v4.0
+            participants:
+              - name: "P1"
+                kind: "replayer"
+                input-directory: "/var/log/ddsrouter"
+                speed: 2.5
+                prefetch-size: 8388608
+            )";
+        Yaml yml = YAML::Load(yml_configuration);
+
+        ddsrouter::core::DdsRouterConfiguration configuration_result =
+                ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml);
+
+        const auto& participant = *configuration_result.participants_configurations.begin();
+        ASSERT_EQ(participant.first, ddsrouter::core::types::ParticipantKind::replayer);
+
+        auto replayer_configuration =
+                std::dynamic_pointer_cast<ddsrouter::core::ReplayerParticipantConfiguration>(participant.second);
+        ASSERT_NE(replayer_configuration, nullptr);
+        ASSERT_EQ(replayer_configuration->input_directory, "/var/log/ddsrouter");
+        ASSERT_EQ(replayer_configuration->speed, 2.5);
+        ASSERT_EQ(replayer_configuration->prefetch_size, 8388608u);
+
+        // Replayer participants are only supported in Linux
+        utils::Formatter error_msg;
+#if defined(__linux__)
+        ASSERT_TRUE(configuration_result.is_valid(error_msg));
+#else
+        ASSERT_FALSE(configuration_result.is_valid(error_msg));
+#endif // defined(__linux__)
+    }
+
+    // Negative speed
+    {
+        const char* yml_configuration =
+                R"(
+            version: v4.0
+            participants:
+              - name: "P1"
+                kind: "replay"
+                input-directory: "/var/log/ddsrouter"
+                speed: -1
+            )";
+        Yaml yml = YAML::Load(yml_configuration);
+
+        ddsrouter::core::DdsRouterConfiguration configuration_result =
+                ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml);
+
+        utils::Formatter error_msg;
+        ASSERT_FALSE(configuration_result.is_valid(error_msg));
+    }
+
+    // Input directory missing
+    {
+        const char* yml_configuration =
+                R"(
+            version: v4.0
+            participants:
+              - name: "P1"
+                kind: "replayer"
+            )";
+        Yaml yml = YAML::Load(yml_configuration);
+
+        ASSERT_THROW(
+            ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml),
+            utils::ConfigurationException);
+    }
+}
+
+/**
+ * Test load a generator participant with a topic with default options and a topic with every option
+ */
+TEST(YamlReaderConfigurationTest, generator_participant)
+{
+    {
+        const char* yml_configuration =
+                R"(
+            version: v4.0
+            participants:
+              - name: "P1"
+                kind: "generator"
+                topics:
+                  - name: "default"
+                  - name: "explicit"
+                    type: "ExplicitType"
+                    rate: 1000
+                    size: 128
+                    max-size: 4096
+                    keys: 10
+                    burst: 50
+                    samples: 100000
+            )";
+        Yaml yml = YAML::Load(yml_configuration);
+
+        ddsrouter::core::DdsRouterConfiguration configuration_result =
+                ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml);
+
+        const auto& participant = *configuration_result.participants_configurations.begin();
+        ASSERT_EQ(participant.first, ddsrouter::core::types::ParticipantKind::generator);
+
+        auto generator_configuration =
+                std::dynamic_pointer_cast<ddsrouter::core::GeneratorParticipantConfiguration>(participant.second);
+        ASSERT_NE(generator_configuration, nullptr);
+        ASSERT_EQ(generator_configuration->topics.size(), 2u);
+
+        const auto& default_topic = generator_configuration->topics[0];
+        ddsrouter::core::GeneratedTopicConfiguration default_configuration;
+        ASSERT_EQ(default_topic.topic_name, "default");
+        ASSERT_EQ(default_topic.type_name, default_configuration.type_name);
+        ASSERT_EQ(default_topic.rate, default_configuration.rate);
+        ASSERT_EQ(default_topic.size, default_configuration.size);
+        ASSERT_EQ(default_topic.max_size, default_configuration.max_size);
+        ASSERT_EQ(default_topic.keys, default_configuration.keys);
+        ASSERT_EQ(default_topic.burst, default_configuration.burst);
+        ASSERT_EQ(default_topic.samples, default_configuration.samples);
+
+        const auto& explicit_topic = generator_configuration->topics[1];
+        ASSERT_EQ(explicit_topic.topic_name, "explicit");
+        ASSERT_EQ(explicit_topic.type_name, "ExplicitType");
+        ASSERT_EQ(explicit_topic.rate, 1000);
+        ASSERT_EQ(explicit_topic.size, 128u);
+        ASSERT_EQ(explicit_topic.max_size, 4096u);
+        ASSERT_EQ(explicit_topic.keys, 10u);
+        ASSERT_EQ(explicit_topic.burst, 50u);
+        ASSERT_EQ(explicit_topic.samples, 100000u);
+
+        utils::Formatter error_msg;
+        ASSERT_TRUE(configuration_result.is_valid(error_msg));
+    }
+
+    // Messages smaller than the generated header
+    {
+        const char* yml_configuration =
+                R"(
+            version: v4.0
+            participants:
+              - name: "P1"
+                kind: "generator"
+                topics:
+                  - name: "small"
+                    size: 8
+            )";
+        Yaml yml = YAML::Load(yml_configuration);
+
+        ddsrouter::core::DdsRouterConfiguration configuration_result =
+                ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml);
+
+        utils::Formatter error_msg;
+        ASSERT_FALSE(configuration_result.is_valid(error_msg));
+    }
+
+    // Topics missing
+    {
+        const char* yml_configuration =
+                R"(
+            version: v4.0
+            participants:
+              - name: "P1"
+                kind: "generator"
+            )";
+        Yaml yml = YAML::Load(yml_configuration);
+
+        ASSERT_THROW(
+            ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml),
+            utils::ConfigurationException);
+    }
+}
+
+/**
+ * Test load a sink participant, with default and with explicit options
+ */
+TEST(YamlReaderConfigurationTest, sink_participant)
+{
+    const char* yml_configuration =
+            R"(
+        version: v4.0
+        participants:
+          - name: "P1"
+            kind: "sink"
+          - name: "P2"
+            kind: "null"
+            report-period: 0
+            check-sequence: true
+        )";
+    Yaml yml = YAML::Load(yml_configuration);
+
+    ddsrouter::core::DdsRouterConfiguration configuration_result =
+            ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml);
+
+    ASSERT_EQ(configuration_result.participants_configurations.size(), 2u);
+
+    for (const auto& participant : configuration_result.participants_configurations)
+    {
+        ASSERT_EQ(participant.first, ddsrouter::core::types::ParticipantKind::sink);
+
+        auto sink_configuration =
+                std::dynamic_pointer_cast<ddsrouter::core::SinkParticipantConfiguration>(participant.second);
+        ASSERT_NE(sink_configuration, nullptr);
+
+        if (sink_configuration->id == "P1")
+        {
+            ASSERT_EQ(sink_configuration->report_period, ddsrouter::core::SinkParticipantConfiguration().report_period);
+            ASSERT_FALSE(sink_configuration->check_sequence);
+        }
+        else
+        {
+            ASSERT_EQ(sink_configuration->report_period, 0u);
+            ASSERT_TRUE(sink_configuration->check_sequence);
+        }
+    }
+
+    utils::Formatter error_msg;
+    ASSERT_TRUE(configuration_result.is_valid(error_msg));
+}
+
 int main(
         int argc,
         char** argv)
@@ -17,6 +17,8 @@
  *
  */
 
+#include <csignal>
+
 #include <cpp_utils/event/FileWatcherHandler.hpp>
 #include <cpp_utils/event/MultipleEventHandler.hpp>
 #include <cpp_utils/event/PeriodicEventHandler.hpp>
@@ -35,6 +37,12 @@
 
 #include <ddsrouter_core/configuration/DdsRouterConfiguration.hpp>
 #include <ddsrouter_core/core/DdsRouter.hpp>
+#include <ddsrouter_core/core/ScopedThreadConfiguration.hpp>
+#include <ddsrouter_core/logging/BinaryLog.hpp>
+#include <ddsrouter_core/logging/LogThrottle.hpp>
+#include <ddsrouter_core/monitoring/MetricsExporter.hpp>
+#include <ddsrouter_core/monitoring/SamplingProfiler.hpp>
+#include <ddsrouter_core/monitoring/SignalTrigger.hpp>
 
 #include <ddsrouter_yaml/CommandlineArgsRouter.hpp>
 #include <ddsrouter_yaml/YamlReaderConfiguration.hpp>
@@ -65,6 +73,10 @@ int main(
     {
         return static_cast<int>(ui::ProcessReturnCode::success);
     }
+    else if (arg_parse_result == ui::ProcessReturnCode::decode_log_argument)
+    {
+        return static_cast<int>(ui::ProcessReturnCode::success);
+    }
     else if (arg_parse_result != ui::ProcessReturnCode::success)
     {
         return static_cast<int>(arg_parse_result);
@@ -157,12 +169,42 @@ int main(
             // eprosima::utils::Log::SetCategoryFilter(std::regex("(DDSROUTER)"));
         }
 
+        /////
+        // Binary log
+
+        // Log the hot paths without formatting their entries. Created before the router, so it outlives every thread
+        // logging in it
+        std::unique_ptr<core::BinaryLog> binary_log;
+
+        if (router_configuration.advanced_options.binary_log.enabled)
+        {
+            binary_log = std::make_unique<core::BinaryLog>(router_configuration.advanced_options.binary_log);
+
+            logUser(DDSROUTER_EXECUTION,
+                    "Writing binary log in " << binary_log->path() << ". Print it with --decode-log.");
+        }
+
+        /////
+        // Log throttle
+
+        // Limit the entries of each call site of the hot paths, so an error storm does not flood the log
+        std::unique_ptr<core::LogThrottle> log_throttle;
+
+        if (!router_configuration.advanced_options.log_throttles.empty())
+        {
+            log_throttle = std::make_unique<core::LogThrottle>(router_configuration.advanced_options.log_throttles);
+        }
+
         // Load XML profiles
         ddspipe::participants::XmlHandler::load_xml(router_configuration.xml_configuration);
 
         // Create DDS Router
         core::DdsRouter router(router_configuration);
 
+        // Threads created from now on until the router starts are housekeeping threads
+        auto housekeeping_threads = std::make_unique<core::ScopedThreadConfiguration>(
+            router_configuration.advanced_options.housekeeping_threads);
+
         /////
         // File Watcher Handler
 
@@ -242,6 +284,65 @@ int main(
             monitor.monitor_topics();
         }
 
+        /////
+        // Metrics exporter
+
+        // Serve the metrics over HTTP, so they can be scraped without a DDS subscriber
+        std::unique_ptr<core::MetricsExporter> metrics_exporter;
+
+        if (router_configuration.advanced_options.metrics_exporter.enabled)
+        {
+            metrics_exporter = std::make_unique<core::MetricsExporter>(
+                router_configuration.advanced_options.metrics_exporter,
+                [&router]()
+                {
+                    return router.metrics();
+                });
+        }
+
+        /////
+        // Profiler
+
+        // Profile the router on demand, as external profilers can not be attached to a router in production
+        std::unique_ptr<core::SamplingProfiler> profiler;
+
+        if (router_configuration.advanced_options.profiler.enabled)
+        {
+            profiler = std::make_unique<core::SamplingProfiler>(router_configuration.advanced_options.profiler);
+
+#if defined(__linux__)
+            // Along with SIGINT and SIGTERM handled above, SIGUSR2 starts a profiling session
+            profiler->trigger_on_signal(SIGUSR2);
+
+            logUser(DDSROUTER_EXECUTION,
+                    "Send SIGUSR2 to profile the DDS Router for " << router_configuration.advanced_options.profiler.duration <<
+                    " ms.");
+#endif // defined(__linux__)
+        }
+
+        /////
+        // Tracing
+
+        // Dump the events traced on demand, as the buffers only keep the latest ones
+        std::unique_ptr<core::SignalTrigger> trace_dump;
+
+        if (router_configuration.advanced_options.tracing.enabled)
+        {
+            trace_dump = std::make_unique<core::SignalTrigger>(
+                [&router]()
+                {
+                    router.dump_trace();
+                });
+
+#if defined(__linux__)
+            trace_dump->trigger_on_signal(SIGUSR1);
+
+            logUser(DDSROUTER_EXECUTION, "Send SIGUSR1 to dump the trace of the DDS Router.");
+#endif // defined(__linux__)
+        }
+
+        housekeeping_threads.reset();
+
         // Start Router
         router.start();
 
@@ -29,6 +29,7 @@ enum class ProcessReturnCode : int
     success = 0,
     help_argument = 1,
     version_argument = 2,
+    decode_log_argument = 3,
     incorrect_argument = 10,
     required_argument_failed = 11,
     execution_failed = 20,
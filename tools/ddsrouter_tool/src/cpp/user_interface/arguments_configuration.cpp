@@ -17,11 +17,14 @@
  *
  */
 
+#include <fstream>
 #include <iostream>
 #include <string>
 #include <vector>
 
 #include <ddsrouter_core/library/config.h>
+#include <ddsrouter_core/logging/BinaryLog.hpp>
+#include <cpp_utils/exception/InitializationException.hpp>
 #include <cpp_utils/Log.hpp>
 #include <cpp_utils/utils.hpp>
 
@@ -73,6 +76,16 @@ const option::Descriptor usage[] = {
         "Print version, branch and commit hash." \
     },
 
+    {
+        optionIndex::DECODE_LOG,
+        0,
+        "",
+        "decode-log",
+        Arg::Readable_File,
+        "  \t--decode-log\t  \t" \
+        "Print the entries of a binary log as text, and exit."
+    },
+
     ////////////////////
     // Application options
     {
@@ -168,6 +181,24 @@ void print_version()
         std::endl;
 }
 
+ProcessReturnCode decode_log(
+        const char* path)
+{
+    std::ifstream file(path, std::ios::binary);
+
+    try
+    {
+        core::BinaryLog::decode(file, std::cout);
+    }
+    catch (const utils::InitializationException& e)
+    {
+        logError(DDSROUTER_ARGS, "Failed to decode " << path << ": " << e.what());
+        return ProcessReturnCode::execution_failed;
+    }
+
+    return ProcessReturnCode::decode_log_argument;
+}
+
 ProcessReturnCode parse_arguments(
         int argc,
         char** argv,
@@ -231,6 +262,11 @@ ProcessReturnCode parse_arguments(
             return ProcessReturnCode::version_argument;
         }
 
+        if (options[optionIndex::DECODE_LOG])
+        {
+            return decode_log(options[optionIndex::DECODE_LOG].arg);
+        }
+
         for (int i = 0; i < parse.optionsCount(); ++i)
         {
             option::Option& opt = buffer[i];
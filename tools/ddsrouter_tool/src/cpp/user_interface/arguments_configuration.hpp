@@ -101,6 +101,7 @@ enum optionIndex
     TIMEOUT,
     LOG_FILTER,
     LOG_VERBOSITY,
+    DECODE_LOG,
 };
 
 /**
@@ -125,6 +126,7 @@ extern const option::Descriptor usage[];
  * @return \c SUCCESS if everything OK
  * @return \c INCORRECT_ARGUMENT if arguments were incorrect (unknown or incorrect value)
  * @return \c HELP_ARGUMENT if arguments help given
+ * @return \c DECODE_LOG_ARGUMENT if a binary log was decoded
  * @return \c REQUIRED_ARGUMENT_FAILED if required arguments not given
  */
 ProcessReturnCode parse_arguments(
@@ -142,6 +144,15 @@ std::ostream& operator <<(
  */
 void print_version();
 
+/**
+ * @brief Print the entries of the binary log in \c path in console.
+ *
+ * @return \c DECODE_LOG_ARGUMENT if the binary log was decoded
+ * @return \c EXECUTION_FAILED if \c path is not a binary log
+ */
+ProcessReturnCode decode_log(
+        const char* path);
+
 ENUMERATION_BUILDER(
     LogKind,
     error,